@@ -224,8 +224,14 @@ char* ToHex_P(const unsigned char * in, size_t insz, char * out, size_t outsz, c
  *
  * New: if the provided buffer is nullptr, a buffer is allocated on the heap (malloc)
  * and returned as a pointer instead of the length of the output (needs casting)
+ *
+ * New: ext_vsnprintf_append_P() formats in place at the end of a heap buffer and only
+ * grows the buffer when the output does not fit. The old buffer is freed after formatting
+ * so arguments may point into its content before `offset`
 \*********************************************************************************************/
 
+uint32_t ext_printf_allocs = 0;               // number of heap allocations done by ext_printf
+
 // get a fresh malloc allocated string based on the current pointer (can be in PROGMEM)
 // It is the caller's responsibility to free the memory
 //
@@ -234,6 +240,7 @@ char * copyStr(const char * str) {
   if (str == nullptr) { return nullptr; }
   char * cpy = (char*) malloc(strlen_P(str) + 1);
   if (cpy == nullptr) { return nullptr; }     // something went wrong
+  ext_printf_allocs++;
   strcpy_P(cpy, str);
   return cpy;
 }
@@ -241,12 +248,16 @@ char * copyStr(const char * str) {
 const char ext_invalid_mem[] PROGMEM = "<--INVALID-->";
 const uint32_t min_valid_ptr = 0x3F000000;    // addresses below this line are invalid
 
-int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_list va) {
+// If `grow_buf_p` is not nullptr, output is appended at `offset` of the heap buffer `*grow_buf_p`
+// of size `*grow_size_p`, which is reallocated if too small. `out_buf` and `buf_len` are then ignored
+static int32_t ext_vsnprintf_impl(char * out_buf, size_t buf_len, char ** grow_buf_p, size_t * grow_size_p, size_t offset, const char * fmt_P, va_list va) {
   va_list va_cpy;
   va_copy(va_cpy, va);
 
   // iterate on fmt to extract arguments and patch them in place
-  char * fmt_cpy = copyStr(fmt_P);
+  // short formats are copied on the stack to avoid a heap allocation
+  char fmt_stack[128];
+  char * fmt_cpy = (strlen_P(fmt_P) < sizeof(fmt_stack)) ? strcpy_P(fmt_stack, fmt_P) : copyStr(fmt_P);
   if (fmt_cpy == nullptr) { return 0; }   // we couldn't copy the format, abort
   char * fmt = fmt_cpy;
   int32_t ret = 0;    // return 0 if unsuccessful
@@ -303,6 +314,7 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
               else if (decimals > 0) {
                 char * hex_char = (char*) malloc(decimals*2 + 2);
                 if (hex_char == nullptr) { goto free_allocs; }
+                ext_printf_allocs++;
                 ToHex_P((const uint8_t *)cur_val, decimals, hex_char, decimals*2 + 2);
                 new_val_str = hex_char;
                 allocs[alloc_idx++] = new_val_str;
@@ -319,6 +331,7 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
                 if (buf_len) {
                   char * hex_char = (char*) malloc(buf_len*2 + 2);
                   if (hex_char == nullptr) { goto free_allocs; }
+                  ext_printf_allocs++;
                   ToHex_P(buf.getBuffer(), buf_len, hex_char, buf_len*2 + 2);
                   new_val_str = hex_char;
                   allocs[alloc_idx++] = new_val_str;
@@ -367,6 +380,7 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
             {
               char * ip_str = (char*) malloc(16);
               if (ip_str == nullptr) { goto free_allocs; }
+              ext_printf_allocs++;
               snprintf_P(ip_str, 16, PSTR("%u.%u.%u.%u"), cur_val & 0xFF, (cur_val >> 8) & 0xFF, (cur_val >> 16) & 0xFF, (cur_val >> 24) & 0xFF);
               new_val_str = ip_str;
               allocs[alloc_idx++] = new_val_str;
@@ -440,7 +454,41 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
     }
   }
   // Serial.printf("> format_final=%s\n", fmt_cpy); Serial.flush();
-  if (out_buf != nullptr) {
+  if (grow_buf_p != nullptr) {
+    // single pass into the spare capacity, grow and format again only on overflow
+    size_t spare = (*grow_size_p > offset) ? *grow_size_p - offset : 0;
+    char dummy[2];
+    va_list va_pass;
+    va_copy(va_pass, va_cpy);
+    int32_t target_len = vsnprintf_P(spare ? *grow_buf_p + offset : dummy, spare ? spare : 1, fmt_cpy, va_pass);
+    va_end(va_pass);
+    if (target_len >= 0) {
+      if ((size_t)target_len < spare) {
+        ret = target_len;
+        aborted = false;
+      } else {
+        size_t new_size = *grow_size_p * 2;     // grow geometrically to amortize further appends
+        if (new_size < offset + target_len + 1) { new_size = offset + target_len + 1; }
+        // no realloc, arguments may point into the old buffer which must stay valid until formatted
+        char * new_buf = (char*) malloc(new_size);
+        if (new_buf != nullptr) {
+          ext_printf_allocs++;
+          vsnprintf_P(new_buf + offset, new_size - offset, fmt_cpy, va_cpy);
+          if (*grow_buf_p != nullptr) {
+            memcpy(new_buf, *grow_buf_p, (offset < *grow_size_p) ? offset : *grow_size_p);
+            free(*grow_buf_p);
+          }
+          *grow_buf_p = new_buf;
+          *grow_size_p = new_size;
+          ret = target_len;
+          aborted = false;
+        }
+      }
+    }
+    if (aborted && (*grow_size_p > offset)) {   // keep the previous content and discard the partial output
+      out_buf = *grow_buf_p + offset;
+    }
+  } else if (out_buf != nullptr) {
     ret = vsnprintf_P(out_buf, buf_len, fmt_cpy, va_cpy);
     aborted = false;    // we completed without malloc error
   } else {
@@ -452,6 +500,7 @@ int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_l
       // successful
       char * allocated_buf = (char*) malloc(target_len + 1);
       if (allocated_buf != nullptr) {
+        ext_printf_allocs++;
         allocated_buf[0] = 0;   // default to empty string
         vsnprintf_P(allocated_buf, target_len + 1, fmt_cpy, va_cpy);
         ret = (int32_t) allocated_buf;
@@ -472,10 +521,24 @@ free_allocs:
     free((void*)allocs[i]);      // it is ok to call free() on nullptr so we don't test for nullptr first
     allocs[i] = nullptr;
   }
-  free(fmt_cpy);          // free the local copy of the format string
+  if (fmt_cpy != fmt_stack) {
+    free(fmt_cpy);        // free the local copy of the format string
+  }
   return ret;
 }
 
+int32_t ext_vsnprintf_P(char * out_buf, size_t buf_len, const char * fmt_P, va_list va) {
+  return ext_vsnprintf_impl(out_buf, buf_len, nullptr, nullptr, 0, fmt_P, va);
+}
+
+// Append to `*buf_p` at `offset`, `*buf_p` being a heap buffer of `*size_p` bytes or nullptr
+// The buffer is replaced by a larger one when needed and `*buf_p` and `*size_p` are updated accordingly
+// Arguments must not point at or behind `offset` as this is where the output goes
+// Returns the number of chars appended (0 if something went wrong)
+int32_t ext_vsnprintf_append_P(char ** buf_p, size_t * size_p, size_t offset, const char * fmt_P, va_list va) {
+  return ext_vsnprintf_impl(nullptr, 0, buf_p, size_p, offset, fmt_P, va);
+}
+
 char * ext_vsnprintf_malloc_P(const char * fmt_P, va_list va) {
   int32_t ret = ext_vsnprintf_P(nullptr, 0, fmt_P, va);
   return (char*) ret;
@@ -28,6 +28,9 @@ int32_t ext_vsnprintf_P(char * buf, size_t buf_len, const char * fmt_P, va_list
 int32_t ext_snprintf_P(char * buf, size_t buf_len, const char * fmt, ...);
 char * ext_snprintf_malloc_P(const char * fmt, ...);
 char * ext_vsnprintf_malloc_P(const char * fmt_P, va_list va);
+int32_t ext_vsnprintf_append_P(char ** buf_p, size_t * size_p, size_t offset, const char * fmt_P, va_list va);
+
+extern uint32_t ext_printf_allocs;      // number of heap allocations done by ext_printf
 
 char* ToHex_P(const unsigned char * in, size_t insz, char * out, size_t outsz, char inbetween);
 
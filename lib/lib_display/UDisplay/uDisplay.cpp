@@ -26,6 +26,7 @@
 
 #ifdef USE_ESP32_S3
 #include "esp_cache.h"
+#include "uDisplay_rotate.h"
 #endif // USE_ESP32_S3
 
 #include "tasmota_options.h"
@@ -72,6 +73,10 @@ uDisplay::~uDisplay(void) {
     free(frame_buffer);
   }
 
+  if (fb_shadow) {
+    free(fb_shadow);
+  }
+
   if (lut_full) {
     free(lut_full);
   }
@@ -118,6 +123,11 @@ uDisplay::uDisplay(char *lp) : Renderer(800, 600) {
   pwr_cbp = 0;
   dim_cbp = 0;
   framebuffer = 0;
+  fb_shadow = 0;
+  fb_shadow_ok = false;
+  upd_bytes = 0;
+  dirty_xs = 0;
+  dirty_xe = -1;
   col_mode = 16;
   sa_mode = 16;
   saw_3 = 0xff;
@@ -413,6 +423,7 @@ uDisplay::uDisplay(char *lp) : Renderer(800, 600) {
               }
               interface = _UDSP_RGB;
             } else {
+              uint16_t line_start = dsp_ncmds;
               if (interface == _UDSP_I2C) {
                 dsp_cmds[dsp_ncmds++] = next_hex(&lp1);
                 if (!str2c(&lp1, ibuff, sizeof(ibuff))) {
@@ -428,6 +439,16 @@ uDisplay::uDisplay(char *lp) : Renderer(800, 600) {
                   }
                 }
               }
+              if (bpp == 1) {
+                // SSD130x memory addressing mode (0x20 with one argument) is forced to page addressing,
+                // Updateframe() addresses each page separately to send only the changed columns
+                uint8_t *cmd = &dsp_cmds[line_start];
+                if (interface == _UDSP_I2C && dsp_ncmds - line_start == 2 && cmd[0] == 0x20) {
+                  cmd[1] = 0x02;
+                } else if (interface == _UDSP_SPI && dsp_ncmds - line_start == 3 && cmd[0] == 0x20 && (cmd[1] & 0x7f) == 1) {
+                  cmd[2] = 0x02;
+                }
+              }
             }
             break;
           case 'f':
@@ -897,6 +918,9 @@ uint16_t cmd_offset = 0;
 
 void uDisplay::send_spi_cmds(uint16_t cmd_offset, uint16_t cmd_size) {
 uint16_t index = 0;
+  if (ep_mode == 1 && dirty_xs > dirty_xe) {
+    mark_dirty_all();     // EP_SET_MEM_AREA and EP_SEND_DATA use the changed area
+  }
 #ifdef UDSP_DEBUG
   Serial.printf("start send cmd table\n");
 #endif
@@ -937,10 +961,10 @@ uint16_t index = 0;
           delay_sync(iob * 10);
           break;
         case EP_SET_MEM_AREA:
-          SetMemoryArea(0, 0, gxs - 1, gys - 1);
+          SetMemoryArea(dirty_xs, dirty_ys, dirty_xe, dirty_ye);
           break;
         case EP_SET_MEM_PTR:
-          SetMemoryPointer(0, 0);
+          SetMemoryPointer(dirty_xs, dirty_ys);
           break;
         case EP_SEND_DATA:
           Send_EP_Data();
@@ -1046,15 +1070,23 @@ Renderer *uDisplay::Init(void) {
   // for any bpp below native 16 bits, we allocate a local framebuffer to copy into
   if (ep_mode || bpp < 16) {
     if (framebuffer) free(framebuffer);
+    // monochrome panels other than epaper store pages of 8 rows
+    uint32_t fb_size = (ep_mode || bpp != 1) ? (gxs * gys * bpp) / 8 : gxs * ((gys + 7) / 8);
 #ifdef ESP8266
-    framebuffer = (uint8_t*)calloc((gxs * gys * bpp) / 8, 1);
+    framebuffer = (uint8_t*)calloc(fb_size, 1);
 #else
     if (UsePSRAM()) {
-      framebuffer = (uint8_t*)heap_caps_malloc((gxs * gys * bpp) / 8, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      framebuffer = (uint8_t*)heap_caps_malloc(fb_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
     } else {
-      framebuffer = (uint8_t*)calloc((gxs * gys * bpp) / 8, 1);
+      framebuffer = (uint8_t*)calloc(fb_size, 1);
     }
 #endif // ESP8266
+    // copy of what the panel shows, so that Updateframe() sends only the bytes that changed
+    if (bpp == 1 && ep_mode != 2) {
+      if (fb_shadow) free(fb_shadow);
+      fb_shadow = (uint8_t*)malloc(fb_size);
+    }
+    mark_dirty_all();
   }
   frame_buffer = framebuffer;
 
@@ -1634,11 +1666,28 @@ void uDisplay::Updateframe(void) {
     return;
   }
 
+  upd_bytes = 0;
+
   if (ep_mode) {
+    // a partial refresh of an unchanged frame is not needed
+    if (ep_mode == 1 && ep_update_mode == DISPLAY_INIT_PARTIAL && epc_part_cnt && !epd_window()) {
+      dirty_xs = 0;
+      dirty_xe = -1;
+      return;
+    }
     Updateframe_EPD();
     return;
   }
 
+  if (dirty_xs > dirty_xe || framebuffer == nullptr) {
+    return;
+  }
+
+  // only the changed columns of the changed pages are sent, pages are addressed separately
+  // with 0xB0 + page, SSD130x panels are set to page addressing at init
+  uint16_t page_s = dirty_ys >> 3;
+  uint16_t page_e = dirty_ye >> 3;
+
   if (interface == _UDSP_I2C) {
 
   #if 0
@@ -1671,30 +1720,30 @@ void uDisplay::Updateframe(void) {
     i2c_command(i2c_page_start | 0x0);  // set hi col = 0, 0x10
     i2c_command(i2c_page_end | 0x0); // set startline line #0, 0x40
 
-	  uint8_t ys = gys >> 3;
-	  uint8_t xs = gxs >> 3;
-    //uint8_t xs = 132 >> 3;
 	  uint8_t m_row = saw_2;
 	  uint8_t m_col = i2c_col_start;
 
-	  uint16_t p = 0;
-
-	  uint8_t i, j, k = 0;
-
-	  for ( i = 0; i < ys; i++) {
-		    // send a bunch of data in one xmission
-        i2c_command(0xB0 + i + m_row); //set page address
-        i2c_command(m_col & 0xf); //set lower column address
-        i2c_command(0x10 | (m_col >> 4)); //set higher column address
-
-        for ( j = 0; j < 8; j++) {
-			      wire->beginTransmission(i2caddr);
-            wire->write(0x40);
-            for ( k = 0; k < xs; k++, p++) {
-		            wire->write(framebuffer[p]);
-            }
-            wire->endTransmission();
-	      }
+    for (uint16_t page = page_s; page <= page_e; page++) {
+      uint16_t xs, xe;
+      if (!page_span(page, &xs, &xe)) { continue; }
+      uint8_t col = m_col + xs;
+      i2c_command(0xB0 + page + m_row); //set page address
+      i2c_command(col & 0xf); //set lower column address
+      i2c_command(0x10 | (col >> 4)); //set higher column address
+
+      // send a bunch of data in one xmission
+      uint8_t *ptr = framebuffer + page * gxs + xs;
+      uint16_t count = xe - xs + 1;
+      upd_bytes += count;
+      while (count) {
+        uint16_t len = count < WIRE_MAX - 1 ? count : WIRE_MAX - 1;
+        wire->beginTransmission(i2caddr);
+        wire->write(0x40);
+        wire->write(ptr, len);
+        wire->endTransmission();
+        ptr += len;
+        count -= len;
+      }
     }
 #endif
 
@@ -1712,27 +1761,23 @@ void uDisplay::Updateframe(void) {
     // ulcd_command(i2c_page_start | 0x0);  // set hi col = 0, 0x10
     // ulcd_command(i2c_page_end | 0x0); // set startline line #0, 0x40
 
-	  uint8_t ys = gys >> 3;
-	  uint8_t xs = gxs >> 3;
-    //uint8_t xs = 132 >> 3;
 	  uint8_t m_row = saw_2;
 	  uint8_t m_col = i2c_col_start;
-    // Serial.printf("m_row=%d m_col=%d xs=%d ys=%d\n", m_row, m_col, xs, ys);
-
-	  uint16_t p = 0;
-
-	  uint8_t i, j, k = 0;
-	  for ( i = 0; i < ys; i++) {   // i = line from 0 to ys
-		    // send a bunch of data in one xmission
-        ulcd_command(0xB0 + i + m_row); //set page address
-        ulcd_command(m_col & 0xf); //set lower column address
-        ulcd_command(0x10 | (m_col >> 4)); //set higher column address
-
-        for ( j = 0; j < 8; j++) {
-            for ( k = 0; k < xs; k++, p++) {
-		            ulcd_data8(framebuffer[p]);
-            }
-	      }
+    // Serial.printf("m_row=%d m_col=%d pages=%d-%d\n", m_row, m_col, page_s, page_e);
+
+    for (uint16_t page = page_s; page <= page_e; page++) {
+      uint16_t xs, xe;
+      if (!page_span(page, &xs, &xe)) { continue; }
+      uint8_t col = m_col + xs;
+      ulcd_command(0xB0 + page + m_row); //set page address
+      ulcd_command(col & 0xf); //set lower column address
+      ulcd_command(0x10 | (col >> 4)); //set higher column address
+
+      uint8_t *ptr = framebuffer + page * gxs + xs;
+      for (uint16_t x = xs; x <= xe; x++) {
+        ulcd_data8(*ptr++);
+      }
+      upd_bytes += xe - xs + 1;
     }
 
     SPI_CS_HIGH
@@ -1740,17 +1785,104 @@ void uDisplay::Updateframe(void) {
 
   }
 
+  if (fb_shadow && !fb_shadow_ok) {
+    // the whole frame was sent
+    memcpy(fb_shadow, framebuffer, gxs * ((gys + 7) / 8));
+    fb_shadow_ok = true;
+  }
+  dirty_xs = 0;
+  dirty_xe = -1;
+#ifdef UDSP_DEBUG
+  Serial.printf("updateframe: %d bytes\n", upd_bytes);
+#endif
+}
+
+// columns of `page` to send, narrowed to the bytes that differ from what the panel shows,
+// returns false if the page did not change
+bool uDisplay::page_span(uint16_t page, uint16_t *xs, uint16_t *xe) {
+  uint16_t x_s = dirty_xs;
+  uint16_t x_e = dirty_xe;
+  if (fb_shadow && fb_shadow_ok) {
+    uint8_t *fb = framebuffer + page * gxs;
+    uint8_t *sh = fb_shadow + page * gxs;
+    while (x_s <= x_e && fb[x_s] == sh[x_s]) { x_s++; }
+    if (x_s > x_e) { return false; }
+    while (fb[x_e] == sh[x_e]) { x_e--; }
+    memcpy(sh + x_s, fb + x_s, x_e - x_s + 1);
+  }
+  *xs = x_s;
+  *xe = x_e;
+  return true;
+}
+
+// add a rectangle in rotated coordinates to the changed area of the framebuffer
+void uDisplay::mark_dirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > width()) { w = width() - x; }
+  if (y + h > height()) { h = height() - y; }
+  if (w <= 0 || h <= 0) { return; }
+
+  int16_t xs, ys, xe, ye;
+  switch (cur_rot) {
+    case 1:
+      xs = gxs - y - h;
+      xe = gxs - y - 1;
+      ys = x;
+      ye = x + w - 1;
+      break;
+    case 2:
+      xs = gxs - x - w;
+      xe = gxs - x - 1;
+      ys = gys - y - h;
+      ye = gys - y - 1;
+      break;
+    case 3:
+      xs = y;
+      xe = y + h - 1;
+      ys = gys - x - w;
+      ye = gys - x - 1;
+      break;
+    default:
+      xs = x;
+      xe = x + w - 1;
+      ys = y;
+      ye = y + h - 1;
+      break;
+  }
+  if (dirty_xs > dirty_xe) {
+    dirty_xs = xs;
+    dirty_xe = xe;
+    dirty_ys = ys;
+    dirty_ye = ye;
+  } else {
+    if (xs < dirty_xs) { dirty_xs = xs; }
+    if (xe > dirty_xe) { dirty_xe = xe; }
+    if (ys < dirty_ys) { dirty_ys = ys; }
+    if (ye > dirty_ye) { dirty_ye = ye; }
+  }
+}
+
+// the panel content is unknown, send the whole frame at next update
+void uDisplay::mark_dirty_all(void) {
+  dirty_xs = 0;
+  dirty_ys = 0;
+  dirty_xe = gxs - 1;
+  dirty_ye = gys - 1;
+  fb_shadow_ok = false;
 }
 
 void uDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
 
 
   if (ep_mode) {
+    mark_dirty(x, y, 1, h);
     drawFastVLine_EPD(x, y, h, color);
     return;
   }
 
   if (framebuffer) {
+    mark_dirty(x, y, 1, h);
     Renderer::drawFastVLine(x, y, h, color);
     return;
   }
@@ -1819,11 +1951,13 @@ void uDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
 
 
   if (ep_mode) {
+    mark_dirty(x, y, w, 1);
     drawFastHLine_EPD(x, y, w, color);
     return;
   }
 
   if (framebuffer) {
+    mark_dirty(x, y, w, 1);
     Renderer::drawFastHLine(x, y, w, color);
     return;
   }
@@ -1910,11 +2044,13 @@ void uDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t col
 
 
   if (ep_mode) {
+    mark_dirty(x, y, w, h);
     fillRect_EPD(x, y, w, h, color);
     return;
   }
 
   if (framebuffer) {
+    mark_dirty(x, y, w, h);
     Renderer::fillRect(x, y, w, h, color);
     return;
   }
@@ -2219,14 +2355,62 @@ void uDisplay::pushColors(uint16_t *data, uint16_t len, boolean not_swapped) {
     if ((seta_yp2 - seta_yp1) * (seta_xp2 - seta_xp2) > len) { return; }
 
     if (cur_rot > 0) {
-      for (uint32_t y = seta_yp1; y < seta_yp2; y++) {
-        seta_yp1++;
-        for (uint32_t x = seta_xp1; x < seta_xp2; x++) {
+      if ((int16_t)seta_xp1 < 0 || (int16_t)seta_yp1 < 0 || seta_xp2 > _width || seta_yp2 > _height ||
+          seta_xp2 <= seta_xp1 || seta_yp2 <= seta_yp1) {
+        // partly outside of the screen, let drawPixel_RGB() clip each pixel
+        for (uint32_t y = seta_yp1; y < seta_yp2; y++) {
+          seta_yp1++;
+          for (uint32_t x = seta_xp1; x < seta_xp2; x++) {
+            uint16_t color = *data++;
+            if (!not_swapped) { color = color << 8 | color >> 8; }
+            drawPixel_RGB(x, y, color);
+            len--;
+            if (!len) return;         // failsafe - exist if len (pixel number) is exhausted
+          }
+        }
+        return;
+      }
+      uint32_t w = seta_xp2 - seta_xp1;
+      uint32_t rows = seta_yp2 - seta_yp1;
+      // only full rows are copied by blocks, the failsafe on len is applied per row
+      // callers may also push one row at a time in the same window, seta_yp1 moves accordingly
+      if (rows > len / w) { rows = len / w; }
+      uint32_t x0 = seta_xp1, y0 = seta_yp1;
+      // panel (physical) size and position in the framebuffer of pixel (x0,y0), see drawPixel_RGB()
+      int32_t fb_w, fb_h, dx, dy;
+      uint32_t px, py, fl_y1, fl_y2;       // flushed framebuffer rows
+      if (cur_rot == 2) {
+        fb_w = _width; fb_h = _height;
+        px = fb_w - x0 - 1; py = fb_h - y0 - 1;
+        dx = -1; dy = -fb_w;
+        fl_y1 = fb_h - y0 - rows; fl_y2 = fb_h - y0;
+      } else {
+        fb_w = _height; fb_h = _width;
+        if (cur_rot == 1) {
+          px = fb_w - y0 - 1; py = x0;
+          dx = fb_w; dy = -1;
+          fl_y1 = x0; fl_y2 = x0 + w;
+        } else {
+          px = y0; py = fb_h - x0 - 1;
+          dx = -fb_w; dy = 1;
+          fl_y1 = fb_h - x0 - w; fl_y2 = fb_h - x0;
+        }
+      }
+      if (rows > 0) {
+        udisp_rotate_copy(rgb_fb + (int32_t)py * fb_w + px, dx, dy, data, w, rows, !not_swapped);
+        // one flush for all the rows touched, instead of a write back per pixel
+        esp_cache_msync(rgb_fb + fl_y1 * fb_w, (fl_y2 - fl_y1) * fb_w * 2, 0);
+        seta_yp1 += rows;
+        data += rows * w;
+        len -= rows * w;
+      }
+      // remaining pixels of an incomplete row
+      if (len && seta_yp1 < seta_yp2) {
+        uint32_t y = seta_yp1++;
+        for (uint32_t x = seta_xp1; x < seta_xp2 && len; x++, len--) {
           uint16_t color = *data++;
           if (!not_swapped) { color = color << 8 | color >> 8; }
           drawPixel_RGB(x, y, color);
-          len--;
-          if (!len) return;         // failsafe - exist if len (pixel number) is exhausted
         }
       }
     } else {
@@ -2432,11 +2616,13 @@ void uDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
 #endif
 
   if (ep_mode) {
+    mark_dirty(x, y, 1, 1);
     drawPixel_EPD(x, y, color);
     return;
   }
 
   if (framebuffer) {
+    mark_dirty(x, y, 1, 1);
     Renderer::drawPixel(x, y, color);
     return;
   }
@@ -3437,6 +3623,7 @@ void uDisplay::Init_EPD(int8_t p) {
 }
 
 void uDisplay::ClearFrameMemory(unsigned char color) {
+    mark_dirty_all();
     SetMemoryArea(0, 0, gxs - 1, gys - 1);
     SetMemoryPointer(0, 0);
     spi_command_EPD(WRITE_RAM);
@@ -3468,6 +3655,7 @@ void uDisplay::DisplayFrame_42(void) {
     for(int i = 0; i < gxs / 8 * gys; i++) {
         spi_data8_EPD(framebuffer[i]^0xff);
     }
+    upd_bytes += gxs / 8 * gys;
     delay(2);
 
     SetLuts();
@@ -3519,21 +3707,70 @@ void uDisplay::Updateframe_EPD(void) {
     switch (ep_update_mode) {
       case DISPLAY_INIT_PARTIAL:
         if (epc_part_cnt) {
+          // descriptors sending the frame with EP_SET_MEM_AREA, EP_SET_MEM_PTR and EP_SEND_DATA
+          // only write the changed window to the panel memory
+          if (!epd_window()) {
+            mark_dirty_all();
+          }
           send_spi_cmds(epcoffs_part, epc_part_cnt);
         }
         break;
       case DISPLAY_INIT_FULL:
         if (epc_full_cnt) {
+          mark_dirty_all();
           send_spi_cmds(epcoffs_full, epc_full_cnt);
         }
         break;
       default:
+        mark_dirty_all();
         SetFrameMemory(framebuffer, 0, 0, gxs, gys);
         DisplayFrame_29();
     }
   } else {
     DisplayFrame_42();
   }
+  // keep the whole frame to send if the panel memory was cleared and not written
+  if (!fb_shadow || fb_shadow_ok) {
+    dirty_xs = 0;
+    dirty_xe = -1;
+  }
+#ifdef UDSP_DEBUG
+  Serial.printf("updateframe: %d bytes\n", upd_bytes);
+#endif
+}
+
+// narrow the changed area of the epaper framebuffer to the rows and bytes that differ
+// from the panel memory, x aligned on bytes; returns false if nothing changed
+// the shadow copy is updated once sent by Send_EP_Data() or SetFrameMemory()
+bool uDisplay::epd_window(void) {
+  if (dirty_xs > dirty_xe) { return false; }
+  uint16_t stride = gxs / 8;
+  int16_t bs = dirty_xs >> 3;
+  int16_t be = dirty_xe >> 3;
+  if (fb_shadow && fb_shadow_ok) {
+    int16_t ys = -1, ye = -1, xs = be, xe = bs;
+    for (int16_t y = dirty_ys; y <= dirty_ye; y++) {
+      uint8_t *fb = framebuffer + y * stride;
+      uint8_t *sh = fb_shadow + y * stride;
+      int16_t b = bs;
+      while (b <= be && fb[b] == sh[b]) { b++; }
+      if (b > be) { continue; }
+      if (b < xs) { xs = b; }
+      b = be;
+      while (fb[b] == sh[b]) { b--; }
+      if (b > xe) { xe = b; }
+      if (ys < 0) { ys = y; }
+      ye = y;
+    }
+    if (ys < 0) { return false; }
+    bs = xs;
+    be = xe;
+    dirty_ys = ys;
+    dirty_ye = ye;
+  }
+  dirty_xs = bs << 3;
+  dirty_xe = (be << 3) | 7;
+  return true;
 }
 
 void uDisplay::DisplayFrame_29(void) {
@@ -3563,6 +3800,11 @@ void uDisplay::SetFrameMemory(const unsigned char* image_buffer) {
     for (int i = 0; i < gxs / 8 * gys; i++) {
         spi_data8_EPD(image_buffer[i] ^ 0xff);
     }
+    upd_bytes += gxs / 8 * gys;
+    if (fb_shadow && image_buffer == framebuffer) {
+      memcpy(fb_shadow, framebuffer, gxs / 8 * gys);
+      fb_shadow_ok = true;
+    }
 }
 
 void uDisplay::SetMemoryPointer(int x, int y) {
@@ -3582,17 +3824,26 @@ void uDisplay::Send_EP_Data() {
 }
 #else
 void uDisplay::Send_EP_Data() {
+  // the window set by EP_SET_MEM_AREA
   uint16_t image_width = gxs & 0xFFF8;
-  uint16_t x = 0;
-  uint16_t y = 0;
-  uint16_t x_end = gxs - 1;
-  uint16_t y_end = gys - 1;
+  uint16_t x = dirty_xs & 0xFFF8;
+  uint16_t y = dirty_ys;
+  uint16_t x_end = dirty_xe;
+  uint16_t y_end = dirty_ye;
 
-  for (uint16_t j = 0; j < y_end - y + 1; j++) {
-    for (uint16_t i = 0; i < (x_end - x + 1) / 8; i++) {
+  for (uint16_t j = y; j <= y_end; j++) {
+    for (uint16_t i = x / 8; i <= x_end / 8; i++) {
         spi_data8_EPD(framebuffer[i + j * (image_width / 8)]^0xff);
     }
   }
+  upd_bytes += (x_end / 8 - x / 8 + 1) * (y_end - y + 1);
+  if (fb_shadow) {
+    // the window is the whole frame if the shadow is not valid, see mark_dirty_all()
+    for (uint16_t j = y; j <= y_end; j++) {
+      memcpy(fb_shadow + x / 8 + j * (image_width / 8), framebuffer + x / 8 + j * (image_width / 8), x_end / 8 - x / 8 + 1);
+    }
+    fb_shadow_ok = true;
+  }
 }
 #endif
 
@@ -211,6 +211,7 @@ class uDisplay : public Renderer {
   void invertDisplay(boolean i);
   void SetPwrCB(pwr_cb cb) { pwr_cbp = cb; };
   void SetDimCB(dim_cb cb) { dim_cbp = cb; };
+  uint32_t upd_bytes;         // framebuffer bytes sent to the panel by the last Updateframe()
 #ifdef USE_UNIVERSAL_TOUCH
 // universal touch driver
   bool utouch_Init(char **name);
@@ -366,6 +367,17 @@ class uDisplay : public Renderer {
    void Send_EP_Data(void);
    void send_spi_cmds(uint16_t cmd_offset, uint16_t cmd_size);
    void send_spi_icmds(uint16_t cmd_size);
+   void mark_dirty(int16_t x, int16_t y, int16_t w, int16_t h);
+   void mark_dirty_all(void);
+   bool page_span(uint16_t page, uint16_t *xs, uint16_t *xe);
+   bool epd_window(void);
+   // changed area of the framebuffer since the last Updateframe(), in panel coordinates, empty if dirty_xs > dirty_xe
+   int16_t dirty_xs;
+   int16_t dirty_ys;
+   int16_t dirty_xe;
+   int16_t dirty_ye;
+   uint8_t *fb_shadow;         // framebuffer as last sent to monochrome panels, `nullptr` if not enough memory
+   bool fb_shadow_ok;
    
 
 #ifdef USE_ESP32_S3
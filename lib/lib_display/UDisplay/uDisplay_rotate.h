@@ -0,0 +1,74 @@
+/*
+  uDisplay_rotate.h -  rotated copy of RGB565 blocks into a framebuffer
+
+  Copyright (C) 2021  Gerhard Mutz and  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _UDISP_ROTATE_
+#define _UDISP_ROTATE_
+
+#include <stdint.h>
+
+// side of the square tiles used for 90 and 270 degrees rotations
+// 16 x 16 pixels of source (512 bytes) stay in the data cache while
+// each column is written as a contiguous run of 16 pixels to the framebuffer
+#ifndef UDSP_ROT_TILE
+#define UDSP_ROT_TILE 16
+#endif
+
+// Copy `w` x `h` pixels from `src` (row stride `w`) to a rotated framebuffer
+// `dst` is the framebuffer address of source pixel (0,0), and
+// source pixel (x,y) goes to `dst + x * dx + y * dy`
+//    rotation 1 (90)  : dx = fb_width, dy = -1
+//    rotation 2 (180) : dx = -1, dy = -fb_width
+//    rotation 3 (270) : dx = -fb_width, dy = 1
+// If `swap` is true, the high and low bytes of each pixel are swapped on the fly
+static inline void udisp_rotate_copy(uint16_t *dst, int32_t dx, int32_t dy, const uint16_t *src, uint32_t w, uint32_t h, bool swap) {
+  // shift by 8 swaps bytes, shift by 0 keeps the color (c | c == c), no test in the inner loops
+  const uint32_t sh = swap ? 8 : 0;
+
+  if (dy == 1 || dy == -1) {
+    // 90 or 270: a source column is a framebuffer row, walk by tiles
+    for (uint32_t ty = 0; ty < h; ty += UDSP_ROT_TILE) {
+      uint32_t th = (h - ty < UDSP_ROT_TILE) ? h - ty : UDSP_ROT_TILE;
+      for (uint32_t tx = 0; tx < w; tx += UDSP_ROT_TILE) {
+        uint32_t tw = (w - tx < UDSP_ROT_TILE) ? w - tx : UDSP_ROT_TILE;
+        for (uint32_t x = tx; x < tx + tw; x++) {
+          const uint16_t *s = src + ty * w + x;
+          uint16_t *d = dst + (int32_t)x * dx + (int32_t)ty * dy;
+          for (uint32_t y = 0; y < th; y++) {
+            uint16_t color = *s;
+            *d = (uint16_t)(color << sh | color >> sh);
+            s += w;
+            d += dy;
+          }
+        }
+      }
+    }
+  } else {
+    // 180: rows are reversed, no need for tiles
+    for (uint32_t y = 0; y < h; y++) {
+      uint16_t *d = dst + (int32_t)y * dy;
+      for (uint32_t x = 0; x < w; x++) {
+        uint16_t color = *src++;
+        *d = (uint16_t)(color << sh | color >> sh);
+        d += dx;
+      }
+    }
+  }
+}
+
+#endif // _UDISP_ROTATE_
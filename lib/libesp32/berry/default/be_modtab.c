@@ -19,6 +19,7 @@ be_extern_native_module(global);
 be_extern_native_module(sys);
 be_extern_native_module(debug);
 be_extern_native_module(gc);
+be_extern_native_module(profiler);
 be_extern_native_module(solidify);
 be_extern_native_module(introspect);
 be_extern_native_module(strict);
@@ -104,6 +105,9 @@ BERRY_LOCAL const bntvmodule_t* const be_module_table[] = {
 #if BE_USE_GC_MODULE
     &be_native_module(gc),
 #endif
+#if BE_USE_PROFILER
+    &be_native_module(profiler),
+#endif
 #if BE_USE_SOLIDIFY_MODULE
     &be_native_module(solidify),
 #endif
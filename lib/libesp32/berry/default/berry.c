@@ -16,6 +16,10 @@
 
 #include "be_mapping.h"
 
+#ifdef USE_BERRY_MATTER_TLV
+extern void be_load_matter_tlv(bvm *vm);
+#endif
+
 /* using GNU/readline library */
 #if defined(USE_READLINE_LIB)
     #include <readline/readline.h>
@@ -406,6 +410,9 @@ int main(int argc, char *argv[])
     int res;
     bvm *vm = be_vm_new(); /* create a virtual machine instance */
     be_set_ctype_func_hanlder(vm, be_call_ctype_func);
+#ifdef USE_BERRY_MATTER_TLV
+    be_load_matter_tlv(vm); /* native Matter TLV codec, used when solidifying Matter */
+#endif
     res = analysis_args(vm, argc, argv);
     be_vm_delete(vm); /* free all objects and vm */
     return res;
@@ -100,6 +100,74 @@
  **/
 #define BE_VM_OBSERVABILITY_SAMPLING    20
 
+/* Macro: BE_USE_PROFILER
+ * Sampling profiler and `profiler` module. When started, the function
+ * and line running in the VM are sampled at regular intervals and the
+ * memory allocated is recorded for the innermost Berry function.
+ * Samples are taken only if BE_USE_PERF_COUNTERS == 1.
+ * Default: 0
+ **/
+#define BE_USE_PROFILER                 1
+
+/* Macro: BE_PROFILER_SAMPLING
+ * If BE_USE_PROFILER == 1
+ * number of instructions between two samples, as a power of 2.
+ * Must be lower than BE_VM_OBSERVABILITY_SAMPLING.
+ * Default: 10 - which translates to 2^10 or 1024 instructions
+ **/
+#define BE_PROFILER_SAMPLING            10
+
+/* Macro: BE_PROFILER_SIZE
+ * If BE_USE_PROFILER == 1
+ * number of entries of the profiler histogram, must be a power of 2.
+ * Each entry is a function and line, it takes 16 bytes on 32 bits platforms.
+ * Default: 64
+ **/
+#define BE_PROFILER_SIZE                64
+
+/* Macro: BE_USE_COMPUTED_GOTO
+ * Use direct threaded dispatch in the VM loop, each instruction jumps
+ * to the next handler instead of going back to a `switch` statement.
+ * Requires GCC or clang (labels as values), ignored with other compilers.
+ * Default: 0
+ **/
+#define BE_USE_COMPUTED_GOTO            1
+
+/* Macro: BE_USE_MEMBER_CACHE
+ * Cache instance member lookups of GETMBR, GETMET and SETMBR per instruction,
+ * avoiding to walk the class hierarchy and search the class members maps.
+ * The cache is flushed at each garbage collection.
+ * Default: 0
+ **/
+#define BE_USE_MEMBER_CACHE             1
+
+/* Macro: BE_MEMBER_CACHE_SIZE
+ * If BE_USE_MEMBER_CACHE == 1
+ * number of entries of the member cache, must be a power of 2.
+ * Each entry takes 20 bytes on 32 bits platforms.
+ * Default: 64
+ **/
+#define BE_MEMBER_CACHE_SIZE            64
+
+/* Macro: BE_USE_INCREMENTAL_GC
+ * Run automatic garbage collections in steps at the next allocations,
+ * so that a collection does not stop the VM for the time needed to mark,
+ * destruct and free all objects at once. Marking is tri-color with write
+ * barriers, only the roots and the protos and classes are rescanned in
+ * a final atomic step. `gc.collect()` always runs a full cycle.
+ * Default: 0
+ **/
+#define BE_USE_INCREMENTAL_GC           1
+
+/* Macro: BE_GC_STEP_BUDGET
+ * If BE_USE_INCREMENTAL_GC == 1
+ * default units of work of each incremental step, one unit is an object
+ * visited or a slot scanned,
+ * can be changed at runtime with `gc.budget()`.
+ * Default: 256
+ **/
+#define BE_GC_STEP_BUDGET               256
+
 /* Macro: BE_STACK_TOTAL_MAX
  * Set the maximum total stack size.
  * Default: 20000
@@ -52,6 +52,7 @@ static void class_init(bvm *vm, bclass *c, const bnfuncinfo *lib)
             }
         }
         be_map_compact(vm, c->members); /* clear space */
+        be_vm_mbrcache_flush(vm);
     }
 }
 
@@ -764,6 +765,7 @@ BERRY_API bbool be_setindex(bvm *vm, int index)
         break;
     }
     if (dst) {
+        be_gc_barrierback(vm, var_togc(o));
         var_setval(dst, v);
         return btrue;
     }
@@ -795,6 +797,7 @@ BERRY_API bbool be_setupval(bvm *vm, int index, int pos)
         be_assert(pos >= 0 && pos < nf->nupvals);
         uv = be_ntvclos_upval(nf, pos)->value;
         var_setval(uv, v);
+        be_gc_barrier(vm, v);
         return btrue;
     }
     return bfalse;
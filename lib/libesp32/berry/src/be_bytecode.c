@@ -23,7 +23,9 @@
 #define MAGIC_NUMBER1       0xBE
 #define MAGIC_NUMBER2       0xCD
 #define MAGIC_NUMBER3       0xFE
-#define BYTECODE_VERSION    4
+#define BYTECODE_VERSION    5
+#define BYTECODE_VERSION_MIN 4  /* oldest version that can still be loaded */
+#define BYTECODE_ALIGN       5  /* first version with 4-bytes aligned instructions */
 
 #define USE_64BIT_INT       (BE_INTGER_TYPE == 2 \
     || BE_INTGER_TYPE == 1 && LONG_MAX == 9223372036854775807L)
@@ -190,11 +192,24 @@ static void save_value(bvm *vm, void *fp, bvalue *v)
     }
 }
 
+/* pad with zeros so that instructions start at a 4-bytes aligned offset,
+ * this allows the loader to use them in place from memory-mapped flash */
+static void save_align(void *fp)
+{
+    long pos;
+    for (pos = be_ftell(fp); pos & 3; ++pos) {
+        save_byte(fp, 0);
+    }
+}
+
 static void save_bytecode(bvm *vm, void *fp, bproto *proto)
 {
     int forbid_gbl = comp_is_named_gbl(vm);
     binstruction *code = proto->code, *end;
     save_long(fp, (uint32_t)proto->codesize);
+    if (proto->codesize) {
+        save_align(fp);
+    }
     for (end = code + proto->codesize; code < end; ++code) {
         save_long(fp, (uint32_t)*code);
         if (forbid_gbl) {   /* we are saving only named globals, so make sure we don't save OP_GETGBL or OP_SETGBL */
@@ -256,7 +271,7 @@ static void save_proto(bvm *vm, void *fp, bproto *proto)
 #endif
         save_byte(fp, proto->argc); /* argc */
         save_byte(fp, proto->nstack); /* nstack */
-        save_byte(fp, proto->varg); /* varg */
+        save_byte(fp, proto->varg & ~BE_VA_SHARED_CODE); /* varg */
         save_byte(fp, 0x00); /* reserved */
         save_bytecode(vm, fp, proto); /* bytecode */
         save_constants(vm, fp, proto); /* constant */
@@ -313,30 +328,70 @@ void be_bytecode_save(bvm *vm, const char *filename, bproto *proto)
 #endif /* BE_USE_BYTECODE_SAVER */
 
 #if BE_USE_BYTECODE_LOADER
-static bbool load_proto(bvm *vm, void *fp, bproto **proto, int info, int version);
+#define READER_BUFFER_SIZE  256 /* read buffer size when loading from a file */
+
+/* bytecode reader, reads a file through a buffer or reads directly from memory */
+typedef struct {
+    void *fp; /* file handle, or NULL when reading from memory */
+    const uint8_t *data; /* buffered bytes, or the whole image in memory */
+    size_t pos; /* read position in data */
+    size_t size; /* count of bytes in data */
+    size_t offset; /* count of bytes read since the beginning of the image */
+    bbool inplace; /* instructions may be referenced in place in data */
+    uint8_t buffer[READER_BUFFER_SIZE];
+} bcreader;
+
+static bbool load_proto(bvm *vm, bcreader *rd, bproto **proto, int info, int version);
+
+static size_t load_read(bcreader *rd, void *dst, size_t len)
+{
+    uint8_t *p = dst;
+    size_t count = rd->size - rd->pos;
+    if (count >= len) { /* all bytes are already available */
+        memcpy(p, rd->data + rd->pos, len);
+        rd->pos += len;
+        rd->offset += len;
+        return len;
+    }
+    memcpy(p, rd->data + rd->pos, count);
+    rd->pos = rd->size;
+    if (rd->fp) {
+        if (len - count >= sizeof(rd->buffer)) { /* large reads bypass the buffer */
+            count += be_fread(rd->fp, p + count, len - count);
+        } else {
+            size_t n = len - count;
+            rd->size = be_fread(rd->fp, rd->buffer, sizeof(rd->buffer));
+            rd->pos = n < rd->size ? n : rd->size;
+            memcpy(p + count, rd->buffer, rd->pos);
+            count += rd->pos;
+        }
+    }
+    rd->offset += count;
+    return count;
+}
 
-static uint8_t load_byte(void *fp)
+static uint8_t load_byte(bcreader *rd)
 {
     uint8_t buffer[1];
-    if (be_fread(fp, buffer, sizeof(buffer)) == sizeof(buffer)) {
+    if (load_read(rd, buffer, sizeof(buffer)) == sizeof(buffer)) {
         return buffer[0];
     }
     return 0;
 }
 
-static uint16_t load_word(void *fp)
+static uint16_t load_word(bcreader *rd)
 {
     uint8_t buffer[2];
-    if (be_fread(fp, buffer, sizeof(buffer)) == sizeof(buffer)) {
+    if (load_read(rd, buffer, sizeof(buffer)) == sizeof(buffer)) {
         return ((uint16_t)buffer[1] << 8) | buffer[0];
     }
     return 0;
 }
 
-static uint32_t load_long(void *fp)
+static uint32_t load_long(bcreader *rd)
 {
     uint8_t buffer[4];
-    if (be_fread(fp, buffer, sizeof(buffer)) == sizeof(buffer)) {
+    if (load_read(rd, buffer, sizeof(buffer)) == sizeof(buffer)) {
         return ((uint32_t)buffer[3] << 24)
             | ((uint32_t)buffer[2] << 16)
             | ((uint32_t)buffer[1] << 8)
@@ -345,11 +400,11 @@ static uint32_t load_long(void *fp)
     return 0;
 }
 
-static int load_head(void *fp)
+static int load_head(bcreader *rd)
 {
     int res;
     uint8_t buffer[8] = { 0 };
-    be_fread(fp, buffer, sizeof(buffer));
+    load_read(rd, buffer, sizeof(buffer));
     res = buffer[0] == MAGIC_NUMBER1 &&
           buffer[1] == MAGIC_NUMBER2 &&
           buffer[2] == MAGIC_NUMBER3 &&
@@ -377,42 +432,49 @@ bbool be_bytecode_check(const char *path)
     return bfalse;
 }
 
-static bint load_int(void *fp)
+static bint load_int(bcreader *rd)
 {
 #if USE_64BIT_INT
     bint i;
-    i = load_long(fp);
-    i |= (bint)load_long(fp) << 32;
+    i = load_long(rd);
+    i |= (bint)load_long(rd) << 32;
     return i;
 #else
-    return load_long(fp);
+    return load_long(rd);
 #endif
 }
 
-static breal load_real(void *fp)
+static breal load_real(bcreader *rd)
 {
 #if BE_USE_SINGLE_FLOAT
     union { breal r; uint32_t i; } u;
-    u.i = load_long(fp);
+    u.i = load_long(rd);
     return u.r;
 #else
     union {
         breal r;
         uint64_t i;
     } u;
-    u.i = load_long(fp);
-    u.i |= (uint64_t)load_long(fp) << 32;
+    u.i = load_long(rd);
+    u.i |= (uint64_t)load_long(rd) << 32;
     return u.r;
 #endif
 }
 
-static bstring* load_string(bvm *vm, void *fp)
+static bstring* load_string(bvm *vm, bcreader *rd)
 {
-    uint16_t len = load_word(fp);
+    uint16_t len = load_word(rd);
     if (len > 0) {
         bstring *str;
-        char *buf = be_malloc(vm, len);
-        be_fread(fp, buf, len);
+        char *buf;
+        if (rd->size - rd->pos >= len) { /* no copy if the string is already available */
+            str = be_newstrn(vm, (const char *)rd->data + rd->pos, len);
+            rd->pos += len;
+            rd->offset += len;
+            return str;
+        }
+        buf = be_malloc(vm, len);
+        load_read(rd, buf, len);
         str = be_newstrn(vm, buf, len);
         be_free(vm, buf, len);
         return str;
@@ -420,29 +482,29 @@ static bstring* load_string(bvm *vm, void *fp)
     return str_literal(vm, "");
 }
 
-static bstring* cache_string(bvm *vm, void *fp)
+static bstring* cache_string(bvm *vm, bcreader *rd)
 {
-    bstring *str = load_string(vm, fp);
+    bstring *str = load_string(vm, rd);
     var_setstr(vm->top, str);
     be_incrtop(vm);
     return str;
 }
 
-static void load_class(bvm *vm, void *fp, bvalue *v, int version)
+static void load_class(bvm *vm, bcreader *rd, bvalue *v, int version)
 {
     int nvar, count;
     bclass *c = be_newclass(vm, NULL, NULL);
     var_setclass(v, c);
-    c->name = load_string(vm, fp);
-    nvar = load_long(fp);
-    count = load_long(fp);
+    c->name = load_string(vm, rd);
+    nvar = load_long(rd);
+    count = load_long(rd);
     while (count--) { /* load method table */
         bvalue *value;
-        bstring *name = cache_string(vm, fp);
+        bstring *name = cache_string(vm, rd);
         value = vm->top;
         var_setproto(value, NULL);
         be_incrtop(vm);
-        if (load_proto(vm, fp, (bproto**)&var_toobj(value), -3, version)) {
+        if (load_proto(vm, rd, (bproto**)&var_toobj(value), -3, version)) {
             /* actual method */
             bproto *proto = (bproto*)var_toobj(value);
             bbool is_method = proto->varg & BE_VA_METHOD;
@@ -461,134 +523,186 @@ static void load_class(bvm *vm, void *fp, bvalue *v, int version)
         be_stackpop(vm, 2); /* pop the cached string and proto */
     }
     for (count = 0; count < nvar; ++count) { /* load member-variable table */
-        bstring *name = cache_string(vm, fp);
+        bstring *name = cache_string(vm, rd);
         be_class_member_bind(vm, c, name, btrue);
         be_stackpop(vm, 1); /* pop the cached string */
     }
 }
 
-static void load_value(bvm *vm, void *fp, bvalue *v, int version)
+static void load_value(bvm *vm, bcreader *rd, bvalue *v, int version)
 {
-    switch (load_byte(fp)) {
-    case BE_INT: var_setint(v, load_int(fp)); break;
-    case BE_REAL: var_setreal(v, load_real(fp)); break;
-    case BE_STRING: var_setstr(v, load_string(vm, fp)); break;
-    case BE_CLASS: load_class(vm, fp, v, version); break;
+    switch (load_byte(rd)) {
+    case BE_INT: var_setint(v, load_int(rd)); break;
+    case BE_REAL: var_setreal(v, load_real(rd)); break;
+    case BE_STRING: var_setstr(v, load_string(vm, rd)); break;
+    case BE_CLASS: load_class(vm, rd, v, version); break;
     default: break;
     }
 }
 
-static void load_bytecode(bvm *vm, void *fp, bproto *proto, int info)
+/* one entry per opcode of this VM, the others have no handler */
+static const uint8_t known_opcodes[] = {
+    #define OPCODE(opc) 0
+    #include "be_opcodes.h"
+    #undef OPCODE
+};
+
+/* fix the global variable index of GETGBL and SETGBL */
+/* and refuse unknown opcodes, which the threaded VM would jump through */
+static binstruction fix_global(bvm *vm, blist *list, int bcnt, binstruction ins)
+{
+    binstruction op = IGET_OP(ins);
+    if (op >= array_count(known_opcodes)) {
+        bytecode_error(vm, be_pushfstring(vm,
+            "invalid opcode %d in bytecode", (int)op));
+    }
+    if (op == OP_GETGBL || op == OP_SETGBL) {
+        int idx = IGET_Bx(ins);
+        if (idx >= bcnt) { /* does not fix builtin index */
+            bvalue *name = be_list_at(list, idx - bcnt);
+            idx = be_global_find(vm, var_tostr(name));
+            ins = (ins & ~IBx_MASK) | ISET_Bx(idx);
+        }
+    }
+    return ins;
+}
+
+/* instructions can be referenced in place if they are aligned, stored
+ * in the native byte order and no global index needs to be changed */
+static bbool code_inplace(bvm *vm, bcreader *rd, blist *list, int bcnt, int size)
 {
-    int size = (int)load_long(fp);
+    const uint16_t one = 1;
+    const binstruction *code = (const binstruction *)(rd->data + rd->pos), *end;
+    if (!rd->inplace || *(const uint8_t *)&one != 1 || ((uintptr_t)code & 3)
+            || rd->size - rd->pos < sizeof(binstruction) * size) {
+        return bfalse;
+    }
+    for (end = code + size; code < end; ++code) {
+        if (fix_global(vm, list, bcnt, *code) != *code) {
+            return bfalse;
+        }
+    }
+    return btrue;
+}
+
+static void load_bytecode(bvm *vm, bcreader *rd, bproto *proto, int info, int version)
+{
+    int size = (int)load_long(rd);
     if (size) {
         binstruction *code, *end;
+        size_t len = sizeof(binstruction) * size;
         int bcnt = be_builtin_count(vm);
         blist *list = var_toobj(be_indexof(vm, info));
         be_assert(be_islist(vm, info));
-        proto->code = be_malloc(vm, sizeof(binstruction) * size);
+        if (version >= BYTECODE_ALIGN) { /* skip padding */
+            uint8_t pad[4];
+            load_read(rd, pad, (0 - rd->offset) & 3);
+        }
+        if (code_inplace(vm, rd, list, bcnt, size)) {
+            proto->code = (binstruction *)(rd->data + rd->pos);
+            proto->codesize = size;
+            proto->varg |= BE_VA_SHARED_CODE;
+            rd->pos += len;
+            rd->offset += len;
+            return;
+        }
+        proto->code = be_malloc(vm, len);
         proto->codesize = size;
-        code = proto->code;
-        for (end = code + size; code < end; ++code) {
-            binstruction ins = (binstruction)load_long(fp);
-            binstruction op = IGET_OP(ins);
-            /* fix global variable index */
-            if (op == OP_GETGBL || op == OP_SETGBL) {
-                int idx = IGET_Bx(ins);
-                if (idx >= bcnt) { /* does not fix builtin index */
-                    bvalue *name = be_list_at(list, idx - bcnt);
-                    idx = be_global_find(vm, var_tostr(name));
-                    ins = (ins & ~IBx_MASK) | ISET_Bx(idx);
-                }
-            }
-            *code = ins;
+        load_read(rd, proto->code, len); /* read all instructions at once, then decode in place */
+        for (code = proto->code, end = code + size; code < end; ++code) {
+            const uint8_t *p = (const uint8_t *)code;
+            binstruction ins = ((binstruction)p[3] << 24)
+                | ((binstruction)p[2] << 16)
+                | ((binstruction)p[1] << 8)
+                | p[0];
+            *code = fix_global(vm, list, bcnt, ins);
         }
     }
 }
 
-static void load_constant(bvm *vm, void *fp, bproto *proto, int version)
+static void load_constant(bvm *vm, bcreader *rd, bproto *proto, int version)
 {
-    int size = (int)load_long(fp); /* nconst */
+    int size = (int)load_long(rd); /* nconst */
     if (size) {
         bvalue *end, *v = be_malloc(vm, sizeof(bvalue) * size);
         memset(v, 0, sizeof(bvalue) * size);
         proto->ktab = v;
         proto->nconst = size;
         for (end = v + size; v < end; ++v) {
-            load_value(vm, fp, v, version);
+            load_value(vm, rd, v, version);
         }
     }
 }
 
-static void load_proto_table(bvm *vm, void *fp, bproto *proto, int info, int version)
+static void load_proto_table(bvm *vm, bcreader *rd, bproto *proto, int info, int version)
 {
-    int size = (int)load_long(fp); /* proto count */
+    int size = (int)load_long(rd); /* proto count */
     if (size) {
         bproto **p = be_malloc(vm, sizeof(bproto *) * size);
         memset(p, 0, sizeof(bproto *) * size);
         proto->ptab = p;
         proto->nproto = size;
         while (size--) {
-            load_proto(vm, fp, p++, info, version);
+            load_proto(vm, rd, p++, info, version);
         }
     }
 }
 
-static void load_upvals(bvm *vm, void *fp, bproto *proto)
+static void load_upvals(bvm *vm, bcreader *rd, bproto *proto)
 {
-    int size = (int)load_byte(fp);
+    int size = (int)load_byte(rd);
     if (size) {
         bupvaldesc *uv, *end;
         proto->upvals = be_malloc(vm, sizeof(bupvaldesc) * size);
         proto->nupvals = (bbyte)size;
         uv = proto->upvals;
         for (end = uv + size; uv < end; ++uv) {
-            uv->instack = load_byte(fp);
-            uv->idx = load_byte(fp);
+            uv->instack = load_byte(rd);
+            uv->idx = load_byte(rd);
         }
     }
 }
 
-static bbool load_proto(bvm *vm, void *fp, bproto **proto, int info, int version)
+static bbool load_proto(bvm *vm, bcreader *rd, bproto **proto, int info, int version)
 {
     /* first load the name */
     /* if empty, it's a static member so don't allocate an actual proto */
-    bstring *name = load_string(vm, fp);
+    bstring *name = load_string(vm, rd);
     if (str_len(name)) {
         *proto = be_newproto(vm);
         (*proto)->name = name;
 #if BE_DEBUG_SOURCE_FILE
-        (*proto)->source = load_string(vm, fp);
+        (*proto)->source = load_string(vm, rd);
 #else
-        load_string(vm, fp);    /* discard name */
+        load_string(vm, rd);    /* discard name */
 #endif
-        (*proto)->argc = load_byte(fp);
-        (*proto)->nstack = load_byte(fp);
+        (*proto)->argc = load_byte(rd);
+        (*proto)->nstack = load_byte(rd);
         if (version > 1) {
-            (*proto)->varg = load_byte(fp);
-            load_byte(fp); /* discard reserved byte */
+            (*proto)->varg = load_byte(rd) & ~BE_VA_SHARED_CODE;
+            load_byte(rd); /* discard reserved byte */
         }
-        load_bytecode(vm, fp, *proto, info);
-        load_constant(vm, fp, *proto, version);
-        load_proto_table(vm, fp, *proto, info, version);
-        load_upvals(vm, fp, *proto);
+        load_bytecode(vm, rd, *proto, info, version);
+        load_constant(vm, rd, *proto, version);
+        load_proto_table(vm, rd, *proto, info, version);
+        load_upvals(vm, rd, *proto);
         return btrue;
     }
     return bfalse;  /* no proto read */
 }
 
-void load_global_info(bvm *vm, void *fp)
+static void load_global_info(bvm *vm, bcreader *rd)
 {
     int i;
-    int bcnt = (int)load_long(fp); /* builtin count */
-    int gcnt = (int)load_long(fp); /* global count */
+    int bcnt = (int)load_long(rd); /* builtin count */
+    int gcnt = (int)load_long(rd); /* global count */
     if (bcnt > be_builtin_count(vm)) {
         bytecode_error(vm, be_pushfstring(vm,
             "inconsistent number of builtin objects."));
     }
     be_newlist(vm);
     for (i = 0; i < gcnt; ++i) {
-        bstring *name = cache_string(vm, fp);
+        bstring *name = cache_string(vm, rd);
         be_global_new(vm, name);
         be_data_push(vm, -2); /* push the variable name to list */
         be_stackpop(vm, 1); /* pop the cached string */
@@ -596,17 +710,16 @@ void load_global_info(bvm *vm, void *fp)
     be_global_release_space(vm);
 }
 
-bclosure* be_bytecode_load_from_fs(bvm *vm, void *fp)
+static bclosure* load_image(bvm *vm, bcreader *rd)
 {
-    int version = load_head(fp);
-    if (version == BYTECODE_VERSION) {
+    int version = load_head(rd);
+    if (version >= BYTECODE_VERSION_MIN && version <= BYTECODE_VERSION) {
         bclosure *cl = be_newclosure(vm, 0);
         var_setclosure(vm->top, cl);
         be_stackpush(vm);
-        load_global_info(vm, fp);
-        load_proto(vm, fp, &cl->proto, -1, version);
+        load_global_info(vm, rd);
+        load_proto(vm, rd, &cl->proto, -1, version);
         be_stackpop(vm, 2); /* pop the closure and list */
-        be_fclose(fp);
         return cl;
     }
     bytecode_error(vm, be_pushfstring(vm,
@@ -614,6 +727,30 @@ bclosure* be_bytecode_load_from_fs(bvm *vm, void *fp)
     return NULL;
 }
 
+bclosure* be_bytecode_load_from_fs(bvm *vm, void *fp)
+{
+    bclosure *cl;
+    bcreader rd;
+    rd.fp = fp;
+    rd.data = rd.buffer;
+    rd.pos = rd.size = rd.offset = 0;
+    rd.inplace = bfalse;
+    cl = load_image(vm, &rd);
+    be_fclose(fp);
+    return cl;
+}
+
+bclosure* be_bytecode_load_from_mem(bvm *vm, const void *data, size_t size, bbool inplace)
+{
+    bcreader rd;
+    rd.fp = NULL;
+    rd.data = data;
+    rd.pos = rd.offset = 0;
+    rd.size = size;
+    rd.inplace = inplace;
+    return load_image(vm, &rd);
+}
+
 bclosure* be_bytecode_load(bvm *vm, const char *filename)
 {
     void *fp = be_fopen(filename, "rb");
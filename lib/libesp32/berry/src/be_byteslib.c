@@ -848,6 +848,35 @@ static int m_add(bvm *vm)
     be_return_nil(vm);
 }
 
+/* read an int of `vsize` bytes, negative for big endian, see `get()` */
+static int buf_get_sized(bvm *vm, buf_impl* attr, int32_t idx, int vsize, bbool sign)
+{
+    int ret = 0;
+    switch (vsize) {
+        case 0:                                     break;
+        case -1:    /* fallback below */
+        case 1:     ret = buf_get1(attr, idx);
+                    if (sign) { ret = (int8_t)(uint8_t) ret; }
+                    break;
+        case 2:     ret = buf_get2_le(attr, idx);
+                    if (sign) { ret = (int16_t)(uint16_t) ret; }
+                    break;
+        case 3:     ret = buf_get3_le(attr, idx);
+                    if (sign & (ret & 0x800000)) { ret = ret | 0xFF000000; }
+                    break;
+        case 4:     ret = buf_get4_le(attr, idx);    break;
+        case -2:    ret = buf_get2_be(attr, idx);
+                    if (sign) { ret = (int16_t)(uint16_t) ret; }
+                    break;
+        case -3:    ret = buf_get3_be(attr, idx);
+                    if (sign & (ret & 0x800000)) { ret = ret | 0xFF000000; }
+                    break;
+        case -4:    ret = buf_get4_be(attr, idx);    break;
+        default:    be_raise(vm, "type_error", "size must be -4, -3, -2, -1, 0, 1, 2, 3 or 4.");
+    }
+    return ret;
+}
+
 /*
  * Get an int made of 1, 2 or 4 bytes, in little or big endian
  * `get(index:int[, size:int = 1]) -> int`
@@ -867,29 +896,7 @@ static int m_get(bvm *vm, bbool sign)
         if (argc >= 3 && be_isint(vm, 3)) {
             vsize = be_toint(vm, 3);
         }
-        int ret = 0;
-        switch (vsize) {
-            case 0:                                     break;
-            case -1:    /* fallback below */
-            case 1:     ret = buf_get1(&attr, idx);
-                        if (sign) { ret = (int8_t)(uint8_t) ret; }
-                        break;
-            case 2:     ret = buf_get2_le(&attr, idx);
-                        if (sign) { ret = (int16_t)(uint16_t) ret; }
-                        break;
-            case 3:     ret = buf_get3_le(&attr, idx);
-                        if (sign & (ret & 0x800000)) { ret = ret | 0xFF000000; }
-                        break;
-            case 4:     ret = buf_get4_le(&attr, idx);    break;
-            case -2:    ret = buf_get2_be(&attr, idx);
-                        if (sign) { ret = (int16_t)(uint16_t) ret; }
-                        break;
-            case -3:    ret = buf_get3_be(&attr, idx);
-                        if (sign & (ret & 0x800000)) { ret = ret | 0xFF000000; }
-                        break;
-            case -4:    ret = buf_get4_be(&attr, idx);    break;
-            default:    be_raise(vm, "type_error", "size must be -4, -3, -2, -1, 0, 1, 2, 3 or 4.");
-        }
+        int ret = buf_get_sized(vm, &attr, idx, vsize, sign);
         be_pop(vm, argc - 1);
         if (vsize != 0) {
             be_pushint(vm, ret);
@@ -1131,6 +1138,395 @@ static int m_reverse(bvm *vm)
     be_return(vm);
 }
 
+/********************************************************************
+** Vector operations on unsigned lanes of 1 or 2 bytes
+**
+** 1-byte lanes are processed 4 at a time in 32 bits words (SWAR),
+** 2-byte lanes are processed one at a time in little or big endian
+********************************************************************/
+enum { VEC_ADD, VEC_SUB, VEC_XOR, VEC_BLEND, VEC_SCALE, VEC_CLAMP };
+
+#define SWAR_HIGH       0x80808080U     /* high bit of each lane */
+#define SWAR_LOW        0x7F7F7F7FU     /* other bits of each lane */
+#define SWAR_EVEN       0x00FF00FFU     /* even lanes */
+#define SWAR_BYTE(v)    ((uint32_t)(v) * 0x01010101U)
+
+/* 0xFF in each lane whose high bit is set in `h` */
+static inline uint32_t swar_mask(uint32_t h)
+{
+    return (h << 1) - (h >> 7);
+}
+
+/* a + b, saturated to 0xFF */
+static inline uint32_t swar_addsat(uint32_t a, uint32_t b)
+{
+    uint32_t s = ((a & SWAR_LOW) + (b & SWAR_LOW)) ^ ((a ^ b) & SWAR_HIGH);
+    uint32_t carry = ((a & b) | ((a | b) & ~s)) & SWAR_HIGH;
+    return s | swar_mask(carry);
+}
+
+/* a - b, saturated to 0 */
+static inline uint32_t swar_subsat(uint32_t a, uint32_t b)
+{
+    uint32_t d = ((a | SWAR_HIGH) - (b & SWAR_LOW)) ^ ((a ^ ~b) & SWAR_HIGH);
+    uint32_t borrow = ((~a & b) | ((~a | b) & d)) & SWAR_HIGH;
+    return d & ~swar_mask(borrow);
+}
+
+/* (a * (256 - alpha) + b * alpha) >> 8, with alpha in 0..256, in two 16 bits lanes */
+static inline uint32_t swar_blend(uint32_t a, uint32_t b, uint32_t alpha)
+{
+    uint32_t even = ((a & SWAR_EVEN) * (256 - alpha) + (b & SWAR_EVEN) * alpha) >> 8;
+    uint32_t odd = ((a >> 8) & SWAR_EVEN) * (256 - alpha) + ((b >> 8) & SWAR_EVEN) * alpha;
+    return (even & SWAR_EVEN) | (odd & ~SWAR_EVEN);
+}
+
+/* min(max(a, lo), hi), without carry between lanes since results stay in range */
+static inline uint32_t swar_clamp(uint32_t a, uint32_t lo, uint32_t hi)
+{
+    uint32_t x = swar_subsat(a, lo) + lo;
+    return x - swar_subsat(x, hi);
+}
+
+static uint32_t swar_op(int op, uint32_t a, uint32_t b, uint32_t c)
+{
+    switch (op) {
+    case VEC_ADD: return swar_addsat(a, b);
+    case VEC_SUB: return swar_subsat(a, b);
+    case VEC_XOR: return a ^ b;
+    case VEC_BLEND: return swar_blend(a, b, c);
+    case VEC_SCALE: return swar_blend(a, 0, 256 - c);
+    default: return swar_clamp(a, b, c);
+    }
+}
+
+/* apply `f(a, b)` to each aligned word `a` of `dst`, `b` is the next word of `src` or `k` */
+#define SWAR_LOOP(f) \
+    for (; n >= 4; n -= 4, dst += 4) { \
+        uint32_t a = *(uint32_t*)dst, b = k; \
+        if (src) { memcpy(&b, src, 4); src += 4; } \
+        *(uint32_t*)dst = f; \
+    }
+
+/* apply `op` to `n` bytes of `dst` with the bytes of `src`, or the constant byte `k` if `src` is NULL */
+static void swar_apply(int op, uint8_t *dst, const uint8_t *src, size_t n, uint32_t k, uint32_t c)
+{
+    k = SWAR_BYTE(k & 0xFF);
+    if (op == VEC_CLAMP) {
+        c = SWAR_BYTE(c & 0xFF);
+    }
+    for (; n && ((uintptr_t)dst & 3); --n, ++dst) { /* lanes are independent, bytes use the same kernels */
+        *dst = (uint8_t)swar_op(op, *dst, src ? *src++ : k, c);
+    }
+    switch (op) {
+    case VEC_ADD: SWAR_LOOP(swar_addsat(a, b)); break;
+    case VEC_SUB: SWAR_LOOP(swar_subsat(a, b)); break;
+    case VEC_XOR: SWAR_LOOP(a ^ b); break;
+    case VEC_BLEND: SWAR_LOOP(swar_blend(a, b, c)); break;
+    case VEC_SCALE: SWAR_LOOP(swar_blend(a, 0, 256 - c)); break;
+    default: SWAR_LOOP(swar_clamp(a, b, c)); break;
+    }
+    for (; n; --n, ++dst) {
+        *dst = (uint8_t)swar_op(op, *dst, src ? *src++ : k, c);
+    }
+}
+
+static uint32_t lane_op(int op, uint32_t a, uint32_t b, uint32_t c, uint32_t max)
+{
+    switch (op) {
+    case VEC_ADD: return a + b > max ? max : a + b;
+    case VEC_SUB: return a > b ? a - b : 0;
+    case VEC_XOR: return (a ^ b) & max;
+    case VEC_BLEND: return (a * (256 - c) + b * c) >> 8;
+    case VEC_SCALE: a = (a * c) >> 8; return a > max ? max : a;
+    default: a = a < b ? b : a; return a > c ? c : a;
+    }
+}
+
+/* apply `op` to the lanes of `attr`, with the lanes of `src` or the constant `k` */
+static void vector_apply(buf_impl *attr, int op, const uint8_t *src, size_t src_len, uint32_t k, uint32_t c, int vsize)
+{
+    size_t i, n = attr->len;
+    if (src && src_len < n) { n = src_len; }
+    if (vsize == 1 && !(op == VEC_SCALE && c > 256)) {
+        swar_apply(op, attr->bufptr, src, n, k, c);
+    } else if (vsize == 1) { /* scale up, saturated */
+        for (i = 0; i < n; i++) {
+            attr->bufptr[i] = (uint8_t)lane_op(op, attr->bufptr[i], 0, c, 0xFF);
+        }
+    } else {
+        bbool be = vsize < 0;
+        for (i = 0; i + 1 < n; i += 2) {
+            uint8_t *p = attr->bufptr + i;
+            uint32_t a = be ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+            uint32_t b = k;
+            if (src) {
+                b = be ? (src[i] << 8) | src[i+1] : src[i] | (src[i+1] << 8);
+            }
+            a = lane_op(op, a, b, c, 0xFFFF);
+            p[be ? 1 : 0] = a & 0xFF;
+            p[be ? 0 : 1] = (a >> 8) & 0xFF;
+        }
+    }
+}
+
+/* lane size at argument `idx`: 1 (default) for bytes, 2 or -2 for 16 bits little or big endian */
+static int vector_size(bvm *vm, int idx)
+{
+    int vsize = 1;
+    if (be_top(vm) >= idx && be_isint(vm, idx)) {
+        vsize = be_toint(vm, idx);
+    }
+    if (vsize != 1 && vsize != 2 && vsize != -2) {
+        be_raise(vm, "type_error", "size must be 1, 2 or -2");
+    }
+    return vsize;
+}
+
+/* int argument clamped to 0..max */
+static uint32_t vector_int(bvm *vm, int idx, uint32_t max)
+{
+    if (be_top(vm) < idx || !be_isint(vm, idx)) {
+        be_raise(vm, "type_error", "argument must be int");
+    }
+    int32_t v = be_toint(vm, idx);
+    return v < 0 ? 0 : ((uint32_t)v > max ? max : (uint32_t)v);
+}
+
+/*
+ * Element-wise operation with an int or the matching lanes of another bytes buffer
+ * `<op>(operand:int or bytes [, alpha:int] [, size:int]) -> self`
+ */
+static int m_vector_binary(bvm *vm, int op)
+{
+    buf_impl attr = m_read_attributes(vm, 1);
+    check_ptr(vm, &attr);
+    int extra = (op == VEC_BLEND);
+    int vsize = vector_size(vm, 3 + extra);
+    uint32_t max = (vsize == 1) ? 0xFF : 0xFFFF;
+    uint32_t k = 0, c = extra ? vector_int(vm, 3, 256) : 0;
+    const uint8_t *src = NULL;
+    size_t src_len = 0;
+    if (be_top(vm) >= 2 && be_isbytes(vm, 2)) {
+        src = (const uint8_t*) be_tobytes(vm, 2, &src_len);
+    } else {
+        k = vector_int(vm, 2, max);
+    }
+    vector_apply(&attr, op, src, src_len, k, c, vsize);
+    be_pushvalue(vm, 1);    /* push bytes object */
+    be_return(vm);
+}
+
+/*
+ * Saturated add, subtract, and xor
+ * `vadd(v:int or bytes [, size:int]) -> self`
+ */
+static int m_vadd(bvm *vm)
+{
+    return m_vector_binary(vm, VEC_ADD);
+}
+
+static int m_vsub(bvm *vm)
+{
+    return m_vector_binary(vm, VEC_SUB);
+}
+
+static int m_vxor(bvm *vm)
+{
+    return m_vector_binary(vm, VEC_XOR);
+}
+
+/*
+ * Blend with `v`, alpha from 0 (self unchanged) to 256 (replaced with `v`)
+ * `vblend(v:int or bytes, alpha:int [, size:int]) -> self`
+ */
+static int m_vblend(bvm *vm)
+{
+    return m_vector_binary(vm, VEC_BLEND);
+}
+
+/*
+ * Scale each lane by factor/256, saturated, i.e. 128 halves the values
+ * `vscale(factor:int [, size:int]) -> self`
+ */
+static int m_vscale(bvm *vm)
+{
+    buf_impl attr = m_read_attributes(vm, 1);
+    check_ptr(vm, &attr);
+    int vsize = vector_size(vm, 3);
+    vector_apply(&attr, VEC_SCALE, NULL, 0, 0, vector_int(vm, 2, 0xFFFF), vsize);
+    be_pushvalue(vm, 1);    /* push bytes object */
+    be_return(vm);
+}
+
+/*
+ * Clamp each lane between `min` and `max`
+ * `vclamp(min:int, max:int [, size:int]) -> self`
+ */
+static int m_vclamp(bvm *vm)
+{
+    buf_impl attr = m_read_attributes(vm, 1);
+    check_ptr(vm, &attr);
+    int vsize = vector_size(vm, 4);
+    uint32_t max = (vsize == 1) ? 0xFF : 0xFFFF;
+    vector_apply(&attr, VEC_CLAMP, NULL, 0, vector_int(vm, 2, max), vector_int(vm, 3, max), vsize);
+    be_pushvalue(vm, 1);    /* push bytes object */
+    be_return(vm);
+}
+
+/*
+ * Fill with a byte value or repeat a pattern, e.g. the 3 bytes of a RGB color
+ * `fill(v:int or bytes [, index:int, len:int]) -> self`
+ */
+static int m_fill(bvm *vm)
+{
+    int argc = be_top(vm);
+    buf_impl attr = m_read_attributes(vm, 1);
+    check_ptr(vm, &attr);
+    int32_t idx = 0, len;
+    if (argc >= 3 && be_isint(vm, 3)) {
+        idx = be_toint(vm, 3);
+        if (idx < 0) { idx = 0; }
+        if (idx > attr.len) { idx = attr.len; }
+    }
+    len = attr.len - idx;
+    if (argc >= 4 && be_isint(vm, 4)) {
+        int32_t l = be_toint(vm, 4);
+        if (l >= 0 && l < len) { len = l; }
+    }
+    uint8_t *p = attr.bufptr + idx;
+    if (argc >= 2 && be_isbytes(vm, 2)) {
+        size_t plen;
+        const uint8_t *pattern = (const uint8_t*) be_tobytes(vm, 2, &plen);
+        if (plen > 0 && len > 0) {
+            int32_t done = (int32_t)plen < len ? (int32_t)plen : len;
+            memmove(p, pattern, done);
+            while (done < len) { /* double the filled part each time */
+                int32_t chunk = done < len - done ? done : len - done;
+                memcpy(p + done, p, chunk);
+                done += chunk;
+            }
+        }
+    } else if (argc >= 2 && be_isint(vm, 2)) {
+        if (len > 0) { memset(p, be_toint(vm, 2), len); }
+    } else {
+        be_raise(vm, "type_error", "operand must be int or bytes");
+    }
+    be_pushvalue(vm, 1);    /* push bytes object */
+    be_return(vm);
+}
+
+/*
+ * Read `count` ints from `index` into a list, see `get()` for size
+ * `unpack(index:int, count:int [, size:int = 1, signed:bool = false]) -> list`
+ */
+static int m_unpack(bvm *vm)
+{
+    int argc = be_top(vm);
+    buf_impl attr = m_read_attributes(vm, 1);
+    check_ptr(vm, &attr);
+    if (argc < 3 || !be_isint(vm, 2) || !be_isint(vm, 3)) {
+        be_raise(vm, "type_error", "unpack(index:int, count:int [, size:int, signed:bool])");
+    }
+    int32_t idx = be_toint(vm, 2);
+    int32_t count = be_toint(vm, 3);
+    int vsize = (argc >= 4 && be_isint(vm, 4)) ? be_toint(vm, 4) : 1;
+    bbool sign = argc >= 5 && be_tobool(vm, 5);
+    int step = vsize < 0 ? -vsize : vsize;
+    if (vsize == 0 || step > 4) {
+        be_raise(vm, "type_error", "size must be -4, -3, -2, -1, 1, 2, 3 or 4.");
+    }
+    if (idx < 0) { idx = 0; }
+    if (count > (attr.len - idx) / step) { count = (attr.len - idx) / step; }
+    be_newobject(vm, "list");
+    for (int32_t i = 0; i < count; i++, idx += step) {
+        be_pushint(vm, buf_get_sized(vm, &attr, idx, vsize, sign));
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_return(vm);
+}
+
+/* min, max and sum of 1-byte lanes, a word at a time */
+static void swar_reduce(const uint8_t *p, size_t n, uint32_t *pmin, uint32_t *pmax, uint32_t *psum)
+{
+    uint32_t wmin = 0xFFFFFFFFU, wmax = 0, min = 0xFF, max = 0, sum = 0;
+    for (; n && ((uintptr_t)p & 3); --n, ++p) {
+        if (*p < min) { min = *p; }
+        if (*p > max) { max = *p; }
+        sum += *p;
+    }
+    while (n >= 4) {
+        /* the two 16 bits lanes of `acc` can hold the sums of 128 words */
+        size_t words = n / 4 > 128 ? 128 : n / 4;
+        uint32_t acc = 0;
+        for (n -= words * 4; words; --words, p += 4) {
+            uint32_t w = *(const uint32_t*)p;
+            wmin -= swar_subsat(wmin, w);
+            wmax += swar_subsat(w, wmax);
+            acc += (w & SWAR_EVEN) + ((w >> 8) & SWAR_EVEN);
+        }
+        sum += (acc & 0xFFFF) + (acc >> 16);
+    }
+    for (; n; --n, ++p) {
+        if (*p < min) { min = *p; }
+        if (*p > max) { max = *p; }
+        sum += *p;
+    }
+    for (int i = 0; i < 4; i++, wmin >>= 8, wmax >>= 8) {
+        if ((wmin & 0xFF) < min) { min = wmin & 0xFF; }
+        if ((wmax & 0xFF) > max) { max = wmax & 0xFF; }
+    }
+    *pmin = min;
+    *pmax = max;
+    *psum = sum;
+}
+
+enum { VEC_MIN, VEC_MAX, VEC_SUM };
+
+/*
+ * Minimum, maximum or sum of the lanes, nil if empty
+ * `vmin([size:int]) -> int`
+ */
+static int m_vector_reduce(bvm *vm, int op)
+{
+    buf_impl attr = m_read_attributes(vm, 1);
+    check_ptr(vm, &attr);
+    int vsize = vector_size(vm, 2);
+    uint32_t res[3] = { 0xFFFF, 0, 0 };  /* min, max, sum */
+    if (attr.len < (vsize == 1 ? 1 : 2)) {
+        be_return_nil(vm);
+    }
+    if (vsize == 1) {
+        swar_reduce(attr.bufptr, attr.len, &res[VEC_MIN], &res[VEC_MAX], &res[VEC_SUM]);
+    } else {
+        for (int32_t i = 0; i + 1 < attr.len; i += 2) {
+            uint32_t v = (vsize < 0) ? buf_get2_be(&attr, i) : buf_get2_le(&attr, i);
+            if (v < res[VEC_MIN]) { res[VEC_MIN] = v; }
+            if (v > res[VEC_MAX]) { res[VEC_MAX] = v; }
+            res[VEC_SUM] += v;
+        }
+    }
+    be_pushint(vm, res[op]);
+    be_return(vm);
+}
+
+static int m_vmin(bvm *vm)
+{
+    return m_vector_reduce(vm, VEC_MIN);
+}
+
+static int m_vmax(bvm *vm)
+{
+    return m_vector_reduce(vm, VEC_MAX);
+}
+
+static int m_vsum(bvm *vm)
+{
+    return m_vector_reduce(vm, VEC_SUM);
+}
+
 static int m_setitem(bvm *vm)
 {
     int argc = be_top(vm);
@@ -1794,6 +2190,17 @@ void be_load_byteslib(bvm *vm)
         { "resize", m_resize },
         { "clear", m_clear },
         { "reverse", m_reverse },
+        { "fill", m_fill },
+        { "unpack", m_unpack },
+        { "vadd", m_vadd },
+        { "vsub", m_vsub },
+        { "vxor", m_vxor },
+        { "vblend", m_vblend },
+        { "vscale", m_vscale },
+        { "vclamp", m_vclamp },
+        { "vmin", m_vmin },
+        { "vmax", m_vmax },
+        { "vsum", m_vsum },
         { "copy", m_copy },
         { "append", m_connect },
         { "+", m_merge },
@@ -1843,6 +2250,17 @@ class be_class_bytes (scope: global, name: bytes) {
     resize, func(m_resize)
     clear, func(m_clear)
     reverse, func(m_reverse)
+    fill, func(m_fill)
+    unpack, func(m_unpack)
+    vadd, func(m_vadd)
+    vsub, func(m_vsub)
+    vxor, func(m_vxor)
+    vblend, func(m_vblend)
+    vscale, func(m_vscale)
+    vclamp, func(m_vclamp)
+    vmin, func(m_vmin)
+    vmax, func(m_vmax)
+    vsum, func(m_vsum)
     copy, func(m_copy)
     append, func(m_connect)
     +, func(m_merge)
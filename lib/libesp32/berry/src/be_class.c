@@ -15,7 +15,9 @@
 #include "be_module.h"
 #include <string.h>
 
+/* members are about to be added, the map may be resized so cached lookups are flushed */
 #define check_members(vm, c)            \
+    be_vm_mbrcache_flush(vm);           \
     if (!(c)->members) {                \
         (c)->members = be_map_new(vm);  \
     }
@@ -40,6 +42,7 @@ void be_class_compress(bvm *vm, bclass *c)
 {
     if (!gc_isconst(c) && c->members) {
         be_map_compact(vm, c->members); /* clear space */
+        be_vm_mbrcache_flush(vm);
     }
 }
 
@@ -210,6 +213,7 @@ static binstance* newobject(bvm *vm, bclass *c)
     be_incrtop(vm); /* protect new objects from GC */
     for (c = c->super; c; c = c->super) {  /* initialize one instance object per class and per superclass */
         prev->super = newobjself(vm, c);
+        be_gc_barrierback(vm, prev);  /* `prev` may be scanned while `super` is allocated */
         prev->super->sub = prev;  /* link the super/sub classes instances */
         prev = prev->super;
     }
@@ -241,6 +245,25 @@ bbool be_class_newobj(bvm *vm, bclass *c, int pos, int argc, int mode)
     return bfalse;
 }
 
+/* Find instance member by name, do not look into virtual members */
+/* Returns the value in the class map, which is the variable index for instance variables, */
+/* and sets `depth` to the number of superinstances walked, or returns NULL if not found */
+bvalue* be_instance_member_slot(bvm *vm, binstance *instance, bstring *name, int *depth)
+{
+    int d = 0;
+    for (; instance; instance = instance->super, ++d) {
+        bmap *members = instance->_class->members;
+        if (members) {
+            bvalue *v = be_map_findstr(vm, members, name);
+            if (v) {
+                *depth = d;
+                return v;
+            }
+        }
+    }
+    return NULL;
+}
+
 /* Find instance member by name and copy value to `dst` */
 /* Do not look into virtual members */
 int be_instance_member_simple(bvm *vm, binstance *instance, bstring *name, bvalue *dst)
@@ -323,6 +346,7 @@ bbool be_instance_setmember(bvm *vm, binstance *o, bstring *name, bvalue *src)
     be_assert(name != NULL);
     binstance * obj = instance_member(vm, o, name, &v);
     if (obj && var_istype(&v, MT_VARIABLE)) {
+        be_gc_barrierback(vm, obj);
         obj->members[var_toint(&v)] = *src;
         return btrue;
     } else {
@@ -61,6 +61,7 @@ bbool be_class_setmember(bvm *vm, bclass *obj, bstring *name, bvalue *src);
 int be_class_closure_count(bclass *c);
 void be_class_upvalue_init(bvm *vm, bclass *c);
 bbool be_class_newobj(bvm *vm, bclass *c, int pos, int argc, int mode);
+bvalue* be_instance_member_slot(bvm *vm, binstance *instance, bstring *name, int *depth);
 int be_instance_member_simple(bvm *vm, binstance *obj, bstring *name, bvalue *dst);
 int be_instance_member(bvm *vm, binstance *obj, bstring *name, bvalue *dst);
 bbool be_instance_setmember(bvm *vm, binstance *obj, bstring *name, bvalue *src);
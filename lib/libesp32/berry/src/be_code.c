@@ -14,15 +14,18 @@
 #include "be_var.h"
 #include "be_exec.h"
 #include "be_vm.h"
+#include "be_mem.h"
 
 #define NOT_MASK                (1 << 0)
 #define NOT_EXPR                (1 << 1)
+#define FOLDED_EXPR             (1 << 2)            /* literal computed from an expression */
 #define FUNC_RET_FLAG           (1 << 0)
 
 #define isset(v, mask)          (((v) & (mask)) != 0)
 #define min(a, b)               ((a) < (b) ? (a) : (b))
 #define notexpr(e)              isset((e)->not, NOT_EXPR)
 #define notmask(e)              isset((e)->not, NOT_MASK)
+#define foldedexpr(e)           isset((e)->not, FOLDED_EXPR)
 #define exp2anyreg(f, e)        exp2reg(f, e, -1)   /* -1 means allocate a new register if needed */
 #define var2anyreg(f, e)        var2reg(f, e, -1)   /* -1 means allocate a new register if needed */
 #define hasjump(e)              ((e)->t != (e)->f || notexpr(e))
@@ -30,6 +33,10 @@
 #define code_call(f, a, b)      codeABC(f, OP_CALL, a, b, 0)
 #define code_getmbr(f, a, b, c) codeABC(f, OP_GETMBR, a, b, c)
 #define jumpboolop(e, b)        ((b) != notmask(e) ? OP_JMPT : OP_JMPF)
+#define isliteral(e)            (((e)->type == ETINT || (e)->type == ETREAL || (e)->type == ETSTRING) && !hasjump(e))
+
+#define FOLD_IMAX               0x7FFFFFFF          /* range of folded ints */
+#define FOLD_IMIN               (-FOLD_IMAX - 1)
 
 #if BE_USE_SCRIPT_COMPILER
 
@@ -87,7 +94,7 @@ static bbool code_move(bfuncinfo *finfo, int a, int b)
     if (finfo->pc > finfo->binfo->lastjmp) {  /* If not the first instruction of the function */
         binstruction *i = be_vector_end(&finfo->code);  /* get the last instruction */
         bopcode op = IGET_OP(*i);
-        if (op <= OP_LDNIL) { /* binop or unop */
+        if (op <= OP_LDNIL && b >= be_list_count(finfo->local)) { /* binop or unop to a temporary register */
             /* remove redundant MOVE instruction */
             int x = IGET_RA(*i), y = IGET_RKB(*i), z = IGET_RKC(*i);
             if (b == x && (a == y || (op < OP_NEG && a == z))) {
@@ -111,6 +118,37 @@ static bbool code_move(bfuncinfo *finfo, int a, int b)
     return bfalse;
 }
 
+/* Change the destination of the last instruction from the temporary register b to a */
+/* Only for instructions that write R(A) and nothing else, b must not be read afterwards */
+/* returns true if the instruction was changed and no MOVE is needed */
+static bbool code_retarget(bfuncinfo *finfo, int a, int b)
+{
+    if (finfo->pc > finfo->binfo->lastjmp && b >= be_list_count(finfo->local)) {
+        binstruction *i = be_vector_end(&finfo->code);  /* get the last instruction */
+        if (IGET_RA(*i) != b) {
+            return bfalse;
+        }
+        switch (IGET_OP(*i)) {
+        case OP_LDBOOL:
+            if (IGET_RKC(*i)) { /* skips the next instruction */
+                return bfalse;
+            }
+            /* fall through */
+        case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV: case OP_MOD:
+        case OP_LT: case OP_LE: case OP_EQ: case OP_NE: case OP_GT: case OP_GE:
+        case OP_AND: case OP_OR: case OP_XOR: case OP_SHL: case OP_SHR:
+        case OP_CONNECT: case OP_NEG: case OP_FLIP: case OP_LDNIL:
+        case OP_LDINT: case OP_LDCONST: case OP_MOVE: case OP_GETGBL:
+        case OP_GETNGBL: case OP_GETUPV: case OP_GETMBR: case OP_GETIDX:
+            *i = (*i & ~IRA_MASK) | ISET_RA(a);
+            return btrue;
+        default:
+            break;
+        }
+    }
+    return bfalse;
+}
+
 /* Free register at top (checks that it´s a register) */
 /* Warning: the register must be at top of stack */
 static void free_expreg(bfuncinfo *finfo, bexpdesc *e)
@@ -534,14 +572,108 @@ static int codedestreg(bfuncinfo *finfo, bexpdesc *e1, bexpdesc *e2, int dst)
 /* On exit, e1 is guaranteed to be ETREG, which may have been allocated */
 static void binaryexp(bfuncinfo *finfo, bopcode op, bexpdesc *e1, bexpdesc *e2, int dst)
 {
-    int src1 = exp2reg(finfo, e1, dst);  /* potentially force the target for src1 reg */
-    int src2 = exp2anyreg(finfo, e2);
+    int src1, src2;
+    if (isliteral(e1)) {  /* e1 was not loaded by `be_code_prebinop()`, e2 is at top */
+        src2 = exp2anyreg(finfo, e2);
+        src1 = exp2reg(finfo, e1, dst);
+    } else {
+        src1 = exp2reg(finfo, e1, dst);  /* potentially force the target for src1 reg */
+        src2 = exp2anyreg(finfo, e2);
+    }
     dst = codedestreg(finfo, e1, e2, dst);
     codeABC(finfo, op, dst, src1, src2);
     e1->type = ETREG;
     e1->v.idx = dst; /* update register as output */
 }
 
+/* Compute int binary operator at compile time, only if the VM gives the same result */
+/* Operands and result are kept in 32 bits range to get the same result on all targets */
+static bbool fold_int(int op, bint x, bint y, bexpdesc *e)
+{
+    long long r;
+    if (x < FOLD_IMIN || x > FOLD_IMAX || y < FOLD_IMIN || y > FOLD_IMAX) {
+        return bfalse;
+    }
+    switch (op) {
+    case OptAdd: r = (long long)x + y; break;
+    case OptSub: r = (long long)x - y; break;
+    case OptMul: r = (long long)x * y; break;
+    case OptDiv: if (y == 0) { return bfalse; } r = (long long)x / y; break; /* keep the runtime error */
+    case OptMod: if (y == 0 || y == -1) { return bfalse; } r = (long long)x % y; break;
+    case OptBitAnd: r = x & y; break;
+    case OptBitOr: r = x | y; break;
+    case OptBitXor: r = x ^ y; break;
+    case OptShiftL: if (y < 0 || y > 30) { return bfalse; } r = (long long)x << y; break;
+    case OptShiftR: if (y < 0 || y > 31) { return bfalse; } r = x >> y; break;
+    case OptLT: e->type = ETBOOL; e->v.i = x < y; return btrue;
+    case OptLE: e->type = ETBOOL; e->v.i = x <= y; return btrue;
+    case OptEQ: e->type = ETBOOL; e->v.i = x == y; return btrue;
+    case OptNE: e->type = ETBOOL; e->v.i = x != y; return btrue;
+    case OptGT: e->type = ETBOOL; e->v.i = x > y; return btrue;
+    case OptGE: e->type = ETBOOL; e->v.i = x >= y; return btrue;
+    default: return bfalse;
+    }
+    if (r < FOLD_IMIN || r > FOLD_IMAX) {
+        return bfalse;
+    }
+    e->type = ETINT;
+    e->v.i = (bint)r;
+    return btrue;
+}
+
+/* Compute real binary operator at compile time, at least one operand is real */
+static bbool fold_real(int op, breal x, breal y, bexpdesc *e)
+{
+    breal r;
+    switch (op) {
+    case OptAdd: r = x + y; break;
+    case OptSub: r = x - y; break;
+    case OptMul: r = x * y; break;
+    case OptDiv: if (y == cast(breal, 0)) { return bfalse; } r = x / y; break; /* keep the runtime error */
+    case OptLT: e->type = ETBOOL; e->v.i = x < y; return btrue;
+    case OptLE: e->type = ETBOOL; e->v.i = x <= y; return btrue;
+    case OptEQ: e->type = ETBOOL; e->v.i = x == y; return btrue;
+    case OptNE: e->type = ETBOOL; e->v.i = x != y; return btrue;
+    case OptGT: e->type = ETBOOL; e->v.i = x > y; return btrue;
+    case OptGE: e->type = ETBOOL; e->v.i = x >= y; return btrue;
+    default: return bfalse;
+    }
+    e->type = ETREAL;
+    e->v.r = r;
+    return btrue;
+}
+
+/* Fold binary operator when both operands are literals, result in e1 */
+/* Returns false if the operation must be done at runtime (other types or runtime error) */
+static bbool fold_binop(bfuncinfo *finfo, int op, bexpdesc *e1, bexpdesc *e2)
+{
+    if (!isliteral(e1) || !isliteral(e2)) {
+        return bfalse;
+    }
+    if (e1->type == ETINT && e2->type == ETINT) {
+        return fold_int(op, e1->v.i, e2->v.i, e1);
+    }
+    if (e1->type == ETSTRING && e2->type == ETSTRING) {
+        switch (op) {
+        case OptAdd: case OptConnect:
+            e1->v.s = be_lexer_strcat(finfo->lexer, e1->v.s, e2->v.s);
+            return btrue;
+        case OptEQ: case OptNE:
+            e1->v.i = (op == OptEQ) == be_eqstr(e1->v.s, e2->v.s);
+            e1->type = ETBOOL;
+            return btrue;
+        default:
+            return bfalse;
+        }
+    }
+    if (e1->type != ETSTRING && e2->type != ETSTRING) {  /* int and real */
+        breal x = e1->type == ETREAL ? e1->v.r : cast(breal, e1->v.i);
+        breal y = e2->type == ETREAL ? e2->v.r : cast(breal, e2->v.i);
+        return fold_real(op, x, y, e1);
+    }
+    return bfalse;
+}
+
 void be_code_prebinop(bfuncinfo *finfo, int op, bexpdesc *e)
 {
     switch (op) {
@@ -552,7 +684,9 @@ void be_code_prebinop(bfuncinfo *finfo, int op, bexpdesc *e)
         be_code_jumpbool(finfo, e, btrue);
         break;
     default:
-        exp2anyreg(finfo, e);
+        if (!isliteral(e)) {  /* literals are loaded after the right operand, or folded */
+            exp2anyreg(finfo, e);
+        }
         break;
     }
 }
@@ -576,7 +710,11 @@ void be_code_binop(bfuncinfo *finfo, int op, bexpdesc *e1, bexpdesc *e2, int dst
     case OptNE: case OptGT: case OptGE: case OptConnect:
     case OptBitAnd: case OptBitOr: case OptBitXor:
     case OptShiftL: case OptShiftR:
-        binaryexp(finfo, (bopcode)(op - OptAdd), e1, e2, dst);
+        if (fold_binop(finfo, op, e1, e2)) {
+            e1->not |= FOLDED_EXPR;
+        } else {
+            binaryexp(finfo, (bopcode)(op - OptAdd), e1, e2, dst);
+        }
         break;
     default: break;
     }
@@ -626,7 +764,11 @@ static int code_neg(bfuncinfo *finfo, bexpdesc *e)
     case ETINT: e->v.i = -e->v.i; break;
     case ETREAL: e->v.r = -e->v.r; break;
     case ETNIL: case ETBOOL: case ETSTRING:
-        return 1; /* error */
+        if (!foldedexpr(e)) {
+            return 1; /* error */
+        }
+        /* a folded expression raises only if it runs, as before folding */
+        /* fall through */
     default:
         unaryexp(finfo, OP_NEG, e);
     }
@@ -639,7 +781,11 @@ static int code_flip(bfuncinfo *finfo, bexpdesc *e)
     switch (e->type) {
     case ETINT: e->v.i = ~e->v.i; break;
     case ETREAL: case ETNIL: case ETBOOL: case ETSTRING:
-        return 2; /* error */
+        if (!foldedexpr(e)) {
+            return 2; /* error */
+        }
+        /* a folded expression raises only if it runs, as before folding */
+        /* fall through */
     default:
         unaryexp(finfo, OP_FLIP, e);
     }
@@ -711,7 +857,8 @@ int be_code_setvar(bfuncinfo *finfo, bexpdesc *e1, bexpdesc *e2, bbool keep_reg)
     switch (e1->type) {
     case ETLOCAL: /* It can't be ETREG. */
         if (e1->v.idx != src) {
-            bbool reg_optimized = code_move(finfo, e1->v.idx, src); /* do explicit move only if needed */
+            bbool reg_optimized = (e2->type == ETREG && code_retarget(finfo, e1->v.idx, src)) ||
+                                  code_move(finfo, e1->v.idx, src); /* do explicit move only if needed */
             if (reg_optimized) {
                 free_expreg(finfo, e2); /* free source (checks only ETREG) */
                 *e2 = *e1;      /* now e2 is e1 ETLOCAL */
@@ -973,4 +1120,96 @@ void be_code_implicit_class(bfuncinfo *finfo, bexpdesc *e, bclass *c)
     e->v.idx = setK(idx);
 }
 
+/* Is the instruction a jump relative to the next instruction */
+static bbool isreljump(binstruction ins)
+{
+    bopcode op = IGET_OP(ins);
+    return op == OP_JMP || op == OP_JMPT || op == OP_JMPF
+        || (op == OP_EXBLK && IGET_RA(ins) == 0);
+}
+
+/* Does the instruction have no effect and can be removed */
+static bbool isnop(binstruction *code, int pc)
+{
+    binstruction ins = code[pc];
+    if (pc > 0) { /* never remove an instruction skipped by the previous one */
+        binstruction prev = code[pc - 1];
+        if (IGET_OP(prev) == OP_CATCH || (IGET_OP(prev) == OP_LDBOOL && IGET_RKC(prev))) {
+            return bfalse;
+        }
+    }
+    switch (IGET_OP(ins)) {
+    case OP_MOVE: return IGET_RA(ins) == IGET_RKB(ins);  /* move to itself */
+    case OP_JMP: return IGET_sBx(ins) == 0;              /* jump to next instruction */
+    default: return bfalse;
+    }
+}
+
+/* Peephole pass on the code of a finished function */
+/* Jumps to an unconditional jump are redirected to its final destination, */
+/* then the instructions without effect are removed and jumps are relocated */
+void be_code_peephole(bfuncinfo *finfo)
+{
+    binstruction *code = be_vector_data(&finfo->code);
+    int pc, n = finfo->pc, count = 0, *map;
+    for (pc = 0; pc < n; ++pc) {
+        bopcode op = IGET_OP(code[pc]);
+        if (op == OP_JMP || op == OP_JMPT || op == OP_JMPF) {
+            int dst = pc + 1 + IGET_sBx(code[pc]), hops = 0;
+            /* limit the hops, a chain of jumps can be a loop */
+            while (dst >= 0 && dst < n && IGET_OP(code[dst]) == OP_JMP && hops++ < 8) {
+                dst = dst + 1 + IGET_sBx(code[dst]);
+            }
+            setjump(finfo, pc, dst);
+        }
+        count += isnop(code, pc);
+    }
+    if (count == 0) {
+        return;
+    }
+    /* map[pc] is the new position of the instruction, or of the next one if removed */
+    map = be_malloc(finfo->lexer->vm, sizeof(int) * ((size_t)n + 1));
+    for (pc = 0, count = 0; pc < n; ++pc) {
+        map[pc] = count;
+        count += !isnop(code, pc);
+    }
+    map[n] = count;
+    for (pc = 0; pc < n; ++pc) {
+        binstruction ins = code[pc];
+        if (map[pc + 1] == map[pc]) {
+            continue; /* removed */
+        }
+        if (isreljump(ins)) {
+            int dst = pc + 1 + IGET_sBx(ins);
+            dst = dst < 0 ? 0 : dst > n ? n : dst;
+            ins = (ins & ~IBx_MASK) | ISET_sBx(map[dst] - (map[pc] + 1));
+        }
+        code[map[pc]] = ins;
+    }
+#if BE_DEBUG_RUNTIME_INFO
+    {
+        blineinfo *li = be_vector_data(&finfo->linevec);
+        blineinfo *end = li + be_vector_count(&finfo->linevec);
+        for (; li < end; ++li) { /* endpc is the last instruction of the line */
+            int e = li->endpc + 1;
+            e = map[e > n ? n : e] - 1;
+            li->endpc = e < 0 ? 0 : e;
+        }
+    }
+#endif
+#if BE_DEBUG_VAR_INFO
+    {
+        bvarinfo *vi = be_vector_data(&finfo->varvec);
+        bvarinfo *end = vi + be_vector_count(&finfo->varvec);
+        for (; vi < end; ++vi) {
+            vi->beginpc = map[vi->beginpc > n ? n : vi->beginpc];
+            vi->endpc = map[vi->endpc > n ? n : vi->endpc];
+        }
+    }
+#endif
+    be_free(finfo->lexer->vm, map, sizeof(int) * ((size_t)n + 1));
+    be_vector_resize(finfo->lexer->vm, &finfo->code, count);
+    finfo->pc = count;
+}
+
 #endif
@@ -201,6 +201,10 @@ static int m_counters(bvm *vm)
     map_insert(vm, "call", vm->counter_call);
     map_insert(vm, "get", vm->counter_get);
     map_insert(vm, "set", vm->counter_set);
+#if BE_USE_MEMBER_CACHE
+    map_insert(vm, "mbrcache_hit", vm->counter_mbrcache_hit);
+    map_insert(vm, "mbrcache_miss", vm->counter_mbrcache_miss);
+#endif
     map_insert(vm, "getgbl", vm->counter_get_global);
     map_insert(vm, "try", vm->counter_try);
     map_insert(vm, "raise", vm->counter_exc);
@@ -260,6 +260,37 @@ static int load_bytecode(bvm *vm, const char *name)
     return res;
 }
 
+struct bytecodebuf {
+    const void *data;
+    size_t size;
+    bbool inplace;
+};
+
+static void bytecode_buffer_loader(bvm *vm, void *data)
+{
+    struct bytecodebuf *buf = cast(struct bytecodebuf*, data);
+    bclosure *cl = be_bytecode_load_from_mem(vm, buf->data, buf->size, buf->inplace);
+    var_setclosure(vm->top, cl);
+    be_incrtop(vm);
+}
+
+/* load bytecode from memory */
+BERRY_API int be_loadbytecode(bvm *vm, const void *data, size_t size, bbool inplace)
+{
+    int res;
+    struct vmstate state;
+    struct bytecodebuf buf;
+    buf.data = data;
+    buf.size = size;
+    buf.inplace = inplace;
+    vm_state_save(vm, &state);
+    res = be_execprotected(vm, bytecode_buffer_loader, &buf);
+    if (res) { /* restore call stack */
+        vm_state_restore(vm, &state, res);
+    }
+    return res;
+}
+
 #else
 #define load_bytecode(vm, name) BE_SYNTAX_ERROR
 #endif /* BE_USE_BYTECODE_LOADER */
@@ -33,13 +33,31 @@
     (vm)->gc.gray = gc_object(obj); \
 }
 
+#if BE_USE_INCREMENTAL_GC
+#define link_again(vm, obj)     {   \
+    (obj)->gray = (vm)->gc.again;   \
+    (vm)->gc.again = gc_object(obj); \
+}
+
+/* protos and classes are filled by the compiler and the class builders
+ * without write barrier, so they are only scanned by the final atomic mark */
+#define link_deferred(vm, obj) \
+    if ((vm)->gc.state == GC_STATE_MARK) link_again(vm, obj) else link_gray(vm, obj)
+#else
+#define link_deferred(vm, obj)  link_gray(vm, obj)
+#endif
+
 static void destruct_object(bvm *vm, bgcobject *obj);
 static void free_object(bvm *vm, bgcobject *obj);
+static bgcobject** sweep_white(bvm *vm, bgcobject **link, size_t budget);
 
 void be_gc_init(bvm *vm)
 {
     vm->gc.usage = sizeof(bvm);
     be_gc_setsteprate(vm, 200);
+#if BE_USE_INCREMENTAL_GC
+    be_gc_setbudget(vm, BE_GC_STEP_BUDGET);
+#endif
     be_gc_init_memory_pools(vm);
 }
 
@@ -47,6 +65,22 @@ void be_gc_deleteall(bvm *vm)
 {
     bupval *uv, *uvnext;
     bgcobject *node, *next;
+#if BE_USE_INCREMENTAL_GC
+    if (vm->gc.state == GC_STATE_DESTRUCT) { /* call the remaining destructors */
+        vm->gc.status |= GC_HALT;
+        for (node = vm->gc.scan; node; node = node->next) {
+            if (gc_iswhite(node)) {
+                destruct_object(vm, node);
+            }
+        }
+        vm->gc.sweep = &vm->gc.list;
+    }
+    if (vm->gc.sweep) { /* destructors of these objects were already called */
+        sweep_white(vm, vm->gc.sweep, 0);
+        vm->gc.sweep = NULL;
+    }
+    vm->gc.state = GC_STATE_IDLE;
+#endif
     /* halt GC and delete all objects */
     vm->gc.status |= GC_HALT;
     /* first: call destructor */
@@ -87,6 +121,11 @@ bgcobject* be_newgcobj(bvm *vm, int type, size_t size)
     be_gc_auto(vm);
     var_settype(obj, (bbyte)type); /* mark the object type */
     obj->marked = GC_WHITE; /* default gc object type is white */
+#if BE_USE_INCREMENTAL_GC
+    if (vm->gc.state == GC_STATE_DESTRUCT) {
+        obj->marked = GC_DARK; /* the pending sweep must keep it */
+    }
+#endif
     obj->next = vm->gc.list; /* link to the next field */
     vm->gc.list = obj; /* insert to head */
     return obj;
@@ -102,6 +141,11 @@ bgcobject* be_gc_newstr(bvm *vm, size_t size, int islong)
     be_gc_auto(vm);
     var_settype(obj, BE_STRING); /* mark the object type to BE_STRING */
     obj->marked = GC_WHITE; /* default string type is white */
+#if BE_USE_INCREMENTAL_GC
+    if (vm->gc.state == GC_STATE_DESTRUCT) {
+        obj->marked = GC_DARK; /* the pending string table cleanup must keep it */
+    }
+#endif
     return obj;
 }
 
@@ -110,6 +154,9 @@ void be_gc_fix(bvm *vm, bgcobject *obj)
     (void)vm;
     if (!gc_isconst(obj)) {
         gc_setfixed(obj);
+#if BE_USE_INCREMENTAL_GC
+        be_gc_shade(vm, obj); /* the fixed objects may already be scanned */
+#endif
     }
 }
 
@@ -128,6 +175,9 @@ bbool be_gc_fix_set(bvm *vm, bgcobject *obj, bbool fix)
     if (!gc_isconst(obj)) {
         if (fix) {
             gc_setfixed(obj);
+#if BE_USE_INCREMENTAL_GC
+            be_gc_shade(vm, obj); /* the fixed objects may already be scanned */
+#endif
         } else {
             gc_clearfixed(obj);
         }
@@ -164,8 +214,8 @@ static void mark_gray(bvm *vm, bgcobject *obj)
         be_assert(!var_isstatic(obj));
         switch (var_primetype(obj)) {
         case BE_STRING: gc_setdark(obj); GC_MARK(string); break; /* just set dark */
-        case BE_CLASS: link_gray(vm, cast_class(obj)); GC_MARK(class); break;
-        case BE_PROTO: link_gray(vm, cast_proto(obj)); GC_MARK(proto); break;
+        case BE_CLASS: link_deferred(vm, cast_class(obj)); GC_MARK(class); break;
+        case BE_PROTO: link_deferred(vm, cast_proto(obj)); GC_MARK(proto); break;
         case BE_INSTANCE: link_gray(vm, cast_instance(obj)); GC_MARK(instance); break;
         case BE_MAP: link_gray(vm, cast_map(obj)); GC_MARK(map); break;
         case BE_LIST: link_gray(vm, cast_list(obj)); GC_MARK(list); break;
@@ -322,7 +372,9 @@ static void free_proto(bvm *vm, bgcobject *obj)
         be_free(vm, proto->upvals, proto->nupvals * sizeof(bupvaldesc));
         be_free(vm, proto->ktab, proto->nconst * sizeof(bvalue));
         be_free(vm, proto->ptab, proto->nproto * sizeof(bproto*));
-        be_free(vm, proto->code, proto->codesize * sizeof(binstruction));
+        if (!(proto->varg & BE_VA_SHARED_CODE)) {
+            be_free(vm, proto->code, proto->codesize * sizeof(binstruction));
+        }
 #if BE_DEBUG_RUNTIME_INFO
         be_free(vm, proto->lineinfo, proto->nlineinfo * sizeof(blineinfo));
 #endif
@@ -399,6 +451,14 @@ static void premark_internal(bvm *vm)
         mark_gray(vm, gc_object(var_toobj(&vm->hook)));
     }
 #endif
+#if BE_USE_PROFILER
+    if (vm->profiler) { /* keep the functions of the histogram until it is cleared */
+        int i;
+        for (i = 0; i < BE_PROFILER_SIZE; ++i) {
+            mark_gray(vm, gc_object(vm->profiler->entries[i].proto));
+        }
+    }
+#endif
 }
 
 static void premark_global(bvm *vm)
@@ -418,6 +478,16 @@ static void premark_global(bvm *vm)
     }
 }
 
+/* set the values above the stack top to nil, a new call frame
+ * could otherwise expose objects that are already freed */
+static void clear_stacktop(bvm *vm)
+{
+    bvalue *v = vm->top, *end = vm->stacktop;
+    for (; v < end; ++v) {
+        var_setnil(v);
+    }
+}
+
 static void premark_stack(bvm *vm)
 {
     bvalue *v = vm->stack, *end = vm->top;
@@ -426,10 +496,7 @@ static void premark_stack(bvm *vm)
         mark_gray_var(vm, v);
     }
     /* set other values to nil */
-    end = vm->stacktop;
-    for (; v < end; ++v) {
-        var_setnil(v);
-    }
+    clear_stacktop(vm);
 }
 
 static void premark_tracestack(bvm *vm)
@@ -451,27 +518,41 @@ static void premark_fixed(bvm *vm)
     }
 }
 
+/* scan the first object of the gray list, returns the work done
+ * as one unit for the object and one for each slot it holds */
+static size_t mark_object(bvm *vm, bgcobject *obj)
+{
+    size_t work = 1;
+    if (obj && !gc_isdark(obj) && !gc_isconst(obj)) {
+        gc_setdark(obj);
+        be_assert(!var_isstatic(obj));
+        switch (var_primetype(obj)) {
+        case BE_CLASS: mark_class(vm, obj); work += 3; break;
+        case BE_PROTO:
+            mark_proto(vm, obj);
+            work += cast_proto(obj)->nconst + cast_proto(obj)->nproto;
+            break;
+        case BE_INSTANCE:
+            mark_instance(vm, obj);
+            work += be_instance_member_count(cast_instance(obj));
+            break;
+        case BE_MAP: mark_map(vm, obj); work += cast_map(obj)->size; break;
+        case BE_LIST: mark_list(vm, obj); work += cast_list(obj)->count; break;
+        case BE_CLOSURE: mark_closure(vm, obj); work += cast_closure(obj)->nupvals; break;
+        case BE_NTVCLOS: mark_ntvclos(vm, obj); work += cast_ntvclos(obj)->nupvals; break;
+        case BE_MODULE: mark_module(vm, obj); work += 2; break;
+        default:
+            be_assert(0); /* error */
+            break;
+        }
+    }
+    return work;
+}
+
 static void mark_unscanned(bvm *vm)
 {
     while (vm->gc.gray) {
-        bgcobject *obj = vm->gc.gray;
-        if (obj && !gc_isdark(obj) && !gc_isconst(obj)) {
-            gc_setdark(obj);
-            be_assert(!var_isstatic(obj));
-            switch (var_primetype(obj)) {
-            case BE_CLASS: mark_class(vm, obj); break;
-            case BE_PROTO: mark_proto(vm, obj); break;
-            case BE_INSTANCE: mark_instance(vm, obj); break;
-            case BE_MAP: mark_map(vm, obj); break;
-            case BE_LIST: mark_list(vm, obj); break;
-            case BE_CLOSURE: mark_closure(vm, obj); break;
-            case BE_NTVCLOS: mark_ntvclos(vm, obj); break;
-            case BE_MODULE: mark_module(vm, obj); break;
-            default:
-                be_assert(0); /* error */
-                break;
-            }
-        }
+        mark_object(vm, vm->gc.gray);
     }
 }
 
@@ -508,31 +589,51 @@ static void destruct_white(bvm *vm)
         node = node->next;
     }
     vm->gc.status &= ~GC_HALT; /* reset GC halt flag */
+    clear_stacktop(vm); /* the destructors leave unreachable objects there */
 }
 
-static void delete_white(bvm *vm)
+/* free the white objects and reset the others to white, starting from
+ * `*link` and visiting at most `budget` objects (no limit if 0).
+ * returns the link where the sweep stopped or NULL at the end of the list */
+static bgcobject** sweep_white(bvm *vm, bgcobject **link, size_t budget)
 {
-    bgcobject *node, *prev, *next;
-    for (node = vm->gc.list, prev = node; node; node = next) {
-        next = node->next;
+    bgcobject *node;
+    while ((node = *link) != NULL) {
         if (gc_iswhite(node)) {
-            if (node == vm->gc.list) { /* first node */
-                vm->gc.list = node->next;
-                prev = node->next;
-            } else { /* not first node */
-                prev->next = next;
-            }
+            *link = node->next; /* unlink the node */
             free_object(vm, node);
 #if BE_USE_PERF_COUNTERS
             vm->counter_gc_freed++;
 #endif
         } else {
             gc_setwhite(node);
-            prev = node;
+            link = &node->next;
+        }
+        if (budget && --budget == 0) {
+            return *link ? link : NULL;
         }
     }
+    return NULL;
 }
 
+static void delete_white(bvm *vm)
+{
+    sweep_white(vm, &vm->gc.list, 0);
+}
+
+#if BE_USE_INCREMENTAL_GC
+static void sweep_begin(bvm *vm)
+{
+    bgcobject **link;
+    /* new objects are inserted at the head of the list, so the pending
+     * sweep must resume after a survivor and never from the list head */
+    do {
+        link = sweep_white(vm, &vm->gc.list, 1);
+    } while (link == &vm->gc.list);
+    vm->gc.sweep = link ? sweep_white(vm, link, vm->gc.budget) : NULL;
+}
+#endif
+
 static void reset_fixedlist(bvm *vm)
 {
     bgcobject *node;
@@ -543,53 +644,77 @@ static void reset_fixedlist(bvm *vm)
     }
 }
 
-void be_gc_auto(bvm *vm)
-{
-    if (vm->gc.status & GC_PAUSE && (BE_USE_DEBUG_GC || vm->gc.usage > vm->gc.threshold || comp_is_gc_debug(vm))) {
-        be_gc_collect(vm);
-    }
-}
-
-size_t be_gc_memcount(bvm *vm)
-{
-    return vm->gc.usage;
-}
-
 #if BE_USE_PERF_COUNTERS
 #define GC_TIMER(i)  if (vm->microsfnct) { vm->micros_gc##i = vm->microsfnct(); }
+#define GC_PAUSE_START()    uint32_t _pause_start = vm->microsfnct ? vm->microsfnct() : 0
+#define GC_PAUSE_END()      gc_pause_record(vm, _pause_start)
+
+/* upper bounds in microseconds of the buckets of the GC pause histogram,
+ * the last bucket counts all longer pauses */
+static const uint32_t gc_pause_limits[BE_GC_PAUSE_BUCKETS - 1] = {
+    100, 250, 500, 1000, 2500, 5000, 10000
+};
+
+static void gc_pause_record(bvm *vm, uint32_t start)
+{
+    if (vm->microsfnct) {
+        uint32_t pause = vm->microsfnct() - start;
+        int i = 0;
+        while (i < BE_GC_PAUSE_BUCKETS - 1 && pause >= gc_pause_limits[i]) {
+            ++i;
+        }
+        vm->gc_pauses[i]++;
+        if (pause > vm->gc_pause_max) {
+            vm->gc_pause_max = pause;
+        }
+    }
+}
 #else
 #define GC_TIMER(i)
+#define GC_PAUSE_START()
+#define GC_PAUSE_END()
 #endif
 
-void be_gc_collect(bvm *vm)
+/* reset the counters of a new cycle */
+static void gc_start(bvm *vm)
 {
-    if (vm->gc.status & GC_HALT) {
-        return; /* the GC cannot run for some reason */
-    }
 #if BE_USE_PERF_COUNTERS
-    size_t slors_used_before_gc, slots_allocated_before_gc;
-    be_gc_memory_pools_info(vm, &slors_used_before_gc, &slots_allocated_before_gc);
+    be_gc_memory_pools_info(vm, &vm->gc_slots_used, &vm->gc_slots_allocated);
     vm->counter_gc_kept = 0;
     vm->counter_gc_freed = 0;
 #endif
     if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_START, vm->gc.usage);
     GC_TIMER(0);
-    /* step 1: set root-set reference objects to unscanned */
     mark_gray_reset_counters(vm); /* reset all internal counters */
+}
+
+/* set root-set reference objects to unscanned */
+static void premark_roots(bvm *vm)
+{
     premark_internal(vm); /* object internal the VM */
     premark_global(vm); /* global objects */
     premark_stack(vm); /* stack objects */
     premark_tracestack(vm); /* trace stack objects */
+}
+
+/* mark all reachable objects and call the destructors of the others */
+static void gc_begin(bvm *vm)
+{
+    gc_start(vm);
+    /* step 1: set root-set reference objects to unscanned */
+    premark_roots(vm);
     premark_fixed(vm); /* fixed objects */
     GC_TIMER(1);
     /* step 2: set unscanned objects to black */
     mark_unscanned(vm);
     GC_TIMER(2);
-    /* step 3: destruct and delete unreachable objects */
+    /* step 3: destruct unreachable objects, the caller deletes them */
     destruct_white(vm);
-    delete_white(vm);
-    be_gcstrtab(vm);
-    GC_TIMER(3);
+}
+
+/* the sweep is complete, prepare the next cycle */
+static void gc_end(bvm *vm)
+{
     /* step 4: reset the fixed objects */
     reset_fixedlist(vm);
     GC_TIMER(4);
@@ -598,12 +723,199 @@ void be_gc_collect(bvm *vm)
     be_gc_memory_pools(vm); /* free unsued memory pools */
     GC_TIMER(5);
 #if BE_USE_PERF_COUNTERS
-    size_t slors_used_after_gc, slots_allocated_after_gc;
-    be_gc_memory_pools_info(vm, &slors_used_after_gc, &slots_allocated_after_gc);
+    size_t slots_used_after_gc, slots_allocated_after_gc;
+    be_gc_memory_pools_info(vm, &slots_used_after_gc, &slots_allocated_after_gc);
     if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage, vm->counter_gc_kept, vm->counter_gc_freed,
-                                            slors_used_before_gc, slots_allocated_before_gc,
-                                            slors_used_after_gc, slots_allocated_after_gc);
+                                            vm->gc_slots_used, vm->gc_slots_allocated,
+                                            slots_used_after_gc, slots_allocated_after_gc);
 #else
     if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage);
 #endif
 }
+
+#if BE_USE_INCREMENTAL_GC
+/*
+ * An incremental collection is a tri-color mark and sweep run in steps
+ * between which the VM keeps running:
+ * - MARK: the roots are grayed at once, then each step looks up the fixed
+ *   objects and blackens gray objects until its budget is spent. Stores
+ *   into scanned objects go through the write barriers, and protos and
+ *   classes are left to the final mark.
+ * - the final mark is atomic: it grays the roots again, since the stack
+ *   and the globals have no barrier, and scans the objects queued by the
+ *   barriers and the deferred protos and classes.
+ * - DESTRUCT: each step calls the destructors of some white objects,
+ *   objects created meanwhile are black.
+ * - SWEEP: each step frees some white objects, see `sweep_begin()`.
+ */
+void be_gc_setbudget(bvm *vm, int budget)
+{
+    vm->gc.budget = (uint16_t)(budget < 1 ? 1 : budget > 0xFFFF ? 0xFFFF : budget);
+}
+
+/* mark an object stored while marking in steps */
+void be_gc_shade(bvm *vm, bgcobject *obj)
+{
+    if (vm->gc.state == GC_STATE_MARK) {
+        mark_gray(vm, obj);
+    }
+}
+
+/* queue a scanned container modified while marking in steps,
+ * so that the final mark scans it again */
+void be_gc_again(bvm *vm, bgcobject *obj)
+{
+    gc_setgray(obj);
+    switch (var_primetype(obj)) {
+    case BE_INSTANCE: link_again(vm, cast_instance(obj)); break;
+    case BE_MAP: link_again(vm, cast_map(obj)); break;
+    case BE_LIST: link_again(vm, cast_list(obj)); break;
+    case BE_CLOSURE: link_again(vm, cast_closure(obj)); break;
+    case BE_NTVCLOS: link_again(vm, cast_ntvclos(obj)); break;
+    case BE_MODULE: link_again(vm, cast_module(obj)); break;
+    default: gc_setdark(obj); break; /* protos and classes are never scanned before the final mark */
+    }
+}
+
+/* start a collection continued by `be_gc_step()` */
+static void gc_mark_begin(bvm *vm)
+{
+    gc_start(vm);
+    vm->gc.state = GC_STATE_MARK;
+    premark_roots(vm);
+    vm->gc.scan = vm->gc.list; /* the fixed objects are looked up in steps */
+    GC_TIMER(1);
+}
+
+/* the final mark, then the destructors are called in steps */
+static void gc_mark_end(bvm *vm)
+{
+    vm->gc.state = GC_STATE_DESTRUCT; /* mark_gray() no longer defers objects */
+    vm->gc.gray = vm->gc.again;
+    vm->gc.again = NULL;
+    premark_roots(vm);
+    mark_unscanned(vm);
+    GC_TIMER(2);
+    vm->gc.scan = vm->gc.list;
+}
+
+/* all destructors are called, free the white objects in steps */
+static void gc_sweep_begin(bvm *vm)
+{
+    vm->gc.state = GC_STATE_SWEEP;
+    sweep_begin(vm);
+    be_gcstrtab(vm);
+    be_vm_mbrcache_flush(vm); /* freed classes or strings may be reused at the same address */
+    GC_TIMER(3);
+    if (!vm->gc.sweep) {
+        vm->gc.state = GC_STATE_IDLE;
+        gc_end(vm);
+    }
+}
+
+/* do at most `budget` units of work of the current phase (no limit if 0),
+ * and move to the next phase once the current one is complete */
+static void gc_advance(bvm *vm, size_t budget)
+{
+    size_t work = budget ? budget : (size_t)-1;
+    switch (vm->gc.state) {
+    case GC_STATE_MARK:
+        for (; vm->gc.scan && work; --work) {
+            bgcobject *node = vm->gc.scan;
+            if (gc_isfixed(node) && gc_iswhite(node)) {
+                mark_gray(vm, node);
+            }
+            vm->gc.scan = node->next;
+        }
+        while (vm->gc.gray && work) {
+            size_t n = mark_object(vm, vm->gc.gray);
+            work = n < work ? work - n : 0;
+        }
+        if (!vm->gc.scan && !vm->gc.gray) {
+            gc_mark_end(vm);
+        }
+        break;
+    case GC_STATE_DESTRUCT:
+        /* since the destructor may allocate objects, we must first suspend the GC */
+        vm->gc.status |= GC_HALT;
+        for (; vm->gc.scan && work; --work) {
+            bgcobject *node = vm->gc.scan;
+            vm->gc.scan = node->next;
+            if (gc_iswhite(node)) {
+                destruct_object(vm, node);
+            }
+        }
+        vm->gc.status &= ~GC_HALT;
+        clear_stacktop(vm); /* the destructors leave unreachable objects there */
+        if (!vm->gc.scan) {
+            gc_sweep_begin(vm);
+        }
+        break;
+    case GC_STATE_SWEEP:
+        vm->gc.sweep = sweep_white(vm, vm->gc.sweep, budget);
+        if (!vm->gc.sweep) {
+            vm->gc.state = GC_STATE_IDLE;
+            gc_end(vm);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+bbool be_gc_step(bvm *vm)
+{
+    if (vm->gc.state != GC_STATE_IDLE && !(vm->gc.status & GC_HALT)) {
+        GC_PAUSE_START();
+        gc_advance(vm, vm->gc.budget);
+        GC_PAUSE_END();
+    }
+    return vm->gc.state != GC_STATE_IDLE;
+}
+#endif
+
+void be_gc_auto(bvm *vm)
+{
+    if (vm->gc.status & GC_PAUSE) {
+#if BE_USE_INCREMENTAL_GC
+        if (vm->gc.state != GC_STATE_IDLE) {
+            be_gc_step(vm); /* no new collection until the current one is complete */
+        } else if (BE_USE_DEBUG_GC || comp_is_gc_debug(vm)) {
+            be_gc_collect(vm);
+        } else if (vm->gc.usage > vm->gc.threshold && !(vm->gc.status & GC_HALT)) {
+            GC_PAUSE_START();
+            gc_mark_begin(vm);
+            GC_PAUSE_END();
+        }
+#else
+        if (BE_USE_DEBUG_GC || vm->gc.usage > vm->gc.threshold || comp_is_gc_debug(vm)) {
+            be_gc_collect(vm);
+        }
+#endif
+    }
+}
+
+size_t be_gc_memcount(bvm *vm)
+{
+    return vm->gc.usage;
+}
+
+void be_gc_collect(bvm *vm)
+{
+    if (vm->gc.status & GC_HALT) {
+        return; /* the GC cannot run for some reason */
+    }
+    GC_PAUSE_START();
+#if BE_USE_INCREMENTAL_GC
+    while (vm->gc.state != GC_STATE_IDLE) { /* complete the pending collection first */
+        gc_advance(vm, 0);
+    }
+#endif
+    gc_begin(vm);
+    delete_white(vm);
+    be_gcstrtab(vm);
+    be_vm_mbrcache_flush(vm); /* freed classes or strings may be reused at the same address */
+    GC_TIMER(3);
+    gc_end(vm);
+    GC_PAUSE_END();
+}
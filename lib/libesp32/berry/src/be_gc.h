@@ -63,6 +63,35 @@ typedef enum {
     GC_CONST = 0x08  /* constant object mark */
 } bgcmark;
 
+#if BE_USE_INCREMENTAL_GC
+/* phases of a collection run in steps by `be_gc_step()` */
+typedef enum {
+    GC_STATE_IDLE,      /* no collection in progress */
+    GC_STATE_MARK,      /* reachable objects are marked in steps */
+    GC_STATE_DESTRUCT,  /* destructors of unreachable objects are called in steps */
+    GC_STATE_SWEEP      /* unreachable objects are freed in steps */
+} bgcstate;
+
+/* write barriers, needed only while marking in steps:
+ * `be_gc_barrier()` marks a value stored into a slot that is not owned by
+ * a container, such as an upvalue, and `be_gc_barrierback()` queues an
+ * already scanned container whose slots are modified for the final mark */
+#define be_gc_barrier(vm, v) do { \
+    if ((vm)->gc.state == GC_STATE_MARK && be_isgcobj(v)) { \
+        be_gc_shade((vm), var_togc(v)); \
+    } \
+} while (0)
+
+#define be_gc_barrierback(vm, o) do { \
+    if ((vm)->gc.state == GC_STATE_MARK && gc_isdark(o) && !gc_isconst(o)) { \
+        be_gc_again((vm), gc_object(o)); \
+    } \
+} while (0)
+#else
+#define be_gc_barrier(vm, v)        do { } while (0)
+#define be_gc_barrierback(vm, o)    do { } while (0)
+#endif
+
 void be_gc_init(bvm *vm);
 void be_gc_deleteall(bvm *vm);
 void be_gc_setsteprate(bvm *vm, int rate);
@@ -75,5 +104,11 @@ void be_gc_unfix(bvm *vm, bgcobject *obj);
 bbool be_gc_fix_set(bvm *vm, bgcobject *obj, bbool fix);
 void be_gc_collect(bvm *vm);
 void be_gc_auto(bvm *vm);
+#if BE_USE_INCREMENTAL_GC
+void be_gc_setbudget(bvm *vm, int budget);
+bbool be_gc_step(bvm *vm);
+void be_gc_shade(bvm *vm, bgcobject *obj);
+void be_gc_again(bvm *vm, bgcobject *obj);
+#endif
 
 #endif
@@ -7,6 +7,7 @@
 ********************************************************************/
 #include "be_object.h"
 #include "be_gc.h"
+#include "be_vm.h"
 
 #if BE_USE_GC_MODULE
 
@@ -27,10 +28,68 @@ static int m_collect(bvm *vm)
     be_return_nil(vm);
 }
 
+/* run a step of the pending incremental collection,
+ * returns `true` if the collection is not complete yet */
+static int m_step(bvm *vm)
+{
+#if BE_USE_INCREMENTAL_GC
+    be_pushbool(vm, be_gc_step(vm));
+#else
+    be_pushbool(vm, bfalse);
+#endif
+    be_return(vm);
+}
+
+/* get or set the units of work done by each step, an object
+ * visited or a slot scanned is one unit */
+static int m_budget(bvm *vm)
+{
+#if BE_USE_INCREMENTAL_GC
+    if (be_top(vm) >= 1 && be_isint(vm, 1)) {
+        be_gc_setbudget(vm, be_toint(vm, 1));
+    }
+    be_pushint(vm, vm->gc.budget);
+    be_return(vm);
+#else
+    be_return_nil(vm);
+#endif
+}
+
+#if BE_USE_PERF_COUNTERS
+/* returns `{'max': <longest pause in us>, 'hist': [...]}`, the histogram buckets
+ * are pauses below 100us, 250us, 500us, 1ms, 2.5ms, 5ms, 10ms and above */
+static int m_pauses(bvm *vm)
+{
+    int i;
+    be_newobject(vm, "map");
+    be_pushstring(vm, "max");
+    be_pushint(vm, vm->gc_pause_max);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    be_pushstring(vm, "hist");
+    be_newobject(vm, "list");
+    for (i = 0; i < BE_GC_PAUSE_BUCKETS; ++i) {
+        be_pushint(vm, vm->gc_pauses[i]);
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    be_pop(vm, 1);
+    be_return(vm);
+}
+#endif
+
 #if !BE_USE_PRECOMPILED_OBJECT
 be_native_module_attr_table(gc){
     be_native_module_function("allocated", m_allocated),
-    be_native_module_function("collect", m_collect)
+    be_native_module_function("collect", m_collect),
+    be_native_module_function("step", m_step),
+    be_native_module_function("budget", m_budget),
+#if BE_USE_PERF_COUNTERS
+    be_native_module_function("pauses", m_pauses),
+#endif
 };
 
 be_define_native_module(gc, NULL);
@@ -39,6 +98,9 @@ be_define_native_module(gc, NULL);
 module gc (scope: global, depend: BE_USE_GC_MODULE) {
     allocated, func(m_allocated)
     collect, func(m_collect)
+    step, func(m_step)
+    budget, func(m_budget)
+    pauses, func(m_pauses), BE_USE_PERF_COUNTERS
 }
 @const_object_info_end */
 #include "../generate/be_fixed_gc.h"
@@ -148,7 +148,8 @@ static char* load_unicode(char *dst, const char *json)
     return dst;
 }
 
-static const char* parser_string(bvm *vm, const char *json)
+/* strings with escape sequences are unescaped in a temporary buffer */
+static const char* parser_escaped_string(bvm *vm, const char *json)
 {
     if (*json == '"') {
         int len = json_strlen(json++);
@@ -201,6 +202,27 @@ static const char* parser_string(bvm *vm, const char *json)
     return NULL;
 }
 
+static const char* parser_string(bvm *vm, const char *json)
+{
+    if (*json == '"') {
+        int ch;
+        const char *s = json + 1;
+        /* fast path: strings without escape are pushed from the input, with no copy */
+        while ((ch = *s) != '"' && ch != '\\' && !(ch >= 0 && ch <= 0x1f)) {
+            ++s;
+        }
+        if (ch == '"') {
+            be_stack_require(vm, 1 + BE_STACK_FREE_MIN);
+            be_pushnstring(vm, json + 1, cast_int(s - json - 1));
+            return s + 1; /* skip '"' */
+        }
+        if (ch == '\\') {
+            return parser_escaped_string(vm, json);
+        }
+    }
+    return NULL; /* unterminated string or control character */
+}
+
 static const char* parser_field(bvm *vm, const char *json)
 {
     be_stack_require(vm, 2 + BE_STACK_FREE_MIN);
@@ -408,6 +430,230 @@ static int m_json_load(bvm *vm)
     be_return_nil(vm);
 }
 
+/* `json.scan()` extracts a few values by their path, without building the
+ * other objects of the document. A path is a list of keys separated with '#',
+ * keys are compared ignoring case like Tasmota rules, e.g. "ENERGY#Power" */
+#define SCAN_MAX_PATHS  16
+#define SCAN_MAX_KEYS   8
+
+typedef struct {
+    const char *key[SCAN_MAX_KEYS];
+    int keylen[SCAN_MAX_KEYS];
+    int nkeys;
+} json_path;
+
+typedef struct {
+    json_path paths[SCAN_MAX_PATHS];
+    uint32_t pending; /* mask of the paths not found yet */
+    int base; /* stack index of the first result */
+} json_scan;
+
+static const char* skip_value(const char *json);
+
+static const char* skip_string(const char *json)
+{
+    int ch;
+    ++json; /* skip '"' */
+    while ((ch = *json++) != '"') {
+        if (ch == '\\') {
+            if (*json++ == '\0') {
+                return NULL;
+            }
+        } else if (ch >= 0 && ch <= 0x1f) { /* also the end of the input */
+            return NULL;
+        }
+    }
+    return json;
+}
+
+/* skip an array or an object, the content is only checked for its structure */
+static const char* skip_container(const char *json, int close)
+{
+    json = skip_space(json + 1);
+    if (*json == close) {
+        return json + 1;
+    }
+    while (json) {
+        if (close == '}') { /* key of the field */
+            if (*json != '"' || (json = skip_string(json)) == NULL
+                || (json = match_char(json, ':')) == NULL) {
+                return NULL;
+            }
+        }
+        json = skip_value(json);
+        if (json) {
+            json = skip_space(json);
+            if (*json == close) {
+                return json + 1;
+            }
+            json = match_char(json, ',');
+        }
+    }
+    return NULL;
+}
+
+static const char* skip_value(const char *json)
+{
+    const char *s;
+    json = skip_space(json);
+    switch (*json) {
+    case '{': return skip_container(json, '}');
+    case '[': return skip_container(json, ']');
+    case '"': return skip_string(json);
+    case 't': return strncmp(json, "true", 4) ? NULL : json + 4;
+    case 'f': return strncmp(json, "false", 5) ? NULL : json + 5;
+    case 'n': return strncmp(json, "null", 4) ? NULL : json + 4;
+    default: /* number */
+        for (s = json; is_digit(*s) || *s == '-' || *s == '+'
+            || *s == '.' || *s == 'e' || *s == 'E'; ++s);
+        return s != json ? s : NULL;
+    }
+}
+
+static bbool key_match(const char *key, const char *s, int len)
+{
+    while (len--) {
+        int a = *key++, b = *s++;
+        if (a >= 'A' && a <= 'Z') a += 'a' - 'A';
+        if (b >= 'A' && b <= 'Z') b += 'a' - 'A';
+        if (a != b) {
+            return bfalse;
+        }
+    }
+    return btrue;
+}
+
+/* scan an object whose path matches the first `depth` keys of the `active` paths,
+ * scanning stops as soon as all the values are found */
+static const char* scan_object(bvm *vm, json_scan *scan, const char *json, int depth, uint32_t active)
+{
+    json = match_char(json, '{');
+    if (*json == '}') {
+        return json + 1;
+    }
+    while (json) {
+        uint32_t leaf = 0, inner = 0;
+        const char *key = json + 1;
+        int i, keylen;
+        if (*json != '"' || (json = skip_string(json)) == NULL
+            || (json = match_char(json, ':')) == NULL) {
+            return NULL;
+        }
+        keylen = cast_int(json - key);
+        while (key[--keylen] != '"'); /* length without the closing '"' and the spaces */
+        for (i = 0; i < SCAN_MAX_PATHS; ++i) {
+            json_path *path = &scan->paths[i];
+            if ((active & scan->pending & (1u << i)) && path->keylen[depth] == keylen
+                && key_match(path->key[depth], key, keylen)) {
+                if (depth == path->nkeys - 1) {
+                    leaf |= 1u << i;
+                } else {
+                    inner |= 1u << i;
+                }
+            }
+        }
+        if (leaf) { /* build only the requested values */
+            const char *value = json;
+            json = parser_value(vm, json);
+            if (json == NULL) {
+                return NULL;
+            }
+            for (i = 0; i < SCAN_MAX_PATHS; ++i) {
+                if (leaf & (1u << i)) {
+                    be_moveto(vm, -1, scan->base + i);
+                }
+            }
+            be_pop(vm, 1);
+            scan->pending &= ~leaf;
+            if (scan->pending == 0) {
+                return json;
+            }
+            if (inner && *skip_space(value) == '{') { /* other paths go through this object */
+                json = value;
+            }
+        }
+        if (inner && *skip_space(json) == '{') {
+            json = scan_object(vm, scan, json, depth + 1, inner);
+            if (json == NULL || scan->pending == 0) {
+                return json;
+            }
+        } else if (!leaf) {
+            json = skip_value(json);
+        }
+        if (json) {
+            json = skip_space(json);
+            if (*json == '}') {
+                return json + 1;
+            }
+            json = match_char(json, ',');
+        }
+    }
+    return NULL;
+}
+
+static void scan_path(bvm *vm, json_path *path, const char *s)
+{
+    path->nkeys = 0;
+    for (;;) {
+        const char *end = strchr(s, '#');
+        if (path->nkeys >= SCAN_MAX_KEYS) {
+            be_raise(vm, "value_error", "too many keys in path");
+        }
+        path->key[path->nkeys] = s;
+        path->keylen[path->nkeys++] = end ? cast_int(end - s) : (int)strlen(s);
+        if (end == NULL) {
+            break;
+        }
+        s = end + 1;
+    }
+}
+
+static int m_json_scan(bvm *vm)
+{
+    json_scan scan;
+    int i, npaths = be_top(vm) - 1;
+    if (npaths < 1 || !be_isstring(vm, 1)) {
+        be_raise(vm, "type_error", "json.scan(payload:string, path:string...)");
+    }
+    if (npaths > SCAN_MAX_PATHS) {
+        be_raise(vm, "value_error", "too many paths");
+    }
+    memset(&scan, 0, sizeof(scan));
+    for (i = 0; i < npaths; ++i) {
+        if (!be_isstring(vm, i + 2)) {
+            be_raise(vm, "type_error", "path must be a string");
+        }
+        scan_path(vm, &scan.paths[i], be_tostring(vm, i + 2));
+        scan.pending |= 1u << i;
+    }
+    be_stack_require(vm, npaths + 1 + BE_STACK_FREE_MIN);
+    scan.base = be_top(vm) + 1;
+    for (i = 0; i < npaths; ++i) {
+        be_pushnil(vm); /* results, nil if not found */
+    }
+    const char *json = skip_space(be_tostring(vm, 1));
+    if (*json == '{') {
+        json = scan_object(vm, &scan, json, 0, scan.pending);
+    } else {
+        json = skip_value(json);
+    }
+    if (json == NULL || (scan.pending && *skip_space(json) != '\0')) {
+        be_return_nil(vm); /* invalid JSON */
+    }
+    if (npaths == 1) {
+        be_pushvalue(vm, scan.base);
+    } else {
+        be_newobject(vm, "list");
+        for (i = 0; i < npaths; ++i) {
+            be_pushvalue(vm, scan.base + i);
+            be_data_push(vm, -2);
+            be_pop(vm, 1);
+        }
+        be_pop(vm, 1);
+    }
+    be_return(vm);
+}
+
 static void make_indent(bvm *vm, int stridx, int indent)
 {
     if (indent) {
@@ -548,7 +794,8 @@ static int m_json_dump(bvm *vm)
 #if !BE_USE_PRECOMPILED_OBJECT
 be_native_module_attr_table(json) {
     be_native_module_function("load", m_json_load),
-    be_native_module_function("dump", m_json_dump)
+    be_native_module_function("dump", m_json_dump),
+    be_native_module_function("scan", m_json_scan)
 };
 
 be_define_native_module(json, NULL);
@@ -557,6 +804,7 @@ be_define_native_module(json, NULL);
 module json (scope: global, depend: BE_USE_JSON_MODULE) {
     load, func(m_json_load)
     dump, func(m_json_dump)
+    scan, func(m_json_scan)
 }
 @const_object_info_end */
 #include "../generate/be_fixed_json.h"
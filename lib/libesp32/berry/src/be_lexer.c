@@ -99,6 +99,12 @@ bstring* be_lexer_newstr(blexer *lexer, const char *str)
     return cache_string(lexer, be_newstr(lexer->vm, str));
 }
 
+/* concatenate two strings of the source, used to fold constant expressions */
+bstring* be_lexer_strcat(blexer *lexer, bstring *s1, bstring *s2)
+{
+    return cache_string(lexer, be_strcat(lexer->vm, s1, s2));
+}
+
 static int next(blexer *lexer)
 {
     struct blexerreader *lr = &lexer->reader;
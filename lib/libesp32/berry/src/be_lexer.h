@@ -134,6 +134,7 @@ void be_lexer_deinit(blexer *lexer);
 void be_lexerror(blexer *lexer, const char *msg);
 int be_lexer_scan_next(blexer *lexer);
 bstring* be_lexer_newstr(blexer *lexer, const char *str);
+bstring* be_lexer_strcat(blexer *lexer, bstring *s1, bstring *s2);
 const char *be_token2str(bvm *vm, btoken *token);
 const char* be_tokentype2str(btokentype type);
 
@@ -73,6 +73,7 @@ bvalue* be_list_push(bvm *vm, blist *list, bvalue *value)
             datasize(list->capacity), datasize(newcap));
         list->capacity = newcap;
     }
+    be_gc_barrierback(vm, list); /* the caller may set the value later */
     slot = list->data + list->count++;
     if (value != NULL) {
         *slot = *value;
@@ -96,6 +97,7 @@ bvalue* be_list_insert(bvm *vm, blist *list, int index, bvalue *value)
             datasize(list->capacity), datasize(newcap));
         list->capacity = newcap;
     }
+    be_gc_barrierback(vm, list);
     data = list->data;
     for (i = list->count++; i > index; --i) {
         data[i] = data[i - 1];
@@ -157,6 +159,7 @@ void be_list_merge(bvm *vm, blist *list, const blist *other)
                 datasize(list->capacity), datasize(newcap));
             list->capacity = newcap;
         }
+        be_gc_barrierback(vm, list);
         memcpy(list->data + dst_len, other->data, src_len * sizeof(bvalue));
         list->count = length;
     }
@@ -185,6 +188,7 @@ int be_list_pool_alloc(bvm *vm, blist *list, bvalue *src)
 {
     bvalue *head = be_list_data(list), *node;
     int id = var_toidx(head); /* get the first free node */
+    be_gc_barrierback(vm, list);
     if (id) {
         node = head + id;
         head->v.i = var_toint(node); /* link the next free node to head */
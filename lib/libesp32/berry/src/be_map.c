@@ -256,6 +256,7 @@ bvalue* be_map_insert(bvm *vm, bmap *map, bvalue *key, bvalue *value)
 {
     uint32_t hash = hashcode(key);
     bmapnode *entry = find(vm, map, key, hash);
+    be_gc_barrierback(vm, map); /* the caller may set the value later */
     if (!entry) { /* new entry */
         if (map->count >= map->size) {
             resize(vm, map, map_nextsize(map->size));
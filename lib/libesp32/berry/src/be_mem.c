@@ -9,6 +9,7 @@
 #include "be_exec.h"
 #include "be_vm.h"
 #include "be_gc.h"
+#include "be_profiler.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -87,6 +88,11 @@ BERRY_API void* be_realloc(bvm *vm, void *ptr, size_t old_size, size_t new_size)
     if (old_size == new_size) { /* the block unchanged, this also captures creation of a zero byte object */
         return ptr;
     }
+#if BE_USE_PROFILER
+    if (new_size > old_size && be_profiler_running(vm)) {
+        be_profiler_alloc(vm, new_size - old_size); /* before any change to the callstack block */
+    }
+#endif
     /* from now on, block == NULL means allocation failure */
 
     while (1) {
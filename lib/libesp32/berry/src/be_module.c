@@ -363,6 +363,7 @@ bbool be_module_setmember(bvm *vm, bmodule *module, bstring *attr, bvalue *src)
             v = be_map_insertstr(vm, attrs, attr, NULL);
         }
         if (v) {
+            be_gc_barrierback(vm, attrs);
             *v = *src;
             return btrue;
         }
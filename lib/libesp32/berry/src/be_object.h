@@ -46,6 +46,7 @@
 #define BE_VA_VARARG            (1 << 0)    /* function has variable number of arguments */
 #define BE_VA_METHOD            (1 << 1)    /* function is a method (this is only a hint) */
 #define BE_VA_STATICMETHOD      (1 << 2)    /* the function is a static method and has the class as implicit '_class' variable */
+#define BE_VA_SHARED_CODE       (1 << 3)    /* code is not owned by the function, it points to a bytecode image in read-only memory */
 #define array_count(a)   (sizeof(a) / sizeof((a)[0]))
 
 #define bcommon_header          \
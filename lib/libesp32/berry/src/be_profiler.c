@@ -0,0 +1,165 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#include "be_profiler.h"
+#include "be_func.h"
+#include "be_vector.h"
+#include "be_mem.h"
+#include <string.h>
+
+#if BE_USE_PROFILER
+
+#if BE_PROFILER_SAMPLING >= BE_VM_OBSERVABILITY_SAMPLING
+#error "BE_PROFILER_SAMPLING must be lower than BE_VM_OBSERVABILITY_SAMPLING"
+#endif
+
+/* line of the instruction at `pc`, 0 without line information */
+static int proto_line(bproto *proto, int pc)
+{
+#if BE_DEBUG_RUNTIME_INFO
+    if (proto->lineinfo && proto->nlineinfo) {
+        blineinfo *it = proto->lineinfo;
+        blineinfo *last = it + proto->nlineinfo - 1;
+        for (; it < last && pc > it->endpc; ++it);
+        return it->linenumber;
+    }
+#else
+    (void)proto; (void)pc;
+#endif
+    return 0;
+}
+
+static void record(bprofiler *prof, bproto *proto, int line, uint32_t samples, uint32_t alloc)
+{
+    uint32_t mask = BE_PROFILER_SIZE - 1;
+    uint32_t i = ((uint32_t)((size_t)proto >> 3) ^ (uint32_t)line * 31) & mask;
+    int n;
+    for (n = 0; n < BE_PROFILER_SIZE; ++n, i = (i + 1) & mask) {
+        bprofentry *e = &prof->entries[i];
+        if (e->proto == NULL) { /* new entry */
+            e->proto = proto;
+            e->line = line;
+        }
+        if (e->proto == proto && e->line == line) {
+            e->samples += samples;
+            e->alloc += alloc;
+            return;
+        }
+    }
+    prof->other_samples += samples; /* the histogram is full */
+    prof->other_alloc += alloc;
+}
+
+/* record in the innermost Berry function of the call stack, since
+ * natives do not change `vm->ip` it is the position in this function */
+static void record_frame(bvm *vm, uint32_t samples, uint32_t alloc)
+{
+    bprofiler *prof = vm->profiler;
+    if (be_stack_count(&vm->callstack) && vm->cf) {
+        bcallframe *base = be_stack_base(&vm->callstack);
+        bcallframe *cf;
+        for (cf = vm->cf; cf >= base; --cf) {
+            if (var_isclosure(cf->func)) {
+                bproto *proto = cast(bclosure*, var_toobj(cf->func))->proto;
+                int pc = cast_int(vm->ip - proto->code) - 1; /* `vm->ip` was already increased */
+                int line = pc >= 0 && pc < proto->codesize ? proto_line(proto, pc) : 0;
+                record(prof, proto, line, samples, alloc);
+                return;
+            }
+        }
+    }
+    prof->other_samples += samples;
+    prof->other_alloc += alloc;
+}
+
+/* clear the histogram and start sampling, returns `bfalse` if out of memory */
+bbool be_profiler_start(bvm *vm)
+{
+    if (vm->profiler == NULL) {
+        vm->profiler = be_os_malloc(sizeof(bprofiler));
+        if (vm->profiler == NULL) {
+            return bfalse;
+        }
+    }
+    memset(vm->profiler, 0, sizeof(bprofiler));
+    vm->profiler->running = btrue;
+    return btrue;
+}
+
+/* stop sampling, the histogram is kept until the next start */
+void be_profiler_stop(bvm *vm)
+{
+    if (vm->profiler) {
+        vm->profiler->running = bfalse;
+    }
+}
+
+void be_profiler_delete(bvm *vm)
+{
+    be_os_free(vm->profiler);
+    vm->profiler = NULL;
+}
+
+/* called from the VM loop every 2^BE_PROFILER_SAMPLING instructions */
+void be_profiler_sample(bvm *vm)
+{
+    record_frame(vm, 1, 0);
+}
+
+/* called before each allocation or growth of a memory block */
+void be_profiler_alloc(bvm *vm, size_t size)
+{
+    record_frame(vm, 0, (uint32_t)size);
+}
+
+static bbool entry_before(bprofentry *a, bprofentry *b, bbool by_alloc)
+{
+    if (by_alloc) {
+        return a->alloc > b->alloc || (a->alloc == b->alloc && a->samples > b->samples);
+    }
+    return a->samples > b->samples || (a->samples == b->samples && a->alloc > b->alloc);
+}
+
+/* copy the histogram to `out`, which holds BE_PROFILER_SIZE entries,
+ * with the lines of each function merged if `merge_lines` is true,
+ * and sort it by samples or by bytes allocated; returns the entries count */
+int be_profiler_sort(bvm *vm, bprofentry *out, bbool merge_lines, bbool by_alloc)
+{
+    int i, j, count = 0;
+    if (vm->profiler == NULL) {
+        return 0;
+    }
+    for (i = 0; i < BE_PROFILER_SIZE; ++i) {
+        bprofentry *e = &vm->profiler->entries[i];
+        if (e->proto == NULL) {
+            continue;
+        }
+        if (merge_lines) {
+            for (j = 0; j < count && out[j].proto != e->proto; ++j);
+            if (j < count) {
+                out[j].samples += e->samples;
+                out[j].alloc += e->alloc;
+                continue;
+            }
+        }
+        out[count] = *e;
+        if (merge_lines) {
+            out[count].line = 0;
+        }
+        ++count;
+    }
+    for (i = 1; i < count; ++i) { /* insertion sort, the table is small */
+        bprofentry e = out[i];
+        for (j = i; j > 0 && entry_before(&e, &out[j - 1], by_alloc); --j) {
+            out[j] = out[j - 1];
+        }
+        out[j] = e;
+    }
+    return count;
+}
+
+#endif /* BE_USE_PROFILER */
@@ -0,0 +1,26 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#ifndef BE_PROFILER_H
+#define BE_PROFILER_H
+
+#include "be_vm.h"
+
+#if BE_USE_PROFILER
+
+#define be_profiler_running(vm)     ((vm)->profiler != NULL && (vm)->profiler->running)
+
+bbool be_profiler_start(bvm *vm);
+void be_profiler_stop(bvm *vm);
+void be_profiler_delete(bvm *vm);
+void be_profiler_sample(bvm *vm);
+void be_profiler_alloc(bvm *vm, size_t size);
+int be_profiler_sort(bvm *vm, bprofentry *out, bbool merge_lines, bbool by_alloc);
+
+#endif
+
+#endif
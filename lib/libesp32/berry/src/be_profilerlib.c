@@ -0,0 +1,107 @@
+/********************************************************************
+** Copyright (c) 2018-2020 Guan Wenliang
+** This file is part of the Berry default interpreter.
+** skiars@qq.com, https://github.com/Skiars/berry
+** See Copyright Notice in the LICENSE file or at
+** https://github.com/Skiars/berry/blob/master/LICENSE
+********************************************************************/
+#include "be_object.h"
+#include "be_profiler.h"
+#include "be_string.h"
+#include "be_mem.h"
+
+#if BE_USE_PROFILER
+
+/* clear previous results and start sampling */
+static int m_start(bvm *vm)
+{
+    if (!be_profiler_start(vm)) {
+        be_raise(vm, "memory_error", "not enough memory for the profiler");
+    }
+    be_return_nil(vm);
+}
+
+static int m_stop(bvm *vm)
+{
+    be_profiler_stop(vm);
+    be_return_nil(vm);
+}
+
+static void map_setstr(bvm *vm, const char *key, const char *value)
+{
+    be_pushstring(vm, key);
+    be_pushstring(vm, value);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+}
+
+static void map_setint(bvm *vm, const char *key, bint value)
+{
+    be_pushstring(vm, key);
+    be_pushint(vm, value);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+}
+
+/* returns a list of `{'function', 'line', 'samples', 'alloc'}` sorted by samples,
+ * `line` is present only with runtime debug info, with `dump(true)` the lines of
+ * each function are merged; what could not be attributed is in function '<other>' */
+static int m_dump(bvm *vm)
+{
+    int i, count;
+    bbool merge = be_top(vm) >= 1 && be_tobool(vm, 1);
+    bprofentry *entries = be_malloc(vm, sizeof(bprofentry) * BE_PROFILER_SIZE);
+    count = be_profiler_sort(vm, entries, merge, bfalse);
+    be_newobject(vm, "list");
+    for (i = 0; i < count; ++i) {
+        bprofentry *e = &entries[i];
+        be_newobject(vm, "map");
+        map_setstr(vm, "function", str(e->proto->name));
+#if BE_DEBUG_SOURCE_FILE
+        if (e->proto->source && str_len(e->proto->source)) {
+            map_setstr(vm, "source", str(e->proto->source));
+        }
+#endif
+        if (e->line) {
+            map_setint(vm, "line", e->line);
+        }
+        map_setint(vm, "samples", e->samples);
+        map_setint(vm, "alloc", e->alloc);
+        be_pop(vm, 1);
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+    }
+    be_free(vm, entries, sizeof(bprofentry) * BE_PROFILER_SIZE);
+    if (vm->profiler && (vm->profiler->other_samples || vm->profiler->other_alloc)) {
+        be_newobject(vm, "map");
+        map_setstr(vm, "function", "<other>");
+        map_setint(vm, "samples", vm->profiler->other_samples);
+        map_setint(vm, "alloc", vm->profiler->other_alloc);
+        be_pop(vm, 1);
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_return(vm);
+}
+
+#if !BE_USE_PRECOMPILED_OBJECT
+be_native_module_attr_table(profiler){
+    be_native_module_function("start", m_start),
+    be_native_module_function("stop", m_stop),
+    be_native_module_function("dump", m_dump),
+};
+
+be_define_native_module(profiler, NULL);
+#else
+/* @const_object_info_begin
+module profiler (scope: global, depend: BE_USE_PROFILER) {
+    start, func(m_start)
+    stop, func(m_stop)
+    dump, func(m_dump)
+}
+@const_object_info_end */
+#include "../generate/be_fixed_profiler.h"
+#endif
+
+#endif /* BE_USE_PROFILER */
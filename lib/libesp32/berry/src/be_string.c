@@ -201,6 +201,11 @@ static bstring* newshortstr(bvm *vm, const char *str, size_t len)
 
     for (s = *list; s != NULL; s = next(s)) {
         if (len == s->slen && !strncmp(str, sstr(s), len)) {
+#if BE_USE_INCREMENTAL_GC
+            if (vm->gc.state == GC_STATE_DESTRUCT) {
+                gc_setdark(s); /* may be unreachable but is used again */
+            }
+#endif
             return s;
         }
     }
@@ -21,6 +21,7 @@
 #include "be_exec.h"
 #include "be_debug.h"
 #include "be_libs.h"
+#include "be_profiler.h"
 #include <string.h>
 #include <math.h>
 
@@ -55,7 +56,18 @@
   #define COUNTER_HOOK()
 #endif
 
-#if BE_USE_PERF_COUNTERS
+#if BE_USE_PERF_COUNTERS && BE_USE_PROFILER
+  /* the profiler is sampled every 2^BE_PROFILER_SAMPLING instructions, the heartbeat
+   * is tested inside since its period is a multiple, so there is still one test per instruction */
+  #define VM_HEARTBEAT() \
+    if ((vm->counter_ins & ((1<<BE_PROFILER_SAMPLING)-1)) == 0) {                  \
+        if (be_profiler_running(vm))                                                \
+            be_profiler_sample(vm);                                                 \
+        if ((vm->counter_ins & ((1<<(BE_VM_OBSERVABILITY_SAMPLING - 1))-1) ) == 0   \
+                && vm->obshook != NULL)                                             \
+            (*vm->obshook)(vm, BE_OBS_VM_HEARTBEAT, vm->counter_ins);               \
+    }
+#elif BE_USE_PERF_COUNTERS
   #define VM_HEARTBEAT() \
     if ((vm->counter_ins & ((1<<(BE_VM_OBSERVABILITY_SAMPLING - 1))-1) ) == 0) { /* call every 2^BE_VM_OBSERVABILITY_SAMPLING instructions */    \
         if (vm->obshook != NULL)                                                    \
@@ -65,12 +77,39 @@
   #define VM_HEARTBEAT()
 #endif
 
-#define vm_exec_loop() \
-    loop: \
-        DEBUG_HOOK(); \
-        COUNTER_HOOK(); \
-        VM_HEARTBEAT(); \
-        switch (IGET_OP(ins = *vm->ip++))
+/* direct threaded dispatch needs GCC labels as values */
+#if BE_USE_COMPUTED_GOTO && defined(__GNUC__)
+  #define VM_THREADED       1
+#else
+  #define VM_THREADED       0
+#endif
+
+#if VM_THREADED
+  /* each instruction jumps to the handler of the next one through `dispatch_table` */
+  #if BE_USE_DEBUG_HOOK || BE_USE_PERF_COUNTERS
+    /* hooks are run from a single place to keep code size small */
+    #define vm_exec_loop() \
+        loop: \
+            DEBUG_HOOK(); \
+            COUNTER_HOOK(); \
+            VM_HEARTBEAT(); \
+            goto *dispatch_table[IGET_OP(ins = *vm->ip++)];
+    #define dispatch()      goto loop
+  #else
+    #define vm_exec_loop()  dispatch();
+    #define dispatch()      goto *dispatch_table[IGET_OP(ins = *vm->ip++)]
+  #endif
+  #define opcase(opcode)    op_##opcode
+#else
+  #define vm_exec_loop() \
+      loop: \
+          DEBUG_HOOK(); \
+          COUNTER_HOOK(); \
+          VM_HEARTBEAT(); \
+          switch (IGET_OP(ins = *vm->ip++))
+  #define opcase(opcode)    case OP_##opcode
+  #define dispatch()        goto loop
+#endif
 
 #if BE_USE_SINGLE_FLOAT
   #define mathfunc(func)    func##f
@@ -78,8 +117,6 @@
   #define mathfunc(func)    func
 #endif
 
-#define opcase(opcode)      case OP_##opcode
-#define dispatch()          goto loop
 
 #define equal_rule(op, iseq) \
     bbool res; \
@@ -333,9 +370,64 @@ static void obj_method(bvm *vm, bvalue *o, bstring *attr, bvalue *dst)
     }
 }
 
+#if BE_USE_MEMBER_CACHE
+#define mbrcache_entry(vm, ip)  (&(vm)->mbrcache[((size_t)(ip) / sizeof(binstruction)) & (BE_MEMBER_CACHE_SIZE - 1)])
+
+void be_vm_mbrcache_flush(bvm *vm)
+{
+    memset(vm->mbrcache, 0, sizeof(vm->mbrcache));
+}
+
+/* Find an instance member using the cache entry of the current instruction */
+/* Returns the member in the class map or NULL if not found (virtual members are not cached) */
+/* `obj` is updated to the superinstance holding the member */
+static bvalue* mbrcache_find(bvm *vm, binstance **obj, bstring *attr)
+{
+    bmbrcache *e = mbrcache_entry(vm, vm->ip);
+    binstance *o = *obj;
+    bvalue *slot;
+    int depth;
+    if (e->ip == vm->ip && e->cls == o->_class && e->name == attr) {
+#if BE_USE_PERF_COUNTERS
+        vm->counter_mbrcache_hit++;
+#endif
+        slot = e->slot;
+        depth = e->depth;
+    } else {
+#if BE_USE_PERF_COUNTERS
+        vm->counter_mbrcache_miss++;
+#endif
+        slot = be_instance_member_slot(vm, o, attr, &depth);
+        if (slot == NULL) {
+            return NULL;
+        }
+        e->ip = vm->ip;
+        e->cls = o->_class;
+        e->name = attr;
+        e->slot = slot;
+        e->depth = depth;
+    }
+    while (depth--) {
+        o = o->super;
+    }
+    *obj = o;
+    return slot;
+}
+#endif
+
 static int obj_attribute(bvm *vm, bvalue *o, bstring *attr, bvalue *dst)
 {
     binstance *obj = var_toobj(o);
+#if BE_USE_MEMBER_CACHE
+    bvalue *slot = mbrcache_find(vm, &obj, attr);
+    if (slot) {
+        *dst = (var_type(slot) == MT_VARIABLE) ? obj->members[slot->v.i] : *slot;
+        int type = var_type(dst);
+        var_clearstatic(dst);
+        return type;
+    }
+    obj = var_toobj(o);     /* not found, try virtual members */
+#endif
     int type = be_instance_member(vm, obj, attr, dst);
     if (type == BE_NONE) {
         vm_error(vm, "attribute_error",
@@ -507,6 +599,8 @@ BERRY_API bvm* be_vm_new(void)
     vm->counter_call = 0;
     vm->counter_get = 0;
     vm->counter_set = 0;
+    vm->counter_mbrcache_hit = 0;
+    vm->counter_mbrcache_miss = 0;
     vm->counter_get_global = 0;
     vm->counter_try = 0;
     vm->counter_exc = 0;
@@ -521,6 +615,9 @@ BERRY_API bvm* be_vm_new(void)
 
 BERRY_API void be_vm_delete(bvm *vm)
 {
+#if BE_USE_PROFILER
+    be_profiler_delete(vm);
+#endif
     be_gc_deleteall(vm);
     be_string_deleteall(vm);
     be_stack_delete(vm, &vm->callstack);
@@ -544,6 +641,14 @@ static void vm_exec(bvm *vm)
     bclosure *clos;
     bvalue *ktab, *reg;
     binstruction ins;
+#if VM_THREADED
+    /* handlers in opcode order, opcodes are only produced by the compiler or the bytecode loader */
+    static const void *const dispatch_table[] = {
+        #define OPCODE(opc) &&op_##opc
+        #include "be_opcodes.h"
+        #undef OPCODE
+    };
+#endif
     vm->cf->status |= BASE_FRAME;
 newframe: /* a new call frame */
     be_assert(var_isclosure(vm->cf->func));
@@ -631,6 +736,7 @@ newframe: /* a new call frame */
             int idx = IGET_Bx(ins);
             be_assert(*clos->upvals != NULL);
             *clos->upvals[idx]->value = *v;
+            be_gc_barrier(vm, v);
             dispatch();
         }
         opcase(MOVE): {
@@ -1006,6 +1112,15 @@ newframe: /* a new call frame */
                 if (var_isfunction(&result)) {
                     var_markstatic(&result);
                 }
+#if BE_USE_MEMBER_CACHE
+                binstance *holder = obj;
+                bvalue *slot = mbrcache_find(vm, &holder, attr);
+                if (slot && var_type(slot) == MT_VARIABLE) {
+                    be_gc_barrierback(vm, holder);
+                    holder->members[slot->v.i] = result;
+                    dispatch();
+                }
+#endif
                 if (!be_instance_setmember(vm, obj, attr, &result)) {
                     reg = vm->reg;
                     vm_error(vm, "attribute_error",
@@ -29,6 +29,8 @@ typedef enum {
     COMP_GC_DEBUG = 0x02,   /* compile with gc debug */
 } compoptmask;
 
+#define BE_GC_PAUSE_BUCKETS     8   /* number of buckets of the GC pause histogram */
+
 typedef struct {
     struct {
         bmap *vtab; /* global variable index table */
@@ -63,6 +65,13 @@ struct bgc {
     size_t threshold; /* he threshold of allocation for the next GC */
     bbyte steprate; /* the rate of increase in the distribution between two GCs (percentage) */
     bbyte status;
+#if BE_USE_INCREMENTAL_GC
+    uint16_t budget; /* units of work done by each incremental step */
+    bbyte state; /* phase of the current collection, see `bgcstate` */
+    bgcobject *scan; /* next object of the list to visit in the mark and destruct phases */
+    bgcobject *again; /* gray objects left to the final atomic mark */
+    bgcobject **sweep; /* next link to sweep, NULL if no sweep is pending */
+#endif
 };
 
 struct bstringtable {
@@ -81,6 +90,34 @@ typedef struct {
     binstruction *ip;
 } bcallsnapshot;
 
+#if BE_USE_MEMBER_CACHE
+/* result of an instance member lookup, cached per instruction */
+typedef struct {
+    const binstruction *ip; /* instruction that did the lookup */
+    bclass *cls; /* class of the instance */
+    bstring *name; /* member name */
+    bvalue *slot; /* member in the class map, value or variable index */
+    int depth; /* number of superinstances to walk to reach the member */
+} bmbrcache;
+#endif
+
+#if BE_USE_PROFILER
+/* entry of the profiler histogram */
+typedef struct {
+    bproto *proto; /* function, NULL if the entry is free */
+    int line; /* line in the function, 0 without runtime debug info */
+    uint32_t samples; /* count of samples */
+    uint32_t alloc; /* bytes allocated */
+} bprofentry;
+
+typedef struct bprofiler {
+    bbool running;
+    uint32_t other_samples; /* samples that did not fit in the histogram */
+    uint32_t other_alloc; /* bytes allocated outside of Berry functions or not fitting in the histogram */
+    bprofentry entries[BE_PROFILER_SIZE];
+} bprofiler;
+#endif
+
 struct bupval {
     bvalue* value;
     union {
@@ -113,12 +150,20 @@ struct bvm {
     int32_t bytesmaxsize; /* max allowed size for bytes() object, default 32kb but can be increased */
     bobshook obshook;
     bmicrosfnct microsfnct; /* fucntion to get time as a microsecond resolution */
+#if BE_USE_MEMBER_CACHE
+    bmbrcache mbrcache[BE_MEMBER_CACHE_SIZE]; /* member lookup cache, indexed by instruction address */
+#endif
+#if BE_USE_PROFILER
+    bprofiler *profiler; /* sampling profiler, allocated when first started */
+#endif
 #if BE_USE_PERF_COUNTERS
     uint32_t counter_ins; /* instructions counter */
     uint32_t counter_enter; /* counter for times the VM was entered */
     uint32_t counter_call; /* counter for calls, VM or native */
     uint32_t counter_get; /* counter for GETMBR or GETMET */
     uint32_t counter_set; /* counter for SETMBR */
+    uint32_t counter_mbrcache_hit; /* counter for member lookups found in cache */
+    uint32_t counter_mbrcache_miss; /* counter for member lookups not found in cache */
     uint32_t counter_get_global; /* counter for GETNBGL */
     uint32_t counter_try; /* counter for `try` statement */
     uint32_t counter_exc; /* counter for raised exceptions */
@@ -145,6 +190,11 @@ struct bvm {
     uint32_t gc_mark_ntvclos;
     uint32_t gc_mark_module;
     uint32_t gc_mark_comobj;
+
+    uint32_t gc_pause_max; /* longest GC pause in microseconds */
+    uint32_t gc_pauses[BE_GC_PAUSE_BUCKETS]; /* histogram of GC pauses, see be_gc.c */
+    size_t gc_slots_used; /* memory pool slots used before the last GC */
+    size_t gc_slots_allocated; /* memory pool slots allocated before the last GC */
 #endif
 #if BE_USE_DEBUG_HOOK
     bvalue hook;
@@ -165,5 +215,10 @@ bbool be_vm_islt(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isle(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isgt(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isge(bvm *vm, bvalue *a, bvalue *b);
+#if BE_USE_MEMBER_CACHE
+void be_vm_mbrcache_flush(bvm *vm);
+#else
+#define be_vm_mbrcache_flush(vm)
+#endif
 
 #endif
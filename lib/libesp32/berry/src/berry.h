@@ -2217,6 +2217,23 @@ BERRY_API int be_loadbuffer(bvm *vm, const char *name, const char *buffer, size_
  */
 BERRY_API int be_loadmode(bvm *vm, const char *name, bbool islocal);
 
+/**
+ * @fn int be_loadbytecode(bvm*, const void*, size_t, bbool)
+ * @note code load API
+ * @brief Load precompiled bytecode from memory and push the closure on the stack
+ *
+ * When `inplace` is true, instructions are used directly from `data` instead of
+ * being copied, whenever they are 4-bytes aligned and need no relocation.
+ * `data` must then stay valid and unchanged, typically a memory-mapped flash partition.
+ *
+ * @param vm virtual machine instance
+ * @param data bytecode image, as saved by be_savecode()
+ * @param size size of the image in bytes
+ * @param inplace use instructions in place from `data` when possible
+ * @return BE_OK on success, or an error code with the error message on the stack
+ */
+BERRY_API int be_loadbytecode(bvm *vm, const void *data, size_t size, bbool inplace);
+
 /**
  * @fn int be_loadlib(bvm*, const char*)
  * @note code load API
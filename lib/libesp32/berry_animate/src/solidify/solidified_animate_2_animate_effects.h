@@ -317,7 +317,7 @@ be_local_closure(Animate_pulse_paint,   /* name */
     }),
     be_str_weak(paint),
     &be_const_str_solidified,
-    ( &(const binstruction[91]) {  /* code */
+    ( &(const binstruction[87]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
       0x200C0501,  //  0001  NE	R3	R2	K1
       0x780E0002,  //  0002  JMPF	R3	#0006
@@ -332,83 +332,79 @@ be_local_closure(Animate_pulse_paint,   /* name */
       0x4C200000,  //  000B  LDNIL	R8
       0x4C240000,  //  000C  LDNIL	R9
       0x5C200600,  //  000D  MOVE	R8	R3
-      0x00280605,  //  000E  ADD	R10	R3	R5
-      0x5C241400,  //  000F  MOVE	R9	R10
-      0x14281108,  //  0010  LT	R10	R8	K8
-      0x782A0000,  //  0011  JMPF	R10	#0013
-      0x58200008,  //  0012  LDCONST	R8	K8
-      0x28281207,  //  0013  GE	R10	R9	R7
-      0x782A0000,  //  0014  JMPF	R10	#0016
-      0x5C240E00,  //  0015  MOVE	R9	R7
-      0x5C281000,  //  0016  MOVE	R10	R8
-      0x142C1409,  //  0017  LT	R11	R10	R9
-      0x782E0002,  //  0018  JMPF	R11	#001C
-      0x98041406,  //  0019  SETIDX	R1	R10	R6
-      0x00281509,  //  001A  ADD	R10	R10	K9
-      0x7001FFFA,  //  001B  JMP		#0017
-      0x242C0908,  //  001C  GT	R11	R4	K8
-      0x782E003A,  //  001D  JMPF	R11	#0059
-      0x042C0604,  //  001E  SUB	R11	R3	R4
-      0x5C201600,  //  001F  MOVE	R8	R11
-      0x5C240600,  //  0020  MOVE	R9	R3
-      0x142C1108,  //  0021  LT	R11	R8	K8
-      0x782E0000,  //  0022  JMPF	R11	#0024
-      0x58200008,  //  0023  LDCONST	R8	K8
-      0x282C1207,  //  0024  GE	R11	R9	R7
-      0x782E0000,  //  0025  JMPF	R11	#0027
-      0x5C240E00,  //  0026  MOVE	R9	R7
-      0x5C281000,  //  0027  MOVE	R10	R8
-      0x142C1409,  //  0028  LT	R11	R10	R9
-      0x782E000F,  //  0029  JMPF	R11	#003A
-      0x8C2C030A,  //  002A  GETMET	R11	R1	K10
-      0x5C340400,  //  002B  MOVE	R13	R2
-      0x5C380C00,  //  002C  MOVE	R14	R6
-      0xB83E1600,  //  002D  GETNGBL	R15	K11
-      0x8C3C1F0C,  //  002E  GETMET	R15	R15	K12
-      0x5C441400,  //  002F  MOVE	R17	R10
-      0x04480604,  //  0030  SUB	R18	R3	R4
-      0x04482509,  //  0031  SUB	R18	R18	K9
-      0x5C4C0600,  //  0032  MOVE	R19	R3
-      0x545200FE,  //  0033  LDINT	R20	255
-      0x58540008,  //  0034  LDCONST	R21	K8
-      0x7C3C0C00,  //  0035  CALL	R15	6
-      0x7C2C0800,  //  0036  CALL	R11	4
-      0x9804140B,  //  0037  SETIDX	R1	R10	R11
-      0x00281509,  //  0038  ADD	R10	R10	K9
-      0x7001FFED,  //  0039  JMP		#0028
-      0x002C0605,  //  003A  ADD	R11	R3	R5
-      0x5C201600,  //  003B  MOVE	R8	R11
-      0x002C0605,  //  003C  ADD	R11	R3	R5
-      0x002C1604,  //  003D  ADD	R11	R11	R4
-      0x5C241600,  //  003E  MOVE	R9	R11
-      0x142C1108,  //  003F  LT	R11	R8	K8
-      0x782E0000,  //  0040  JMPF	R11	#0042
-      0x58200008,  //  0041  LDCONST	R8	K8
-      0x282C1207,  //  0042  GE	R11	R9	R7
-      0x782E0000,  //  0043  JMPF	R11	#0045
-      0x5C240E00,  //  0044  MOVE	R9	R7
-      0x5C281000,  //  0045  MOVE	R10	R8
-      0x142C1409,  //  0046  LT	R11	R10	R9
-      0x782E0010,  //  0047  JMPF	R11	#0059
-      0x8C2C030A,  //  0048  GETMET	R11	R1	K10
-      0x5C340400,  //  0049  MOVE	R13	R2
-      0x5C380C00,  //  004A  MOVE	R14	R6
-      0xB83E1600,  //  004B  GETNGBL	R15	K11
-      0x8C3C1F0C,  //  004C  GETMET	R15	R15	K12
-      0x5C441400,  //  004D  MOVE	R17	R10
-      0x00480605,  //  004E  ADD	R18	R3	R5
-      0x04482509,  //  004F  SUB	R18	R18	K9
-      0x004C0605,  //  0050  ADD	R19	R3	R5
-      0x004C2604,  //  0051  ADD	R19	R19	R4
-      0x58500008,  //  0052  LDCONST	R20	K8
-      0x545600FE,  //  0053  LDINT	R21	255
-      0x7C3C0C00,  //  0054  CALL	R15	6
-      0x7C2C0800,  //  0055  CALL	R11	4
-      0x9804140B,  //  0056  SETIDX	R1	R10	R11
-      0x00281509,  //  0057  ADD	R10	R10	K9
-      0x7001FFEC,  //  0058  JMP		#0046
-      0x502C0200,  //  0059  LDBOOL	R11	1	0
-      0x80041600,  //  005A  RET	1	R11
+      0x00240605,  //  000E  ADD	R9	R3	R5
+      0x14281108,  //  000F  LT	R10	R8	K8
+      0x782A0000,  //  0010  JMPF	R10	#0012
+      0x58200008,  //  0011  LDCONST	R8	K8
+      0x28281207,  //  0012  GE	R10	R9	R7
+      0x782A0000,  //  0013  JMPF	R10	#0015
+      0x5C240E00,  //  0014  MOVE	R9	R7
+      0x5C281000,  //  0015  MOVE	R10	R8
+      0x142C1409,  //  0016  LT	R11	R10	R9
+      0x782E0002,  //  0017  JMPF	R11	#001B
+      0x98041406,  //  0018  SETIDX	R1	R10	R6
+      0x00281509,  //  0019  ADD	R10	R10	K9
+      0x7001FFFA,  //  001A  JMP		#0016
+      0x242C0908,  //  001B  GT	R11	R4	K8
+      0x782E0037,  //  001C  JMPF	R11	#0055
+      0x04200604,  //  001D  SUB	R8	R3	R4
+      0x5C240600,  //  001E  MOVE	R9	R3
+      0x142C1108,  //  001F  LT	R11	R8	K8
+      0x782E0000,  //  0020  JMPF	R11	#0022
+      0x58200008,  //  0021  LDCONST	R8	K8
+      0x282C1207,  //  0022  GE	R11	R9	R7
+      0x782E0000,  //  0023  JMPF	R11	#0025
+      0x5C240E00,  //  0024  MOVE	R9	R7
+      0x5C281000,  //  0025  MOVE	R10	R8
+      0x142C1409,  //  0026  LT	R11	R10	R9
+      0x782E000F,  //  0027  JMPF	R11	#0038
+      0x8C2C030A,  //  0028  GETMET	R11	R1	K10
+      0x5C340400,  //  0029  MOVE	R13	R2
+      0x5C380C00,  //  002A  MOVE	R14	R6
+      0xB83E1600,  //  002B  GETNGBL	R15	K11
+      0x8C3C1F0C,  //  002C  GETMET	R15	R15	K12
+      0x5C441400,  //  002D  MOVE	R17	R10
+      0x04480604,  //  002E  SUB	R18	R3	R4
+      0x04482509,  //  002F  SUB	R18	R18	K9
+      0x5C4C0600,  //  0030  MOVE	R19	R3
+      0x545200FE,  //  0031  LDINT	R20	255
+      0x58540008,  //  0032  LDCONST	R21	K8
+      0x7C3C0C00,  //  0033  CALL	R15	6
+      0x7C2C0800,  //  0034  CALL	R11	4
+      0x9804140B,  //  0035  SETIDX	R1	R10	R11
+      0x00281509,  //  0036  ADD	R10	R10	K9
+      0x7001FFED,  //  0037  JMP		#0026
+      0x00200605,  //  0038  ADD	R8	R3	R5
+      0x002C0605,  //  0039  ADD	R11	R3	R5
+      0x00241604,  //  003A  ADD	R9	R11	R4
+      0x142C1108,  //  003B  LT	R11	R8	K8
+      0x782E0000,  //  003C  JMPF	R11	#003E
+      0x58200008,  //  003D  LDCONST	R8	K8
+      0x282C1207,  //  003E  GE	R11	R9	R7
+      0x782E0000,  //  003F  JMPF	R11	#0041
+      0x5C240E00,  //  0040  MOVE	R9	R7
+      0x5C281000,  //  0041  MOVE	R10	R8
+      0x142C1409,  //  0042  LT	R11	R10	R9
+      0x782E0010,  //  0043  JMPF	R11	#0055
+      0x8C2C030A,  //  0044  GETMET	R11	R1	K10
+      0x5C340400,  //  0045  MOVE	R13	R2
+      0x5C380C00,  //  0046  MOVE	R14	R6
+      0xB83E1600,  //  0047  GETNGBL	R15	K11
+      0x8C3C1F0C,  //  0048  GETMET	R15	R15	K12
+      0x5C441400,  //  0049  MOVE	R17	R10
+      0x00480605,  //  004A  ADD	R18	R3	R5
+      0x04482509,  //  004B  SUB	R18	R18	K9
+      0x004C0605,  //  004C  ADD	R19	R3	R5
+      0x004C2604,  //  004D  ADD	R19	R19	R4
+      0x58500008,  //  004E  LDCONST	R20	K8
+      0x545600FE,  //  004F  LDINT	R21	255
+      0x7C3C0C00,  //  0050  CALL	R15	6
+      0x7C2C0800,  //  0051  CALL	R11	4
+      0x9804140B,  //  0052  SETIDX	R1	R10	R11
+      0x00281509,  //  0053  ADD	R10	R10	K9
+      0x7001FFEC,  //  0054  JMP		#0042
+      0x502C0200,  //  0055  LDBOOL	R11	1	0
+      0x80041600,  //  0056  RET	1	R11
     })
   )
 );
@@ -297,13 +297,13 @@ be_local_closure(Animate_palette_ptr_to_palette,   /* name */
       0x20100903,  //  000C  NE	R4	R4	K3
       0x7812000A,  //  000D  JMPF	R4	#0019
       0x50100200,  //  000E  LDBOOL	R4	1	0
-      0x78120007,  //  000F  JMPF	R4	#0018
+      0x78120013,  //  000F  JMPF	R4	#0024
       0x54120003,  //  0010  LDINT	R4	4
       0x08100604,  //  0011  MUL	R4	R3	R4
       0x94100404,  //  0012  GETIDX	R4	R2	R4
       0x1C100903,  //  0013  EQ	R4	R4	K3
       0x78120000,  //  0014  JMPF	R4	#0016
-      0x70020001,  //  0015  JMP		#0018
+      0x7002000D,  //  0015  JMP		#0024
       0x000C0702,  //  0016  ADD	R3	R3	K2
       0x7001FFF5,  //  0017  JMP		#000E
       0x7002000A,  //  0018  JMP		#0024
@@ -807,7 +807,7 @@ be_local_closure(Animate_palette_parse_palette,   /* name */
       0x581C0004,  //  001B  LDCONST	R7	K4
       0x58180004,  //  001C  LDCONST	R6	K4
       0x14200C04,  //  001D  LT	R8	R6	R4
-      0x78220011,  //  001E  JMPF	R8	#0031
+      0x78220026,  //  001E  JMPF	R8	#0046
       0xB8220C00,  //  001F  GETNGBL	R8	K6
       0x8C201107,  //  0020  GETMET	R8	R8	K7
       0x5C280E00,  //  0021  MOVE	R10	R7
@@ -1494,7 +1494,7 @@ be_local_closure(Animate_oscillator_animate,   /* name */
       0x5C3C0C00,  //  0052  MOVE	R15	R6
       0x7C240C00,  //  0053  CALL	R9	6
       0x5C1C1200,  //  0054  MOVE	R7	R9
-      0x70020008,  //  0055  JMP		#005F
+      0x7002002C,  //  0055  JMP		#0083
       0xB8260200,  //  0056  GETNGBL	R9	K1
       0x8C24130E,  //  0057  GETMET	R9	R9	K14
       0x5C2C1000,  //  0058  MOVE	R11	R8
@@ -1511,7 +1511,7 @@ be_local_closure(Animate_oscillator_animate,   /* name */
       0x14241004,  //  0063  LT	R9	R8	R4
       0x78260001,  //  0064  JMPF	R9	#0067
       0x5C1C0A00,  //  0065  MOVE	R7	R5
-      0x70020000,  //  0066  JMP		#0068
+      0x7002001B,  //  0066  JMP		#0083
       0x5C1C0C00,  //  0067  MOVE	R7	R6
       0x70020019,  //  0068  JMP		#0083
       0x8824010C,  //  0069  GETMBR	R9	R0	K12
@@ -194,6 +194,17 @@ BE_FUNC_CTYPE_DECLARE(matter_get_ip_bytes, "&", "s")
 
 extern int matter_publish_command(bvm *vm);
 
+// Native TLV codec, see be_matter_tlv.c
+extern int matter_tlv_parse(bvm *vm);
+extern int matter_tlv_encode(bvm *vm);
+extern int matter_tlv_len(bvm *vm);
+extern int matter_tlv_next(bvm *vm);
+extern int matter_tlv_child(bvm *vm);
+extern int matter_tlv_count(bvm *vm);
+extern int matter_tlv_find(bvm *vm);
+extern int matter_tlv_value(bvm *vm);
+extern int matter_tlv_sub(bvm *vm);
+
 #include "solidify/solidified_Matter_0_Inspect.h"
 
 extern const bclass be_class_Matter_TLV;   // need to declare it upfront because of circular reference
@@ -746,6 +757,15 @@ module matter (scope: global, strings: weak) {
   get_command_name, ctype_func(matter_get_command_name)
   get_opcode_name, ctype_func(matter_get_opcode_name)
   TLV, class(be_class_Matter_TLV)
+  _tlv_parse, func(matter_tlv_parse)
+  _tlv_encode, func(matter_tlv_encode)
+  _tlv_len, func(matter_tlv_len)
+  _tlv_next, func(matter_tlv_next)
+  _tlv_child, func(matter_tlv_child)
+  _tlv_count, func(matter_tlv_count)
+  _tlv_find, func(matter_tlv_find)
+  _tlv_value, func(matter_tlv_value)
+  _tlv_sub, func(matter_tlv_sub)
   sort, closure(matter_sort_closure)
   jitter, closure(matter_jitter_closure)
   inspect, closure(matter_inspect_closure)
@@ -0,0 +1,778 @@
+/*
+  be_matter_tlv.c - native Matter TLV encoder and decoder
+
+  Copyright (C) 2023  Stephan Hadinger & Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/********************************************************************
+ * Native TLV codec used by `matter.TLV`
+ *
+ * `_tlv_parse` builds the same tree of `Matter_TLV_item/list/struct/array`
+ * as the former Berry parser, `_tlv_encode` and `_tlv_len` walk such a tree
+ * and replace `tlv2raw()` and `encode_len()`.
+ * The `_tlv_next/find/child/count/value/sub` functions read elements in place
+ * from the raw buffer, they back `Matter_TLV_view` which decodes lazily.
+ *
+ * This file only uses the Berry API so it is also compiled in the host
+ * Berry used for solidification and tests.
+ *******************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include "berry.h"
+
+#define TLV_I1        0x00
+#define TLV_I2        0x01
+#define TLV_I4        0x02
+#define TLV_I8        0x03
+#define TLV_U1        0x04
+#define TLV_U2        0x05
+#define TLV_U4        0x06
+#define TLV_U8        0x07
+#define TLV_BFALSE    0x08
+#define TLV_BTRUE     0x09
+#define TLV_FLOAT     0x0A
+#define TLV_DOUBLE    0x0B
+#define TLV_UTF1      0x0C
+#define TLV_UTF2      0x0D
+#define TLV_UTF4      0x0E
+#define TLV_UTF8      0x0F
+#define TLV_B1        0x10
+#define TLV_B2        0x11
+#define TLV_B4        0x12
+#define TLV_B8        0x13
+#define TLV_NULL      0x14
+#define TLV_STRUCT    0x15
+#define TLV_ARRAY     0x16
+#define TLV_LIST      0x17
+#define TLV_EOC       0x18
+#define TLV_RAW       0xFF
+
+#define TLV_MAX_DEPTH 24      // Matter messages are nested at most ~8 levels
+
+// same as `Matter_TLV._len`, negative values are length prefixed, 0 is no value
+static const int8_t tlv_len[] = {
+  1, 2, 4, 8, 1, 2, 4, 8,
+  0, 0, 4, 8,
+  -1, -2, -4, -8,
+  -1, -2, -4, -8,
+  0, 0, 0, 0, 0
+};
+
+static void tlv_raise_truncated(bvm *vm) {
+  be_raise(vm, "TLV_error", "TLV truncated");
+}
+
+static void tlv_raise_type(bvm *vm, int typ) {
+  char msg[32];
+  snprintf(msg, sizeof(msg), "invalid TLV type %i", typ);
+  be_raise(vm, "TLV_error", msg);
+}
+
+static uint32_t tlv_get(const uint8_t *p, int n) {
+  uint32_t v = 0;
+  while (n-- > 0) { v = (v << 8) | p[n]; }
+  return v;
+}
+
+/*********************************************************************************************\
+ * Decoding
+\*********************************************************************************************/
+
+typedef struct {
+  int32_t vendor, profile, number, sub;
+  bbool has_vendor, has_profile, has_number, has_sub;
+} tlv_tag;
+
+// decode the control byte and the tag of the element at `idx`
+// returns the index of the value, which is also the first child of containers
+static size_t tlv_head(bvm *vm, const uint8_t *buf, size_t len, size_t idx, int *typ, tlv_tag *tag) {
+  if (idx >= len) { tlv_raise_truncated(vm); }
+  int tag_control = buf[idx] & 0xE0;
+  *typ = buf[idx] & 0x1F;
+  idx++;
+  if (*typ > TLV_EOC) { tlv_raise_type(vm, *typ); }
+  memset(tag, 0, sizeof(tlv_tag));
+
+  if (tag_control == 0xC0 || tag_control == 0xE0) {       // vendor and profile
+    if (idx + 4 > len) { tlv_raise_truncated(vm); }
+    tag->vendor = tlv_get(buf + idx, 2);
+    tag->profile = tlv_get(buf + idx + 2, 2);
+    tag->has_vendor = tag->has_profile = btrue;
+    idx += 4;
+  } else if (tag_control == 0x40 || tag_control == 0x60) { // Matter common profile
+    tag->profile = -1;
+    tag->has_profile = btrue;
+  }
+  if (tag_control == 0x20) {                              // context specific tag
+    if (idx + 1 > len) { tlv_raise_truncated(vm); }
+    tag->sub = buf[idx];
+    tag->has_sub = btrue;
+    idx += 1;
+  } else if (tag_control != 0x00) {
+    int n = (tag_control == 0xC0 || tag_control == 0x80 || tag_control == 0x40) ? 2 : 4;
+    if (idx + n > len) { tlv_raise_truncated(vm); }
+    tag->number = (int32_t) tlv_get(buf + idx, n);
+    tag->has_number = btrue;
+    idx += n;
+  }
+  return idx;
+}
+
+// size of the value of a scalar element whose value starts at `idx`, including its length prefix
+static size_t tlv_value_len(bvm *vm, const uint8_t *buf, size_t len, size_t idx, int typ) {
+  int item_len = tlv_len[typ];
+  size_t n;
+  if (item_len >= 0) {
+    n = item_len;
+  } else if (item_len == -8) {
+    be_raise(vm, "TLV_error", "unsupported TLV 8 bytes length");
+  } else {
+    if (idx - item_len > len) { tlv_raise_truncated(vm); }
+    n = -item_len + tlv_get(buf + idx, -item_len);
+  }
+  if (idx + n > len || idx + n < idx) { tlv_raise_truncated(vm); }
+  return n;
+}
+
+// returns the index following the element at `idx`, with all its children
+static size_t tlv_skip(bvm *vm, const uint8_t *buf, size_t len, size_t idx, int depth) {
+  int typ;
+  tlv_tag tag;
+  if (depth > TLV_MAX_DEPTH) { be_raise(vm, "TLV_error", "TLV nested too deep"); }
+  idx = tlv_head(vm, buf, len, idx, &typ, &tag);
+  if (typ >= TLV_STRUCT && typ <= TLV_LIST) {
+    while (1) {
+      if (idx >= len) { tlv_raise_truncated(vm); }
+      if (buf[idx] == TLV_EOC) { break; }
+      idx = tlv_skip(vm, buf, len, idx, depth + 1);
+    }
+    return idx + 1;
+  }
+  return idx + tlv_value_len(vm, buf, len, idx, typ);
+}
+
+// push the value of a scalar element, `raw` is the stack index of the bytes() buffer
+// pushes nil for NULL, EOC and containers
+static void tlv_push_value(bvm *vm, int raw, const uint8_t *buf, size_t len, size_t idx, int typ) {
+  size_t n = (typ < TLV_STRUCT) ? tlv_value_len(vm, buf, len, idx, typ) : 0;
+  int item_len = tlv_len[typ];
+  if (item_len == 8) {                                    // i64 / u64 / double
+    if (!be_getglobal(vm, "int64")) { be_raise(vm, "TLV_error", "int64 not available"); }
+    be_getmember(vm, -1, "frombytes");
+    be_pushvalue(vm, raw);
+    be_pushint(vm, idx);
+    be_call(vm, 2);
+    be_moveto(vm, -3, -4);
+    be_pop(vm, 3);
+  } else if (typ == TLV_BFALSE || typ == TLV_BTRUE) {
+    be_pushbool(vm, typ == TLV_BTRUE);
+  } else if (typ < TLV_U8) {                              // i1/i2/i4 u1/u2/u4, as 32 bits like `bytes.get()`
+    uint32_t v = tlv_get(buf + idx, item_len);
+    if (typ <= TLV_I8) {
+      if (item_len == 1) { v = (int8_t) v; }
+      if (item_len == 2) { v = (int16_t) v; }
+    }
+    be_pushint(vm, (int32_t) v);
+  } else if (typ == TLV_FLOAT) {
+    union { uint32_t i; float f; } u;
+    u.i = tlv_get(buf + idx, 4);
+    be_pushreal(vm, (breal) u.f);
+  } else if (item_len < 0) {                              // length prefixed bytes or string
+    if (typ <= TLV_UTF8) {
+      be_pushnstring(vm, (const char*) buf + idx - item_len, n + item_len);
+    } else {
+      be_pushbytes(vm, buf + idx - item_len, n + item_len);
+    }
+  } else {
+    be_pushnil(vm);
+  }
+}
+
+typedef struct {
+  bvm *vm;
+  int cl;                   // stack index of the `Matter_TLV` class
+  int raw;                  // stack index of the bytes() buffer
+  const uint8_t *buf;
+  size_t len;
+} tlv_parser;
+
+static void tlv_set_int(bvm *vm, int obj, const char *name, bint v) {
+  be_pushint(vm, v);
+  be_setmember(vm, obj, name);
+  be_pop(vm, 1);
+}
+
+// parse the element at `idx` and push the new item, returns the index of the next element
+// children of arrays are anonymous and don't get their tags
+static size_t tlv_parse_item(tlv_parser *p, size_t idx, int parent, bbool anonymous, int depth) {
+  bvm *vm = p->vm;
+  int typ;
+  tlv_tag tag;
+  if (depth > TLV_MAX_DEPTH) { be_raise(vm, "TLV_error", "TLV nested too deep"); }
+  idx = tlv_head(vm, p->buf, p->len, idx, &typ, &tag);
+
+  be_stack_require(vm, 8);
+  be_getmember(vm, p->cl, typ == TLV_STRUCT ? "Matter_TLV_struct" :
+                          typ == TLV_ARRAY ? "Matter_TLV_array" :
+                          typ == TLV_LIST ? "Matter_TLV_list" : "Matter_TLV_item");
+  if (parent) { be_pushvalue(vm, parent); } else { be_pushnil(vm); }
+  be_call(vm, 1);
+  be_pop(vm, 1);
+  int item = be_absindex(vm, -1);
+
+  tlv_set_int(vm, item, "typ", typ);
+  if (!anonymous) {
+    if (tag.has_vendor)   { tlv_set_int(vm, item, "tag_vendor", tag.vendor); }
+    if (tag.has_profile)  { tlv_set_int(vm, item, "tag_profile", tag.profile); }
+    if (tag.has_number)   { tlv_set_int(vm, item, "tag_number", tag.number); }
+    if (tag.has_sub)      { tlv_set_int(vm, item, "tag_sub", tag.sub); }
+  }
+
+  if (typ >= TLV_STRUCT && typ <= TLV_LIST) {
+    be_getmember(vm, item, "val");
+    be_getmember(vm, -1, ".p");
+    int list = be_absindex(vm, -1);
+    while (1) {
+      if (idx >= p->len) { tlv_raise_truncated(vm); }
+      if (p->buf[idx] == TLV_EOC) { break; }
+      idx = tlv_parse_item(p, idx, item, typ == TLV_ARRAY, depth + 1);
+      be_data_push(vm, list);
+      be_pop(vm, 1);
+    }
+    be_pop(vm, 2);
+    idx += 1;
+  } else if (typ != TLV_NULL && typ != TLV_EOC) {
+    tlv_push_value(vm, p->raw, p->buf, p->len, idx, typ);
+    be_setmember(vm, item, "val");
+    be_pop(vm, 1);
+    idx += tlv_value_len(vm, p->buf, p->len, idx, typ);
+  }
+  tlv_set_int(vm, item, "next_idx", idx);
+  return idx;
+}
+
+// `matter._tlv_parse(cl:class, raw:bytes [, idx:int, parent:instance]) -> instance`
+//
+// Parse the TLV element at `idx` into `cl.Matter_TLV_item` or containers, the next index is in `next_idx`
+int matter_tlv_parse(bvm *vm) {
+  int argc = be_top(vm);
+  if (argc >= 2 && be_isbytes(vm, 2)) {
+    tlv_parser p;
+    p.vm = vm;
+    p.cl = 1;
+    p.raw = 2;
+    p.buf = (const uint8_t*) be_tobytes(vm, 2, &p.len);
+    bint idx = (argc >= 3 && be_isint(vm, 3)) ? be_toint(vm, 3) : 0;
+    int parent = (argc >= 4 && !be_isnil(vm, 4)) ? 4 : 0;
+    if (idx < 0) { tlv_raise_truncated(vm); }
+    tlv_parse_item(&p, idx, parent, bfalse, 0);
+    be_return(vm);
+  }
+  be_raise(vm, "type_error", NULL);
+}
+
+/*********************************************************************************************\
+ * Encoding
+ *
+ * The encoding is appended to a bytes() buffer which grows as needed, without buffer
+ * it only computes the length. Types are compressed like `tlv2raw()` does.
+\*********************************************************************************************/
+
+typedef struct {
+  bvm *vm;
+  int raw;                  // stack index of the bytes() written to, 0 to only compute the length
+  size_t base;              // index of the encoding in `raw`
+  uint8_t *buf;             // start of the encoding
+  size_t pos;
+  size_t size;              // room available from `buf`
+} tlv_writer;
+
+// resize `raw` to have `size` bytes from `base`, the buffer may move
+static void tlv_resize(tlv_writer *w, size_t size) {
+  bvm *vm = w->vm;
+  size_t len;
+  be_getmember(vm, w->raw, "resize");
+  be_pushvalue(vm, w->raw);
+  be_pushint(vm, w->base + size);
+  be_call(vm, 2);
+  be_pop(vm, 3);
+  w->buf = (uint8_t*) be_tobytes(vm, w->raw, &len);
+  if (w->buf == NULL || len != w->base + size) { be_raise(vm, "memory_error", NULL); }
+  w->buf += w->base;
+  w->size = size;
+}
+
+static void tlv_put_mem(tlv_writer *w, const void *src, size_t n) {
+  if (w->raw) {
+    if (w->pos + n > w->size) { tlv_resize(w, w->pos + n + 64 + w->pos / 4); }
+    memcpy(w->buf + w->pos, src, n);
+  }
+  w->pos += n;
+}
+
+static void tlv_put(tlv_writer *w, uint32_t v, int n) {
+  uint8_t b[4];
+  for (int i = 0; i < n; i++) { b[i] = v >> (8 * i); }
+  tlv_put_mem(w, b, n);
+}
+
+static bbool tlv_member_int(bvm *vm, int obj, const char *name, int32_t *v) {
+  be_getmember(vm, obj, name);
+  bbool ok = be_isint(vm, -1);
+  if (ok) { *v = be_toint(vm, -1); }
+  be_pop(vm, 1);
+  return ok;
+}
+
+static void tlv_read_tag(bvm *vm, int obj, tlv_tag *tag) {
+  memset(tag, 0, sizeof(tlv_tag));
+  if (be_isinstance(vm, obj)) {                           // raw bytes() have no tag
+    tag->has_vendor = tlv_member_int(vm, obj, "tag_vendor", &tag->vendor);
+    tag->has_profile = tlv_member_int(vm, obj, "tag_profile", &tag->profile);
+    tag->has_number = tlv_member_int(vm, obj, "tag_number", &tag->number);
+    tag->has_sub = tlv_member_int(vm, obj, "tag_sub", &tag->sub);
+  }
+}
+
+static void tlv_encode_tag(tlv_writer *w, const tlv_tag *tag, int typ) {
+  int32_t number = tag->has_number ? tag->number : 0;
+  bbool huge = (number >= 65536) || (number < 0);
+  if (tag->has_vendor) {                                  // full encoding
+    tlv_put(w, (huge ? 0xE0 : 0xC0) + typ, 1);
+    tlv_put(w, tag->vendor, 2);
+    tlv_put(w, tag->profile, 2);
+    tlv_put(w, number, huge ? 4 : 2);
+  } else if (tag->has_profile) {                          // Matter common profile or implicit profile
+    tlv_put(w, (tag->profile == -1 ? (huge ? 0x60 : 0x40) : (huge ? 0xA0 : 0x80)) + typ, 1);
+    tlv_put(w, number, huge ? 4 : 2);
+  } else if (tag->has_sub) {
+    tlv_put(w, 0x20 + typ, 1);
+    tlv_put(w, tag->sub, 1);
+  } else {                                                // anonymous tag
+    tlv_put(w, typ, 1);
+  }
+}
+
+// same as `Matter_TLV_item._cmp_gt()`, returns true if `a` sorts strictly after `b`
+static bbool tlv_cmp_gt(const tlv_tag *a, const tlv_tag *b) {
+  if (a->has_vendor) {
+    if (!b->has_vendor) { return btrue; }
+    if (a->vendor > b->vendor) { return btrue; }
+    if (a->vendor == b->vendor && a->profile > b->profile) { return btrue; }
+  }
+  if (a->has_profile && a->profile == -1) {
+    if (!b->has_profile) { return btrue; }
+  } else if (!a->has_profile) {
+    if (b->has_profile && b->profile == -1) { return bfalse; }
+  }
+  if (a->has_number) {
+    if (!b->has_number) { return btrue; }
+    return a->number > b->number;
+  }
+  if (a->has_sub) {
+    if (!b->has_sub) { return btrue; }
+    if (a->sub > b->sub) { return btrue; }
+  }
+  return bfalse;
+}
+
+// insertion sort of the elements of the list at `list`, stable like `Matter_TLV_item.sort()`
+static void tlv_sort(bvm *vm, int list, int n) {
+  tlv_tag k, t;
+  for (int i = 1; i < n; i++) {
+    be_pushint(vm, i);
+    be_getindex(vm, list);
+    int key = be_absindex(vm, -1);
+    tlv_read_tag(vm, key, &k);
+    int j = i;
+    while (j > 0) {
+      be_pushint(vm, j - 1);
+      be_getindex(vm, list);
+      tlv_read_tag(vm, -1, &t);
+      if (!tlv_cmp_gt(&t, &k)) { be_pop(vm, 2); break; }
+      be_pushint(vm, j);
+      be_pushvalue(vm, -2);
+      be_setindex(vm, list);
+      be_pop(vm, 4);
+      j--;
+    }
+    be_pushint(vm, j);
+    be_pushvalue(vm, key);
+    be_setindex(vm, list);
+    be_pop(vm, 4);
+  }
+}
+
+static bbool tlv_is_sorted(bvm *vm, int list, int n) {
+  tlv_tag prev, cur;
+  be_pushint(vm, 0);
+  be_getindex(vm, list);
+  tlv_read_tag(vm, -1, &prev);
+  be_pop(vm, 2);
+  for (int i = 1; i < n; i++) {
+    be_pushint(vm, i);
+    be_getindex(vm, list);
+    tlv_read_tag(vm, -1, &cur);
+    be_pop(vm, 2);
+    if (tlv_cmp_gt(&prev, &cur)) { return bfalse; }
+    prev = cur;
+  }
+  return btrue;
+}
+
+// `int(v)` for any Berry value
+static bint tlv_toint(bvm *vm, int v) {
+  if (be_isint(vm, v)) { return be_toint(vm, v); }
+  if (be_isreal(vm, v)) { return (bint) be_toreal(vm, v); }
+  if (be_isbool(vm, v)) { return be_tobool(vm, v); }
+  be_getbuiltin(vm, "int");
+  be_pushvalue(vm, v);
+  be_call(vm, 1);
+  bint i = be_isint(vm, -2) ? be_toint(vm, -2) : 0;
+  be_pop(vm, 2);
+  return i;
+}
+
+// `real(v)` for any Berry value
+static breal tlv_toreal(bvm *vm, int v) {
+  if (be_isint(vm, v) || be_isreal(vm, v)) { return be_toreal(vm, v); }
+  be_getbuiltin(vm, "real");
+  be_pushvalue(vm, v);
+  be_call(vm, 1);
+  breal r = be_isnumber(vm, -2) ? be_toreal(vm, -2) : 0;
+  be_pop(vm, 2);
+  return r;
+}
+
+// length of a string or bytes() value, strings are converted in place with `str()`
+static size_t tlv_size(bvm *vm, int v, bbool utf) {
+  size_t len = 0;
+  if (be_isbytes(vm, v)) {
+    be_tobytes(vm, v, &len);
+  } else if (utf) {
+    be_tostring(vm, v);
+    len = be_strlen(vm, v);
+  } else {
+    be_raise(vm, "value_error", "bytes expected");
+  }
+  return len;
+}
+
+static void tlv_encode(tlv_writer *w, int item, int depth);
+
+static void tlv_encode_children(tlv_writer *w, int val, int typ, int depth) {
+  bvm *vm = w->vm;
+  int top = be_top(vm);
+  if (!be_islistinstance(vm, val)) { be_raise(vm, "value_error", "TLV container needs a list"); }
+  be_getmember(vm, val, ".p");
+  int list = be_absindex(vm, -1);
+  int n = be_data_size(vm, list);
+  if (typ == TLV_STRUCT && n > 1 && !tlv_is_sorted(vm, list, n)) {
+    be_copy(vm, list);                  // sort a copy, the struct keeps its order
+    list = be_absindex(vm, -1);
+    tlv_sort(vm, list, n);
+  }
+  for (int i = 0; i < n; i++) {
+    be_pushint(vm, i);
+    be_getindex(vm, list);
+    tlv_encode(w, be_absindex(vm, -1), depth + 1);
+    be_pop(vm, 2);
+  }
+  tlv_put(w, TLV_EOC, 1);
+  be_pop(vm, be_top(vm) - top);
+}
+
+static void tlv_encode_value(tlv_writer *w, int item, int val, int typ) {
+  bvm *vm = w->vm;
+  int new_typ = typ;
+  size_t size = 0;
+  tlv_tag tag;
+
+  // compress the type to the smallest encoding like `tlv2raw()` does
+  if (typ == TLV_BFALSE || typ == TLV_BTRUE) {
+    new_typ = be_tobool(vm, val) ? TLV_BTRUE : TLV_BFALSE;
+  } else if (typ >= TLV_I2 && typ <= TLV_I4) {
+    bint i = tlv_toint(vm, val);
+    if (i <= 127 && i >= -128)            { new_typ = TLV_I1; }
+    else if (i <= 32767 && i >= -32768)   { new_typ = TLV_I2; }
+  } else if (typ >= TLV_U2 && typ <= TLV_U4) {
+    bint i = tlv_toint(vm, val);
+    if (i <= 255 && i >= 0)               { new_typ = TLV_U1; }
+    else if (i <= 65535 && i >= 0)        { new_typ = TLV_U2; }
+  } else if (typ >= TLV_UTF1 && typ <= TLV_B8) {
+    bbool utf = (typ <= TLV_UTF8);
+    size = tlv_size(vm, val, utf);
+    int base = utf ? TLV_UTF1 : TLV_B1;
+    new_typ = base + (size <= 255 ? 0 : size <= 65535 ? 1 : 2);    // 4 bytes length is rejected below
+  }
+  if (new_typ != typ) {
+    tlv_set_int(vm, item, "typ", new_typ);
+    typ = new_typ;
+  }
+
+  tlv_read_tag(vm, item, &tag);
+  tlv_encode_tag(w, &tag, typ);
+
+  if (typ == TLV_BFALSE || typ == TLV_BTRUE || typ == TLV_NULL) {
+    // no value
+  } else if (typ < TLV_I8 || (typ >= TLV_U1 && typ < TLV_U8)) {
+    tlv_put(w, (uint32_t) tlv_toint(vm, val), tlv_len[typ]);
+  } else if (typ == TLV_I8 || typ == TLV_U8) {             // bytes(8), int64 or int
+    uint8_t v8[8] = {0};
+    if (be_isbytes(vm, val)) {
+      size_t len;
+      const void *p = be_tobytes(vm, val, &len);
+      memcpy(v8, p, len < 8 ? len : 8);
+    } else if (be_isinstance(vm, val)) {
+      be_getmember(vm, val, "tobytes");
+      be_pushvalue(vm, val);
+      be_call(vm, 1);
+      size_t len;
+      const void *p = be_tobytes(vm, -2, &len);
+      memcpy(v8, p, len < 8 ? len : 8);
+      be_pop(vm, 2);
+    } else {
+      int64_t i = tlv_toint(vm, val);
+      for (int k = 0; k < 8; k++) { v8[k] = (uint8_t)(i >> (8 * k)); }
+    }
+    tlv_put_mem(w, v8, 8);
+  } else if (typ == TLV_FLOAT) {
+    union { uint32_t i; float f; } u;
+    u.f = (float) tlv_toreal(vm, val);
+    tlv_put(w, u.i, 4);
+  } else if (typ == TLV_UTF1 || typ == TLV_UTF2 || typ == TLV_B1 || typ == TLV_B2) {
+    const void *p = be_isbytes(vm, val) ? be_tobytes(vm, val, NULL) : be_tostring(vm, val);
+    tlv_put(w, size, -tlv_len[typ]);
+    tlv_put_mem(w, p, size);
+  } else if (typ == TLV_DOUBLE) {
+    be_raise(vm, "value_error", "Unsupported type TLV.DOUBLE");
+  } else {
+    char msg[32];
+    snprintf(msg, sizeof(msg), "unsupported type %i", typ);
+    be_raise(vm, "value_error", msg);
+  }
+}
+
+// encode the item at stack index `item`, raw bytes() are copied as is
+static void tlv_encode(tlv_writer *w, int item, int depth) {
+  bvm *vm = w->vm;
+  if (depth > TLV_MAX_DEPTH) { be_raise(vm, "TLV_error", "TLV nested too deep"); }
+  be_stack_require(vm, 10);
+  int32_t typ;
+  if (!be_isinstance(vm, item) || !tlv_member_int(vm, item, "typ", &typ)) {
+    if (!be_isbytes(vm, item)) { be_raise(vm, "value_error", "not a TLV item"); }
+    size_t len;
+    const void *p = be_tobytes(vm, item, &len);
+    tlv_put_mem(w, p, len);
+    return;
+  }
+  be_getmember(vm, item, "val");
+  int val = be_absindex(vm, -1);
+  if (typ == TLV_RAW) {
+    size_t len = 0;
+    const void *p = be_isbytes(vm, val) ? be_tobytes(vm, val, &len) : NULL;
+    if (p == NULL && be_isstring(vm, val)) { p = be_tostring(vm, val); len = be_strlen(vm, val); }
+    if (p) { tlv_put_mem(w, p, len); }
+  } else if (typ >= TLV_STRUCT && typ <= TLV_LIST) {
+    tlv_tag tag;
+    tlv_read_tag(vm, item, &tag);
+    tlv_encode_tag(w, &tag, typ);
+    tlv_encode_children(w, val, typ, depth);
+  } else {
+    tlv_encode_value(w, item, val, typ);
+  }
+  be_pop(vm, 1);
+}
+
+// `matter._tlv_len(item:instance) -> int`
+//
+// Length of the encoded item, like `encode_len()` it compresses the types
+int matter_tlv_len(bvm *vm) {
+  if (be_top(vm) >= 1) {
+    tlv_writer w = { vm, 0, 0, NULL, 0, 0 };
+    tlv_encode(&w, 1, 0);
+    be_pushint(vm, w.pos);
+    be_return(vm);
+  }
+  be_raise(vm, "type_error", NULL);
+}
+
+// `matter._tlv_encode(item:instance [, raw:bytes]) -> bytes`
+//
+// Append the encoded item to `raw` or to a new bytes() buffer
+int matter_tlv_encode(bvm *vm) {
+  int argc = be_top(vm);
+  if (argc >= 1) {
+    tlv_writer w = { vm, 0, 0, NULL, 0, 0 };
+    if (argc >= 2 && be_isbytes(vm, 2)) {
+      be_tobytes(vm, 2, &w.base);
+      be_pushvalue(vm, 2);
+    } else {
+      be_pushbytes(vm, NULL, 0);
+    }
+    w.raw = be_absindex(vm, -1);
+    tlv_encode(&w, 1, 0);
+    tlv_resize(&w, w.pos);
+    be_pushvalue(vm, w.raw);
+    be_return(vm);
+  }
+  be_raise(vm, "type_error", NULL);
+}
+
+/*********************************************************************************************\
+ * In place access to raw TLV, used by `Matter_TLV_view`
+\*********************************************************************************************/
+
+// read the `raw:bytes, idx:int` arguments, returns NULL if they are invalid
+static const uint8_t *tlv_args(bvm *vm, size_t *len, size_t *idx) {
+  if (be_top(vm) >= 2 && be_isbytes(vm, 1) && be_isint(vm, 2) && be_toint(vm, 2) >= 0) {
+    *idx = be_toint(vm, 2);
+    return (const uint8_t*) be_tobytes(vm, 1, len);
+  }
+  be_raise(vm, "type_error", NULL);
+  return NULL;
+}
+
+// index of the first child if the element at `idx` is a container, or 0
+static size_t tlv_first_child(bvm *vm, const uint8_t *buf, size_t len, size_t idx) {
+  int typ;
+  tlv_tag tag;
+  size_t child = tlv_head(vm, buf, len, idx, &typ, &tag);
+  return (typ >= TLV_STRUCT && typ <= TLV_LIST) ? child : 0;
+}
+
+// `matter._tlv_next(raw:bytes, idx:int) -> int`
+//
+// Index following the element at `idx`
+int matter_tlv_next(bvm *vm) {
+  size_t len, idx;
+  const uint8_t *buf = tlv_args(vm, &len, &idx);
+  be_pushint(vm, tlv_skip(vm, buf, len, idx, 0));
+  be_return(vm);
+}
+
+// `matter._tlv_child(raw:bytes, idx:int, n:int) -> int or nil`
+//
+// Index of the n-th child of the container at `idx`
+int matter_tlv_child(bvm *vm) {
+  size_t len, idx;
+  const uint8_t *buf = tlv_args(vm, &len, &idx);
+  bint n = be_isint(vm, 3) ? be_toint(vm, 3) : -1;
+  size_t child = tlv_first_child(vm, buf, len, idx);
+  if (child && n >= 0) {
+    while (child < len && buf[child] != TLV_EOC) {
+      if (n-- == 0) {
+        be_pushint(vm, child);
+        be_return(vm);
+      }
+      child = tlv_skip(vm, buf, len, child, 1);
+    }
+  }
+  be_return_nil(vm);
+}
+
+// `matter._tlv_count(raw:bytes, idx:int) -> int`
+//
+// Number of children of the container at `idx`, 0 for other elements
+int matter_tlv_count(bvm *vm) {
+  size_t len, idx;
+  const uint8_t *buf = tlv_args(vm, &len, &idx);
+  size_t child = tlv_first_child(vm, buf, len, idx);
+  int n = 0;
+  if (child) {
+    while (child < len && buf[child] != TLV_EOC) {
+      child = tlv_skip(vm, buf, len, child, 1);
+      n++;
+    }
+  }
+  be_pushint(vm, n);
+  be_return(vm);
+}
+
+// `matter._tlv_find(raw:bytes, idx:int, sub:int) -> int or nil`
+//
+// Index of the first child with context specific tag `sub` in the container at `idx`
+int matter_tlv_find(bvm *vm) {
+  size_t len, idx;
+  const uint8_t *buf = tlv_args(vm, &len, &idx);
+  if (!be_isint(vm, 3)) { be_return_nil(vm); }
+  bint sub = be_toint(vm, 3);
+  size_t child = tlv_first_child(vm, buf, len, idx);
+  if (child) {
+    while (child < len && buf[child] != TLV_EOC) {
+      if ((buf[child] & 0xE0) == 0x20 && child + 1 < len && buf[child + 1] == sub) {
+        be_pushint(vm, child);
+        be_return(vm);
+      }
+      child = tlv_skip(vm, buf, len, child, 1);
+    }
+  }
+  be_return_nil(vm);
+}
+
+// `matter._tlv_value(raw:bytes, idx:int) -> any`
+//
+// Value of the scalar element at `idx`, nil for NULL and containers
+int matter_tlv_value(bvm *vm) {
+  size_t len, idx;
+  const uint8_t *buf = tlv_args(vm, &len, &idx);
+  int typ;
+  tlv_tag tag;
+  size_t val = tlv_head(vm, buf, len, idx, &typ, &tag);
+  tlv_push_value(vm, 1, buf, len, val, typ);
+  be_return(vm);
+}
+
+// `matter._tlv_sub(raw:bytes, idx:int) -> int or nil`
+//
+// Context specific tag of the element at `idx`
+int matter_tlv_sub(bvm *vm) {
+  size_t len, idx;
+  const uint8_t *buf = tlv_args(vm, &len, &idx);
+  int typ;
+  tlv_tag tag;
+  tlv_head(vm, buf, len, idx, &typ, &tag);
+  if (tag.has_sub) {
+    be_pushint(vm, tag.sub);
+    be_return(vm);
+  }
+  be_return_nil(vm);
+}
+
+#ifdef USE_BERRY_MATTER_TLV
+// The host Berry has no native `matter` module, its placeholder `matter.be`
+// copies the codec from the `_matter_tlv` global map registered here
+void be_load_matter_tlv(bvm *vm) {
+  static const struct { const char *name; bntvfunc f; } funcs[] = {
+    { "_tlv_parse", matter_tlv_parse },   { "_tlv_encode", matter_tlv_encode },
+    { "_tlv_len", matter_tlv_len },       { "_tlv_next", matter_tlv_next },
+    { "_tlv_child", matter_tlv_child },   { "_tlv_count", matter_tlv_count },
+    { "_tlv_find", matter_tlv_find },     { "_tlv_value", matter_tlv_value },
+    { "_tlv_sub", matter_tlv_sub },
+  };
+  be_newobject(vm, "map");
+  for (size_t i = 0; i < sizeof(funcs) / sizeof(funcs[0]); i++) {
+    be_pushstring(vm, funcs[i].name);
+    be_pushntvfunction(vm, funcs[i].f);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+  }
+  be_pop(vm, 1);
+  be_setglobal(vm, "_matter_tlv");
+  be_pop(vm, 1);
+}
+#endif // USE_BERRY_MATTER_TLV
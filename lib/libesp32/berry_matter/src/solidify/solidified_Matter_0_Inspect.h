@@ -128,9 +128,9 @@ be_local_closure(matter_inspect,   /* name */
     /* K6   */  be_nested_str_weak(matter),
     /* K7   */  be_nested_str_weak(sort),
     /* K8   */  be_nested_str_weak(_X27_X25s_X27_X3A_X20_X25s),
-    /* K9   */  be_nested_str_weak(_X7B),
-    /* K10  */  be_nested_str_weak(concat),
-    /* K11  */  be_nested_str_weak(_X2C_X20),
+    /* K9   */  be_nested_str_weak(concat),
+    /* K10  */  be_nested_str_weak(_X2C_X20),
+    /* K11  */  be_nested_str_weak(_X7B),
     /* K12  */  be_nested_str_weak(_X7D),
     /* K13  */  be_nested_str_weak(Exception_X3A),
     /* K14  */  be_nested_str_weak(_X7C),
@@ -158,7 +158,7 @@ be_local_closure(matter_inspect,   /* name */
       0x5C1C0A00,  //  0011  MOVE	R7	R5
       0x7C180200,  //  0012  CALL	R6	1
       0x20180D03,  //  0013  NE	R6	R6	K3
-      0x781A0002,  //  0014  JMPF	R6	#0018
+      0x7819FFF4,  //  0014  JMPF	R6	#000A
       0x8C180504,  //  0015  GETMET	R6	R2	K4
       0x5C200800,  //  0016  MOVE	R8	R4
       0x7C180400,  //  0017  CALL	R6	2
@@ -198,10 +198,10 @@ be_local_closure(matter_inspect,   /* name */
       0x58100005,  //  0039  LDCONST	R4	K5
       0xAC100200,  //  003A  CATCH	R4	1	0
       0xB0080000,  //  003B  RAISE	2	R0	R0
-      0x8C10070A,  //  003C  GETMET	R4	R3	K10
-      0x5818000B,  //  003D  LDCONST	R6	K11
+      0x8C100709,  //  003C  GETMET	R4	R3	K9
+      0x5818000A,  //  003D  LDCONST	R6	K10
       0x7C100400,  //  003E  CALL	R4	2
-      0x00121204,  //  003F  ADD	R4	K9	R4
+      0x00121604,  //  003F  ADD	R4	K11	R4
       0x0010090C,  //  0040  ADD	R4	R4	K12
       0xA8040001,  //  0041  EXBLK	1	1
       0x80040800,  //  0042  RET	1	R4
@@ -338,7 +338,7 @@ be_local_closure(matter_consolidate_clusters,   /* name */
       0x7C240400,  //  0053  CALL	R9	2
       0x4C280000,  //  0054  LDNIL	R10
       0x1C24120A,  //  0055  EQ	R9	R9	R10
-      0x78260003,  //  0056  JMPF	R9	#005B
+      0x7825FFF6,  //  0056  JMPF	R9	#004E
       0x94240606,  //  0057  GETIDX	R9	R3	R6
       0x8C241305,  //  0058  GETMET	R9	R9	K5
       0x5C2C1000,  //  0059  MOVE	R11	R8
@@ -64,7 +64,7 @@ be_local_closure(Matter_Base38_encode,   /* name */
     }),
     be_str_weak(encode),
     &be_const_str_solidified,
-    ( &(const binstruction[58]) {  /* code */
+    ( &(const binstruction[56]) {  /* code */
       0x58040000,  //  0000  LDCONST	R1	K0
       0x84080000,  //  0001  CLOSURE	R2	P0
       0x580C0001,  //  0002  LDCONST	R3	K1
@@ -73,11 +73,11 @@ be_local_closure(Matter_Base38_encode,   /* name */
       0x7C100200,  //  0005  CALL	R4	1
       0x58140002,  //  0006  LDCONST	R5	K2
       0x14180604,  //  0007  LT	R6	R3	R4
-      0x781A002F,  //  0008  JMPF	R6	#0039
+      0x781A002D,  //  0008  JMPF	R6	#0037
       0x4C180000,  //  0009  LDNIL	R6
       0x001C0703,  //  000A  ADD	R7	R3	K3
       0x141C0E04,  //  000B  LT	R7	R7	R4
-      0x781E0012,  //  000C  JMPF	R7	#0020
+      0x781E0011,  //  000C  JMPF	R7	#001F
       0x941C0003,  //  000D  GETIDX	R7	R0	R3
       0x00200704,  //  000E  ADD	R8	R3	K4
       0x94200008,  //  000F  GETIDX	R8	R0	R8
@@ -88,41 +88,39 @@ be_local_closure(Matter_Base38_encode,   /* name */
       0x94200008,  //  0014  GETIDX	R8	R0	R8
       0x5426000F,  //  0015  LDINT	R9	16
       0x38201009,  //  0016  SHL	R8	R8	R9
-      0x301C0E08,  //  0017  OR	R7	R7	R8
-      0x5C180E00,  //  0018  MOVE	R6	R7
-      0x5C1C0400,  //  0019  MOVE	R7	R2
-      0x5C200C00,  //  001A  MOVE	R8	R6
-      0x54260004,  //  001B  LDINT	R9	5
-      0x7C1C0400,  //  001C  CALL	R7	2
-      0x00140A07,  //  001D  ADD	R5	R5	R7
-      0x000C0705,  //  001E  ADD	R3	R3	K5
-      0x70020017,  //  001F  JMP		#0038
-      0x001C0704,  //  0020  ADD	R7	R3	K4
-      0x141C0E04,  //  0021  LT	R7	R7	R4
-      0x781E000D,  //  0022  JMPF	R7	#0031
-      0x941C0003,  //  0023  GETIDX	R7	R0	R3
-      0x00200704,  //  0024  ADD	R8	R3	K4
-      0x94200008,  //  0025  GETIDX	R8	R0	R8
-      0x54260007,  //  0026  LDINT	R9	8
-      0x38201009,  //  0027  SHL	R8	R8	R9
-      0x301C0E08,  //  0028  OR	R7	R7	R8
-      0x5C180E00,  //  0029  MOVE	R6	R7
-      0x5C1C0400,  //  002A  MOVE	R7	R2
-      0x5C200C00,  //  002B  MOVE	R8	R6
-      0x54260003,  //  002C  LDINT	R9	4
-      0x7C1C0400,  //  002D  CALL	R7	2
-      0x00140A07,  //  002E  ADD	R5	R5	R7
-      0x000C0703,  //  002F  ADD	R3	R3	K3
-      0x70020006,  //  0030  JMP		#0038
-      0x94180003,  //  0031  GETIDX	R6	R0	R3
-      0x5C1C0400,  //  0032  MOVE	R7	R2
-      0x5C200C00,  //  0033  MOVE	R8	R6
-      0x58240003,  //  0034  LDCONST	R9	K3
-      0x7C1C0400,  //  0035  CALL	R7	2
-      0x00140A07,  //  0036  ADD	R5	R5	R7
-      0x000C0704,  //  0037  ADD	R3	R3	K4
-      0x7001FFCD,  //  0038  JMP		#0007
-      0x80040A00,  //  0039  RET	1	R5
+      0x30180E08,  //  0017  OR	R6	R7	R8
+      0x5C1C0400,  //  0018  MOVE	R7	R2
+      0x5C200C00,  //  0019  MOVE	R8	R6
+      0x54260004,  //  001A  LDINT	R9	5
+      0x7C1C0400,  //  001B  CALL	R7	2
+      0x00140A07,  //  001C  ADD	R5	R5	R7
+      0x000C0705,  //  001D  ADD	R3	R3	K5
+      0x7001FFE7,  //  001E  JMP		#0007
+      0x001C0704,  //  001F  ADD	R7	R3	K4
+      0x141C0E04,  //  0020  LT	R7	R7	R4
+      0x781E000C,  //  0021  JMPF	R7	#002F
+      0x941C0003,  //  0022  GETIDX	R7	R0	R3
+      0x00200704,  //  0023  ADD	R8	R3	K4
+      0x94200008,  //  0024  GETIDX	R8	R0	R8
+      0x54260007,  //  0025  LDINT	R9	8
+      0x38201009,  //  0026  SHL	R8	R8	R9
+      0x30180E08,  //  0027  OR	R6	R7	R8
+      0x5C1C0400,  //  0028  MOVE	R7	R2
+      0x5C200C00,  //  0029  MOVE	R8	R6
+      0x54260003,  //  002A  LDINT	R9	4
+      0x7C1C0400,  //  002B  CALL	R7	2
+      0x00140A07,  //  002C  ADD	R5	R5	R7
+      0x000C0703,  //  002D  ADD	R3	R3	K3
+      0x7001FFD7,  //  002E  JMP		#0007
+      0x94180003,  //  002F  GETIDX	R6	R0	R3
+      0x5C1C0400,  //  0030  MOVE	R7	R2
+      0x5C200C00,  //  0031  MOVE	R8	R6
+      0x58240003,  //  0032  LDCONST	R9	K3
+      0x7C1C0400,  //  0033  CALL	R7	2
+      0x00140A07,  //  0034  ADD	R5	R5	R7
+      0x000C0704,  //  0035  ADD	R3	R3	K4
+      0x7001FFCF,  //  0036  JMP		#0007
+      0x80040A00,  //  0037  RET	1	R5
     })
   )
 );
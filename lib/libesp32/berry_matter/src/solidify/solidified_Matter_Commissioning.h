@@ -23,11 +23,11 @@ be_local_closure(Matter_Commisioning_Context_parse_StatusReport,   /* name */
     /* K0   */  be_nested_str_weak(session),
     /* K1   */  be_nested_str_weak(tasmota),
     /* K2   */  be_nested_str_weak(log),
-    /* K3   */  be_nested_str_weak(MTR_X3A_X20_X3EStatus_X20_X20_X20_X20),
-    /* K4   */  be_nested_str_weak(raw),
-    /* K5   */  be_nested_str_weak(app_payload_idx),
-    /* K6   */  be_const_int(2147483647),
-    /* K7   */  be_nested_str_weak(tohex),
+    /* K3   */  be_nested_str_weak(raw),
+    /* K4   */  be_nested_str_weak(app_payload_idx),
+    /* K5   */  be_const_int(2147483647),
+    /* K6   */  be_nested_str_weak(tohex),
+    /* K7   */  be_nested_str_weak(MTR_X3A_X20_X3EStatus_X20_X20_X20_X20),
     /* K8   */  be_const_int(3),
     }),
     be_str_weak(parse_StatusReport),
@@ -36,13 +36,13 @@ be_local_closure(Matter_Commisioning_Context_parse_StatusReport,   /* name */
       0x88080300,  //  0000  GETMBR	R2	R1	K0
       0xB80E0200,  //  0001  GETNGBL	R3	K1
       0x8C0C0702,  //  0002  GETMET	R3	R3	K2
-      0x88140305,  //  0003  GETMBR	R5	R1	K5
-      0x40140B06,  //  0004  CONNECT	R5	R5	K6
-      0x88180304,  //  0005  GETMBR	R6	R1	K4
+      0x88140304,  //  0003  GETMBR	R5	R1	K4
+      0x40140B05,  //  0004  CONNECT	R5	R5	K5
+      0x88180303,  //  0005  GETMBR	R6	R1	K3
       0x94140C05,  //  0006  GETIDX	R5	R6	R5
-      0x8C140B07,  //  0007  GETMET	R5	R5	K7
+      0x8C140B06,  //  0007  GETMET	R5	R5	K6
       0x7C140200,  //  0008  CALL	R5	1
-      0x00160605,  //  0009  ADD	R5	K3	R5
+      0x00160E05,  //  0009  ADD	R5	K7	R5
       0x58180008,  //  000A  LDCONST	R6	K8
       0x7C0C0600,  //  000B  CALL	R3	3
       0x500C0000,  //  000C  LDBOOL	R3	0	0
@@ -71,8 +71,8 @@ be_local_closure(Matter_Commisioning_Context_find_fabric_by_destination_id,   /*
     /* K1   */  be_nested_str_weak(tasmota),
     /* K2   */  be_nested_str_weak(loglevel),
     /* K3   */  be_nested_str_weak(log),
-    /* K4   */  be_nested_str_weak(MTR_X3A_X20SEARCHING_X3A_X20destinationId_X3D),
-    /* K5   */  be_nested_str_weak(tohex),
+    /* K4   */  be_nested_str_weak(tohex),
+    /* K5   */  be_nested_str_weak(MTR_X3A_X20SEARCHING_X3A_X20destinationId_X3D),
     /* K6   */  be_nested_str_weak(device),
     /* K7   */  be_nested_str_weak(sessions),
     /* K8   */  be_nested_str_weak(fabrics),
@@ -98,9 +98,9 @@ be_local_closure(Matter_Commisioning_Context_find_fabric_by_destination_id,   /*
       0x78120006,  //  0005  JMPF	R4	#000D
       0xB8120200,  //  0006  GETNGBL	R4	K1
       0x8C100903,  //  0007  GETMET	R4	R4	K3
-      0x8C180305,  //  0008  GETMET	R6	R1	K5
+      0x8C180304,  //  0008  GETMET	R6	R1	K4
       0x7C180200,  //  0009  CALL	R6	1
-      0x001A0806,  //  000A  ADD	R6	K4	R6
+      0x001A0A06,  //  000A  ADD	R6	K5	R6
       0x541E0003,  //  000B  LDINT	R7	4
       0x7C100600,  //  000C  CALL	R4	3
       0x60100010,  //  000D  GETGBL	R4	G16
@@ -114,11 +114,11 @@ be_local_closure(Matter_Commisioning_Context_find_fabric_by_destination_id,   /*
       0x88180B09,  //  0015  GETMBR	R6	R5	K9
       0x4C1C0000,  //  0016  LDNIL	R7
       0x1C180C07,  //  0017  EQ	R6	R6	R7
-      0x741A0007,  //  0018  JMPT	R6	#0021
+      0x7419FFF9,  //  0018  JMPT	R6	#0013
       0x88180B0A,  //  0019  GETMBR	R6	R5	K10
       0x4C1C0000,  //  001A  LDNIL	R7
       0x1C180C07,  //  001B  EQ	R6	R6	R7
-      0x741A0003,  //  001C  JMPT	R6	#0021
+      0x7419FFF5,  //  001C  JMPT	R6	#0013
       0x88180B0B,  //  001D  GETMBR	R6	R5	K11
       0x4C1C0000,  //  001E  LDNIL	R7
       0x1C180C07,  //  001F  EQ	R6	R6	R7
@@ -148,13 +148,13 @@ be_local_closure(Matter_Commisioning_Context_find_fabric_by_destination_id,   /*
       0x782A0006,  //  0037  JMPF	R10	#003F
       0xB82A0200,  //  0038  GETNGBL	R10	K1
       0x8C281503,  //  0039  GETMET	R10	R10	K3
-      0x8C301305,  //  003A  GETMET	R12	R9	K5
+      0x8C301304,  //  003A  GETMET	R12	R9	K4
       0x7C300200,  //  003B  CALL	R12	1
       0x0032220C,  //  003C  ADD	R12	K17	R12
       0x54360003,  //  003D  LDINT	R13	4
       0x7C280600,  //  003E  CALL	R10	3
       0x1C281201,  //  003F  EQ	R10	R9	R1
-      0x782A0001,  //  0040  JMPF	R10	#0043
+      0x7829FFD1,  //  0040  JMPF	R10	#0013
       0xA8040001,  //  0041  EXBLK	1	1
       0x80040A00,  //  0042  RET	1	R5
       0x7001FFCE,  //  0043  JMP		#0013
@@ -843,13 +843,13 @@ be_local_closure(Matter_Commisioning_Context_parse_Pake3,   /* name */
       0x5422000E,  //  004D  LDINT	R8	15
       0x40220808,  //  004E  CONNECT	R8	K4	R8
       0x94200E08,  //  004F  GETIDX	R8	R7	R8
-      0x5426000F,  //  0050  LDINT	R9	16
-      0x542A001E,  //  0051  LDINT	R10	31
-      0x4024120A,  //  0052  CONNECT	R9	R9	R10
+      0x5426001E,  //  0050  LDINT	R9	31
+      0x542A000F,  //  0051  LDINT	R10	16
+      0x40241409,  //  0052  CONNECT	R9	R10	R9
       0x94240E09,  //  0053  GETIDX	R9	R7	R9
-      0x542A001F,  //  0054  LDINT	R10	32
-      0x542E002E,  //  0055  LDINT	R11	47
-      0x4028140B,  //  0056  CONNECT	R10	R10	R11
+      0x542A002E,  //  0054  LDINT	R10	47
+      0x542E001F,  //  0055  LDINT	R11	32
+      0x4028160A,  //  0056  CONNECT	R10	R11	R10
       0x94280E0A,  //  0057  GETIDX	R10	R7	R10
       0x8C2C010B,  //  0058  GETMET	R11	R0	K11
       0x5C340200,  //  0059  MOVE	R13	R1
@@ -1204,13 +1204,13 @@ be_local_closure(Matter_Commisioning_Context_parse_Sigma3,   /* name */
       0x5466000E,  //  00F3  LDINT	R25	15
       0x40660619,  //  00F4  CONNECT	R25	K3	R25
       0x94643019,  //  00F5  GETIDX	R25	R24	R25
-      0x546A000F,  //  00F6  LDINT	R26	16
-      0x546E001E,  //  00F7  LDINT	R27	31
-      0x4068341B,  //  00F8  CONNECT	R26	R26	R27
+      0x546A001E,  //  00F6  LDINT	R26	31
+      0x546E000F,  //  00F7  LDINT	R27	16
+      0x4068361A,  //  00F8  CONNECT	R26	R27	R26
       0x9468301A,  //  00F9  GETIDX	R26	R24	R26
-      0x546E001F,  //  00FA  LDINT	R27	32
-      0x5472002E,  //  00FB  LDINT	R28	47
-      0x406C361C,  //  00FC  CONNECT	R27	R27	R28
+      0x546E002E,  //  00FA  LDINT	R27	47
+      0x5472001F,  //  00FB  LDINT	R28	32
+      0x406C381B,  //  00FC  CONNECT	R27	R28	R27
       0x946C301B,  //  00FD  GETIDX	R27	R24	R27
       0xB8720A00,  //  00FE  GETNGBL	R28	K5
       0x8C703939,  //  00FF  GETMET	R28	R28	K57
@@ -1694,13 +1694,13 @@ be_local_closure(Matter_Commisioning_Context_parse_Sigma1,   /* name */
       0x545E000E,  //  00C0  LDINT	R23	15
       0x405E0817,  //  00C1  CONNECT	R23	K4	R23
       0x945C2C17,  //  00C2  GETIDX	R23	R22	R23
-      0x5462000F,  //  00C3  LDINT	R24	16
-      0x5466001E,  //  00C4  LDINT	R25	31
-      0x40603019,  //  00C5  CONNECT	R24	R24	R25
+      0x5462001E,  //  00C3  LDINT	R24	31
+      0x5466000F,  //  00C4  LDINT	R25	16
+      0x40603218,  //  00C5  CONNECT	R24	R25	R24
       0x94602C18,  //  00C6  GETIDX	R24	R22	R24
-      0x5466001F,  //  00C7  LDINT	R25	32
-      0x546A002E,  //  00C8  LDINT	R26	47
-      0x4064321A,  //  00C9  CONNECT	R25	R25	R26
+      0x5466002E,  //  00C7  LDINT	R25	47
+      0x546A001F,  //  00C8  LDINT	R26	32
+      0x40643419,  //  00C9  CONNECT	R25	R26	R25
       0x94642C19,  //  00CA  GETIDX	R25	R22	R25
       0xB86A0C00,  //  00CB  GETNGBL	R26	K6
       0x8C683537,  //  00CC  GETMET	R26	R26	K55
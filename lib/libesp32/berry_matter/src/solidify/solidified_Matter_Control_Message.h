@@ -152,9 +152,9 @@ be_local_closure(Matter_Control_Message_process_incoming_control_message,   /* n
     ( &(const bvalue[13]) {     /* constants */
     /* K0   */  be_nested_str_weak(tasmota),
     /* K1   */  be_nested_str_weak(log),
-    /* K2   */  be_nested_str_weak(MTR_X3A_X20received_X20control_X20message_X20),
-    /* K3   */  be_nested_str_weak(matter),
-    /* K4   */  be_nested_str_weak(inspect),
+    /* K2   */  be_nested_str_weak(matter),
+    /* K3   */  be_nested_str_weak(inspect),
+    /* K4   */  be_nested_str_weak(MTR_X3A_X20received_X20control_X20message_X20),
     /* K5   */  be_const_int(3),
     /* K6   */  be_nested_str_weak(opcode),
     /* K7   */  be_const_int(0),
@@ -169,11 +169,11 @@ be_local_closure(Matter_Control_Message_process_incoming_control_message,   /* n
     ( &(const binstruction[37]) {  /* code */
       0xB80A0000,  //  0000  GETNGBL	R2	K0
       0x8C080501,  //  0001  GETMET	R2	R2	K1
-      0xB8120600,  //  0002  GETNGBL	R4	K3
-      0x8C100904,  //  0003  GETMET	R4	R4	K4
+      0xB8120400,  //  0002  GETNGBL	R4	K2
+      0x8C100903,  //  0003  GETMET	R4	R4	K3
       0x5C180200,  //  0004  MOVE	R6	R1
       0x7C100400,  //  0005  CALL	R4	2
-      0x00120404,  //  0006  ADD	R4	K2	R4
+      0x00120804,  //  0006  ADD	R4	K4	R4
       0x58140005,  //  0007  LDCONST	R5	K5
       0x7C080600,  //  0008  CALL	R2	3
       0x88080306,  //  0009  GETMBR	R2	R1	K6
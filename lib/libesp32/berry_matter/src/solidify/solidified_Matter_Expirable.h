@@ -626,7 +626,7 @@ be_local_closure(Matter_Expirable_list_remove_expired,   /* name */
       0x8C0C0103,  //  000F  GETMET	R3	R0	K3
       0x5C140400,  //  0010  MOVE	R5	R2
       0x7C0C0400,  //  0011  CALL	R3	2
-      0x70020000,  //  0012  JMP		#0014
+      0x7001FFEE,  //  0012  JMP		#0002
       0x00080504,  //  0013  ADD	R2	R2	K4
       0x7001FFEC,  //  0014  JMP		#0002
       0x80040200,  //  0015  RET	1	R1
@@ -670,7 +670,7 @@ be_local_closure(Matter_Expirable_list_persistables,   /* name */
           0x68000000,  //  0002  GETUPV	R0	U0
           0x7C000000,  //  0003  CALL	R0	0
           0x88040100,  //  0004  GETMBR	R1	R0	K0
-          0x78060000,  //  0005  JMPF	R1	#0007
+          0x7805FFF9,  //  0005  JMPF	R1	#0000
           0x80040000,  //  0006  RET	1	R0
           0x7001FFF7,  //  0007  JMP		#0000
           0x80000000,  //  0008  RET	0
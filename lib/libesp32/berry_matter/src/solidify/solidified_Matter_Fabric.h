@@ -271,8 +271,8 @@ be_local_closure(Matter_Fabric_fromjson,   /* name */
     /* K9   */  be_nested_str_weak(0x),
     /* K10  */  be_nested_str_weak(set),
     /* K11  */  be_nested_str_weak(fromhex),
-    /* K12  */  be_const_int(2),
-    /* K13  */  be_const_int(2147483647),
+    /* K12  */  be_const_int(2147483647),
+    /* K13  */  be_const_int(2),
     /* K14  */  be_nested_str_weak(_X24_X24),
     /* K15  */  be_nested_str_weak(fromb64),
     /* K16  */  be_nested_str_weak(stop_iteration),
@@ -317,11 +317,11 @@ be_local_closure(Matter_Fabric_fromjson,   /* name */
       0x60340015,  //  0021  GETGBL	R13	G21
       0x7C340000,  //  0022  CALL	R13	0
       0x8C341B0B,  //  0023  GETMET	R13	R13	K11
-      0x403E190D,  //  0024  CONNECT	R15	K12	K13
+      0x403E1B0C,  //  0024  CONNECT	R15	K13	K12
       0x943C100F,  //  0025  GETIDX	R15	R8	R15
       0x7C340400,  //  0026  CALL	R13	2
       0x7C240800,  //  0027  CALL	R9	4
-      0x70020015,  //  0028  JMP		#003F
+      0x7001FFE2,  //  0028  JMP		#000C
       0x8C240708,  //  0029  GETMET	R9	R3	K8
       0x5C2C1000,  //  002A  MOVE	R11	R8
       0x5830000E,  //  002B  LDCONST	R12	K14
@@ -334,17 +334,17 @@ be_local_closure(Matter_Fabric_fromjson,   /* name */
       0x60340015,  //  0032  GETGBL	R13	G21
       0x7C340000,  //  0033  CALL	R13	0
       0x8C341B0F,  //  0034  GETMET	R13	R13	K15
-      0x403E190D,  //  0035  CONNECT	R15	K12	K13
+      0x403E1B0C,  //  0035  CONNECT	R15	K13	K12
       0x943C100F,  //  0036  GETIDX	R15	R8	R15
       0x7C340400,  //  0037  CALL	R13	2
       0x7C240800,  //  0038  CALL	R9	4
-      0x70020004,  //  0039  JMP		#003F
+      0x7001FFD1,  //  0039  JMP		#000C
       0x8C24090A,  //  003A  GETMET	R9	R4	K10
       0x5C2C0A00,  //  003B  MOVE	R11	R5
       0x5C300E00,  //  003C  MOVE	R12	R7
       0x5C341000,  //  003D  MOVE	R13	R8
       0x7C240800,  //  003E  CALL	R9	4
-      0x70020004,  //  003F  JMP		#0045
+      0x7001FFCB,  //  003F  JMP		#000C
       0x8C24090A,  //  0040  GETMET	R9	R4	K10
       0x5C2C0A00,  //  0041  MOVE	R11	R5
       0x5C300E00,  //  0042  MOVE	R12	R7
@@ -416,16 +416,16 @@ be_local_closure(Matter_Fabric_tojson,   /* name */
     /* K9   */  be_nested_str_weak(stop_iteration),
     /* K10  */  be_nested_str_weak(matter),
     /* K11  */  be_nested_str_weak(sort),
-    /* K12  */  be_nested_str_weak(_X24_X24),
-    /* K13  */  be_nested_str_weak(tob64),
+    /* K12  */  be_nested_str_weak(tob64),
+    /* K13  */  be_nested_str_weak(_X24_X24),
     /* K14  */  be_nested_str_weak(_X25s_X3A_X25s),
     /* K15  */  be_nested_str_weak(dump),
     /* K16  */  be_nested_str_weak(_sessions),
     /* K17  */  be_nested_str_weak(persistables),
     /* K18  */  be_nested_str_weak(tojson),
-    /* K19  */  be_nested_str_weak(_X5B),
-    /* K20  */  be_nested_str_weak(concat),
-    /* K21  */  be_nested_str_weak(_X2C),
+    /* K19  */  be_nested_str_weak(concat),
+    /* K20  */  be_nested_str_weak(_X2C),
+    /* K21  */  be_nested_str_weak(_X5B),
     /* K22  */  be_nested_str_weak(_X5D),
     /* K23  */  be_nested_str_weak(_X22_sessions_X22_X3A),
     /* K24  */  be_nested_str_weak(persist_post),
@@ -434,7 +434,7 @@ be_local_closure(Matter_Fabric_tojson,   /* name */
     }),
     be_str_weak(tojson),
     &be_const_str_solidified,
-    ( &(const binstruction[119]) {  /* code */
+    ( &(const binstruction[118]) {  /* code */
       0xA4060000,  //  0000  IMPORT	R1	K0
       0xA40A0200,  //  0001  IMPORT	R2	K1
       0x8C0C0102,  //  0002  GETMET	R3	R0	K2
@@ -457,10 +457,10 @@ be_local_closure(Matter_Fabric_tojson,   /* name */
       0x5C200C00,  //  0013  MOVE	R8	R6
       0x7C1C0200,  //  0014  CALL	R7	1
       0x201C0F05,  //  0015  NE	R7	R7	K5
-      0x781E0005,  //  0016  JMPF	R7	#001D
+      0x781DFFF4,  //  0016  JMPF	R7	#000C
       0x941C0B06,  //  0017  GETIDX	R7	R5	K6
       0x201C0F07,  //  0018  NE	R7	R7	K7
-      0x781E0002,  //  0019  JMPF	R7	#001D
+      0x781DFFF1,  //  0019  JMPF	R7	#000C
       0x8C1C0708,  //  001A  GETMET	R7	R3	K8
       0x5C240A00,  //  001B  MOVE	R9	R5
       0x7C1C0400,  //  001C  CALL	R7	2
@@ -478,7 +478,7 @@ be_local_closure(Matter_Fabric_tojson,   /* name */
       0x60140010,  //  0028  GETGBL	R5	G16
       0x5C180600,  //  0029  MOVE	R6	R3
       0x7C140200,  //  002A  CALL	R5	1
-      0xA8020020,  //  002B  EXBLK	0	#004D
+      0xA802001F,  //  002B  EXBLK	0	#004C
       0x5C180A00,  //  002C  MOVE	R6	R5
       0x7C180000,  //  002D  CALL	R6	0
       0x8C1C0504,  //  002E  GETMET	R7	R2	K4
@@ -493,67 +493,66 @@ be_local_closure(Matter_Fabric_tojson,   /* name */
       0x5C240E00,  //  0037  MOVE	R9	R7
       0x60280015,  //  0038  GETGBL	R10	G21
       0x7C200400,  //  0039  CALL	R8	2
-      0x78220003,  //  003A  JMPF	R8	#003F
-      0x8C200F0D,  //  003B  GETMET	R8	R7	K13
+      0x78220002,  //  003A  JMPF	R8	#003E
+      0x8C200F0C,  //  003B  GETMET	R8	R7	K12
       0x7C200200,  //  003C  CALL	R8	1
-      0x00221808,  //  003D  ADD	R8	K12	R8
-      0x5C1C1000,  //  003E  MOVE	R7	R8
-      0x8C200908,  //  003F  GETMET	R8	R4	K8
-      0x60280018,  //  0040  GETGBL	R10	G24
-      0x582C000E,  //  0041  LDCONST	R11	K14
-      0x8C30030F,  //  0042  GETMET	R12	R1	K15
-      0x60380008,  //  0043  GETGBL	R14	G8
-      0x5C3C0C00,  //  0044  MOVE	R15	R6
-      0x7C380200,  //  0045  CALL	R14	1
-      0x7C300400,  //  0046  CALL	R12	2
-      0x8C34030F,  //  0047  GETMET	R13	R1	K15
-      0x5C3C0E00,  //  0048  MOVE	R15	R7
-      0x7C340400,  //  0049  CALL	R13	2
-      0x7C280600,  //  004A  CALL	R10	3
-      0x7C200400,  //  004B  CALL	R8	2
-      0x7001FFDE,  //  004C  JMP		#002C
-      0x58140009,  //  004D  LDCONST	R5	K9
-      0xAC140200,  //  004E  CATCH	R5	1	0
-      0xB0080000,  //  004F  RAISE	2	R0	R0
-      0x60140012,  //  0050  GETGBL	R5	G18
-      0x7C140000,  //  0051  CALL	R5	0
-      0x60180010,  //  0052  GETGBL	R6	G16
-      0x881C0110,  //  0053  GETMBR	R7	R0	K16
-      0x8C1C0F11,  //  0054  GETMET	R7	R7	K17
-      0x7C1C0200,  //  0055  CALL	R7	1
-      0x7C180200,  //  0056  CALL	R6	1
-      0xA8020006,  //  0057  EXBLK	0	#005F
-      0x5C1C0C00,  //  0058  MOVE	R7	R6
-      0x7C1C0000,  //  0059  CALL	R7	0
-      0x8C200B08,  //  005A  GETMET	R8	R5	K8
-      0x8C280F12,  //  005B  GETMET	R10	R7	K18
-      0x7C280200,  //  005C  CALL	R10	1
-      0x7C200400,  //  005D  CALL	R8	2
-      0x7001FFF8,  //  005E  JMP		#0058
-      0x58180009,  //  005F  LDCONST	R6	K9
-      0xAC180200,  //  0060  CATCH	R6	1	0
-      0xB0080000,  //  0061  RAISE	2	R0	R0
-      0x6018000C,  //  0062  GETGBL	R6	G12
-      0x5C1C0A00,  //  0063  MOVE	R7	R5
-      0x7C180200,  //  0064  CALL	R6	1
-      0x24180D06,  //  0065  GT	R6	R6	K6
-      0x781A0007,  //  0066  JMPF	R6	#006F
-      0x8C180B14,  //  0067  GETMET	R6	R5	K20
-      0x58200015,  //  0068  LDCONST	R8	K21
-      0x7C180400,  //  0069  CALL	R6	2
-      0x001A2606,  //  006A  ADD	R6	K19	R6
-      0x00180D16,  //  006B  ADD	R6	R6	K22
-      0x8C1C0908,  //  006C  GETMET	R7	R4	K8
-      0x00262E06,  //  006D  ADD	R9	K23	R6
-      0x7C1C0400,  //  006E  CALL	R7	2
-      0x8C180118,  //  006F  GETMET	R6	R0	K24
-      0x7C180200,  //  0070  CALL	R6	1
-      0x8C180914,  //  0071  GETMET	R6	R4	K20
-      0x58200015,  //  0072  LDCONST	R8	K21
-      0x7C180400,  //  0073  CALL	R6	2
-      0x001A3206,  //  0074  ADD	R6	K25	R6
-      0x00180D1A,  //  0075  ADD	R6	R6	K26
-      0x80040C00,  //  0076  RET	1	R6
+      0x001E1A08,  //  003D  ADD	R7	K13	R8
+      0x8C200908,  //  003E  GETMET	R8	R4	K8
+      0x60280018,  //  003F  GETGBL	R10	G24
+      0x582C000E,  //  0040  LDCONST	R11	K14
+      0x8C30030F,  //  0041  GETMET	R12	R1	K15
+      0x60380008,  //  0042  GETGBL	R14	G8
+      0x5C3C0C00,  //  0043  MOVE	R15	R6
+      0x7C380200,  //  0044  CALL	R14	1
+      0x7C300400,  //  0045  CALL	R12	2
+      0x8C34030F,  //  0046  GETMET	R13	R1	K15
+      0x5C3C0E00,  //  0047  MOVE	R15	R7
+      0x7C340400,  //  0048  CALL	R13	2
+      0x7C280600,  //  0049  CALL	R10	3
+      0x7C200400,  //  004A  CALL	R8	2
+      0x7001FFDF,  //  004B  JMP		#002C
+      0x58140009,  //  004C  LDCONST	R5	K9
+      0xAC140200,  //  004D  CATCH	R5	1	0
+      0xB0080000,  //  004E  RAISE	2	R0	R0
+      0x60140012,  //  004F  GETGBL	R5	G18
+      0x7C140000,  //  0050  CALL	R5	0
+      0x60180010,  //  0051  GETGBL	R6	G16
+      0x881C0110,  //  0052  GETMBR	R7	R0	K16
+      0x8C1C0F11,  //  0053  GETMET	R7	R7	K17
+      0x7C1C0200,  //  0054  CALL	R7	1
+      0x7C180200,  //  0055  CALL	R6	1
+      0xA8020006,  //  0056  EXBLK	0	#005E
+      0x5C1C0C00,  //  0057  MOVE	R7	R6
+      0x7C1C0000,  //  0058  CALL	R7	0
+      0x8C200B08,  //  0059  GETMET	R8	R5	K8
+      0x8C280F12,  //  005A  GETMET	R10	R7	K18
+      0x7C280200,  //  005B  CALL	R10	1
+      0x7C200400,  //  005C  CALL	R8	2
+      0x7001FFF8,  //  005D  JMP		#0057
+      0x58180009,  //  005E  LDCONST	R6	K9
+      0xAC180200,  //  005F  CATCH	R6	1	0
+      0xB0080000,  //  0060  RAISE	2	R0	R0
+      0x6018000C,  //  0061  GETGBL	R6	G12
+      0x5C1C0A00,  //  0062  MOVE	R7	R5
+      0x7C180200,  //  0063  CALL	R6	1
+      0x24180D06,  //  0064  GT	R6	R6	K6
+      0x781A0007,  //  0065  JMPF	R6	#006E
+      0x8C180B13,  //  0066  GETMET	R6	R5	K19
+      0x58200014,  //  0067  LDCONST	R8	K20
+      0x7C180400,  //  0068  CALL	R6	2
+      0x001A2A06,  //  0069  ADD	R6	K21	R6
+      0x00180D16,  //  006A  ADD	R6	R6	K22
+      0x8C1C0908,  //  006B  GETMET	R7	R4	K8
+      0x00262E06,  //  006C  ADD	R9	K23	R6
+      0x7C1C0400,  //  006D  CALL	R7	2
+      0x8C180118,  //  006E  GETMET	R6	R0	K24
+      0x7C180200,  //  006F  CALL	R6	1
+      0x8C180913,  //  0070  GETMET	R6	R4	K19
+      0x58200014,  //  0071  LDCONST	R8	K20
+      0x7C180400,  //  0072  CALL	R6	2
+      0x001A3206,  //  0073  ADD	R6	K25	R6
+      0x00180D1A,  //  0074  ADD	R6	R6	K26
+      0x80040C00,  //  0075  RET	1	R6
     })
   )
 );
@@ -1183,8 +1182,8 @@ be_local_closure(Matter_Fabric_writejson,   /* name */
     /* K11  */  be_nested_str_weak(stop_iteration),
     /* K12  */  be_nested_str_weak(matter),
     /* K13  */  be_nested_str_weak(sort),
-    /* K14  */  be_nested_str_weak(_X24_X24),
-    /* K15  */  be_nested_str_weak(tob64),
+    /* K14  */  be_nested_str_weak(tob64),
+    /* K15  */  be_nested_str_weak(_X24_X24),
     /* K16  */  be_nested_str_weak(_X2C),
     /* K17  */  be_nested_str_weak(_X25s_X3A_X25s),
     /* K18  */  be_nested_str_weak(dump),
@@ -1198,7 +1197,7 @@ be_local_closure(Matter_Fabric_writejson,   /* name */
     }),
     be_str_weak(writejson),
     &be_const_str_solidified,
-    ( &(const binstruction[125]) {  /* code */
+    ( &(const binstruction[124]) {  /* code */
       0xA40A0000,  //  0000  IMPORT	R2	K0
       0xA40E0200,  //  0001  IMPORT	R3	K1
       0x8C100302,  //  0002  GETMET	R4	R1	K2
@@ -1224,10 +1223,10 @@ be_local_closure(Matter_Fabric_writejson,   /* name */
       0x5C240E00,  //  0016  MOVE	R9	R7
       0x7C200200,  //  0017  CALL	R8	1
       0x20201107,  //  0018  NE	R8	R8	K7
-      0x78220005,  //  0019  JMPF	R8	#0020
+      0x7821FFF4,  //  0019  JMPF	R8	#000F
       0x94200D08,  //  001A  GETIDX	R8	R6	K8
       0x20201109,  //  001B  NE	R8	R8	K9
-      0x78220002,  //  001C  JMPF	R8	#0020
+      0x7821FFF1,  //  001C  JMPF	R8	#000F
       0x8C20090A,  //  001D  GETMET	R8	R4	K10
       0x5C280C00,  //  001E  MOVE	R10	R6
       0x7C200400,  //  001F  CALL	R8	2
@@ -1244,7 +1243,7 @@ be_local_closure(Matter_Fabric_writejson,   /* name */
       0x60180010,  //  002A  GETGBL	R6	G16
       0x5C1C0800,  //  002B  MOVE	R7	R4
       0x7C180200,  //  002C  CALL	R6	1
-      0xA8020026,  //  002D  EXBLK	0	#0055
+      0xA8020025,  //  002D  EXBLK	0	#0054
       0x5C1C0C00,  //  002E  MOVE	R7	R6
       0x7C1C0000,  //  002F  CALL	R7	0
       0x8C200706,  //  0030  GETMET	R8	R3	K6
@@ -1259,71 +1258,70 @@ be_local_closure(Matter_Fabric_writejson,   /* name */
       0x5C281000,  //  0039  MOVE	R10	R8
       0x602C0015,  //  003A  GETGBL	R11	G21
       0x7C240400,  //  003B  CALL	R9	2
-      0x78260003,  //  003C  JMPF	R9	#0041
-      0x8C24110F,  //  003D  GETMET	R9	R8	K15
+      0x78260002,  //  003C  JMPF	R9	#0040
+      0x8C24110E,  //  003D  GETMET	R9	R8	K14
       0x7C240200,  //  003E  CALL	R9	1
-      0x00261C09,  //  003F  ADD	R9	K14	R9
-      0x5C201200,  //  0040  MOVE	R8	R9
-      0x5C240A00,  //  0041  MOVE	R9	R5
-      0x74260002,  //  0042  JMPT	R9	#0046
-      0x8C240302,  //  0043  GETMET	R9	R1	K2
-      0x582C0010,  //  0044  LDCONST	R11	K16
-      0x7C240400,  //  0045  CALL	R9	2
-      0x8C240302,  //  0046  GETMET	R9	R1	K2
-      0x602C0018,  //  0047  GETGBL	R11	G24
-      0x58300011,  //  0048  LDCONST	R12	K17
-      0x8C340512,  //  0049  GETMET	R13	R2	K18
-      0x603C0008,  //  004A  GETGBL	R15	G8
-      0x5C400E00,  //  004B  MOVE	R16	R7
-      0x7C3C0200,  //  004C  CALL	R15	1
-      0x7C340400,  //  004D  CALL	R13	2
-      0x8C380512,  //  004E  GETMET	R14	R2	K18
-      0x5C401000,  //  004F  MOVE	R16	R8
-      0x7C380400,  //  0050  CALL	R14	2
-      0x7C2C0600,  //  0051  CALL	R11	3
-      0x7C240400,  //  0052  CALL	R9	2
-      0x50140000,  //  0053  LDBOOL	R5	0	0
-      0x7001FFD8,  //  0054  JMP		#002E
-      0x5818000B,  //  0055  LDCONST	R6	K11
-      0xAC180200,  //  0056  CATCH	R6	1	0
-      0xB0080000,  //  0057  RAISE	2	R0	R0
-      0x50180200,  //  0058  LDBOOL	R6	1	0
-      0x601C0010,  //  0059  GETGBL	R7	G16
-      0x88200113,  //  005A  GETMBR	R8	R0	K19
-      0x8C201114,  //  005B  GETMET	R8	R8	K20
-      0x7C200200,  //  005C  CALL	R8	1
-      0x7C1C0200,  //  005D  CALL	R7	1
-      0xA802000F,  //  005E  EXBLK	0	#006F
-      0x5C200E00,  //  005F  MOVE	R8	R7
-      0x7C200000,  //  0060  CALL	R8	0
-      0x781A0003,  //  0061  JMPF	R6	#0066
-      0x8C240302,  //  0062  GETMET	R9	R1	K2
-      0x582C0015,  //  0063  LDCONST	R11	K21
-      0x7C240400,  //  0064  CALL	R9	2
-      0x70020002,  //  0065  JMP		#0069
-      0x8C240302,  //  0066  GETMET	R9	R1	K2
-      0x582C0010,  //  0067  LDCONST	R11	K16
-      0x7C240400,  //  0068  CALL	R9	2
-      0x8C240302,  //  0069  GETMET	R9	R1	K2
-      0x8C2C1116,  //  006A  GETMET	R11	R8	K22
-      0x7C2C0200,  //  006B  CALL	R11	1
-      0x7C240400,  //  006C  CALL	R9	2
-      0x50180000,  //  006D  LDBOOL	R6	0	0
-      0x7001FFEF,  //  006E  JMP		#005F
-      0x581C000B,  //  006F  LDCONST	R7	K11
-      0xAC1C0200,  //  0070  CATCH	R7	1	0
-      0xB0080000,  //  0071  RAISE	2	R0	R0
-      0x5C1C0C00,  //  0072  MOVE	R7	R6
-      0x741E0002,  //  0073  JMPT	R7	#0077
-      0x8C1C0302,  //  0074  GETMET	R7	R1	K2
-      0x58240017,  //  0075  LDCONST	R9	K23
-      0x7C1C0400,  //  0076  CALL	R7	2
-      0x8C1C0118,  //  0077  GETMET	R7	R0	K24
-      0x7C1C0200,  //  0078  CALL	R7	1
-      0x8C1C0302,  //  0079  GETMET	R7	R1	K2
-      0x58240019,  //  007A  LDCONST	R9	K25
-      0x7C1C0400,  //  007B  CALL	R7	2
-      0x80000000,  //  007C  RET	0
+      0x00221E09,  //  003F  ADD	R8	K15	R9
+      0x5C240A00,  //  0040  MOVE	R9	R5
+      0x74260002,  //  0041  JMPT	R9	#0045
+      0x8C240302,  //  0042  GETMET	R9	R1	K2
+      0x582C0010,  //  0043  LDCONST	R11	K16
+      0x7C240400,  //  0044  CALL	R9	2
+      0x8C240302,  //  0045  GETMET	R9	R1	K2
+      0x602C0018,  //  0046  GETGBL	R11	G24
+      0x58300011,  //  0047  LDCONST	R12	K17
+      0x8C340512,  //  0048  GETMET	R13	R2	K18
+      0x603C0008,  //  0049  GETGBL	R15	G8
+      0x5C400E00,  //  004A  MOVE	R16	R7
+      0x7C3C0200,  //  004B  CALL	R15	1
+      0x7C340400,  //  004C  CALL	R13	2
+      0x8C380512,  //  004D  GETMET	R14	R2	K18
+      0x5C401000,  //  004E  MOVE	R16	R8
+      0x7C380400,  //  004F  CALL	R14	2
+      0x7C2C0600,  //  0050  CALL	R11	3
+      0x7C240400,  //  0051  CALL	R9	2
+      0x50140000,  //  0052  LDBOOL	R5	0	0
+      0x7001FFD9,  //  0053  JMP		#002E
+      0x5818000B,  //  0054  LDCONST	R6	K11
+      0xAC180200,  //  0055  CATCH	R6	1	0
+      0xB0080000,  //  0056  RAISE	2	R0	R0
+      0x50180200,  //  0057  LDBOOL	R6	1	0
+      0x601C0010,  //  0058  GETGBL	R7	G16
+      0x88200113,  //  0059  GETMBR	R8	R0	K19
+      0x8C201114,  //  005A  GETMET	R8	R8	K20
+      0x7C200200,  //  005B  CALL	R8	1
+      0x7C1C0200,  //  005C  CALL	R7	1
+      0xA802000F,  //  005D  EXBLK	0	#006E
+      0x5C200E00,  //  005E  MOVE	R8	R7
+      0x7C200000,  //  005F  CALL	R8	0
+      0x781A0003,  //  0060  JMPF	R6	#0065
+      0x8C240302,  //  0061  GETMET	R9	R1	K2
+      0x582C0015,  //  0062  LDCONST	R11	K21
+      0x7C240400,  //  0063  CALL	R9	2
+      0x70020002,  //  0064  JMP		#0068
+      0x8C240302,  //  0065  GETMET	R9	R1	K2
+      0x582C0010,  //  0066  LDCONST	R11	K16
+      0x7C240400,  //  0067  CALL	R9	2
+      0x8C240302,  //  0068  GETMET	R9	R1	K2
+      0x8C2C1116,  //  0069  GETMET	R11	R8	K22
+      0x7C2C0200,  //  006A  CALL	R11	1
+      0x7C240400,  //  006B  CALL	R9	2
+      0x50180000,  //  006C  LDBOOL	R6	0	0
+      0x7001FFEF,  //  006D  JMP		#005E
+      0x581C000B,  //  006E  LDCONST	R7	K11
+      0xAC1C0200,  //  006F  CATCH	R7	1	0
+      0xB0080000,  //  0070  RAISE	2	R0	R0
+      0x5C1C0C00,  //  0071  MOVE	R7	R6
+      0x741E0002,  //  0072  JMPT	R7	#0076
+      0x8C1C0302,  //  0073  GETMET	R7	R1	K2
+      0x58240017,  //  0074  LDCONST	R9	K23
+      0x7C1C0400,  //  0075  CALL	R7	2
+      0x8C1C0118,  //  0076  GETMET	R7	R0	K24
+      0x7C1C0200,  //  0077  CALL	R7	1
+      0x8C1C0302,  //  0078  GETMET	R7	R1	K2
+      0x58240019,  //  0079  LDCONST	R9	K25
+      0x7C1C0400,  //  007A  CALL	R7	2
+      0x80000000,  //  007B  RET	0
     })
   )
 );
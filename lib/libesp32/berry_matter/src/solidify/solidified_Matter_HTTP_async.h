@@ -28,8 +28,8 @@ be_local_closure(Matter_HTTP_async_parse_http_payload,   /* name */
     /* K5   */  be_nested_str_weak(response),
     /* K6   */  be_nested_str_weak(response_offset),
     /* K7   */  be_const_int(0),
-    /* K8   */  be_nested_str_weak(0x),
-    /* K9   */  be_const_int(1),
+    /* K8   */  be_const_int(1),
+    /* K9   */  be_nested_str_weak(0x),
     /* K10  */  be_nested_str_weak(status),
     /* K11  */  be_const_int(2),
     /* K12  */  be_nested_str_weak(),
@@ -43,7 +43,7 @@ be_local_closure(Matter_HTTP_async_parse_http_payload,   /* name */
       0x88040100,  //  0000  GETMBR	R1	R0	K0
       0x78060045,  //  0001  JMPF	R1	#0048
       0x50040200,  //  0002  LDBOOL	R1	1	0
-      0x78060042,  //  0003  JMPF	R1	#0047
+      0x7806004C,  //  0003  JMPF	R1	#0051
       0x88040101,  //  0004  GETMBR	R1	R0	K1
       0x4C080000,  //  0005  LDNIL	R2
       0x1C040202,  //  0006  EQ	R1	R1	R2
@@ -60,8 +60,8 @@ be_local_closure(Matter_HTTP_async_parse_http_payload,   /* name */
       0x00080403,  //  0011  ADD	R2	R2	R3
       0x90020C02,  //  0012  SETMBR	R0	K6	R2
       0x60080009,  //  0013  GETGBL	R2	G9
-      0x940C0309,  //  0014  GETIDX	R3	R1	K9
-      0x000E1003,  //  0015  ADD	R3	K8	R3
+      0x940C0308,  //  0014  GETIDX	R3	R1	K8
+      0x000E1203,  //  0015  ADD	R3	K9	R3
       0x7C080200,  //  0016  CALL	R2	1
       0x90020202,  //  0017  SETMBR	R0	K1	R2
       0x88080101,  //  0018  GETMBR	R2	R0	K1
@@ -89,7 +89,7 @@ be_local_closure(Matter_HTTP_async_parse_http_payload,   /* name */
       0x880C0106,  //  002E  GETMBR	R3	R0	K6
       0x88100101,  //  002F  GETMBR	R4	R0	K1
       0x000C0604,  //  0030  ADD	R3	R3	R4
-      0x040C0709,  //  0031  SUB	R3	R3	K9
+      0x040C0708,  //  0031  SUB	R3	R3	K8
       0x40080403,  //  0032  CONNECT	R2	R2	R3
       0x880C0105,  //  0033  GETMBR	R3	R0	K5
       0x8804010E,  //  0034  GETMBR	R1	R0	K14
@@ -106,9 +106,9 @@ be_local_closure(Matter_HTTP_async_parse_http_payload,   /* name */
       0x90020D07,  //  003F  SETMBR	R0	K6	K7
       0x4C040000,  //  0040  LDNIL	R1
       0x90020201,  //  0041  SETMBR	R0	K1	R1
-      0x70020000,  //  0042  JMP		#0044
+      0x7001FFBE,  //  0042  JMP		#0002
       0x80000200,  //  0043  RET	0
-      0x70020000,  //  0044  JMP		#0046
+      0x7001FFBC,  //  0044  JMP		#0002
       0x80000200,  //  0045  RET	0
       0x7001FFBA,  //  0046  JMP		#0002
       0x70020008,  //  0047  JMP		#0051
@@ -541,7 +541,7 @@ be_local_closure(Matter_HTTP_async_parse_http_headers,   /* name */
       0x940C0308,  //  000E  GETIDX	R3	R1	K8
       0x00080403,  //  000F  ADD	R2	R2	R3
       0x90020802,  //  0010  SETMBR	R0	K4	R2
-      0x7002001A,  //  0011  JMP		#002D
+      0x7001FFED,  //  0011  JMP		#0000
       0xB80A0000,  //  0012  GETNGBL	R2	K0
       0x88080509,  //  0013  GETMBR	R2	R2	K9
       0x8C080502,  //  0014  GETMET	R2	R2	K2
@@ -837,7 +837,7 @@ be_local_closure(Matter_HTTP_async_send_http,   /* name */
     }),
     be_str_weak(send_http),
     &be_const_str_solidified,
-    ( &(const binstruction[50]) {  /* code */
+    ( &(const binstruction[49]) {  /* code */
       0xA4060000,  //  0000  IMPORT	R1	K0
       0x90020302,  //  0001  SETMBR	R0	K1	K2
       0x88080103,  //  0002  GETMBR	R2	R0	K3
@@ -846,48 +846,47 @@ be_local_closure(Matter_HTTP_async_send_http,   /* name */
       0x58180005,  //  0005  LDCONST	R6	K5
       0x7C0C0600,  //  0006  CALL	R3	3
       0x280C0706,  //  0007  GE	R3	R3	K6
-      0x780E0002,  //  0008  JMPF	R3	#000C
+      0x780E0001,  //  0008  JMPF	R3	#000B
       0x000E0E02,  //  0009  ADD	R3	K7	R2
-      0x000C0708,  //  000A  ADD	R3	R3	K8
-      0x5C080600,  //  000B  MOVE	R2	R3
-      0x4C0C0000,  //  000C  LDNIL	R3
-      0x88100109,  //  000D  GETMBR	R4	R0	K9
-      0x4C140000,  //  000E  LDNIL	R5
-      0x1C100805,  //  000F  EQ	R4	R4	R5
-      0x78120007,  //  0010  JMPF	R4	#0019
-      0x60100018,  //  0011  GETGBL	R4	G24
-      0x8814010A,  //  0012  GETMBR	R5	R0	K10
-      0x8818010B,  //  0013  GETMBR	R6	R0	K11
-      0x5C1C0400,  //  0014  MOVE	R7	R2
-      0x8820010C,  //  0015  GETMBR	R8	R0	K12
-      0x7C100800,  //  0016  CALL	R4	4
-      0x5C0C0800,  //  0017  MOVE	R3	R4
-      0x70020007,  //  0018  JMP		#0021
-      0x60100018,  //  0019  GETGBL	R4	G24
-      0x8814010D,  //  001A  GETMBR	R5	R0	K13
-      0x8818010B,  //  001B  GETMBR	R6	R0	K11
-      0x5C1C0400,  //  001C  MOVE	R7	R2
-      0x8820010C,  //  001D  GETMBR	R8	R0	K12
-      0x88240109,  //  001E  GETMBR	R9	R0	K9
-      0x7C100A00,  //  001F  CALL	R4	5
-      0x5C0C0800,  //  0020  MOVE	R3	R4
-      0x8C10010E,  //  0021  GETMET	R4	R0	K14
-      0x5C180600,  //  0022  MOVE	R6	R3
-      0x7C100400,  //  0023  CALL	R4	2
-      0x6014000C,  //  0024  GETGBL	R5	G12
-      0x5C180600,  //  0025  MOVE	R6	R3
-      0x7C140200,  //  0026  CALL	R5	1
-      0x20140805,  //  0027  NE	R5	R4	R5
-      0x78160007,  //  0028  JMPF	R5	#0031
-      0x8C14010F,  //  0029  GETMET	R5	R0	K15
-      0x7C140200,  //  002A  CALL	R5	1
-      0x5415FFFB,  //  002B  LDINT	R5	-4
-      0x90022005,  //  002C  SETMBR	R0	K16	R5
-      0x5415FFFE,  //  002D  LDINT	R5	-1
-      0x90022205,  //  002E  SETMBR	R0	K17	R5
-      0x8C140112,  //  002F  GETMET	R5	R0	K18
-      0x7C140200,  //  0030  CALL	R5	1
-      0x80000000,  //  0031  RET	0
+      0x00080708,  //  000A  ADD	R2	R3	K8
+      0x4C0C0000,  //  000B  LDNIL	R3
+      0x88100109,  //  000C  GETMBR	R4	R0	K9
+      0x4C140000,  //  000D  LDNIL	R5
+      0x1C100805,  //  000E  EQ	R4	R4	R5
+      0x78120007,  //  000F  JMPF	R4	#0018
+      0x60100018,  //  0010  GETGBL	R4	G24
+      0x8814010A,  //  0011  GETMBR	R5	R0	K10
+      0x8818010B,  //  0012  GETMBR	R6	R0	K11
+      0x5C1C0400,  //  0013  MOVE	R7	R2
+      0x8820010C,  //  0014  GETMBR	R8	R0	K12
+      0x7C100800,  //  0015  CALL	R4	4
+      0x5C0C0800,  //  0016  MOVE	R3	R4
+      0x70020007,  //  0017  JMP		#0020
+      0x60100018,  //  0018  GETGBL	R4	G24
+      0x8814010D,  //  0019  GETMBR	R5	R0	K13
+      0x8818010B,  //  001A  GETMBR	R6	R0	K11
+      0x5C1C0400,  //  001B  MOVE	R7	R2
+      0x8820010C,  //  001C  GETMBR	R8	R0	K12
+      0x88240109,  //  001D  GETMBR	R9	R0	K9
+      0x7C100A00,  //  001E  CALL	R4	5
+      0x5C0C0800,  //  001F  MOVE	R3	R4
+      0x8C10010E,  //  0020  GETMET	R4	R0	K14
+      0x5C180600,  //  0021  MOVE	R6	R3
+      0x7C100400,  //  0022  CALL	R4	2
+      0x6014000C,  //  0023  GETGBL	R5	G12
+      0x5C180600,  //  0024  MOVE	R6	R3
+      0x7C140200,  //  0025  CALL	R5	1
+      0x20140805,  //  0026  NE	R5	R4	R5
+      0x78160007,  //  0027  JMPF	R5	#0030
+      0x8C14010F,  //  0028  GETMET	R5	R0	K15
+      0x7C140200,  //  0029  CALL	R5	1
+      0x5415FFFB,  //  002A  LDINT	R5	-4
+      0x90022005,  //  002B  SETMBR	R0	K16	R5
+      0x5415FFFE,  //  002C  LDINT	R5	-1
+      0x90022205,  //  002D  SETMBR	R0	K17	R5
+      0x8C140112,  //  002E  GETMET	R5	R0	K18
+      0x7C140200,  //  002F  CALL	R5	1
+      0x80000000,  //  0030  RET	0
     })
   )
 );
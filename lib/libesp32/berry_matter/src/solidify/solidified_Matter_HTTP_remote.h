@@ -263,10 +263,10 @@ be_local_closure(Matter_HTTP_remote_call_sync,   /* name */
     /* K4   */  be_nested_str_weak(up),
     /* K5   */  be_nested_str_weak(eth),
     /* K6   */  be_nested_str_weak(current_cmd),
-    /* K7   */  be_nested_str_weak(_X2Fcm_X3Fcmnd_X3D),
-    /* K8   */  be_nested_str_weak(tr),
-    /* K9   */  be_nested_str_weak(_X20),
-    /* K10  */  be_nested_str_weak(_X2B),
+    /* K7   */  be_nested_str_weak(tr),
+    /* K8   */  be_nested_str_weak(_X20),
+    /* K9   */  be_nested_str_weak(_X2B),
+    /* K10  */  be_nested_str_weak(_X2Fcm_X3Fcmnd_X3D),
     /* K11  */  be_nested_str_weak(log),
     /* K12  */  be_nested_str_weak(MTR_X3A_X20HTTP_X20sync_X20request_X20_X27http_X3A_X2F_X2F_X25s_X3A_X25i_X25s_X27),
     /* K13  */  be_nested_str_weak(addr),
@@ -283,7 +283,7 @@ be_local_closure(Matter_HTTP_remote_call_sync,   /* name */
     }),
     be_str_weak(call_sync),
     &be_const_str_solidified,
-    ( &(const binstruction[72]) {  /* code */
+    ( &(const binstruction[71]) {  /* code */
       0xA40E0000,  //  0000  IMPORT	R3	K0
       0xA4120200,  //  0001  IMPORT	R4	K1
       0xB8160400,  //  0002  GETNGBL	R5	K2
@@ -300,12 +300,12 @@ be_local_closure(Matter_HTTP_remote_call_sync,   /* name */
       0x80040A00,  //  000D  RET	1	R5
       0x4C140000,  //  000E  LDNIL	R5
       0x90020C05,  //  000F  SETMBR	R0	K6	R5
-      0x8C140708,  //  0010  GETMET	R5	R3	K8
+      0x8C140707,  //  0010  GETMET	R5	R3	K7
       0x5C1C0200,  //  0011  MOVE	R7	R1
-      0x58200009,  //  0012  LDCONST	R8	K9
-      0x5824000A,  //  0013  LDCONST	R9	K10
+      0x58200008,  //  0012  LDCONST	R8	K8
+      0x58240009,  //  0013  LDCONST	R9	K9
       0x7C140800,  //  0014  CALL	R5	4
-      0x00160E05,  //  0015  ADD	R5	K7	R5
+      0x00161405,  //  0015  ADD	R5	K10	R5
       0xB81A0400,  //  0016  GETNGBL	R6	K2
       0x8C180D0B,  //  0017  GETMET	R6	R6	K11
       0x60200018,  //  0018  GETGBL	R8	G24
@@ -332,30 +332,29 @@ be_local_closure(Matter_HTTP_remote_call_sync,   /* name */
       0x7C200200,  //  002D  CALL	R8	1
       0x5426001D,  //  002E  LDINT	R9	30
       0x24201009,  //  002F  GT	R8	R8	R9
-      0x78220004,  //  0030  JMPF	R8	#0036
+      0x78220003,  //  0030  JMPF	R8	#0035
       0x5422001C,  //  0031  LDINT	R8	29
       0x40222408,  //  0032  CONNECT	R8	K18	R8
       0x94200E08,  //  0033  GETIDX	R8	R7	R8
-      0x00201113,  //  0034  ADD	R8	R8	K19
-      0x5C1C1000,  //  0035  MOVE	R7	R8
-      0xB8220400,  //  0036  GETNGBL	R8	K2
-      0x8C20110B,  //  0037  GETMET	R8	R8	K11
-      0x60280018,  //  0038  GETGBL	R10	G24
-      0x582C0014,  //  0039  LDCONST	R11	K20
-      0xB8320400,  //  003A  GETNGBL	R12	K2
-      0x8C301915,  //  003B  GETMET	R12	R12	K21
-      0x7C300200,  //  003C  CALL	R12	1
-      0x88340116,  //  003D  GETMBR	R13	R0	K22
-      0x0430180D,  //  003E  SUB	R12	R12	R13
-      0x8834010D,  //  003F  GETMBR	R13	R0	K13
-      0x6038000C,  //  0040  GETGBL	R14	G12
-      0x883C0117,  //  0041  GETMBR	R15	R0	K23
-      0x7C380200,  //  0042  CALL	R14	1
-      0x5C3C0E00,  //  0043  MOVE	R15	R7
-      0x7C280A00,  //  0044  CALL	R10	5
-      0x582C000F,  //  0045  LDCONST	R11	K15
-      0x7C200600,  //  0046  CALL	R8	3
-      0x80040C00,  //  0047  RET	1	R6
+      0x001C1113,  //  0034  ADD	R7	R8	K19
+      0xB8220400,  //  0035  GETNGBL	R8	K2
+      0x8C20110B,  //  0036  GETMET	R8	R8	K11
+      0x60280018,  //  0037  GETGBL	R10	G24
+      0x582C0014,  //  0038  LDCONST	R11	K20
+      0xB8320400,  //  0039  GETNGBL	R12	K2
+      0x8C301915,  //  003A  GETMET	R12	R12	K21
+      0x7C300200,  //  003B  CALL	R12	1
+      0x88340116,  //  003C  GETMBR	R13	R0	K22
+      0x0430180D,  //  003D  SUB	R12	R12	R13
+      0x8834010D,  //  003E  GETMBR	R13	R0	K13
+      0x6038000C,  //  003F  GETGBL	R14	G12
+      0x883C0117,  //  0040  GETMBR	R15	R0	K23
+      0x7C380200,  //  0041  CALL	R14	1
+      0x5C3C0E00,  //  0042  MOVE	R15	R7
+      0x7C280A00,  //  0043  CALL	R10	5
+      0x582C000F,  //  0044  LDCONST	R11	K15
+      0x7C200600,  //  0045  CALL	R8	3
+      0x80040C00,  //  0046  RET	1	R6
     })
   )
 );
@@ -393,7 +392,7 @@ be_local_closure(Matter_HTTP_remote_event_http_finished,   /* name */
     }),
     be_str_weak(event_http_finished),
     &be_const_str_solidified,
-    ( &(const binstruction[45]) {  /* code */
+    ( &(const binstruction[44]) {  /* code */
       0x88040100,  //  0000  GETMBR	R1	R0	K0
       0x4C080000,  //  0001  LDNIL	R2
       0x1C040202,  //  0002  EQ	R1	R1	R2
@@ -411,34 +410,33 @@ be_local_closure(Matter_HTTP_remote_event_http_finished,   /* name */
       0x7C080200,  //  000E  CALL	R2	1
       0x540E001D,  //  000F  LDINT	R3	30
       0x24080403,  //  0010  GT	R2	R2	R3
-      0x780A0004,  //  0011  JMPF	R2	#0017
+      0x780A0003,  //  0011  JMPF	R2	#0016
       0x540A001C,  //  0012  LDINT	R2	29
       0x400A0602,  //  0013  CONNECT	R2	K3	R2
       0x94080202,  //  0014  GETIDX	R2	R1	R2
-      0x00080504,  //  0015  ADD	R2	R2	K4
-      0x5C040400,  //  0016  MOVE	R1	R2
-      0xB80A0A00,  //  0017  GETNGBL	R2	K5
-      0x8C080506,  //  0018  GETMET	R2	R2	K6
-      0x60100018,  //  0019  GETGBL	R4	G24
-      0x58140007,  //  001A  LDCONST	R5	K7
-      0xB81A0A00,  //  001B  GETNGBL	R6	K5
-      0x8C180D08,  //  001C  GETMET	R6	R6	K8
-      0x7C180200,  //  001D  CALL	R6	1
-      0x881C0109,  //  001E  GETMBR	R7	R0	K9
-      0x04180C07,  //  001F  SUB	R6	R6	R7
-      0x881C010A,  //  0020  GETMBR	R7	R0	K10
-      0x6020000C,  //  0021  GETGBL	R8	G12
-      0x88240101,  //  0022  GETMBR	R9	R0	K1
-      0x7C200200,  //  0023  CALL	R8	1
-      0x5C240200,  //  0024  MOVE	R9	R1
-      0x7C100A00,  //  0025  CALL	R4	5
-      0x5814000B,  //  0026  LDCONST	R5	K11
-      0x7C080600,  //  0027  CALL	R2	3
-      0x8C08010C,  //  0028  GETMET	R2	R0	K12
-      0x8810010D,  //  0029  GETMBR	R4	R0	K13
-      0x88140101,  //  002A  GETMBR	R5	R0	K1
-      0x7C080600,  //  002B  CALL	R2	3
-      0x80000000,  //  002C  RET	0
+      0x00040504,  //  0015  ADD	R1	R2	K4
+      0xB80A0A00,  //  0016  GETNGBL	R2	K5
+      0x8C080506,  //  0017  GETMET	R2	R2	K6
+      0x60100018,  //  0018  GETGBL	R4	G24
+      0x58140007,  //  0019  LDCONST	R5	K7
+      0xB81A0A00,  //  001A  GETNGBL	R6	K5
+      0x8C180D08,  //  001B  GETMET	R6	R6	K8
+      0x7C180200,  //  001C  CALL	R6	1
+      0x881C0109,  //  001D  GETMBR	R7	R0	K9
+      0x04180C07,  //  001E  SUB	R6	R6	R7
+      0x881C010A,  //  001F  GETMBR	R7	R0	K10
+      0x6020000C,  //  0020  GETGBL	R8	G12
+      0x88240101,  //  0021  GETMBR	R9	R0	K1
+      0x7C200200,  //  0022  CALL	R8	1
+      0x5C240200,  //  0023  MOVE	R9	R1
+      0x7C100A00,  //  0024  CALL	R4	5
+      0x5814000B,  //  0025  LDCONST	R5	K11
+      0x7C080600,  //  0026  CALL	R2	3
+      0x8C08010C,  //  0027  GETMET	R2	R0	K12
+      0x8810010D,  //  0028  GETMBR	R4	R0	K13
+      0x88140101,  //  0029  GETMBR	R5	R0	K1
+      0x7C080600,  //  002A  CALL	R2	3
+      0x80000000,  //  002B  RET	0
     })
   )
 );
@@ -468,24 +466,23 @@ be_local_closure(Matter_HTTP_remote_web_last_seen,   /* name */
     }),
     be_str_weak(web_last_seen),
     &be_const_str_solidified,
-    ( &(const binstruction[17]) {  /* code */
+    ( &(const binstruction[16]) {  /* code */
       0xA4060000,  //  0000  IMPORT	R1	K0
       0x5409FFFE,  //  0001  LDINT	R2	-1
       0x880C0101,  //  0002  GETMBR	R3	R0	K1
       0x4C100000,  //  0003  LDNIL	R4
       0x200C0604,  //  0004  NE	R3	R3	R4
-      0x780E0005,  //  0005  JMPF	R3	#000C
+      0x780E0004,  //  0005  JMPF	R3	#000B
       0xB80E0400,  //  0006  GETNGBL	R3	K2
       0x8C0C0703,  //  0007  GETMET	R3	R3	K3
       0x7C0C0200,  //  0008  CALL	R3	1
       0x88100101,  //  0009  GETMBR	R4	R0	K1
-      0x040C0604,  //  000A  SUB	R3	R3	R4
-      0x5C080600,  //  000B  MOVE	R2	R3
-      0xB80E0800,  //  000C  GETNGBL	R3	K4
-      0x8C0C0705,  //  000D  GETMET	R3	R3	K5
-      0x5C140400,  //  000E  MOVE	R5	R2
-      0x7C0C0400,  //  000F  CALL	R3	2
-      0x80040600,  //  0010  RET	1	R3
+      0x04080604,  //  000A  SUB	R2	R3	R4
+      0xB80E0800,  //  000B  GETNGBL	R3	K4
+      0x8C0C0705,  //  000C  GETMET	R3	R3	K5
+      0x5C140400,  //  000D  MOVE	R5	R2
+      0x7C0C0400,  //  000E  CALL	R3	2
+      0x80040600,  //  000F  RET	1	R3
     })
   )
 );
@@ -765,7 +762,7 @@ be_local_closure(Matter_HTTP_remote_scheduler,   /* name */
       0x88100100,  //  0009  GETMBR	R4	R0	K0
       0x94100803,  //  000A  GETIDX	R4	R4	R3
       0x1C100902,  //  000B  EQ	R4	R4	K2
-      0x78120001,  //  000C  JMPF	R4	#000F
+      0x7811FFF9,  //  000C  JMPF	R4	#0007
       0x5C040600,  //  000D  MOVE	R1	R3
       0x70020000,  //  000E  JMP		#0010
       0x7001FFF6,  //  000F  JMP		#0007
@@ -790,7 +787,7 @@ be_local_closure(Matter_HTTP_remote_scheduler,   /* name */
       0x88180100,  //  0022  GETMBR	R6	R0	K0
       0x94180C03,  //  0023  GETIDX	R6	R6	R3
       0x7C100400,  //  0024  CALL	R4	2
-      0x78120001,  //  0025  JMPF	R4	#0028
+      0x7811FFF7,  //  0025  JMPF	R4	#001E
       0x5C040600,  //  0026  MOVE	R1	R3
       0x70020000,  //  0027  JMP		#0029
       0x7001FFF4,  //  0028  JMP		#001E
@@ -901,10 +898,10 @@ be_local_closure(Matter_HTTP_remote_probe_async,   /* name */
     /* K4   */  be_nested_str_weak(up),
     /* K5   */  be_nested_str_weak(eth),
     /* K6   */  be_nested_str_weak(current_cmd),
-    /* K7   */  be_nested_str_weak(_X2Fcm_X3Fcmnd_X3D),
-    /* K8   */  be_nested_str_weak(tr),
-    /* K9   */  be_nested_str_weak(_X20),
-    /* K10  */  be_nested_str_weak(_X2B),
+    /* K7   */  be_nested_str_weak(tr),
+    /* K8   */  be_nested_str_weak(_X20),
+    /* K9   */  be_nested_str_weak(_X2B),
+    /* K10  */  be_nested_str_weak(_X2Fcm_X3Fcmnd_X3D),
     /* K11  */  be_nested_str_weak(log),
     /* K12  */  be_nested_str_weak(MTR_X3A_X20HTTP_X20async_X20request_X20_X27http_X3A_X2F_X2F_X25s_X3A_X25i_X25s_X27),
     /* K13  */  be_nested_str_weak(addr),
@@ -930,12 +927,12 @@ be_local_closure(Matter_HTTP_remote_probe_async,   /* name */
       0x4C100000,  //  000C  LDNIL	R4
       0x80040800,  //  000D  RET	1	R4
       0x90020C01,  //  000E  SETMBR	R0	K6	R1
-      0x8C100508,  //  000F  GETMET	R4	R2	K8
+      0x8C100507,  //  000F  GETMET	R4	R2	K7
       0x5C180200,  //  0010  MOVE	R6	R1
-      0x581C0009,  //  0011  LDCONST	R7	K9
-      0x5820000A,  //  0012  LDCONST	R8	K10
+      0x581C0008,  //  0011  LDCONST	R7	K8
+      0x58200009,  //  0012  LDCONST	R8	K9
       0x7C100800,  //  0013  CALL	R4	4
-      0x00120E04,  //  0014  ADD	R4	K7	R4
+      0x00121404,  //  0014  ADD	R4	K10	R4
       0xB8160400,  //  0015  GETNGBL	R5	K2
       0x8C140B0B,  //  0016  GETMET	R5	R5	K11
       0x601C0018,  //  0017  GETGBL	R7	G24
@@ -1050,7 +1047,7 @@ be_local_closure(Matter_HTTP_remote_dispatch_cb,   /* name */
       0x741E0002,  //  000D  JMPT	R7	#0011
       0x4C1C0000,  //  000E  LDNIL	R7
       0x1C1C0C07,  //  000F  EQ	R7	R6	R7
-      0x781E0004,  //  0010  JMPF	R7	#0016
+      0x781DFFF5,  //  0010  JMPF	R7	#0007
       0x5C1C0A00,  //  0011  MOVE	R7	R5
       0x5C200200,  //  0012  MOVE	R8	R1
       0x5C240400,  //  0013  MOVE	R9	R2
@@ -193,7 +193,7 @@ be_local_closure(Matter_IM_process_status_response,   /* name */
       0x5C1C0200,  //  000D  MOVE	R7	R1
       0x7C140400,  //  000E  CALL	R5	2
       0x80040A00,  //  000F  RET	1	R5
-      0x70020009,  //  0010  JMP		#001B
+      0x70020019,  //  0010  JMP		#002B
       0xB8160E00,  //  0011  GETNGBL	R5	K7
       0x8C140B08,  //  0012  GETMET	R5	R5	K8
       0x601C0018,  //  0013  GETGBL	R7	G24
@@ -493,7 +493,7 @@ be_local_closure(Matter_IM_process_invoke_request_solo,   /* name */
       0x8C201113,  //  0059  GETMET	R8	R8	K19
       0x58280014,  //  005A  LDCONST	R10	K20
       0x7C200400,  //  005B  CALL	R8	2
-      0x78220009,  //  005C  JMPF	R8	#0067
+      0x78220051,  //  005C  JMPF	R8	#00AF
       0xB8222400,  //  005D  GETNGBL	R8	K18
       0x8C201102,  //  005E  GETMET	R8	R8	K2
       0x60280018,  //  005F  GETGBL	R10	G24
@@ -520,7 +520,7 @@ be_local_closure(Matter_IM_process_invoke_request_solo,   /* name */
       0x8C201113,  //  0074  GETMET	R8	R8	K19
       0x58280014,  //  0075  LDCONST	R10	K20
       0x7C200400,  //  0076  CALL	R8	2
-      0x7822000A,  //  0077  JMPF	R8	#0083
+      0x78220036,  //  0077  JMPF	R8	#00AF
       0xB8222400,  //  0078  GETNGBL	R8	K18
       0x8C201102,  //  0079  GETMET	R8	R8	K2
       0x60280018,  //  007A  GETGBL	R10	G24
@@ -546,7 +546,7 @@ be_local_closure(Matter_IM_process_invoke_request_solo,   /* name */
       0x8C201113,  //  008E  GETMET	R8	R8	K19
       0x58280014,  //  008F  LDCONST	R10	K20
       0x7C200400,  //  0090  CALL	R8	2
-      0x7822000A,  //  0091  JMPF	R8	#009D
+      0x7822001C,  //  0091  JMPF	R8	#00AF
       0xB8222400,  //  0092  GETNGBL	R8	K18
       0x8C201102,  //  0093  GETMET	R8	R8	K2
       0x60280018,  //  0094  GETGBL	R10	G24
@@ -1016,7 +1016,7 @@ be_local_closure(Matter_IM_process_invoke_request,   /* name */
       0x8C341B22,  //  0074  GETMET	R13	R13	K34
       0x583C001E,  //  0075  LDCONST	R15	K30
       0x7C340400,  //  0076  CALL	R13	2
-      0x78360009,  //  0077  JMPF	R13	#0082
+      0x7835FFA6,  //  0077  JMPF	R13	#001F
       0xB8363600,  //  0078  GETNGBL	R13	K27
       0x8C341B02,  //  0079  GETMET	R13	R13	K2
       0x603C0018,  //  007A  GETGBL	R15	G24
@@ -1027,7 +1027,7 @@ be_local_closure(Matter_IM_process_invoke_request,   /* name */
       0x7C3C0600,  //  007F  CALL	R15	3
       0x5840001E,  //  0080  LDCONST	R16	K30
       0x7C340600,  //  0081  CALL	R13	3
-      0x70020052,  //  0082  JMP		#00D6
+      0x7001FF9B,  //  0082  JMP		#001F
       0x4C340000,  //  0083  LDNIL	R13
       0x2034140D,  //  0084  NE	R13	R10	R13
       0x78360022,  //  0085  JMPF	R13	#00A9
@@ -1053,7 +1053,7 @@ be_local_closure(Matter_IM_process_invoke_request,   /* name */
       0x8C341B22,  //  0099  GETMET	R13	R13	K34
       0x583C001E,  //  009A  LDCONST	R15	K30
       0x7C340400,  //  009B  CALL	R13	2
-      0x7836000A,  //  009C  JMPF	R13	#00A8
+      0x7835FF81,  //  009C  JMPF	R13	#001F
       0xB8363600,  //  009D  GETNGBL	R13	K27
       0x8C341B02,  //  009E  GETMET	R13	R13	K2
       0x603C0018,  //  009F  GETGBL	R15	G24
@@ -1065,7 +1065,7 @@ be_local_closure(Matter_IM_process_invoke_request,   /* name */
       0x7C3C0800,  //  00A5  CALL	R15	4
       0x5840001E,  //  00A6  LDCONST	R16	K30
       0x7C340600,  //  00A7  CALL	R13	3
-      0x7002002C,  //  00A8  JMP		#00D6
+      0x7001FF75,  //  00A8  JMP		#001F
       0x88340710,  //  00A9  GETMBR	R13	R3	K16
       0x4C380000,  //  00AA  LDNIL	R14
       0x20341A0E,  //  00AB  NE	R13	R13	R14
@@ -1083,7 +1083,7 @@ be_local_closure(Matter_IM_process_invoke_request,   /* name */
       0x8C341B22,  //  00B7  GETMET	R13	R13	K34
       0x583C001E,  //  00B8  LDCONST	R15	K30
       0x7C340400,  //  00B9  CALL	R13	2
-      0x7836000A,  //  00BA  JMPF	R13	#00C6
+      0x7835FF63,  //  00BA  JMPF	R13	#001F
       0xB8363600,  //  00BB  GETNGBL	R13	K27
       0x8C341B02,  //  00BC  GETMET	R13	R13	K2
       0x603C0018,  //  00BD  GETGBL	R15	G24
@@ -1095,12 +1095,12 @@ be_local_closure(Matter_IM_process_invoke_request,   /* name */
       0x7C3C0800,  //  00C3  CALL	R15	4
       0x5840001E,  //  00C4  LDCONST	R16	K30
       0x7C340600,  //  00C5  CALL	R13	3
-      0x7002000E,  //  00C6  JMP		#00D6
+      0x7001FF57,  //  00C6  JMP		#001F
       0xB8363600,  //  00C7  GETNGBL	R13	K27
       0x8C341B22,  //  00C8  GETMET	R13	R13	K34
       0x583C001E,  //  00C9  LDCONST	R15	K30
       0x7C340400,  //  00CA  CALL	R13	2
-      0x78360009,  //  00CB  JMPF	R13	#00D6
+      0x7835FF52,  //  00CB  JMPF	R13	#001F
       0xB8363600,  //  00CC  GETNGBL	R13	K27
       0x8C341B02,  //  00CD  GETMET	R13	R13	K2
       0x603C0018,  //  00CE  GETGBL	R15	G24
@@ -1357,7 +1357,7 @@ be_local_closure(Matter_IM_process_write_request,   /* name */
           0x4C200000,  //  001E  LDNIL	R8
           0x201C0E08,  //  001F  NE	R7	R7	R8
           0x781E0037,  //  0020  JMPF	R7	#0059
-          0x78120035,  //  0021  JMPF	R4	#0058
+          0x78120041,  //  0021  JMPF	R4	#0064
           0xB81E0000,  //  0022  GETNGBL	R7	K0
           0x8C1C0F0C,  //  0023  GETMET	R7	R7	K12
           0x7C1C0200,  //  0024  CALL	R7	1
@@ -1897,7 +1897,7 @@ be_local_closure(Matter_IM_remove_sendqueue_by_exchangeid,   /* name */
       0x8C0C0703,  //  0011  GETMET	R3	R3	K3
       0x5C140400,  //  0012  MOVE	R5	R2
       0x7C0C0400,  //  0013  CALL	R3	2
-      0x70020000,  //  0014  JMP		#0016
+      0x7001FFEF,  //  0014  JMP		#0005
       0x00080504,  //  0015  ADD	R2	R2	K4
       0x7001FFED,  //  0016  JMP		#0005
       0x80000000,  //  0017  RET	0
@@ -1960,7 +1960,7 @@ be_local_closure(Matter_IM_process_incoming,   /* name */
       0x7C0C0600,  //  0007  CALL	R3	3
       0x4C100000,  //  0008  LDNIL	R4
       0x20100604,  //  0009  NE	R4	R3	R4
-      0x78120004,  //  000A  JMPF	R4	#0010
+      0x78120015,  //  000A  JMPF	R4	#0021
       0x8C100106,  //  000B  GETMET	R4	R0	K6
       0x5C180200,  //  000C  MOVE	R6	R1
       0x5C1C0600,  //  000D  MOVE	R7	R3
@@ -2356,7 +2356,7 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
           0x5C380C00,  //  0063  MOVE	R14	R6
           0x7C280800,  //  0064  CALL	R10	4
           0x68280002,  //  0065  GETUPV	R10	U2
-          0x742A000B,  //  0066  JMPT	R10	#0073
+          0x742A0048,  //  0066  JMPT	R10	#00B0
           0xB82A2C00,  //  0067  GETNGBL	R10	K22
           0x8C281517,  //  0068  GETMET	R10	R10	K23
           0x60300018,  //  0069  GETGBL	R12	G24
@@ -2374,7 +2374,7 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
           0x4C280000,  //  0075  LDNIL	R10
           0x2024120A,  //  0076  NE	R9	R9	R10
           0x78260026,  //  0077  JMPF	R9	#009F
-          0x780E0024,  //  0078  JMPF	R3	#009E
+          0x780E0036,  //  0078  JMPF	R3	#00B0
           0x60240015,  //  0079  GETGBL	R9	G21
           0x542A002F,  //  007A  LDINT	R10	48
           0x7C240200,  //  007B  CALL	R9	1
@@ -2389,7 +2389,7 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
           0x8C24131C,  //  0084  GETMET	R9	R9	K28
           0x582C001A,  //  0085  LDCONST	R11	K26
           0x7C240400,  //  0086  CALL	R9	2
-          0x78260015,  //  0087  JMPF	R9	#009E
+          0x78260027,  //  0087  JMPF	R9	#00B0
           0xB8262C00,  //  0088  GETNGBL	R9	K22
           0x8C241317,  //  0089  GETMET	R9	R9	K23
           0x602C0018,  //  008A  GETGBL	R11	G24
@@ -2482,13 +2482,13 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
           0x1C2C120B,  //  00E1  EQ	R11	R9	R11
           0x782E0001,  //  00E2  JMPF	R11	#00E5
           0x4C200000,  //  00E3  LDNIL	R8
-          0x70020006,  //  00E4  JMP		#00EC
+          0x7001FFD2,  //  00E4  JMP		#00B8
           0x00241322,  //  00E5  ADD	R9	R9	K34
           0x602C000C,  //  00E6  GETGBL	R11	G12
           0x5C301000,  //  00E7  MOVE	R12	R8
           0x7C2C0200,  //  00E8  CALL	R11	1
           0x282C120B,  //  00E9  GE	R11	R9	R11
-          0x782E0000,  //  00EA  JMPF	R11	#00EC
+          0x782DFFCC,  //  00EA  JMPF	R11	#00B8
           0x4C200000,  //  00EB  LDNIL	R8
           0x7001FFCA,  //  00EC  JMP		#00B8
           0x80040E00,  //  00ED  RET	1	R7
@@ -3149,7 +3149,7 @@ be_local_closure(Matter_IM_process_read_request_solo,   /* name */
       0x8C281526,  //  00B7  GETMET	R10	R10	K38
       0x58300014,  //  00B8  LDCONST	R12	K20
       0x7C280400,  //  00B9  CALL	R10	2
-      0x782A000D,  //  00BA  JMPF	R10	#00C9
+      0x782A003D,  //  00BA  JMPF	R10	#00F9
       0x8C280933,  //  00BB  GETMET	R10	R4	K51
       0x7C280200,  //  00BC  CALL	R10	1
       0xB82E2400,  //  00BD  GETNGBL	R11	K18
@@ -3181,7 +3181,7 @@ be_local_closure(Matter_IM_process_read_request_solo,   /* name */
       0x8C2C1726,  //  00D7  GETMET	R11	R11	K38
       0x58340014,  //  00D8  LDCONST	R13	K20
       0x7C2C0400,  //  00D9  CALL	R11	2
-      0x782E000C,  //  00DA  JMPF	R11	#00E8
+      0x782E001D,  //  00DA  JMPF	R11	#00F9
       0xB82E2400,  //  00DB  GETNGBL	R11	K18
       0x8C2C170B,  //  00DC  GETMET	R11	R11	K11
       0x60340018,  //  00DD  GETGBL	R13	G24
@@ -3241,9 +3241,9 @@ be_local_closure(Matter_IM_send_enqueued,   /* name */
     /* K4   */  be_nested_str_weak(send_im),
     /* K5   */  be_nested_str_weak(tasmota),
     /* K6   */  be_nested_str_weak(log),
-    /* K7   */  be_nested_str_weak(MTR_X3A_X20remove_X20IM_X20message_X20exch_X3D),
-    /* K8   */  be_nested_str_weak(resp),
-    /* K9   */  be_nested_str_weak(exchange_id),
+    /* K7   */  be_nested_str_weak(resp),
+    /* K8   */  be_nested_str_weak(exchange_id),
+    /* K9   */  be_nested_str_weak(MTR_X3A_X20remove_X20IM_X20message_X20exch_X3D),
     /* K10  */  be_nested_str_weak(remove),
     /* K11  */  be_const_int(1),
     }),
@@ -3270,17 +3270,17 @@ be_local_closure(Matter_IM_send_enqueued,   /* name */
       0xB8120A00,  //  0011  GETNGBL	R4	K5
       0x8C100906,  //  0012  GETMET	R4	R4	K6
       0x60180008,  //  0013  GETGBL	R6	G8
-      0x881C0708,  //  0014  GETMBR	R7	R3	K8
-      0x881C0F09,  //  0015  GETMBR	R7	R7	K9
+      0x881C0707,  //  0014  GETMBR	R7	R3	K7
+      0x881C0F08,  //  0015  GETMBR	R7	R7	K8
       0x7C180200,  //  0016  CALL	R6	1
-      0x001A0E06,  //  0017  ADD	R6	K7	R6
+      0x001A1206,  //  0017  ADD	R6	K9	R6
       0x541E0003,  //  0018  LDINT	R7	4
       0x7C100600,  //  0019  CALL	R4	3
       0x88100101,  //  001A  GETMBR	R4	R0	K1
       0x8C10090A,  //  001B  GETMET	R4	R4	K10
       0x5C180400,  //  001C  MOVE	R6	R2
       0x7C100400,  //  001D  CALL	R4	2
-      0x70020000,  //  001E  JMP		#0020
+      0x7001FFE1,  //  001E  JMP		#0001
       0x0008050B,  //  001F  ADD	R2	R2	K11
       0x7001FFDF,  //  0020  JMP		#0001
       0x80000000,  //  0021  RET	0
@@ -3394,7 +3394,7 @@ be_local_closure(Matter_IM_expire_sendqueue,   /* name */
       0x8C0C0706,  //  0010  GETMET	R3	R3	K6
       0x5C140200,  //  0011  MOVE	R5	R1
       0x7C0C0400,  //  0012  CALL	R3	2
-      0x70020000,  //  0013  JMP		#0015
+      0x7001FFEC,  //  0013  JMP		#0001
       0x00040307,  //  0014  ADD	R1	R1	K7
       0x7001FFEA,  //  0015  JMP		#0001
       0x4C080000,  //  0016  LDNIL	R2
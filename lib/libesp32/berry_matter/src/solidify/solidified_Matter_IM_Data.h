@@ -2890,7 +2890,7 @@ be_local_closure(Matter_ReadRequestMessage_solo_from_raw,   /* name */
       0x7002000B,  //  0023  JMP		#0030
       0x541E0024,  //  0024  LDINT	R7	37
       0x1C1C0C07,  //  0025  EQ	R7	R6	R7
-      0x781E0007,  //  0026  JMPF	R7	#002F
+      0x781E0018,  //  0026  JMPF	R7	#0040
       0x8C1C0301,  //  0027  GETMET	R7	R1	K1
       0x00240504,  //  0028  ADD	R9	R2	K4
       0x58280004,  //  0029  LDCONST	R10	K4
@@ -2903,16 +2903,16 @@ be_local_closure(Matter_ReadRequestMessage_solo_from_raw,   /* name */
       0x1C1C0B04,  //  0030  EQ	R7	R5	K4
       0x781E0001,  //  0031  JMPF	R7	#0034
       0x90020C04,  //  0032  SETMBR	R0	K6	R4
-      0x7002000A,  //  0033  JMP		#003F
+      0x7001FFDB,  //  0033  JMP		#0010
       0x1C1C0B05,  //  0034  EQ	R7	R5	K5
       0x781E0001,  //  0035  JMPF	R7	#0038
       0x90020E04,  //  0036  SETMBR	R0	K7	R4
-      0x70020006,  //  0037  JMP		#003F
+      0x7001FFD7,  //  0037  JMP		#0010
       0x541E0003,  //  0038  LDINT	R7	4
       0x1C1C0A07,  //  0039  EQ	R7	R5	R7
       0x781E0001,  //  003A  JMPF	R7	#003D
       0x90021004,  //  003B  SETMBR	R0	K8	R4
-      0x70020001,  //  003C  JMP		#003F
+      0x7001FFD2,  //  003C  JMP		#0010
       0x4C1C0000,  //  003D  LDNIL	R7
       0x80040E00,  //  003E  RET	1	R7
       0x7001FFCF,  //  003F  JMP		#0010
@@ -4246,7 +4246,7 @@ be_local_closure(Matter_InvokeRequestMessage_solo_from_raw,   /* name */
       0x7002000B,  //  005F  JMP		#006C
       0x541E0024,  //  0060  LDINT	R7	37
       0x1C1C0C07,  //  0061  EQ	R7	R6	R7
-      0x781E0007,  //  0062  JMPF	R7	#006B
+      0x781E0017,  //  0062  JMPF	R7	#007B
       0x8C1C0301,  //  0063  GETMET	R7	R1	K1
       0x00240504,  //  0064  ADD	R9	R2	K4
       0x58280004,  //  0065  LDCONST	R10	K4
@@ -4259,15 +4259,15 @@ be_local_closure(Matter_InvokeRequestMessage_solo_from_raw,   /* name */
       0x1C1C0B06,  //  006C  EQ	R7	R5	K6
       0x781E0001,  //  006D  JMPF	R7	#0070
       0x90020E04,  //  006E  SETMBR	R0	K7	R4
-      0x70020009,  //  006F  JMP		#007A
+      0x7001FFDB,  //  006F  JMP		#004C
       0x1C1C0B02,  //  0070  EQ	R7	R5	K2
       0x781E0001,  //  0071  JMPF	R7	#0074
       0x90021004,  //  0072  SETMBR	R0	K8	R4
-      0x70020005,  //  0073  JMP		#007A
+      0x7001FFD7,  //  0073  JMP		#004C
       0x1C1C0B04,  //  0074  EQ	R7	R5	K4
       0x781E0001,  //  0075  JMPF	R7	#0078
       0x90021204,  //  0076  SETMBR	R0	K9	R4
-      0x70020001,  //  0077  JMP		#007A
+      0x7001FFD3,  //  0077  JMP		#004C
       0x4C1C0000,  //  0078  LDNIL	R7
       0x80040E00,  //  0079  RET	1	R7
       0x7001FFD0,  //  007A  JMP		#004C
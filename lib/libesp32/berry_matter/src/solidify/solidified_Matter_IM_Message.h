@@ -844,7 +844,7 @@ be_local_closure(Matter_IM_ReportDataSubscribed_send_im,   /* name */
       0x90020002,  //  0018  SETMBR	R0	K0	R2
       0x50080000,  //  0019  LDBOOL	R2	0	0
       0x90020C02,  //  001A  SETMBR	R0	K6	R2
-      0x7002001E,  //  001B  JMP		#003B
+      0x7002002C,  //  001B  JMP		#0049
       0x88080107,  //  001C  GETMBR	R2	R0	K7
       0x8C080508,  //  001D  GETMET	R2	R2	K8
       0x50100000,  //  001E  LDBOOL	R4	0	0
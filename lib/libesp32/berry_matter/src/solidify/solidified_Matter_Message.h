@@ -57,14 +57,14 @@ be_local_closure(Matter_Frame_encode_frame,   /* name */
       0x1C0C0403,  //  0001  EQ	R3	R2	R3
       0x780E000A,  //  0002  JMPF	R3	#000E
       0x600C0015,  //  0003  GETGBL	R3	G21
-      0x5412000F,  //  0004  LDINT	R4	16
-      0x78060003,  //  0005  JMPF	R1	#000A
-      0x6014000C,  //  0006  GETGBL	R5	G12
-      0x5C180200,  //  0007  MOVE	R6	R1
-      0x7C140200,  //  0008  CALL	R5	1
-      0x70020000,  //  0009  JMP		#000B
-      0x58140000,  //  000A  LDCONST	R5	K0
-      0x00100805,  //  000B  ADD	R4	R4	R5
+      0x78060003,  //  0004  JMPF	R1	#0009
+      0x6010000C,  //  0005  GETGBL	R4	G12
+      0x5C140200,  //  0006  MOVE	R5	R1
+      0x7C100200,  //  0007  CALL	R4	1
+      0x70020000,  //  0008  JMP		#000A
+      0x58100000,  //  0009  LDCONST	R4	K0
+      0x5416000F,  //  000A  LDINT	R5	16
+      0x00100A04,  //  000B  ADD	R4	R5	R4
       0x7C0C0200,  //  000C  CALL	R3	1
       0x5C080600,  //  000D  MOVE	R2	R3
       0x880C0101,  //  000E  GETMBR	R3	R0	K1
@@ -724,7 +724,7 @@ be_local_closure(Matter_Frame_decode_header,   /* name */
     }),
     be_str_weak(decode_header),
     &be_const_str_solidified,
-    ( &(const binstruction[121]) {  /* code */
+    ( &(const binstruction[111]) {  /* code */
       0x58040000,  //  0000  LDCONST	R1	K0
       0x88080101,  //  0001  GETMBR	R2	R0	K1
       0x8C0C0503,  //  0002  GETMET	R3	R2	K3
@@ -760,92 +760,82 @@ be_local_closure(Matter_Frame_decode_header,   /* name */
       0x7C0C0600,  //  0020  CALL	R3	3
       0x90021403,  //  0021  SETMBR	R0	K10	R3
       0x8C0C0506,  //  0022  GETMET	R3	R2	K6
-      0x54160007,  //  0023  LDINT	R5	8
-      0x08161205,  //  0024  MUL	R5	K9	R5
-      0x541A0006,  //  0025  LDINT	R6	7
-      0x00140A06,  //  0026  ADD	R5	R5	R6
-      0x58180004,  //  0027  LDCONST	R6	K4
-      0x7C0C0600,  //  0028  CALL	R3	3
-      0x90021603,  //  0029  SETMBR	R0	K11	R3
-      0x8C0C0506,  //  002A  GETMET	R3	R2	K6
-      0x54160007,  //  002B  LDINT	R5	8
-      0x08161205,  //  002C  MUL	R5	K9	R5
-      0x541A0005,  //  002D  LDINT	R6	6
-      0x00140A06,  //  002E  ADD	R5	R5	R6
-      0x58180004,  //  002F  LDCONST	R6	K4
-      0x7C0C0600,  //  0030  CALL	R3	3
-      0x90021803,  //  0031  SETMBR	R0	K12	R3
-      0x8C0C0506,  //  0032  GETMET	R3	R2	K6
-      0x54160007,  //  0033  LDINT	R5	8
-      0x08161205,  //  0034  MUL	R5	K9	R5
-      0x541A0004,  //  0035  LDINT	R6	5
-      0x00140A06,  //  0036  ADD	R5	R5	R6
-      0x58180004,  //  0037  LDCONST	R6	K4
-      0x7C0C0600,  //  0038  CALL	R3	3
-      0x90021A03,  //  0039  SETMBR	R0	K13	R3
-      0x8C0C0506,  //  003A  GETMET	R3	R2	K6
-      0x54160007,  //  003B  LDINT	R5	8
-      0x08161205,  //  003C  MUL	R5	K9	R5
+      0x5416001E,  //  0023  LDINT	R5	31
+      0x58180004,  //  0024  LDCONST	R6	K4
+      0x7C0C0600,  //  0025  CALL	R3	3
+      0x90021603,  //  0026  SETMBR	R0	K11	R3
+      0x8C0C0506,  //  0027  GETMET	R3	R2	K6
+      0x5416001D,  //  0028  LDINT	R5	30
+      0x58180004,  //  0029  LDCONST	R6	K4
+      0x7C0C0600,  //  002A  CALL	R3	3
+      0x90021803,  //  002B  SETMBR	R0	K12	R3
+      0x8C0C0506,  //  002C  GETMET	R3	R2	K6
+      0x5416001C,  //  002D  LDINT	R5	29
+      0x58180004,  //  002E  LDCONST	R6	K4
+      0x7C0C0600,  //  002F  CALL	R3	3
+      0x90021A03,  //  0030  SETMBR	R0	K13	R3
+      0x8C0C0506,  //  0031  GETMET	R3	R2	K6
+      0x54160017,  //  0032  LDINT	R5	24
+      0x58180007,  //  0033  LDCONST	R6	K7
+      0x7C0C0600,  //  0034  CALL	R3	3
+      0x90021C03,  //  0035  SETMBR	R0	K14	R3
+      0x880C010E,  //  0036  GETMBR	R3	R0	K14
+      0x240C0704,  //  0037  GT	R3	R3	K4
+      0x780E0001,  //  0038  JMPF	R3	#003B
+      0x500C0000,  //  0039  LDBOOL	R3	0	0
+      0x80040600,  //  003A  RET	1	R3
+      0x8C0C0503,  //  003B  GETMET	R3	R2	K3
+      0x58140004,  //  003C  LDCONST	R5	K4
       0x58180007,  //  003D  LDCONST	R6	K7
       0x7C0C0600,  //  003E  CALL	R3	3
-      0x90021C03,  //  003F  SETMBR	R0	K14	R3
-      0x880C010E,  //  0040  GETMBR	R3	R0	K14
-      0x240C0704,  //  0041  GT	R3	R3	K4
-      0x780E0001,  //  0042  JMPF	R3	#0045
-      0x500C0000,  //  0043  LDBOOL	R3	0	0
-      0x80040600,  //  0044  RET	1	R3
-      0x8C0C0503,  //  0045  GETMET	R3	R2	K3
-      0x58140004,  //  0046  LDCONST	R5	K4
-      0x58180007,  //  0047  LDCONST	R6	K7
-      0x7C0C0600,  //  0048  CALL	R3	3
-      0x90021E03,  //  0049  SETMBR	R0	K15	R3
-      0x8C0C0503,  //  004A  GETMET	R3	R2	K3
-      0x54160003,  //  004B  LDINT	R5	4
-      0x541A0003,  //  004C  LDINT	R6	4
-      0x7C0C0600,  //  004D  CALL	R3	3
-      0x90022003,  //  004E  SETMBR	R0	K16	R3
-      0x540E0007,  //  004F  LDINT	R3	8
-      0x00040203,  //  0050  ADD	R1	R1	R3
-      0x880C0105,  //  0051  GETMBR	R3	R0	K5
-      0x780E0006,  //  0052  JMPF	R3	#005A
+      0x90021E03,  //  003F  SETMBR	R0	K15	R3
+      0x8C0C0503,  //  0040  GETMET	R3	R2	K3
+      0x54160003,  //  0041  LDINT	R5	4
+      0x541A0003,  //  0042  LDINT	R6	4
+      0x7C0C0600,  //  0043  CALL	R3	3
+      0x90022003,  //  0044  SETMBR	R0	K16	R3
+      0x540E0007,  //  0045  LDINT	R3	8
+      0x00040203,  //  0046  ADD	R1	R1	R3
+      0x880C0105,  //  0047  GETMBR	R3	R0	K5
+      0x780E0006,  //  0048  JMPF	R3	#0050
+      0x540E0006,  //  0049  LDINT	R3	7
+      0x000C0203,  //  004A  ADD	R3	R1	R3
+      0x400C0203,  //  004B  CONNECT	R3	R1	R3
+      0x940C0403,  //  004C  GETIDX	R3	R2	R3
+      0x90022203,  //  004D  SETMBR	R0	K17	R3
+      0x540E0007,  //  004E  LDINT	R3	8
+      0x00040203,  //  004F  ADD	R1	R1	R3
+      0x880C0108,  //  0050  GETMBR	R3	R0	K8
+      0x1C0C0704,  //  0051  EQ	R3	R3	K4
+      0x780E0007,  //  0052  JMPF	R3	#005B
       0x540E0006,  //  0053  LDINT	R3	7
       0x000C0203,  //  0054  ADD	R3	R1	R3
       0x400C0203,  //  0055  CONNECT	R3	R1	R3
       0x940C0403,  //  0056  GETIDX	R3	R2	R3
-      0x90022203,  //  0057  SETMBR	R0	K17	R3
+      0x90022403,  //  0057  SETMBR	R0	K18	R3
       0x540E0007,  //  0058  LDINT	R3	8
       0x00040203,  //  0059  ADD	R1	R1	R3
-      0x880C0108,  //  005A  GETMBR	R3	R0	K8
-      0x1C0C0704,  //  005B  EQ	R3	R3	K4
-      0x780E0007,  //  005C  JMPF	R3	#0065
-      0x540E0006,  //  005D  LDINT	R3	7
-      0x000C0203,  //  005E  ADD	R3	R1	R3
-      0x400C0203,  //  005F  CONNECT	R3	R1	R3
-      0x940C0403,  //  0060  GETIDX	R3	R2	R3
-      0x90022403,  //  0061  SETMBR	R0	K18	R3
-      0x540E0007,  //  0062  LDINT	R3	8
-      0x00040203,  //  0063  ADD	R1	R1	R3
-      0x70020008,  //  0064  JMP		#006E
-      0x880C0108,  //  0065  GETMBR	R3	R0	K8
-      0x1C0C0707,  //  0066  EQ	R3	R3	K7
-      0x780E0005,  //  0067  JMPF	R3	#006E
-      0x8C0C0503,  //  0068  GETMET	R3	R2	K3
-      0x5C140200,  //  0069  MOVE	R5	R1
-      0x58180007,  //  006A  LDCONST	R6	K7
-      0x7C0C0600,  //  006B  CALL	R3	3
-      0x90022603,  //  006C  SETMBR	R0	K19	R3
-      0x00040307,  //  006D  ADD	R1	R1	K7
-      0x880C010D,  //  006E  GETMBR	R3	R0	K13
-      0x780E0005,  //  006F  JMPF	R3	#0076
-      0x8C0C0503,  //  0070  GETMET	R3	R2	K3
-      0x5C140200,  //  0071  MOVE	R5	R1
-      0x58180007,  //  0072  LDCONST	R6	K7
-      0x7C0C0600,  //  0073  CALL	R3	3
-      0x00100707,  //  0074  ADD	R4	R3	K7
-      0x00040204,  //  0075  ADD	R1	R1	R4
-      0x90022801,  //  0076  SETMBR	R0	K20	R1
-      0x500C0200,  //  0077  LDBOOL	R3	1	0
-      0x80040600,  //  0078  RET	1	R3
+      0x70020008,  //  005A  JMP		#0064
+      0x880C0108,  //  005B  GETMBR	R3	R0	K8
+      0x1C0C0707,  //  005C  EQ	R3	R3	K7
+      0x780E0005,  //  005D  JMPF	R3	#0064
+      0x8C0C0503,  //  005E  GETMET	R3	R2	K3
+      0x5C140200,  //  005F  MOVE	R5	R1
+      0x58180007,  //  0060  LDCONST	R6	K7
+      0x7C0C0600,  //  0061  CALL	R3	3
+      0x90022603,  //  0062  SETMBR	R0	K19	R3
+      0x00040307,  //  0063  ADD	R1	R1	K7
+      0x880C010D,  //  0064  GETMBR	R3	R0	K13
+      0x780E0005,  //  0065  JMPF	R3	#006C
+      0x8C0C0503,  //  0066  GETMET	R3	R2	K3
+      0x5C140200,  //  0067  MOVE	R5	R1
+      0x58180007,  //  0068  LDCONST	R6	K7
+      0x7C0C0600,  //  0069  CALL	R3	3
+      0x00100707,  //  006A  ADD	R4	R3	K7
+      0x00040204,  //  006B  ADD	R1	R1	R4
+      0x90022801,  //  006C  SETMBR	R0	K20	R1
+      0x500C0200,  //  006D  LDBOOL	R3	1	0
+      0x80040600,  //  006E  RET	1	R3
     })
   )
 );
@@ -1052,8 +1042,8 @@ be_local_closure(Matter_Frame_decrypt,   /* name */
     /* K14  */  be_const_int(1),
     /* K15  */  be_nested_str_weak(AES_CTR),
     /* K16  */  be_nested_str_weak(decrypt),
-    /* K17  */  be_const_int(0),
-    /* K18  */  be_const_int(3),
+    /* K17  */  be_const_int(3),
+    /* K18  */  be_const_int(0),
     /* K19  */  be_nested_str_weak(message_handler),
     /* K20  */  be_nested_str_weak(_n_bytes),
     /* K21  */  be_nested_str_weak(clear),
@@ -1094,15 +1084,15 @@ be_local_closure(Matter_Frame_decrypt,   /* name */
       0x882C010D,  //  0016  GETMBR	R11	R0	K13
       0x5431FFFD,  //  0017  LDINT	R12	-2
       0x7C240600,  //  0018  CALL	R9	3
-      0x542A0004,  //  0019  LDINT	R10	5
-      0x542E000E,  //  001A  LDINT	R11	15
-      0x4028140B,  //  001B  CONNECT	R10	R10	R11
+      0x542A000E,  //  0019  LDINT	R10	15
+      0x542E0004,  //  001A  LDINT	R11	5
+      0x4028160A,  //  001B  CONNECT	R10	R11	R10
       0x9428100A,  //  001C  GETIDX	R10	R8	R10
       0x0024120A,  //  001D  ADD	R9	R9	R10
-      0x542A0003,  //  001E  LDINT	R10	4
-      0x882C0103,  //  001F  GETMBR	R11	R0	K3
-      0x042C170E,  //  0020  SUB	R11	R11	K14
-      0x4028140B,  //  0021  CONNECT	R10	R10	R11
+      0x88280103,  //  001E  GETMBR	R10	R0	K3
+      0x0428150E,  //  001F  SUB	R10	R10	K14
+      0x542E0003,  //  0020  LDINT	R11	4
+      0x4028160A,  //  0021  CONNECT	R10	R11	R10
       0x882C0102,  //  0022  GETMBR	R11	R0	K2
       0x9428160A,  //  0023  GETIDX	R10	R11	R10
       0x8C30030F,  //  0024  GETMET	R12	R1	K15
@@ -1114,7 +1104,7 @@ be_local_closure(Matter_Frame_decrypt,   /* name */
       0x58400009,  //  002A  LDCONST	R16	K9
       0x7C300800,  //  002B  CALL	R12	4
       0x5C2C1800,  //  002C  MOVE	R11	R12
-      0x40322312,  //  002D  CONNECT	R12	K17	K18
+      0x40322511,  //  002D  CONNECT	R12	K18	K17
       0x88340102,  //  002E  GETMBR	R13	R0	K2
       0x94301A0C,  //  002F  GETIDX	R12	R13	R12
       0x0030180B,  //  0030  ADD	R12	R12	R11
@@ -1151,12 +1141,12 @@ be_local_closure(Matter_Frame_decrypt,   /* name */
       0x8C20111C,  //  004F  GETMET	R8	R8	K28
       0x5C280C00,  //  0050  MOVE	R10	R6
       0x5C2C0E00,  //  0051  MOVE	R11	R7
-      0x58300011,  //  0052  LDCONST	R12	K17
+      0x58300012,  //  0052  LDCONST	R12	K18
       0x6034000C,  //  0053  GETGBL	R13	G12
       0x5C380E00,  //  0054  MOVE	R14	R7
       0x7C340200,  //  0055  CALL	R13	1
       0x5C380600,  //  0056  MOVE	R14	R3
-      0x583C0011,  //  0057  LDCONST	R15	K17
+      0x583C0012,  //  0057  LDCONST	R15	K18
       0x5C400800,  //  0058  MOVE	R16	R4
       0x5C440600,  //  0059  MOVE	R17	R3
       0x5C480800,  //  005A  MOVE	R18	R4
@@ -1183,7 +1173,7 @@ be_local_closure(Matter_Frame_decrypt,   /* name */
       0xB8260C00,  //  006F  GETNGBL	R9	K6
       0x8C241307,  //  0070  GETMET	R9	R9	K7
       0x582C001D,  //  0071  LDCONST	R11	K29
-      0x58300012,  //  0072  LDCONST	R12	K18
+      0x58300011,  //  0072  LDCONST	R12	K17
       0x7C240600,  //  0073  CALL	R9	3
       0x80041000,  //  0074  RET	1	R8
     })
@@ -199,8 +199,8 @@ be_local_closure(Matter_MessageHandler_msg_received,   /* name */
     /* K50  */  be_nested_str_weak(send_encrypted_ack),
     /* K51  */  be_nested_str_weak(decrypt),
     /* K52  */  be_nested_str_weak(msg_received_header_frame_decrypted),
-    /* K53  */  be_nested_str_weak(MTR_X3A_X20_X3E_X20_X20_X20_X20_X20_X20_X20_X20_X20_X20Decrypted_X20message_X3A_X20protocol_id_X3A),
-    /* K54  */  be_nested_str_weak(protocol_id),
+    /* K53  */  be_nested_str_weak(protocol_id),
+    /* K54  */  be_nested_str_weak(MTR_X3A_X20_X3E_X20_X20_X20_X20_X20_X20_X20_X20_X20_X20Decrypted_X20message_X3A_X20protocol_id_X3A),
     /* K55  */  be_nested_str_weak(_X20opcode_X3D),
     /* K56  */  be_nested_str_weak(_X20exchange_id_X3D),
     /* K57  */  be_nested_str_weak(im),
@@ -332,7 +332,7 @@ be_local_closure(Matter_MessageHandler_msg_received,   /* name */
       0x8C241318,  //  006D  GETMET	R9	R9	K24
       0x582C0021,  //  006E  LDCONST	R11	K33
       0x7C240400,  //  006F  CALL	R9	2
-      0x7826000C,  //  0070  JMPF	R9	#007E
+      0x78260026,  //  0070  JMPF	R9	#0098
       0xB8262E00,  //  0071  GETNGBL	R9	K23
       0x8C241302,  //  0072  GETMET	R9	R9	K2
       0x602C0018,  //  0073  GETGBL	R11	G24
@@ -478,9 +478,9 @@ be_local_closure(Matter_MessageHandler_msg_received,   /* name */
       0xB8262E00,  //  00FF  GETNGBL	R9	K23
       0x8C241302,  //  0100  GETMET	R9	R9	K2
       0x602C0008,  //  0101  GETGBL	R11	G8
-      0x88300B36,  //  0102  GETMBR	R12	R5	K54
+      0x88300B35,  //  0102  GETMBR	R12	R5	K53
       0x7C2C0200,  //  0103  CALL	R11	1
-      0x002E6A0B,  //  0104  ADD	R11	K53	R11
+      0x002E6C0B,  //  0104  ADD	R11	K54	R11
       0x002C1737,  //  0105  ADD	R11	R11	K55
       0x60300008,  //  0106  GETGBL	R12	G8
       0x88340B1E,  //  0107  GETMBR	R13	R5	K30
@@ -499,7 +499,7 @@ be_local_closure(Matter_MessageHandler_msg_received,   /* name */
       0x8C24131D,  //  0114  GETMET	R9	R9	K29
       0x5C2C0A00,  //  0115  MOVE	R11	R5
       0x7C240400,  //  0116  CALL	R9	2
-      0x88240B36,  //  0117  GETMBR	R9	R5	K54
+      0x88240B35,  //  0117  GETMBR	R9	R5	K53
       0x1C28130E,  //  0118  EQ	R10	R9	K14
       0x782A000F,  //  0119  JMPF	R10	#012A
       0x88280B1E,  //  011A  GETMBR	R10	R5	K30
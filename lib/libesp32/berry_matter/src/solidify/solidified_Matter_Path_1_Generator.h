@@ -167,7 +167,7 @@ be_local_closure(Matter_PathGenerator__next_cluster,   /* name */
       0x74120002,  //  0022  JMPT	R4	#0026
       0x88100100,  //  0023  GETMBR	R4	R0	K0
       0x1C100404,  //  0024  EQ	R4	R2	R4
-      0x78120001,  //  0025  JMPF	R4	#0028
+      0x7811FFF0,  //  0025  JMPF	R4	#0017
       0x88100100,  //  0026  GETMBR	R4	R0	K0
       0x80040800,  //  0027  RET	1	R4
       0x7001FFED,  //  0028  JMP		#0017
@@ -399,7 +399,7 @@ be_local_closure(Matter_PathGenerator__next_endpoint,   /* name */
       0x8C100909,  //  0027  GETMET	R4	R4	K9
       0x7C100200,  //  0028  CALL	R4	1
       0x1C100404,  //  0029  EQ	R4	R2	R4
-      0x78120005,  //  002A  JMPF	R4	#0031
+      0x7811FFEE,  //  002A  JMPF	R4	#001A
       0x88100100,  //  002B  GETMBR	R4	R0	K0
       0x8C10090B,  //  002C  GETMET	R4	R4	K11
       0x7C100200,  //  002D  CALL	R4	1
@@ -480,7 +480,7 @@ be_local_closure(Matter_PathGenerator__next_attribute,   /* name */
       0x74120002,  //  0023  JMPT	R4	#0027
       0x88100100,  //  0024  GETMBR	R4	R0	K0
       0x1C100404,  //  0025  EQ	R4	R2	R4
-      0x78120001,  //  0026  JMPF	R4	#0029
+      0x7811FFF0,  //  0026  JMPF	R4	#0018
       0x88100100,  //  0027  GETMBR	R4	R0	K0
       0x80040800,  //  0028  RET	1	R4
       0x7001FFED,  //  0029  JMP		#0018
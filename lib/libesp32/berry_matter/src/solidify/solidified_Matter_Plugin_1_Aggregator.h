@@ -55,9 +55,9 @@ be_local_closure(Matter_Plugin_Aggregator_read_attribute,   /* name */
       0x58280005,  //  000A  LDCONST	R10	K5
       0x7C1C0600,  //  000B  CALL	R7	3
       0x80040E00,  //  000C  RET	1	R7
-      0x70020006,  //  000D  JMP		#0015
+      0x70020031,  //  000D  JMP		#0040
       0x1C1C0D08,  //  000E  EQ	R7	R6	K8
-      0x781E0004,  //  000F  JMPF	R7	#0015
+      0x781E002F,  //  000F  JMPF	R7	#0040
       0x8C1C0706,  //  0010  GETMET	R7	R3	K6
       0x88240909,  //  0011  GETMBR	R9	R4	K9
       0x58280005,  //  0012  LDCONST	R10	K5
@@ -95,7 +95,7 @@ be_local_closure(Matter_Plugin_Aggregator_read_attribute,   /* name */
       0xB82E0000,  //  0032  GETNGBL	R11	K0
       0x882C170F,  //  0033  GETMBR	R11	R11	K15
       0x202C140B,  //  0034  NE	R11	R10	R11
-      0x782E0004,  //  0035  JMPF	R11	#003B
+      0x782DFFF9,  //  0035  JMPF	R11	#0030
       0x8C2C0F0C,  //  0036  GETMET	R11	R7	K12
       0x4C340000,  //  0037  LDNIL	R13
       0x88380907,  //  0038  GETMBR	R14	R4	K7
@@ -160,7 +160,7 @@ be_local_closure(Matter_Plugin_Aggregator_invoke_request,   /* name */
       0x781E0002,  //  0007  JMPF	R7	#000B
       0x501C0200,  //  0008  LDBOOL	R7	1	0
       0x80040E00,  //  0009  RET	1	R7
-      0x70020010,  //  000A  JMP		#001C
+      0x7002001A,  //  000A  JMP		#0026
       0x1C1C0D06,  //  000B  EQ	R7	R6	K6
       0x781E0009,  //  000C  JMPF	R7	#0017
       0x8C1C0907,  //  000D  GETMET	R7	R4	K7
@@ -172,10 +172,10 @@ be_local_closure(Matter_Plugin_Aggregator_invoke_request,   /* name */
       0x7C200800,  //  0013  CALL	R8	4
       0x900E0705,  //  0014  SETMBR	R3	K3	K5
       0x80040E00,  //  0015  RET	1	R7
-      0x70020004,  //  0016  JMP		#001C
+      0x7002000E,  //  0016  JMP		#0026
       0x541E003F,  //  0017  LDINT	R7	64
       0x1C1C0C07,  //  0018  EQ	R7	R6	R7
-      0x781E0001,  //  0019  JMPF	R7	#001C
+      0x781E000B,  //  0019  JMPF	R7	#0026
       0x501C0200,  //  001A  LDBOOL	R7	1	0
       0x80040E00,  //  001B  RET	1	R7
       0x70020008,  //  001C  JMP		#0026
@@ -81,9 +81,9 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x58280005,  //  000A  LDCONST	R10	K5
       0x7C1C0600,  //  000B  CALL	R7	3
       0x80040E00,  //  000C  RET	1	R7
-      0x70020006,  //  000D  JMP		#0015
+      0x70020102,  //  000D  JMP		#0111
       0x1C1C0D08,  //  000E  EQ	R7	R6	K8
-      0x781E0004,  //  000F  JMPF	R7	#0015
+      0x781E0100,  //  000F  JMPF	R7	#0111
       0x8C1C0706,  //  0010  GETMET	R7	R3	K6
       0x88240909,  //  0011  GETMBR	R9	R4	K9
       0x58280005,  //  0012  LDCONST	R10	K5
@@ -94,7 +94,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x1C1C0A07,  //  0017  EQ	R7	R5	R7
       0x781E0004,  //  0018  JMPF	R7	#001E
       0x1C1C0D05,  //  0019  EQ	R7	R6	K5
-      0x781E0001,  //  001A  JMPF	R7	#001D
+      0x781E00F5,  //  001A  JMPF	R7	#0111
       0x4C1C0000,  //  001B  LDNIL	R7
       0x80040E00,  //  001C  RET	1	R7
       0x700200F2,  //  001D  JMP		#0111
@@ -106,7 +106,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x1C1C0A07,  //  0023  EQ	R7	R5	R7
       0x781E0034,  //  0024  JMPF	R7	#005A
       0x1C1C0D05,  //  0025  EQ	R7	R6	K5
-      0x781E0031,  //  0026  JMPF	R7	#0059
+      0x781E00E9,  //  0026  JMPF	R7	#0111
       0x8C1C090A,  //  0027  GETMET	R7	R4	K10
       0x7C1C0200,  //  0028  CALL	R7	1
       0x8820010B,  //  0029  GETMBR	R8	R0	K11
@@ -174,7 +174,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x582C0018,  //  0067  LDCONST	R11	K24
       0x7C200600,  //  0068  CALL	R8	3
       0x80041000,  //  0069  RET	1	R8
-      0x70020004,  //  006A  JMP		#0070
+      0x700200A5,  //  006A  JMP		#0111
       0x8C200706,  //  006B  GETMET	R8	R3	K6
       0x88280917,  //  006C  GETMBR	R10	R4	K23
       0x582C0019,  //  006D  LDCONST	R11	K25
@@ -198,7 +198,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x942C171C,  //  007F  GETIDX	R11	R11	K28
       0x7C200600,  //  0080  CALL	R8	3
       0x80041000,  //  0081  RET	1	R8
-      0x7002000F,  //  0082  JMP		#0093
+      0x7002008D,  //  0082  JMP		#0111
       0x88200113,  //  0083  GETMBR	R8	R0	K19
       0x88201116,  //  0084  GETMBR	R8	R8	K22
       0x54268000,  //  0085  LDINT	R9	32769
@@ -209,7 +209,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x582C001D,  //  008A  LDCONST	R11	K29
       0x7C200600,  //  008B  CALL	R8	3
       0x80041000,  //  008C  RET	1	R8
-      0x70020004,  //  008D  JMP		#0093
+      0x70020082,  //  008D  JMP		#0111
       0x8C200706,  //  008E  GETMET	R8	R3	K6
       0x88280917,  //  008F  GETMBR	R10	R4	K23
       0x582C001E,  //  0090  LDCONST	R11	K30
@@ -234,7 +234,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x942C1720,  //  00A3  GETIDX	R11	R11	K32
       0x7C200600,  //  00A4  CALL	R8	3
       0x80041000,  //  00A5  RET	1	R8
-      0x70020004,  //  00A6  JMP		#00AC
+      0x70020069,  //  00A6  JMP		#0111
       0x8C200706,  //  00A7  GETMET	R8	R3	K6
       0x88280917,  //  00A8  GETMBR	R10	R4	K23
       0x582C0019,  //  00A9  LDCONST	R11	K25
@@ -260,7 +260,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x942C1723,  //  00BD  GETIDX	R11	R11	K35
       0x7C200600,  //  00BE  CALL	R8	3
       0x80041000,  //  00BF  RET	1	R8
-      0x70020004,  //  00C0  JMP		#00C6
+      0x7002004F,  //  00C0  JMP		#0111
       0x8C200706,  //  00C1  GETMET	R8	R3	K6
       0x88280917,  //  00C2  GETMBR	R10	R4	K23
       0x582C0024,  //  00C3  LDCONST	R11	K36
@@ -296,7 +296,7 @@ be_local_closure(Matter_Plugin_Device_read_attribute,   /* name */
       0x5C341000,  //  00E1  MOVE	R13	R8
       0x7C280600,  //  00E2  CALL	R10	3
       0x80041400,  //  00E3  RET	1	R10
-      0x70020004,  //  00E4  JMP		#00EA
+      0x7002002B,  //  00E4  JMP		#0111
       0x8C200706,  //  00E5  GETMET	R8	R3	K6
       0x88280917,  //  00E6  GETMBR	R10	R4	K23
       0x582C0024,  //  00E7  LDCONST	R11	K36
@@ -577,7 +577,7 @@ be_local_closure(Matter_Plugin_Device_invoke_request,   /* name */
       0x781E0002,  //  0007  JMPF	R7	#000B
       0x501C0200,  //  0008  LDBOOL	R7	1	0
       0x80040E00,  //  0009  RET	1	R7
-      0x70020010,  //  000A  JMP		#001C
+      0x70020026,  //  000A  JMP		#0032
       0x1C1C0D06,  //  000B  EQ	R7	R6	K6
       0x781E0009,  //  000C  JMPF	R7	#0017
       0x8C1C0907,  //  000D  GETMET	R7	R4	K7
@@ -589,10 +589,10 @@ be_local_closure(Matter_Plugin_Device_invoke_request,   /* name */
       0x7C200800,  //  0013  CALL	R8	4
       0x900E0705,  //  0014  SETMBR	R3	K3	K5
       0x80040E00,  //  0015  RET	1	R7
-      0x70020004,  //  0016  JMP		#001C
+      0x7002001A,  //  0016  JMP		#0032
       0x541E003F,  //  0017  LDINT	R7	64
       0x1C1C0C07,  //  0018  EQ	R7	R6	R7
-      0x781E0001,  //  0019  JMPF	R7	#001C
+      0x781E0017,  //  0019  JMPF	R7	#0032
       0x501C0200,  //  001A  LDBOOL	R7	1	0
       0x80040E00,  //  001B  RET	1	R7
       0x70020014,  //  001C  JMP		#0032
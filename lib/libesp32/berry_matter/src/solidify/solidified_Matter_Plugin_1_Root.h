@@ -137,7 +137,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x882C0308,  //  000C  GETMBR	R11	R1	K8
       0x7C200600,  //  000D  CALL	R8	3
       0x80041000,  //  000E  RET	1	R8
-      0x70020027,  //  000F  JMP		#0038
+      0x700203C6,  //  000F  JMP		#03D7
       0x1C200F09,  //  0010  EQ	R8	R7	K9
       0x7822000D,  //  0011  JMPF	R8	#0020
       0x8C200B0A,  //  0012  GETMET	R8	R5	K10
@@ -153,7 +153,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x54360383,  //  001C  LDINT	R13	900
       0x7C240800,  //  001D  CALL	R9	4
       0x80041000,  //  001E  RET	1	R8
-      0x70020017,  //  001F  JMP		#0038
+      0x700203B6,  //  001F  JMP		#03D7
       0x1C200F0D,  //  0020  EQ	R8	R7	K13
       0x78220005,  //  0021  JMPF	R8	#0028
       0x8C200706,  //  0022  GETMET	R8	R3	K6
@@ -161,7 +161,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C000D,  //  0024  LDCONST	R11	K13
       0x7C200600,  //  0025  CALL	R8	3
       0x80041000,  //  0026  RET	1	R8
-      0x7002000F,  //  0027  JMP		#0038
+      0x700203AE,  //  0027  JMP		#03D7
       0x1C200F0F,  //  0028  EQ	R8	R7	K15
       0x78220005,  //  0029  JMPF	R8	#0030
       0x8C200706,  //  002A  GETMET	R8	R3	K6
@@ -169,10 +169,10 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C000D,  //  002C  LDCONST	R11	K13
       0x7C200600,  //  002D  CALL	R8	3
       0x80041000,  //  002E  RET	1	R8
-      0x70020007,  //  002F  JMP		#0038
+      0x700203A6,  //  002F  JMP		#03D7
       0x54220003,  //  0030  LDINT	R8	4
       0x1C200E08,  //  0031  EQ	R8	R7	R8
-      0x78220004,  //  0032  JMPF	R8	#0038
+      0x782203A3,  //  0032  JMPF	R8	#03D7
       0x8C200706,  //  0033  GETMET	R8	R3	K6
       0x88280B10,  //  0034  GETMBR	R10	R5	K16
       0x502C0000,  //  0035  LDBOOL	R11	0	0
@@ -369,7 +369,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x584C0009,  //  00F4  LDCONST	R19	K9
       0x7C3C0800,  //  00F5  CALL	R15	4
       0x80041000,  //  00F6  RET	1	R8
-      0x70020023,  //  00F7  JMP		#011C
+      0x700202DE,  //  00F7  JMP		#03D7
       0x1C200F09,  //  00F8  EQ	R8	R7	K9
       0x7822000B,  //  00F9  JMPF	R8	#0106
       0x8C200706,  //  00FA  GETMET	R8	R3	K6
@@ -383,7 +383,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x942C1729,  //  0102  GETIDX	R11	R11	K41
       0x7C200600,  //  0103  CALL	R8	3
       0x80041000,  //  0104  RET	1	R8
-      0x70020015,  //  0105  JMP		#011C
+      0x700202D0,  //  0105  JMP		#03D7
       0x1C200F0D,  //  0106  EQ	R8	R7	K13
       0x7822000B,  //  0107  JMPF	R8	#0114
       0x8C200706,  //  0108  GETMET	R8	R3	K6
@@ -397,10 +397,10 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x942C172D,  //  0110  GETIDX	R11	R11	K45
       0x7C200600,  //  0111  CALL	R8	3
       0x80041000,  //  0112  RET	1	R8
-      0x70020007,  //  0113  JMP		#011C
+      0x700202C2,  //  0113  JMP		#03D7
       0x54220007,  //  0114  LDINT	R8	8
       0x1C200E08,  //  0115  EQ	R8	R7	R8
-      0x78220004,  //  0116  JMPF	R8	#011C
+      0x782202BF,  //  0116  JMPF	R8	#03D7
       0x8C200706,  //  0117  GETMET	R8	R3	K6
       0x88280B10,  //  0118  GETMBR	R10	R5	K16
       0x502C0000,  //  0119  LDBOOL	R11	0	0
@@ -430,7 +430,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x5C301000,  //  0131  MOVE	R12	R8
       0x7C240600,  //  0132  CALL	R9	3
       0x80041200,  //  0133  RET	1	R9
-      0x70020019,  //  0134  JMP		#014F
+      0x700202A1,  //  0134  JMP		#03D7
       0x1C200F09,  //  0135  EQ	R8	R7	K9
       0x78220005,  //  0136  JMPF	R8	#013D
       0x8C200706,  //  0137  GETMET	R8	R3	K6
@@ -438,10 +438,10 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C000F,  //  0139  LDCONST	R11	K15
       0x7C200600,  //  013A  CALL	R8	3
       0x80041000,  //  013B  RET	1	R8
-      0x70020011,  //  013C  JMP		#014F
+      0x70020299,  //  013C  JMP		#03D7
       0x54220006,  //  013D  LDINT	R8	7
       0x1C200E08,  //  013E  EQ	R8	R7	R8
-      0x7822000E,  //  013F  JMPF	R8	#014F
+      0x78220296,  //  013F  JMPF	R8	#03D7
       0xB8225C00,  //  0140  GETNGBL	R8	K46
       0xB8262400,  //  0141  GETNGBL	R9	K18
       0x8C241331,  //  0142  GETMET	R9	R9	K49
@@ -520,7 +520,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0xAC280200,  //  018B  CATCH	R10	1	0
       0xB0080000,  //  018C  RAISE	2	R0	R0
       0x80041000,  //  018D  RET	1	R8
-      0x70020078,  //  018E  JMP		#0208
+      0x70020247,  //  018E  JMP		#03D7
       0x1C200F09,  //  018F  EQ	R8	R7	K9
       0x7822004D,  //  0190  JMPF	R8	#01DF
       0x8C200B11,  //  0191  GETMET	R8	R5	K17
@@ -600,7 +600,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0xAC280200,  //  01DB  CATCH	R10	1	0
       0xB0080000,  //  01DC  RAISE	2	R0	R0
       0x80041000,  //  01DD  RET	1	R8
-      0x70020028,  //  01DE  JMP		#0208
+      0x700201F7,  //  01DE  JMP		#03D7
       0x1C200F0D,  //  01DF  EQ	R8	R7	K13
       0x78220007,  //  01E0  JMPF	R8	#01E9
       0x8C200706,  //  01E1  GETMET	R8	R3	K6
@@ -610,7 +610,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x882C1747,  //  01E5  GETMBR	R11	R11	K71
       0x7C200600,  //  01E6  CALL	R8	3
       0x80041000,  //  01E7  RET	1	R8
-      0x7002001E,  //  01E8  JMP		#0208
+      0x700201ED,  //  01E8  JMP		#03D7
       0x1C200F0F,  //  01E9  EQ	R8	R7	K15
       0x78220009,  //  01EA  JMPF	R8	#01F5
       0x88200136,  //  01EB  GETMBR	R8	R0	K54
@@ -622,14 +622,14 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x5C301000,  //  01F1  MOVE	R12	R8
       0x7C240600,  //  01F2  CALL	R9	3
       0x80041200,  //  01F3  RET	1	R9
-      0x70020012,  //  01F4  JMP		#0208
+      0x700201E1,  //  01F4  JMP		#03D7
       0x54220003,  //  01F5  LDINT	R8	4
       0x1C200E08,  //  01F6  EQ	R8	R7	R8
       0x78220000,  //  01F7  JMPF	R8	#01F9
-      0x7002000E,  //  01F8  JMP		#0208
+      0x700201DD,  //  01F8  JMP		#03D7
       0x54220004,  //  01F9  LDINT	R8	5
       0x1C200E08,  //  01FA  EQ	R8	R7	R8
-      0x7822000B,  //  01FB  JMPF	R8	#0208
+      0x782201DA,  //  01FB  JMPF	R8	#03D7
       0x88200349,  //  01FC  GETMBR	R8	R1	K73
       0x8C20113D,  //  01FD  GETMET	R8	R8	K61
       0x7C200200,  //  01FE  CALL	R8	1
@@ -657,7 +657,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x78220004,  //  0214  JMPF	R8	#021A
       0x78260001,  //  0215  JMPF	R9	#0218
       0x5828000D,  //  0216  LDCONST	R10	K13
-      0x70020000,  //  0217  JMP		#0219
+      0x70020002,  //  0217  JMP		#021B
       0x58280009,  //  0218  LDCONST	R10	K9
       0x70020000,  //  0219  JMP		#021B
       0x58280005,  //  021A  LDCONST	R10	K5
@@ -666,7 +666,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x5C381400,  //  021D  MOVE	R14	R10
       0x7C2C0600,  //  021E  CALL	R11	3
       0x80041600,  //  021F  RET	1	R11
-      0x70020026,  //  0220  JMP		#0248
+      0x700201B5,  //  0220  JMP		#03D7
       0x1C200F09,  //  0221  EQ	R8	R7	K9
       0x78220011,  //  0222  JMPF	R8	#0235
       0x88200136,  //  0223  GETMBR	R8	R0	K54
@@ -680,15 +680,15 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x7C300200,  //  022B  CALL	R12	1
       0x7C240600,  //  022C  CALL	R9	3
       0x80041200,  //  022D  RET	1	R9
-      0x70020004,  //  022E  JMP		#0234
+      0x700201A7,  //  022E  JMP		#03D7
       0x8C240706,  //  022F  GETMET	R9	R3	K6
       0x882C0B18,  //  0230  GETMBR	R11	R5	K24
       0x4C300000,  //  0231  LDNIL	R12
       0x7C240600,  //  0232  CALL	R9	3
       0x80041200,  //  0233  RET	1	R9
-      0x70020012,  //  0234  JMP		#0248
+      0x700201A1,  //  0234  JMP		#03D7
       0x1C200F0D,  //  0235  EQ	R8	R7	K13
-      0x78220010,  //  0236  JMPF	R8	#0248
+      0x7822019F,  //  0236  JMPF	R8	#03D7
       0x88200136,  //  0237  GETMBR	R8	R0	K54
       0x8820114C,  //  0238  GETMBR	R8	R8	K76
       0x4C240000,  //  0239  LDNIL	R9
@@ -700,7 +700,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x7C300200,  //  023F  CALL	R12	1
       0x7C240600,  //  0240  CALL	R9	3
       0x80041200,  //  0241  RET	1	R9
-      0x70020004,  //  0242  JMP		#0248
+      0x70020193,  //  0242  JMP		#03D7
       0x8C240706,  //  0243  GETMET	R9	R3	K6
       0x882C0B18,  //  0244  GETMBR	R11	R5	K24
       0x4C300000,  //  0245  LDNIL	R12
@@ -720,7 +720,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0009,  //  0253  LDCONST	R11	K9
       0x7C200600,  //  0254  CALL	R8	3
       0x80041000,  //  0255  RET	1	R8
-      0x700200E6,  //  0256  JMP		#033E
+      0x7002017F,  //  0256  JMP		#03D7
       0x1C200F09,  //  0257  EQ	R8	R7	K9
       0x78220010,  //  0258  JMPF	R8	#026A
       0x88200136,  //  0259  GETMBR	R8	R0	K54
@@ -733,13 +733,13 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C004E,  //  0260  LDCONST	R11	K78
       0x7C200600,  //  0261  CALL	R8	3
       0x80041000,  //  0262  RET	1	R8
-      0x70020004,  //  0263  JMP		#0269
+      0x70020172,  //  0263  JMP		#03D7
       0x8C200706,  //  0264  GETMET	R8	R3	K6
       0x88280B16,  //  0265  GETMBR	R10	R5	K22
       0x582C004F,  //  0266  LDCONST	R11	K79
       0x7C200600,  //  0267  CALL	R8	3
       0x80041000,  //  0268  RET	1	R8
-      0x700200D3,  //  0269  JMP		#033E
+      0x7002016C,  //  0269  JMP		#03D7
       0x1C200F0D,  //  026A  EQ	R8	R7	K13
       0x78220006,  //  026B  JMPF	R8	#0273
       0x8C200706,  //  026C  GETMET	R8	R3	K6
@@ -748,7 +748,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x882C1750,  //  026F  GETMBR	R11	R11	K80
       0x7C200600,  //  0270  CALL	R8	3
       0x80041000,  //  0271  RET	1	R8
-      0x700200CA,  //  0272  JMP		#033E
+      0x70020163,  //  0272  JMP		#03D7
       0x1C200F0F,  //  0273  EQ	R8	R7	K15
       0x78220020,  //  0274  JMPF	R8	#0296
       0x88200136,  //  0275  GETMBR	R8	R0	K54
@@ -766,7 +766,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x942C1751,  //  0281  GETIDX	R11	R11	K81
       0x7C200600,  //  0282  CALL	R8	3
       0x80041000,  //  0283  RET	1	R8
-      0x7002000F,  //  0284  JMP		#0295
+      0x70020151,  //  0284  JMP		#03D7
       0x88200136,  //  0285  GETMBR	R8	R0	K54
       0x8820114D,  //  0286  GETMBR	R8	R8	K77
       0x54268000,  //  0287  LDINT	R9	32769
@@ -777,13 +777,13 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0052,  //  028C  LDCONST	R11	K82
       0x7C200600,  //  028D  CALL	R8	3
       0x80041000,  //  028E  RET	1	R8
-      0x70020004,  //  028F  JMP		#0295
+      0x70020146,  //  028F  JMP		#03D7
       0x8C200706,  //  0290  GETMET	R8	R3	K6
       0x88280B16,  //  0291  GETMBR	R10	R5	K22
       0x582C0053,  //  0292  LDCONST	R11	K83
       0x7C200600,  //  0293  CALL	R8	3
       0x80041000,  //  0294  RET	1	R8
-      0x700200A7,  //  0295  JMP		#033E
+      0x70020140,  //  0295  JMP		#03D7
       0x54220003,  //  0296  LDINT	R8	4
       0x1C200E08,  //  0297  EQ	R8	R7	R8
       0x78220006,  //  0298  JMPF	R8	#02A0
@@ -793,7 +793,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x882C174D,  //  029C  GETMBR	R11	R11	K77
       0x7C200600,  //  029D  CALL	R8	3
       0x80041000,  //  029E  RET	1	R8
-      0x7002009D,  //  029F  JMP		#033E
+      0x70020136,  //  029F  JMP		#03D7
       0x54220004,  //  02A0  LDINT	R8	5
       0x1C200E08,  //  02A1  EQ	R8	R7	R8
       0x78220015,  //  02A2  JMPF	R8	#02B9
@@ -812,13 +812,13 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x942C1755,  //  02AF  GETIDX	R11	R11	K85
       0x7C200600,  //  02B0  CALL	R8	3
       0x80041000,  //  02B1  RET	1	R8
-      0x70020004,  //  02B2  JMP		#02B8
+      0x70020123,  //  02B2  JMP		#03D7
       0x8C200706,  //  02B3  GETMET	R8	R3	K6
       0x88280B16,  //  02B4  GETMBR	R10	R5	K22
       0x582C004F,  //  02B5  LDCONST	R11	K79
       0x7C200600,  //  02B6  CALL	R8	3
       0x80041000,  //  02B7  RET	1	R8
-      0x70020084,  //  02B8  JMP		#033E
+      0x7002011D,  //  02B8  JMP		#03D7
       0x54220005,  //  02B9  LDINT	R8	6
       0x1C200E08,  //  02BA  EQ	R8	R7	R8
       0x78220005,  //  02BB  JMPF	R8	#02C2
@@ -827,7 +827,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0056,  //  02BE  LDCONST	R11	K86
       0x7C200600,  //  02BF  CALL	R8	3
       0x80041000,  //  02C0  RET	1	R8
-      0x7002007B,  //  02C1  JMP		#033E
+      0x70020114,  //  02C1  JMP		#03D7
       0x54220006,  //  02C2  LDINT	R8	7
       0x1C200E08,  //  02C3  EQ	R8	R7	R8
       0x78220010,  //  02C4  JMPF	R8	#02D6
@@ -841,13 +841,13 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0005,  //  02CC  LDCONST	R11	K5
       0x7C200600,  //  02CD  CALL	R8	3
       0x80041000,  //  02CE  RET	1	R8
-      0x70020004,  //  02CF  JMP		#02D5
+      0x70020106,  //  02CF  JMP		#03D7
       0x8C200706,  //  02D0  GETMET	R8	R3	K6
       0x88280B0C,  //  02D1  GETMBR	R10	R5	K12
       0x582C0009,  //  02D2  LDCONST	R11	K9
       0x7C200600,  //  02D3  CALL	R8	3
       0x80041000,  //  02D4  RET	1	R8
-      0x70020067,  //  02D5  JMP		#033E
+      0x70020100,  //  02D5  JMP		#03D7
       0x54220007,  //  02D6  LDINT	R8	8
       0x1C200E08,  //  02D7  EQ	R8	R7	R8
       0x7822000B,  //  02D8  JMPF	R8	#02E5
@@ -862,7 +862,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x942C1759,  //  02E1  GETIDX	R11	R11	K89
       0x7C200600,  //  02E2  CALL	R8	3
       0x80041000,  //  02E3  RET	1	R8
-      0x70020058,  //  02E4  JMP		#033E
+      0x700200F1,  //  02E4  JMP		#03D7
       0x54220008,  //  02E5  LDINT	R8	9
       0x1C200E08,  //  02E6  EQ	R8	R7	R8
       0x78220005,  //  02E7  JMPF	R8	#02EE
@@ -871,7 +871,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0009,  //  02EA  LDCONST	R11	K9
       0x7C200600,  //  02EB  CALL	R8	3
       0x80041000,  //  02EC  RET	1	R8
-      0x7002004F,  //  02ED  JMP		#033E
+      0x700200E8,  //  02ED  JMP		#03D7
       0x54220009,  //  02EE  LDINT	R8	10
       0x1C200E08,  //  02EF  EQ	R8	R7	R8
       0x78220015,  //  02F0  JMPF	R8	#0307
@@ -896,7 +896,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x5C341000,  //  0303  MOVE	R13	R8
       0x7C280600,  //  0304  CALL	R10	3
       0x80041400,  //  0305  RET	1	R10
-      0x70020036,  //  0306  JMP		#033E
+      0x700200CF,  //  0306  JMP		#03D7
       0x5422000E,  //  0307  LDINT	R8	15
       0x1C200E08,  //  0308  EQ	R8	R7	R8
       0x7822000B,  //  0309  JMPF	R8	#0316
@@ -911,7 +911,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x7C2C0600,  //  0312  CALL	R11	3
       0x7C200600,  //  0313  CALL	R8	3
       0x80041000,  //  0314  RET	1	R8
-      0x70020027,  //  0315  JMP		#033E
+      0x700200C0,  //  0315  JMP		#03D7
       0x54220010,  //  0316  LDINT	R8	17
       0x1C200E08,  //  0317  EQ	R8	R7	R8
       0x78220005,  //  0318  JMPF	R8	#031F
@@ -920,7 +920,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0009,  //  031B  LDCONST	R11	K9
       0x7C200600,  //  031C  CALL	R8	3
       0x80041000,  //  031D  RET	1	R8
-      0x7002001E,  //  031E  JMP		#033E
+      0x700200B7,  //  031E  JMP		#03D7
       0x54220011,  //  031F  LDINT	R8	18
       0x1C200E08,  //  0320  EQ	R8	R7	R8
       0x7822000B,  //  0321  JMPF	R8	#032E
@@ -935,10 +935,10 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x7C2C0600,  //  032A  CALL	R11	3
       0x7C200600,  //  032B  CALL	R8	3
       0x80041000,  //  032C  RET	1	R8
-      0x7002000F,  //  032D  JMP		#033E
+      0x700200A8,  //  032D  JMP		#03D7
       0x54220012,  //  032E  LDINT	R8	19
       0x1C200E08,  //  032F  EQ	R8	R7	R8
-      0x7822000C,  //  0330  JMPF	R8	#033E
+      0x782200A5,  //  0330  JMPF	R8	#03D7
       0x8C200B0A,  //  0331  GETMET	R8	R5	K10
       0x7C200200,  //  0332  CALL	R8	1
       0x8C24110B,  //  0333  GETMET	R9	R8	K11
@@ -965,7 +965,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x8C200B11,  //  0348  GETMET	R8	R5	K17
       0x7C200200,  //  0349  CALL	R8	1
       0x80041000,  //  034A  RET	1	R8
-      0x70020016,  //  034B  JMP		#0363
+      0x7002008A,  //  034B  JMP		#03D7
       0x1C200F09,  //  034C  EQ	R8	R7	K9
       0x78220005,  //  034D  JMPF	R8	#0354
       0x8C200706,  //  034E  GETMET	R8	R3	K6
@@ -973,7 +973,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0005,  //  0350  LDCONST	R11	K5
       0x7C200600,  //  0351  CALL	R8	3
       0x80041000,  //  0352  RET	1	R8
-      0x7002000E,  //  0353  JMP		#0363
+      0x70020082,  //  0353  JMP		#03D7
       0x1C200F0D,  //  0354  EQ	R8	R7	K13
       0x78220005,  //  0355  JMPF	R8	#035C
       0x8C200706,  //  0356  GETMET	R8	R3	K6
@@ -981,9 +981,9 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0009,  //  0358  LDCONST	R11	K9
       0x7C200600,  //  0359  CALL	R8	3
       0x80041000,  //  035A  RET	1	R8
-      0x70020006,  //  035B  JMP		#0363
+      0x7002007A,  //  035B  JMP		#03D7
       0x1C200F0F,  //  035C  EQ	R8	R7	K15
-      0x78220004,  //  035D  JMPF	R8	#0363
+      0x78220078,  //  035D  JMPF	R8	#03D7
       0x8C200706,  //  035E  GETMET	R8	R3	K6
       0x88280B18,  //  035F  GETMBR	R10	R5	K24
       0x4C2C0000,  //  0360  LDNIL	R11
@@ -1002,9 +1002,9 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x7C2C0200,  //  036D  CALL	R11	1
       0x7C200600,  //  036E  CALL	R8	3
       0x80041000,  //  036F  RET	1	R8
-      0x7002000B,  //  0370  JMP		#037D
+      0x70020065,  //  0370  JMP		#03D7
       0x1C200F09,  //  0371  EQ	R8	R7	K9
-      0x78220009,  //  0372  JMPF	R8	#037D
+      0x78220063,  //  0372  JMPF	R8	#03D7
       0x8C200B11,  //  0373  GETMET	R8	R5	K17
       0x7C200200,  //  0374  CALL	R8	1
       0x8C24110B,  //  0375  GETMET	R9	R8	K11
@@ -1026,7 +1026,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x582C0009,  //  0385  LDCONST	R11	K9
       0x7C200600,  //  0386  CALL	R8	3
       0x80041000,  //  0387  RET	1	R8
-      0x70020013,  //  0388  JMP		#039D
+      0x7002004D,  //  0388  JMP		#03D7
       0x1C200F09,  //  0389  EQ	R8	R7	K9
       0x78220005,  //  038A  JMPF	R8	#0391
       0x8C200706,  //  038B  GETMET	R8	R3	K6
@@ -1034,9 +1034,9 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x542E0003,  //  038D  LDINT	R11	4
       0x7C200600,  //  038E  CALL	R8	3
       0x80041000,  //  038F  RET	1	R8
-      0x7002000B,  //  0390  JMP		#039D
+      0x70020045,  //  0390  JMP		#03D7
       0x1C200F0D,  //  0391  EQ	R8	R7	K13
-      0x78220009,  //  0392  JMPF	R8	#039D
+      0x78220043,  //  0392  JMPF	R8	#03D7
       0x8C200B11,  //  0393  GETMET	R8	R5	K17
       0x7C200200,  //  0394  CALL	R8	1
       0x8C24110B,  //  0395  GETMET	R9	R8	K11
@@ -1052,7 +1052,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0x1C200C08,  //  039F  EQ	R8	R6	R8
       0x78220007,  //  03A0  JMPF	R8	#03A9
       0x1C200F0F,  //  03A1  EQ	R8	R7	K15
-      0x78220004,  //  03A2  JMPF	R8	#03A8
+      0x78220033,  //  03A2  JMPF	R8	#03D7
       0x8C200706,  //  03A3  GETMET	R8	R3	K6
       0x88280B0E,  //  03A4  GETMBR	R10	R5	K14
       0x542E001D,  //  03A5  LDINT	R11	30
@@ -1094,7 +1094,7 @@ be_local_closure(Matter_Plugin_Root_read_attribute,   /* name */
       0xB8360200,  //  03C9  GETNGBL	R13	K1
       0x88341B60,  //  03CA  GETMBR	R13	R13	K96
       0x2034180D,  //  03CB  NE	R13	R12	R13
-      0x78360004,  //  03CC  JMPF	R13	#03D2
+      0x7835FFF7,  //  03CC  JMPF	R13	#03C5
       0x8C34110B,  //  03CD  GETMET	R13	R8	K11
       0x4C3C0000,  //  03CE  LDNIL	R15
       0x88400B0C,  //  03CF  GETMBR	R16	R5	K12
@@ -1159,7 +1159,7 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x1C1C0A07,  //  0005  EQ	R7	R5	R7
       0x781E0019,  //  0006  JMPF	R7	#0021
       0x1C1C0D04,  //  0007  EQ	R7	R6	K4
-      0x781E0016,  //  0008  JMPF	R7	#0020
+      0x781E0059,  //  0008  JMPF	R7	#0063
       0x601C0004,  //  0009  GETGBL	R7	G4
       0x5C200600,  //  000A  MOVE	R8	R3
       0x7C1C0200,  //  000B  CALL	R7	1
@@ -1177,7 +1177,7 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x7C1C0600,  //  0017  CALL	R7	3
       0x501C0200,  //  0018  LDBOOL	R7	1	0
       0x80040E00,  //  0019  RET	1	R7
-      0x70020004,  //  001A  JMP		#0020
+      0x70020047,  //  001A  JMP		#0063
       0xB81E0000,  //  001B  GETNGBL	R7	K0
       0x881C0F0A,  //  001C  GETMBR	R7	R7	K10
       0x900A1207,  //  001D  SETMBR	R2	K9	R7
@@ -1188,7 +1188,7 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x1C1C0A07,  //  0022  EQ	R7	R5	R7
       0x781E0004,  //  0023  JMPF	R7	#0029
       0x1C1C0D04,  //  0024  EQ	R7	R6	K4
-      0x781E0001,  //  0025  JMPF	R7	#0028
+      0x781E003C,  //  0025  JMPF	R7	#0063
       0x501C0200,  //  0026  LDBOOL	R7	1	0
       0x80040E00,  //  0027  RET	1	R7
       0x70020039,  //  0028  JMP		#0063
@@ -1200,10 +1200,10 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x781E0002,  //  002E  JMPF	R7	#0032
       0x501C0200,  //  002F  LDBOOL	R7	1	0
       0x80040E00,  //  0030  RET	1	R7
-      0x70020004,  //  0031  JMP		#0037
+      0x70020030,  //  0031  JMP		#0063
       0x541E0005,  //  0032  LDINT	R7	6
       0x1C1C0C07,  //  0033  EQ	R7	R6	R7
-      0x781E0001,  //  0034  JMPF	R7	#0037
+      0x781E002D,  //  0034  JMPF	R7	#0063
       0x501C0200,  //  0035  LDBOOL	R7	1	0
       0x80040E00,  //  0036  RET	1	R7
       0x7002002A,  //  0037  JMP		#0063
@@ -1211,7 +1211,7 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x1C1C0A07,  //  0039  EQ	R7	R5	R7
       0x781E0004,  //  003A  JMPF	R7	#0040
       0x1C1C0D04,  //  003B  EQ	R7	R6	K4
-      0x781E0001,  //  003C  JMPF	R7	#003F
+      0x781E0025,  //  003C  JMPF	R7	#0063
       0x501C0200,  //  003D  LDBOOL	R7	1	0
       0x80040E00,  //  003E  RET	1	R7
       0x70020022,  //  003F  JMP		#0063
@@ -1219,7 +1219,7 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x1C1C0A07,  //  0041  EQ	R7	R5	R7
       0x781E0007,  //  0042  JMPF	R7	#004B
       0x1C1C0D04,  //  0043  EQ	R7	R6	K4
-      0x781E0004,  //  0044  JMPF	R7	#004A
+      0x781E001D,  //  0044  JMPF	R7	#0063
       0xB81E0000,  //  0045  GETNGBL	R7	K0
       0x881C0F0A,  //  0046  GETMBR	R7	R7	K10
       0x900A1207,  //  0047  SETMBR	R2	K9	R7
@@ -1233,9 +1233,9 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
       0x781E0002,  //  004F  JMPF	R7	#0053
       0x501C0200,  //  0050  LDBOOL	R7	1	0
       0x80040E00,  //  0051  RET	1	R7
-      0x70020003,  //  0052  JMP		#0057
+      0x7002000F,  //  0052  JMP		#0063
       0x1C1C0D0B,  //  0053  EQ	R7	R6	K11
-      0x781E0001,  //  0054  JMPF	R7	#0057
+      0x781E000D,  //  0054  JMPF	R7	#0063
       0x501C0200,  //  0055  LDBOOL	R7	1	0
       0x80040E00,  //  0056  RET	1	R7
       0x7002000A,  //  0057  JMP		#0063
@@ -1404,7 +1404,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
     }),
     be_str_weak(invoke_request),
     &be_const_str_solidified,
-    ( &(const binstruction[745]) {  /* code */
+    ( &(const binstruction[743]) {  /* code */
       0xA4120000,  //  0000  IMPORT	R4	K0
       0xB8160200,  //  0001  GETNGBL	R5	K1
       0x88140B02,  //  0002  GETMBR	R5	R5	K2
@@ -1438,7 +1438,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x7C2C0800,  //  001E  CALL	R11	4
       0x900E0907,  //  001F  SETMBR	R3	K4	K7
       0x80041400,  //  0020  RET	1	R10
-      0x70020041,  //  0021  JMP		#0064
+      0x700202C2,  //  0021  JMP		#02E5
       0x1C200F0E,  //  0022  EQ	R8	R7	K14
       0x7822001A,  //  0023  JMPF	R8	#003F
       0x8C200506,  //  0024  GETMET	R8	R2	K6
@@ -1467,10 +1467,10 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x7C300800,  //  003B  CALL	R12	4
       0x900E0910,  //  003C  SETMBR	R3	K4	K16
       0x80041600,  //  003D  RET	1	R11
-      0x70020024,  //  003E  JMP		#0064
+      0x700202A5,  //  003E  JMP		#02E5
       0x54220003,  //  003F  LDINT	R8	4
       0x1C200E08,  //  0040  EQ	R8	R7	R8
-      0x78220021,  //  0041  JMPF	R8	#0064
+      0x782202A2,  //  0041  JMPF	R8	#02E5
       0x8C200111,  //  0042  GETMET	R8	R0	K17
       0x5C280600,  //  0043  MOVE	R10	R3
       0x7C200400,  //  0044  CALL	R8	2
@@ -1503,9 +1503,9 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x5C2C0200,  //  005F  MOVE	R11	R1
       0x7C240400,  //  0060  CALL	R9	2
       0x80041000,  //  0061  RET	1	R8
-      0x70020000,  //  0062  JMP		#0064
+      0x70020281,  //  0062  JMP		#02E5
       0xB0063119,  //  0063  RAISE	1	K24	K25
-      0x70020281,  //  0064  JMP		#02E7
+      0x7002027F,  //  0064  JMP		#02E5
       0x5422003D,  //  0065  LDINT	R8	62
       0x1C200C08,  //  0066  EQ	R8	R6	R8
       0x782201E2,  //  0067  JMPF	R8	#024B
@@ -1540,7 +1540,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x7C280800,  //  0084  CALL	R10	4
       0x900E0910,  //  0085  SETMBR	R3	K4	K16
       0x80041200,  //  0086  RET	1	R9
-      0x700201C1,  //  0087  JMP		#024A
+      0x7002025C,  //  0087  JMP		#02E5
       0x1C200F05,  //  0088  EQ	R8	R7	K5
       0x7822003C,  //  0089  JMPF	R8	#00C7
       0x8C200506,  //  008A  GETMET	R8	R2	K6
@@ -1603,7 +1603,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x7C3C0800,  //  00C3  CALL	R15	4
       0x900E0907,  //  00C4  SETMBR	R3	K4	K7
       0x80041C00,  //  00C5  RET	1	R14
-      0x70020182,  //  00C6  JMP		#024A
+      0x7002021D,  //  00C6  JMP		#02E5
       0x54220003,  //  00C7  LDINT	R8	4
       0x1C200E08,  //  00C8  EQ	R8	R7	R8
       0x7822003C,  //  00C9  JMPF	R8	#0107
@@ -1667,7 +1667,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x54420004,  //  0103  LDINT	R16	5
       0x900E0810,  //  0104  SETMBR	R3	K4	R16
       0x80041E00,  //  0105  RET	1	R15
-      0x70020142,  //  0106  JMP		#024A
+      0x700201DD,  //  0106  JMP		#02E5
       0x5422000A,  //  0107  LDINT	R8	11
       0x1C200E08,  //  0108  EQ	R8	R7	R8
       0x7822000B,  //  0109  JMPF	R8	#0116
@@ -1682,7 +1682,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x900E3409,  //  0112  SETMBR	R3	K26	R9
       0x4C240000,  //  0113  LDNIL	R9
       0x80041200,  //  0114  RET	1	R9
-      0x70020133,  //  0115  JMP		#024A
+      0x700201CE,  //  0115  JMP		#02E5
       0x54220005,  //  0116  LDINT	R8	6
       0x1C200E08,  //  0117  EQ	R8	R7	R8
       0x782200BB,  //  0118  JMPF	R8	#01D5
@@ -1873,7 +1873,7 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x54660007,  //  01D1  LDINT	R25	8
       0x900E0819,  //  01D2  SETMBR	R3	K4	R25
       0x80043000,  //  01D3  RET	1	R24
-      0x70020074,  //  01D4  JMP		#024A
+      0x7002010F,  //  01D4  JMP		#02E5
       0x54220008,  //  01D5  LDINT	R8	9
       0x1C200E08,  //  01D6  EQ	R8	R7	R8
       0x7822002C,  //  01D7  JMPF	R8	#0205
@@ -1921,10 +1921,10 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x542A0007,  //  0201  LDINT	R10	8
       0x900E080A,  //  0202  SETMBR	R3	K4	R10
       0x80041200,  //  0203  RET	1	R9
-      0x70020044,  //  0204  JMP		#024A
+      0x700200DF,  //  0204  JMP		#02E5
       0x54220009,  //  0205  LDINT	R8	10
       0x1C200E08,  //  0206  EQ	R8	R7	R8
-      0x78220041,  //  0207  JMPF	R8	#024A
+      0x782200DC,  //  0207  JMPF	R8	#02E5
       0x8C200506,  //  0208  GETMET	R8	R2	K6
       0x58280005,  //  0209  LDCONST	R10	K5
       0x7C200400,  //  020A  CALL	R8	2
@@ -1991,12 +1991,12 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x4C240000,  //  0247  LDNIL	R9
       0xA0000000,  //  0248  CLOSE	R0
       0x80041200,  //  0249  RET	1	R9
-      0x7002009B,  //  024A  JMP		#02E7
+      0x70020099,  //  024A  JMP		#02E5
       0x5422003B,  //  024B  LDINT	R8	60
       0x1C200C08,  //  024C  EQ	R8	R6	R8
-      0x78220085,  //  024D  JMPF	R8	#02D4
+      0x78220083,  //  024D  JMPF	R8	#02D2
       0x1C200F05,  //  024E  EQ	R8	R7	K5
-      0x78220065,  //  024F  JMPF	R8	#02B6
+      0x78220063,  //  024F  JMPF	R8	#02B4
       0x8C200506,  //  0250  GETMET	R8	R2	K6
       0x58280005,  //  0251  LDCONST	R10	K5
       0x7C200400,  //  0252  CALL	R8	2
@@ -2050,106 +2050,104 @@ be_local_closure(Matter_Plugin_Root_invoke_request,   /* name */
       0x6034000C,  //  0282  GETGBL	R13	G12
       0x5C381200,  //  0283  MOVE	R14	R9
       0x7C340200,  //  0284  CALL	R13	1
-      0x543A001F,  //  0285  LDINT	R14	32
-      0x543E0040,  //  0286  LDINT	R15	65
-      0x00381C0F,  //  0287  ADD	R14	R14	R15
-      0x20341A0E,  //  0288  NE	R13	R13	R14
-      0x7436000B,  //  0289  JMPT	R13	#0296
-      0x6034000C,  //  028A  GETGBL	R13	G12
-      0x5C381800,  //  028B  MOVE	R14	R12
-      0x7C340200,  //  028C  CALL	R13	1
-      0x543A000F,  //  028D  LDINT	R14	16
-      0x14341A0E,  //  028E  LT	R13	R13	R14
-      0x74360005,  //  028F  JMPT	R13	#0296
-      0x6034000C,  //  0290  GETGBL	R13	G12
-      0x5C381800,  //  0291  MOVE	R14	R12
-      0x7C340200,  //  0292  CALL	R13	1
-      0x543A001F,  //  0293  LDINT	R14	32
-      0x24341A0E,  //  0294  GT	R13	R13	R14
-      0x7836000A,  //  0295  JMPF	R13	#02A1
-      0xB8364400,  //  0296  GETNGBL	R13	K34
-      0x8C341B2C,  //  0297  GETMET	R13	R13	K44
-      0x583C005F,  //  0298  LDCONST	R15	K95
-      0x5840000E,  //  0299  LDCONST	R16	K14
-      0x7C340600,  //  029A  CALL	R13	3
-      0xB8360200,  //  029B  GETNGBL	R13	K1
-      0x88341B60,  //  029C  GETMBR	R13	R13	K96
-      0x900E340D,  //  029D  SETMBR	R3	K26	R13
-      0x4C340000,  //  029E  LDNIL	R13
-      0xA0000000,  //  029F  CLOSE	R0
-      0x80041A00,  //  02A0  RET	1	R13
-      0x5436001E,  //  02A1  LDINT	R13	31
-      0x40360A0D,  //  02A2  CONNECT	R13	K5	R13
-      0x9434120D,  //  02A3  GETIDX	R13	R9	R13
-      0x543A001F,  //  02A4  LDINT	R14	32
-      0x40381D40,  //  02A5  CONNECT	R14	R14	K64
-      0x9438120E,  //  02A6  GETIDX	R14	R9	R14
-      0x883C0116,  //  02A7  GETMBR	R15	R0	K22
-      0x8C3C1F61,  //  02A8  GETMET	R15	R15	K97
-      0x5C441000,  //  02A9  MOVE	R17	R8
-      0x5C481600,  //  02AA  MOVE	R18	R11
-      0x5C4C1400,  //  02AB  MOVE	R19	R10
-      0x5C501800,  //  02AC  MOVE	R20	R12
-      0x5C541A00,  //  02AD  MOVE	R21	R13
-      0x5C581C00,  //  02AE  MOVE	R22	R14
-      0x8C5C0354,  //  02AF  GETMET	R23	R1	K84
-      0x7C5C0200,  //  02B0  CALL	R23	1
-      0x7C3C1000,  //  02B1  CALL	R15	8
-      0x503C0200,  //  02B2  LDBOOL	R15	1	0
-      0xA0000000,  //  02B3  CLOSE	R0
-      0x80041E00,  //  02B4  RET	1	R15
-      0x7002001C,  //  02B5  JMP		#02D3
-      0x1C200F07,  //  02B6  EQ	R8	R7	K7
-      0x78220012,  //  02B7  JMPF	R8	#02CB
-      0x8C200506,  //  02B8  GETMET	R8	R2	K6
-      0x58280005,  //  02B9  LDCONST	R10	K5
-      0x7C200400,  //  02BA  CALL	R8	2
-      0xB8264400,  //  02BB  GETNGBL	R9	K34
-      0x8C24132C,  //  02BC  GETMET	R9	R9	K44
-      0x602C0008,  //  02BD  GETGBL	R11	G8
-      0x5C301000,  //  02BE  MOVE	R12	R8
-      0x7C2C0200,  //  02BF  CALL	R11	1
-      0x002EC40B,  //  02C0  ADD	R11	K98	R11
-      0x58300010,  //  02C1  LDCONST	R12	K16
-      0x7C240600,  //  02C2  CALL	R9	3
-      0x88240116,  //  02C3  GETMBR	R9	R0	K22
-      0x8C241363,  //  02C4  GETMET	R9	R9	K99
-      0x5C2C1000,  //  02C5  MOVE	R11	R8
-      0x7C240400,  //  02C6  CALL	R9	2
-      0x50240200,  //  02C7  LDBOOL	R9	1	0
-      0xA0000000,  //  02C8  CLOSE	R0
-      0x80041200,  //  02C9  RET	1	R9
-      0x70020007,  //  02CA  JMP		#02D3
-      0x1C200F0E,  //  02CB  EQ	R8	R7	K14
-      0x78220005,  //  02CC  JMPF	R8	#02D3
-      0x88200116,  //  02CD  GETMBR	R8	R0	K22
-      0x8C201164,  //  02CE  GETMET	R8	R8	K100
-      0x7C200200,  //  02CF  CALL	R8	1
-      0x50200200,  //  02D0  LDBOOL	R8	1	0
-      0xA0000000,  //  02D1  CLOSE	R0
-      0x80041000,  //  02D2  RET	1	R8
-      0x70020012,  //  02D3  JMP		#02E7
-      0x54220029,  //  02D4  LDINT	R8	42
-      0x1C200C08,  //  02D5  EQ	R8	R6	R8
-      0x78220005,  //  02D6  JMPF	R8	#02DD
-      0x1C200F05,  //  02D7  EQ	R8	R7	K5
-      0x78220002,  //  02D8  JMPF	R8	#02DC
-      0x50200200,  //  02D9  LDBOOL	R8	1	0
-      0xA0000000,  //  02DA  CLOSE	R0
-      0x80041000,  //  02DB  RET	1	R8
-      0x70020009,  //  02DC  JMP		#02E7
-      0x60200003,  //  02DD  GETGBL	R8	G3
-      0x5C240000,  //  02DE  MOVE	R9	R0
-      0x7C200200,  //  02DF  CALL	R8	1
-      0x8C201165,  //  02E0  GETMET	R8	R8	K101
-      0x5C280200,  //  02E1  MOVE	R10	R1
-      0x5C2C0400,  //  02E2  MOVE	R11	R2
-      0x5C300600,  //  02E3  MOVE	R12	R3
-      0x7C200800,  //  02E4  CALL	R8	4
+      0x543A0060,  //  0285  LDINT	R14	97
+      0x20341A0E,  //  0286  NE	R13	R13	R14
+      0x7436000B,  //  0287  JMPT	R13	#0294
+      0x6034000C,  //  0288  GETGBL	R13	G12
+      0x5C381800,  //  0289  MOVE	R14	R12
+      0x7C340200,  //  028A  CALL	R13	1
+      0x543A000F,  //  028B  LDINT	R14	16
+      0x14341A0E,  //  028C  LT	R13	R13	R14
+      0x74360005,  //  028D  JMPT	R13	#0294
+      0x6034000C,  //  028E  GETGBL	R13	G12
+      0x5C381800,  //  028F  MOVE	R14	R12
+      0x7C340200,  //  0290  CALL	R13	1
+      0x543A001F,  //  0291  LDINT	R14	32
+      0x24341A0E,  //  0292  GT	R13	R13	R14
+      0x7836000A,  //  0293  JMPF	R13	#029F
+      0xB8364400,  //  0294  GETNGBL	R13	K34
+      0x8C341B2C,  //  0295  GETMET	R13	R13	K44
+      0x583C005F,  //  0296  LDCONST	R15	K95
+      0x5840000E,  //  0297  LDCONST	R16	K14
+      0x7C340600,  //  0298  CALL	R13	3
+      0xB8360200,  //  0299  GETNGBL	R13	K1
+      0x88341B60,  //  029A  GETMBR	R13	R13	K96
+      0x900E340D,  //  029B  SETMBR	R3	K26	R13
+      0x4C340000,  //  029C  LDNIL	R13
+      0xA0000000,  //  029D  CLOSE	R0
+      0x80041A00,  //  029E  RET	1	R13
+      0x5436001E,  //  029F  LDINT	R13	31
+      0x40360A0D,  //  02A0  CONNECT	R13	K5	R13
+      0x9434120D,  //  02A1  GETIDX	R13	R9	R13
+      0x543A001F,  //  02A2  LDINT	R14	32
+      0x40381D40,  //  02A3  CONNECT	R14	R14	K64
+      0x9438120E,  //  02A4  GETIDX	R14	R9	R14
+      0x883C0116,  //  02A5  GETMBR	R15	R0	K22
+      0x8C3C1F61,  //  02A6  GETMET	R15	R15	K97
+      0x5C441000,  //  02A7  MOVE	R17	R8
+      0x5C481600,  //  02A8  MOVE	R18	R11
+      0x5C4C1400,  //  02A9  MOVE	R19	R10
+      0x5C501800,  //  02AA  MOVE	R20	R12
+      0x5C541A00,  //  02AB  MOVE	R21	R13
+      0x5C581C00,  //  02AC  MOVE	R22	R14
+      0x8C5C0354,  //  02AD  GETMET	R23	R1	K84
+      0x7C5C0200,  //  02AE  CALL	R23	1
+      0x7C3C1000,  //  02AF  CALL	R15	8
+      0x503C0200,  //  02B0  LDBOOL	R15	1	0
+      0xA0000000,  //  02B1  CLOSE	R0
+      0x80041E00,  //  02B2  RET	1	R15
+      0x70020030,  //  02B3  JMP		#02E5
+      0x1C200F07,  //  02B4  EQ	R8	R7	K7
+      0x78220012,  //  02B5  JMPF	R8	#02C9
+      0x8C200506,  //  02B6  GETMET	R8	R2	K6
+      0x58280005,  //  02B7  LDCONST	R10	K5
+      0x7C200400,  //  02B8  CALL	R8	2
+      0xB8264400,  //  02B9  GETNGBL	R9	K34
+      0x8C24132C,  //  02BA  GETMET	R9	R9	K44
+      0x602C0008,  //  02BB  GETGBL	R11	G8
+      0x5C301000,  //  02BC  MOVE	R12	R8
+      0x7C2C0200,  //  02BD  CALL	R11	1
+      0x002EC40B,  //  02BE  ADD	R11	K98	R11
+      0x58300010,  //  02BF  LDCONST	R12	K16
+      0x7C240600,  //  02C0  CALL	R9	3
+      0x88240116,  //  02C1  GETMBR	R9	R0	K22
+      0x8C241363,  //  02C2  GETMET	R9	R9	K99
+      0x5C2C1000,  //  02C3  MOVE	R11	R8
+      0x7C240400,  //  02C4  CALL	R9	2
+      0x50240200,  //  02C5  LDBOOL	R9	1	0
+      0xA0000000,  //  02C6  CLOSE	R0
+      0x80041200,  //  02C7  RET	1	R9
+      0x7002001B,  //  02C8  JMP		#02E5
+      0x1C200F0E,  //  02C9  EQ	R8	R7	K14
+      0x78220019,  //  02CA  JMPF	R8	#02E5
+      0x88200116,  //  02CB  GETMBR	R8	R0	K22
+      0x8C201164,  //  02CC  GETMET	R8	R8	K100
+      0x7C200200,  //  02CD  CALL	R8	1
+      0x50200200,  //  02CE  LDBOOL	R8	1	0
+      0xA0000000,  //  02CF  CLOSE	R0
+      0x80041000,  //  02D0  RET	1	R8
+      0x70020012,  //  02D1  JMP		#02E5
+      0x54220029,  //  02D2  LDINT	R8	42
+      0x1C200C08,  //  02D3  EQ	R8	R6	R8
+      0x78220005,  //  02D4  JMPF	R8	#02DB
+      0x1C200F05,  //  02D5  EQ	R8	R7	K5
+      0x7822000D,  //  02D6  JMPF	R8	#02E5
+      0x50200200,  //  02D7  LDBOOL	R8	1	0
+      0xA0000000,  //  02D8  CLOSE	R0
+      0x80041000,  //  02D9  RET	1	R8
+      0x70020009,  //  02DA  JMP		#02E5
+      0x60200003,  //  02DB  GETGBL	R8	G3
+      0x5C240000,  //  02DC  MOVE	R9	R0
+      0x7C200200,  //  02DD  CALL	R8	1
+      0x8C201165,  //  02DE  GETMET	R8	R8	K101
+      0x5C280200,  //  02DF  MOVE	R10	R1
+      0x5C2C0400,  //  02E0  MOVE	R11	R2
+      0x5C300600,  //  02E1  MOVE	R12	R3
+      0x7C200800,  //  02E2  CALL	R8	4
+      0xA0000000,  //  02E3  CLOSE	R0
+      0x80041000,  //  02E4  RET	1	R8
       0xA0000000,  //  02E5  CLOSE	R0
-      0x80041000,  //  02E6  RET	1	R8
-      0xA0000000,  //  02E7  CLOSE	R0
-      0x80000000,  //  02E8  RET	0
+      0x80000000,  //  02E6  RET	0
     })
   )
 );
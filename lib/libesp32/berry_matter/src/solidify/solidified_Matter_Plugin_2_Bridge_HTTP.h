@@ -257,49 +257,48 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_call_remote_sync,   /* name */
     }),
     be_str_weak(call_remote_sync),
     &be_const_str_solidified,
-    ( &(const binstruction[42]) {  /* code */
+    ( &(const binstruction[41]) {  /* code */
       0xA40E0000,  //  0000  IMPORT	R3	K0
       0x58100001,  //  0001  LDCONST	R4	K1
       0x4C140000,  //  0002  LDNIL	R5
       0x20140405,  //  0003  NE	R5	R2	R5
-      0x78160005,  //  0004  JMPF	R5	#000B
+      0x78160004,  //  0004  JMPF	R5	#000A
       0x00140302,  //  0005  ADD	R5	R1	K2
       0x60180008,  //  0006  GETGBL	R6	G8
       0x5C1C0400,  //  0007  MOVE	R7	R2
       0x7C180200,  //  0008  CALL	R6	1
-      0x00140A06,  //  0009  ADD	R5	R5	R6
-      0x5C040A00,  //  000A  MOVE	R1	R5
-      0x24140903,  //  000B  GT	R5	R4	K3
-      0x78160016,  //  000C  JMPF	R5	#0024
-      0x88140104,  //  000D  GETMBR	R5	R0	K4
-      0x8C140B05,  //  000E  GETMET	R5	R5	K5
-      0x5C1C0200,  //  000F  MOVE	R7	R1
-      0x88200106,  //  0010  GETMBR	R8	R0	K6
-      0x7C140600,  //  0011  CALL	R5	3
-      0x4C180000,  //  0012  LDNIL	R6
-      0x20180A06,  //  0013  NE	R6	R5	R6
-      0x781A0007,  //  0014  JMPF	R6	#001D
-      0x88180104,  //  0015  GETMBR	R6	R0	K4
-      0x8C180D07,  //  0016  GETMET	R6	R6	K7
-      0x50200200,  //  0017  LDBOOL	R8	1	0
-      0x7C180400,  //  0018  CALL	R6	2
-      0x8C180708,  //  0019  GETMET	R6	R3	K8
-      0x5C200A00,  //  001A  MOVE	R8	R5
-      0x7C180400,  //  001B  CALL	R6	2
-      0x80040C00,  //  001C  RET	1	R6
-      0x04100909,  //  001D  SUB	R4	R4	K9
-      0xB81A1400,  //  001E  GETNGBL	R6	K10
-      0x8C180D0B,  //  001F  GETMET	R6	R6	K11
-      0x5820000C,  //  0020  LDCONST	R8	K12
-      0x5824000D,  //  0021  LDCONST	R9	K13
-      0x7C180600,  //  0022  CALL	R6	3
-      0x7001FFE6,  //  0023  JMP		#000B
-      0x88140104,  //  0024  GETMBR	R5	R0	K4
-      0x8C140B07,  //  0025  GETMET	R5	R5	K7
-      0x501C0000,  //  0026  LDBOOL	R7	0	0
-      0x7C140400,  //  0027  CALL	R5	2
-      0x4C140000,  //  0028  LDNIL	R5
-      0x80040A00,  //  0029  RET	1	R5
+      0x00040A06,  //  0009  ADD	R1	R5	R6
+      0x24140903,  //  000A  GT	R5	R4	K3
+      0x78160016,  //  000B  JMPF	R5	#0023
+      0x88140104,  //  000C  GETMBR	R5	R0	K4
+      0x8C140B05,  //  000D  GETMET	R5	R5	K5
+      0x5C1C0200,  //  000E  MOVE	R7	R1
+      0x88200106,  //  000F  GETMBR	R8	R0	K6
+      0x7C140600,  //  0010  CALL	R5	3
+      0x4C180000,  //  0011  LDNIL	R6
+      0x20180A06,  //  0012  NE	R6	R5	R6
+      0x781A0007,  //  0013  JMPF	R6	#001C
+      0x88180104,  //  0014  GETMBR	R6	R0	K4
+      0x8C180D07,  //  0015  GETMET	R6	R6	K7
+      0x50200200,  //  0016  LDBOOL	R8	1	0
+      0x7C180400,  //  0017  CALL	R6	2
+      0x8C180708,  //  0018  GETMET	R6	R3	K8
+      0x5C200A00,  //  0019  MOVE	R8	R5
+      0x7C180400,  //  001A  CALL	R6	2
+      0x80040C00,  //  001B  RET	1	R6
+      0x04100909,  //  001C  SUB	R4	R4	K9
+      0xB81A1400,  //  001D  GETNGBL	R6	K10
+      0x8C180D0B,  //  001E  GETMET	R6	R6	K11
+      0x5820000C,  //  001F  LDCONST	R8	K12
+      0x5824000D,  //  0020  LDCONST	R9	K13
+      0x7C180600,  //  0021  CALL	R6	3
+      0x7001FFE6,  //  0022  JMP		#000A
+      0x88140104,  //  0023  GETMBR	R5	R0	K4
+      0x8C140B07,  //  0024  GETMET	R5	R5	K7
+      0x501C0000,  //  0025  LDBOOL	R7	0	0
+      0x7C140400,  //  0026  CALL	R5	2
+      0x4C140000,  //  0027  LDNIL	R5
+      0x80040A00,  //  0028  RET	1	R5
     })
   )
 );
@@ -332,7 +331,7 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_web_value_onoff,   /* name */
       0x780A0004,  //  0002  JMPF	R2	#0008
       0x78060001,  //  0003  JMPF	R1	#0006
       0x58080000,  //  0004  LDCONST	R2	K0
-      0x70020000,  //  0005  JMP		#0007
+      0x70020002,  //  0005  JMP		#0009
       0x58080001,  //  0006  LDCONST	R2	K1
       0x70020000,  //  0007  JMP		#0009
       0x58080002,  //  0008  LDCONST	R2	K2
@@ -435,8 +434,8 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_web_values,   /* name */
     /* K0   */  be_nested_str_weak(webserver),
     /* K1   */  be_nested_str_weak(web_values_prefix),
     /* K2   */  be_nested_str_weak(content_send),
-    /* K3   */  be_nested_str_weak(_X26lt_X3B_X2D_X2D_X20_X28),
-    /* K4   */  be_nested_str_weak(DISPLAY_NAME),
+    /* K3   */  be_nested_str_weak(DISPLAY_NAME),
+    /* K4   */  be_nested_str_weak(_X26lt_X3B_X2D_X2D_X20_X28),
     /* K5   */  be_nested_str_weak(_X29_X20_X2D_X2D_X26gt_X3B),
     }),
     be_str_weak(web_values),
@@ -446,8 +445,8 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_web_values,   /* name */
       0x8C080101,  //  0001  GETMET	R2	R0	K1
       0x7C080200,  //  0002  CALL	R2	1
       0x8C080302,  //  0003  GETMET	R2	R1	K2
-      0x88100104,  //  0004  GETMBR	R4	R0	K4
-      0x00120604,  //  0005  ADD	R4	K3	R4
+      0x88100103,  //  0004  GETMBR	R4	R0	K3
+      0x00120804,  //  0005  ADD	R4	K4	R4
       0x00100905,  //  0006  ADD	R4	R4	K5
       0x7C080400,  //  0007  CALL	R2	2
       0x80000000,  //  0008  RET	0
@@ -627,7 +626,7 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_read_attribute,   /* name */
       0x582C000A,  //  0011  LDCONST	R11	K10
       0x7C200600,  //  0012  CALL	R8	3
       0x80041000,  //  0013  RET	1	R8
-      0x70020004,  //  0014  JMP		#001A
+      0x70020075,  //  0014  JMP		#008B
       0x8C200708,  //  0015  GETMET	R8	R3	K8
       0x88280909,  //  0016  GETMBR	R10	R4	K9
       0x582C000B,  //  0017  LDCONST	R11	K11
@@ -648,7 +647,7 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_read_attribute,   /* name */
       0x5C301000,  //  0026  MOVE	R12	R8
       0x7C240600,  //  0027  CALL	R9	3
       0x80041200,  //  0028  RET	1	R9
-      0x70020004,  //  0029  JMP		#002F
+      0x70020060,  //  0029  JMP		#008B
       0x8C240708,  //  002A  GETMET	R9	R3	K8
       0x882C0911,  //  002B  GETMBR	R11	R4	K17
       0x4C300000,  //  002C  LDNIL	R12
@@ -674,7 +673,7 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_read_attribute,   /* name */
       0x942C1716,  //  0040  GETIDX	R11	R11	K22
       0x7C200600,  //  0041  CALL	R8	3
       0x80041000,  //  0042  RET	1	R8
-      0x70020004,  //  0043  JMP		#0049
+      0x70020046,  //  0043  JMP		#008B
       0x8C200708,  //  0044  GETMET	R8	R3	K8
       0x88280909,  //  0045  GETMBR	R10	R4	K9
       0x582C0017,  //  0046  LDCONST	R11	K23
@@ -705,7 +704,7 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_read_attribute,   /* name */
       0x5C341000,  //  005F  MOVE	R13	R8
       0x7C280600,  //  0060  CALL	R10	3
       0x80041400,  //  0061  RET	1	R10
-      0x70020004,  //  0062  JMP		#0068
+      0x70020027,  //  0062  JMP		#008B
       0x8C240708,  //  0063  GETMET	R9	R3	K8
       0x882C0911,  //  0064  GETMBR	R11	R4	K17
       0x4C300000,  //  0065  LDNIL	R12
@@ -730,7 +729,7 @@ be_local_closure(Matter_Plugin_Bridge_HTTP_read_attribute,   /* name */
       0x5C301000,  //  0078  MOVE	R12	R8
       0x7C240600,  //  0079  CALL	R9	3
       0x80041200,  //  007A  RET	1	R9
-      0x70020004,  //  007B  JMP		#0081
+      0x7002000E,  //  007B  JMP		#008B
       0x8C240708,  //  007C  GETMET	R9	R3	K8
       0x882C0911,  //  007D  GETMBR	R11	R4	K17
       0x4C300000,  //  007E  LDNIL	R12
@@ -108,7 +108,7 @@ be_local_closure(Matter_Plugin_Light1_invoke_request,   /* name */
       0x7C200600,  //  0012  CALL	R8	3
       0x50200200,  //  0013  LDBOOL	R8	1	0
       0x80041000,  //  0014  RET	1	R8
-      0x7002001D,  //  0015  JMP		#0034
+      0x7002008F,  //  0015  JMP		#00A6
       0x1C200F0A,  //  0016  EQ	R8	R7	K10
       0x78220009,  //  0017  JMPF	R8	#0022
       0x8C200107,  //  0018  GETMET	R8	R0	K7
@@ -120,9 +120,9 @@ be_local_closure(Matter_Plugin_Light1_invoke_request,   /* name */
       0x7C200600,  //  001E  CALL	R8	3
       0x50200200,  //  001F  LDBOOL	R8	1	0
       0x80041000,  //  0020  RET	1	R8
-      0x70020011,  //  0021  JMP		#0034
+      0x70020083,  //  0021  JMP		#00A6
       0x1C200F0B,  //  0022  EQ	R8	R7	K11
-      0x7822000F,  //  0023  JMPF	R8	#0034
+      0x78220081,  //  0023  JMPF	R8	#00A6
       0x8C200107,  //  0024  GETMET	R8	R0	K7
       0x8828010C,  //  0025  GETMBR	R10	R0	K12
       0x782A0000,  //  0026  JMPF	R10	#0028
@@ -173,22 +173,22 @@ be_local_closure(Matter_Plugin_Light1_invoke_request,   /* name */
       0x7C240A00,  //  0053  CALL	R9	5
       0x50240200,  //  0054  LDBOOL	R9	1	0
       0x80041200,  //  0055  RET	1	R9
-      0x70020044,  //  0056  JMP		#009C
+      0x7002004E,  //  0056  JMP		#00A6
       0x1C200F0A,  //  0057  EQ	R8	R7	K10
       0x78220002,  //  0058  JMPF	R8	#005C
       0x50200200,  //  0059  LDBOOL	R8	1	0
       0x80041000,  //  005A  RET	1	R8
-      0x7002003F,  //  005B  JMP		#009C
+      0x70020049,  //  005B  JMP		#00A6
       0x1C200F0B,  //  005C  EQ	R8	R7	K11
       0x78220002,  //  005D  JMPF	R8	#0061
       0x50200200,  //  005E  LDBOOL	R8	1	0
       0x80041000,  //  005F  RET	1	R8
-      0x7002003A,  //  0060  JMP		#009C
+      0x70020044,  //  0060  JMP		#00A6
       0x1C200F15,  //  0061  EQ	R8	R7	K21
       0x78220002,  //  0062  JMPF	R8	#0066
       0x50200200,  //  0063  LDBOOL	R8	1	0
       0x80041000,  //  0064  RET	1	R8
-      0x70020035,  //  0065  JMP		#009C
+      0x7002003F,  //  0065  JMP		#00A6
       0x54220003,  //  0066  LDINT	R8	4
       0x1C200E08,  //  0067  EQ	R8	R7	R8
       0x78220021,  //  0068  JMPF	R8	#008B
@@ -225,22 +225,22 @@ be_local_closure(Matter_Plugin_Light1_invoke_request,   /* name */
       0x7C280E00,  //  0087  CALL	R10	7
       0x50280200,  //  0088  LDBOOL	R10	1	0
       0x80041400,  //  0089  RET	1	R10
-      0x70020010,  //  008A  JMP		#009C
+      0x7002001A,  //  008A  JMP		#00A6
       0x54220004,  //  008B  LDINT	R8	5
       0x1C200E08,  //  008C  EQ	R8	R7	R8
       0x78220002,  //  008D  JMPF	R8	#0091
       0x50200200,  //  008E  LDBOOL	R8	1	0
       0x80041000,  //  008F  RET	1	R8
-      0x7002000A,  //  0090  JMP		#009C
+      0x70020014,  //  0090  JMP		#00A6
       0x54220005,  //  0091  LDINT	R8	6
       0x1C200E08,  //  0092  EQ	R8	R7	R8
       0x78220002,  //  0093  JMPF	R8	#0097
       0x50200200,  //  0094  LDBOOL	R8	1	0
       0x80041000,  //  0095  RET	1	R8
-      0x70020004,  //  0096  JMP		#009C
+      0x7002000E,  //  0096  JMP		#00A6
       0x54220006,  //  0097  LDINT	R8	7
       0x1C200E08,  //  0098  EQ	R8	R7	R8
-      0x78220001,  //  0099  JMPF	R8	#009C
+      0x7822000B,  //  0099  JMPF	R8	#00A6
       0x50200200,  //  009A  LDBOOL	R8	1	0
       0x80041000,  //  009B  RET	1	R8
       0x70020008,  //  009C  JMP		#00A6
@@ -503,7 +503,7 @@ be_local_closure(Matter_Plugin_Light1_read_attribute,   /* name */
       0x8C1C0104,  //  0007  GETMET	R7	R0	K4
       0x7C1C0200,  //  0008  CALL	R7	1
       0x1C1C0D05,  //  0009  EQ	R7	R6	K5
-      0x781E0004,  //  000A  JMPF	R7	#0010
+      0x781E0033,  //  000A  JMPF	R7	#003F
       0x8C1C0706,  //  000B  GETMET	R7	R3	K6
       0x88240907,  //  000C  GETMBR	R9	R4	K7
       0x88280108,  //  000D  GETMBR	R10	R0	K8
@@ -49,8 +49,8 @@ be_local_closure(Matter_Plugin_Sensor_OnOff_update_shadow,   /* name */
     ( &(const bvalue[14]) {     /* constants */
     /* K0   */  be_nested_str_weak(update_shadow),
     /* K1   */  be_nested_str_weak(VIRTUAL),
-    /* K2   */  be_nested_str_weak(Switch),
-    /* K3   */  be_nested_str_weak(tasmota_switch_index),
+    /* K2   */  be_nested_str_weak(tasmota_switch_index),
+    /* K3   */  be_nested_str_weak(Switch),
     /* K4   */  be_nested_str_weak(tasmota),
     /* K5   */  be_nested_str_weak(cmd),
     /* K6   */  be_nested_str_weak(Status_X208),
@@ -73,9 +73,9 @@ be_local_closure(Matter_Plugin_Sensor_OnOff_update_shadow,   /* name */
       0x88040101,  //  0005  GETMBR	R1	R0	K1
       0x74060022,  //  0006  JMPT	R1	#002A
       0x60040008,  //  0007  GETGBL	R1	G8
-      0x88080103,  //  0008  GETMBR	R2	R0	K3
+      0x88080102,  //  0008  GETMBR	R2	R0	K2
       0x7C040200,  //  0009  CALL	R1	1
-      0x00060401,  //  000A  ADD	R1	K2	R1
+      0x00060601,  //  000A  ADD	R1	K3	R1
       0xB80A0800,  //  000B  GETNGBL	R2	K4
       0x8C080505,  //  000C  GETMET	R2	R2	K5
       0x58100006,  //  000D  LDCONST	R4	K6
@@ -70,9 +70,9 @@ be_local_closure(Matter_Plugin_Shutter_invoke_request,   /* name */
     /* K6   */  be_const_int(0),
     /* K7   */  be_nested_str_weak(tasmota),
     /* K8   */  be_nested_str_weak(cmd),
-    /* K9   */  be_nested_str_weak(ShutterStopOpen),
-    /* K10  */  be_nested_str_weak(tasmota_shutter_index),
-    /* K11  */  be_const_int(1),
+    /* K9   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K10  */  be_const_int(1),
+    /* K11  */  be_nested_str_weak(ShutterStopOpen),
     /* K12  */  be_nested_str_weak(update_shadow),
     /* K13  */  be_nested_str_weak(ShutterStopClose),
     /* K14  */  be_const_int(2),
@@ -104,24 +104,24 @@ be_local_closure(Matter_Plugin_Shutter_invoke_request,   /* name */
       0xB8220E00,  //  000C  GETNGBL	R8	K7
       0x8C201108,  //  000D  GETMET	R8	R8	K8
       0x60280008,  //  000E  GETGBL	R10	G8
-      0x882C010A,  //  000F  GETMBR	R11	R0	K10
-      0x002C170B,  //  0010  ADD	R11	R11	K11
+      0x882C0109,  //  000F  GETMBR	R11	R0	K9
+      0x002C170A,  //  0010  ADD	R11	R11	K10
       0x7C280200,  //  0011  CALL	R10	1
-      0x002A120A,  //  0012  ADD	R10	K9	R10
+      0x002A160A,  //  0012  ADD	R10	K11	R10
       0x502C0200,  //  0013  LDBOOL	R11	1	0
       0x7C200600,  //  0014  CALL	R8	3
       0x8C20010C,  //  0015  GETMET	R8	R0	K12
       0x7C200200,  //  0016  CALL	R8	1
       0x50200200,  //  0017  LDBOOL	R8	1	0
       0x80041000,  //  0018  RET	1	R8
-      0x7002004E,  //  0019  JMP		#0069
-      0x1C200F0B,  //  001A  EQ	R8	R7	K11
+      0x70020058,  //  0019  JMP		#0073
+      0x1C200F0A,  //  001A  EQ	R8	R7	K10
       0x7822000D,  //  001B  JMPF	R8	#002A
       0xB8220E00,  //  001C  GETNGBL	R8	K7
       0x8C201108,  //  001D  GETMET	R8	R8	K8
       0x60280008,  //  001E  GETGBL	R10	G8
-      0x882C010A,  //  001F  GETMBR	R11	R0	K10
-      0x002C170B,  //  0020  ADD	R11	R11	K11
+      0x882C0109,  //  001F  GETMBR	R11	R0	K9
+      0x002C170A,  //  0020  ADD	R11	R11	K10
       0x7C280200,  //  0021  CALL	R10	1
       0x002A1A0A,  //  0022  ADD	R10	K13	R10
       0x502C0200,  //  0023  LDBOOL	R11	1	0
@@ -130,14 +130,14 @@ be_local_closure(Matter_Plugin_Shutter_invoke_request,   /* name */
       0x7C200200,  //  0026  CALL	R8	1
       0x50200200,  //  0027  LDBOOL	R8	1	0
       0x80041000,  //  0028  RET	1	R8
-      0x7002003E,  //  0029  JMP		#0069
+      0x70020048,  //  0029  JMP		#0073
       0x1C200F0E,  //  002A  EQ	R8	R7	K14
       0x7822000D,  //  002B  JMPF	R8	#003A
       0xB8220E00,  //  002C  GETNGBL	R8	K7
       0x8C201108,  //  002D  GETMET	R8	R8	K8
       0x60280008,  //  002E  GETGBL	R10	G8
-      0x882C010A,  //  002F  GETMBR	R11	R0	K10
-      0x002C170B,  //  0030  ADD	R11	R11	K11
+      0x882C0109,  //  002F  GETMBR	R11	R0	K9
+      0x002C170A,  //  0030  ADD	R11	R11	K10
       0x7C280200,  //  0031  CALL	R10	1
       0x002A1E0A,  //  0032  ADD	R10	K15	R10
       0x502C0200,  //  0033  LDBOOL	R11	1	0
@@ -146,10 +146,10 @@ be_local_closure(Matter_Plugin_Shutter_invoke_request,   /* name */
       0x7C200200,  //  0036  CALL	R8	1
       0x50200200,  //  0037  LDBOOL	R8	1	0
       0x80041000,  //  0038  RET	1	R8
-      0x7002002E,  //  0039  JMP		#0069
+      0x70020038,  //  0039  JMP		#0073
       0x54220004,  //  003A  LDINT	R8	5
       0x1C200E08,  //  003B  EQ	R8	R7	R8
-      0x7822002B,  //  003C  JMPF	R8	#0069
+      0x78220035,  //  003C  JMPF	R8	#0073
       0xB8220E00,  //  003D  GETNGBL	R8	K7
       0x8C201110,  //  003E  GETMET	R8	R8	K16
       0x60280008,  //  003F  GETGBL	R10	G8
@@ -174,8 +174,8 @@ be_local_closure(Matter_Plugin_Shutter_invoke_request,   /* name */
       0xB8260E00,  //  0052  GETNGBL	R9	K7
       0x8C241308,  //  0053  GETMET	R9	R9	K8
       0x602C0008,  //  0054  GETGBL	R11	G8
-      0x8830010A,  //  0055  GETMBR	R12	R0	K10
-      0x0030190B,  //  0056  ADD	R12	R12	K11
+      0x88300109,  //  0055  GETMBR	R12	R0	K9
+      0x0030190A,  //  0056  ADD	R12	R12	K10
       0x7C2C0200,  //  0057  CALL	R11	1
       0x002E280B,  //  0058  ADD	R11	K20	R11
       0x002C1715,  //  0059  ADD	R11	R11	K21
@@ -235,17 +235,17 @@ be_local_closure(Matter_Plugin_Shutter_read_attribute,   /* name */
     /* K7   */  be_nested_str_weak(set),
     /* K8   */  be_nested_str_weak(U1),
     /* K9   */  be_nested_str_weak(U2),
-    /* K10  */  be_const_int(1),
-    /* K11  */  be_nested_str_weak(shadow_shutter_inverted),
-    /* K12  */  be_nested_str_weak(shadow_shutter_pos),
-    /* K13  */  be_nested_str_weak(shadow_shutter_direction),
+    /* K10  */  be_nested_str_weak(shadow_shutter_inverted),
+    /* K11  */  be_nested_str_weak(shadow_shutter_pos),
+    /* K12  */  be_nested_str_weak(shadow_shutter_direction),
+    /* K13  */  be_const_int(1),
     /* K14  */  be_const_int(2),
     /* K15  */  be_nested_str_weak(shadow_shutter_target),
     /* K16  */  be_nested_str_weak(read_attribute),
     }),
     be_str_weak(read_attribute),
     &be_const_str_solidified,
-    ( &(const binstruction[131]) {  /* code */
+    ( &(const binstruction[126]) {  /* code */
       0xB8120000,  //  0000  GETNGBL	R4	K0
       0x88100901,  //  0001  GETMBR	R4	R4	K1
       0x88140502,  //  0002  GETMBR	R5	R2	K2
@@ -253,7 +253,7 @@ be_local_closure(Matter_Plugin_Shutter_read_attribute,   /* name */
       0x4C1C0000,  //  0004  LDNIL	R7
       0x54220101,  //  0005  LDINT	R8	258
       0x1C200A08,  //  0006  EQ	R8	R5	R8
-      0x78220071,  //  0007  JMPF	R8	#007A
+      0x7822006C,  //  0007  JMPF	R8	#0075
       0x8C200104,  //  0008  GETMET	R8	R0	K4
       0x7C200200,  //  0009  CALL	R8	1
       0x8C200105,  //  000A  GETMET	R8	R0	K5
@@ -265,7 +265,7 @@ be_local_closure(Matter_Plugin_Shutter_read_attribute,   /* name */
       0x542E00FE,  //  0010  LDINT	R11	255
       0x7C200600,  //  0011  CALL	R8	3
       0x80041000,  //  0012  RET	1	R8
-      0x70020065,  //  0013  JMP		#007A
+      0x70020060,  //  0013  JMP		#0075
       0x54220004,  //  0014  LDINT	R8	5
       0x1C200C08,  //  0015  EQ	R8	R6	R8
       0x78220005,  //  0016  JMPF	R8	#001D
@@ -274,109 +274,104 @@ be_local_closure(Matter_Plugin_Shutter_read_attribute,   /* name */
       0x582C0006,  //  0019  LDCONST	R11	K6
       0x7C200600,  //  001A  CALL	R8	3
       0x80041000,  //  001B  RET	1	R8
-      0x7002005C,  //  001C  JMP		#007A
+      0x70020057,  //  001C  JMP		#0075
       0x54220006,  //  001D  LDINT	R8	7
       0x1C200C08,  //  001E  EQ	R8	R6	R8
-      0x78220006,  //  001F  JMPF	R8	#0027
+      0x78220005,  //  001F  JMPF	R8	#0026
       0x8C200707,  //  0020  GETMET	R8	R3	K7
       0x88280908,  //  0021  GETMBR	R10	R4	K8
-      0x542E0007,  //  0022  LDINT	R11	8
-      0x002E140B,  //  0023  ADD	R11	K10	R11
-      0x7C200600,  //  0024  CALL	R8	3
-      0x80041000,  //  0025  RET	1	R8
-      0x70020052,  //  0026  JMP		#007A
-      0x5422000C,  //  0027  LDINT	R8	13
-      0x1C200C08,  //  0028  EQ	R8	R6	R8
-      0x78220005,  //  0029  JMPF	R8	#0030
-      0x8C200707,  //  002A  GETMET	R8	R3	K7
-      0x88280908,  //  002B  GETMBR	R10	R4	K8
-      0x542E00FE,  //  002C  LDINT	R11	255
-      0x7C200600,  //  002D  CALL	R8	3
-      0x80041000,  //  002E  RET	1	R8
-      0x70020049,  //  002F  JMP		#007A
-      0x5422000D,  //  0030  LDINT	R8	14
-      0x1C200C08,  //  0031  EQ	R8	R6	R8
-      0x78220013,  //  0032  JMPF	R8	#0047
-      0x8820010B,  //  0033  GETMBR	R8	R0	K11
-      0x1C201106,  //  0034  EQ	R8	R8	K6
-      0x78220006,  //  0035  JMPF	R8	#003D
-      0x54220063,  //  0036  LDINT	R8	100
-      0x8824010C,  //  0037  GETMBR	R9	R0	K12
-      0x04201009,  //  0038  SUB	R8	R8	R9
-      0x54260063,  //  0039  LDINT	R9	100
-      0x08201009,  //  003A  MUL	R8	R8	R9
-      0x5C1C1000,  //  003B  MOVE	R7	R8
-      0x70020003,  //  003C  JMP		#0041
-      0x8820010C,  //  003D  GETMBR	R8	R0	K12
-      0x54260063,  //  003E  LDINT	R9	100
-      0x08201009,  //  003F  MUL	R8	R8	R9
-      0x5C1C1000,  //  0040  MOVE	R7	R8
-      0x8C200707,  //  0041  GETMET	R8	R3	K7
-      0x88280909,  //  0042  GETMBR	R10	R4	K9
-      0x5C2C0E00,  //  0043  MOVE	R11	R7
-      0x7C200600,  //  0044  CALL	R8	3
-      0x80041000,  //  0045  RET	1	R8
-      0x70020032,  //  0046  JMP		#007A
-      0x54220009,  //  0047  LDINT	R8	10
-      0x1C200C08,  //  0048  EQ	R8	R6	R8
-      0x78220010,  //  0049  JMPF	R8	#005B
-      0x8820010D,  //  004A  GETMBR	R8	R0	K13
-      0x1C201106,  //  004B  EQ	R8	R8	K6
-      0x78220001,  //  004C  JMPF	R8	#004F
-      0x58200006,  //  004D  LDCONST	R8	K6
-      0x70020005,  //  004E  JMP		#0055
-      0x8820010D,  //  004F  GETMBR	R8	R0	K13
-      0x24201106,  //  0050  GT	R8	R8	K6
-      0x78220001,  //  0051  JMPF	R8	#0054
-      0x5820000A,  //  0052  LDCONST	R8	K10
-      0x70020000,  //  0053  JMP		#0055
-      0x5820000E,  //  0054  LDCONST	R8	K14
-      0x8C240707,  //  0055  GETMET	R9	R3	K7
-      0x882C0908,  //  0056  GETMBR	R11	R4	K8
-      0x5C301000,  //  0057  MOVE	R12	R8
-      0x7C240600,  //  0058  CALL	R9	3
-      0x80041200,  //  0059  RET	1	R9
-      0x7002001E,  //  005A  JMP		#007A
-      0x5422000A,  //  005B  LDINT	R8	11
-      0x1C200C08,  //  005C  EQ	R8	R6	R8
-      0x78220013,  //  005D  JMPF	R8	#0072
-      0x8820010B,  //  005E  GETMBR	R8	R0	K11
-      0x1C201106,  //  005F  EQ	R8	R8	K6
-      0x78220006,  //  0060  JMPF	R8	#0068
-      0x54220063,  //  0061  LDINT	R8	100
-      0x8824010F,  //  0062  GETMBR	R9	R0	K15
-      0x04201009,  //  0063  SUB	R8	R8	R9
-      0x54260063,  //  0064  LDINT	R9	100
-      0x08201009,  //  0065  MUL	R8	R8	R9
-      0x5C1C1000,  //  0066  MOVE	R7	R8
-      0x70020003,  //  0067  JMP		#006C
-      0x8820010F,  //  0068  GETMBR	R8	R0	K15
-      0x54260063,  //  0069  LDINT	R9	100
-      0x08201009,  //  006A  MUL	R8	R8	R9
-      0x5C1C1000,  //  006B  MOVE	R7	R8
-      0x8C200707,  //  006C  GETMET	R8	R3	K7
-      0x88280909,  //  006D  GETMBR	R10	R4	K9
-      0x5C2C0E00,  //  006E  MOVE	R11	R7
-      0x7C200600,  //  006F  CALL	R8	3
-      0x80041000,  //  0070  RET	1	R8
-      0x70020007,  //  0071  JMP		#007A
-      0x54220016,  //  0072  LDINT	R8	23
-      0x1C200C08,  //  0073  EQ	R8	R6	R8
-      0x78220004,  //  0074  JMPF	R8	#007A
-      0x8C200707,  //  0075  GETMET	R8	R3	K7
-      0x88280908,  //  0076  GETMBR	R10	R4	K8
-      0x582C0006,  //  0077  LDCONST	R11	K6
-      0x7C200600,  //  0078  CALL	R8	3
-      0x80041000,  //  0079  RET	1	R8
-      0x60200003,  //  007A  GETGBL	R8	G3
-      0x5C240000,  //  007B  MOVE	R9	R0
-      0x7C200200,  //  007C  CALL	R8	1
-      0x8C201110,  //  007D  GETMET	R8	R8	K16
-      0x5C280200,  //  007E  MOVE	R10	R1
-      0x5C2C0400,  //  007F  MOVE	R11	R2
-      0x5C300600,  //  0080  MOVE	R12	R3
-      0x7C200800,  //  0081  CALL	R8	4
-      0x80041000,  //  0082  RET	1	R8
+      0x542E0008,  //  0022  LDINT	R11	9
+      0x7C200600,  //  0023  CALL	R8	3
+      0x80041000,  //  0024  RET	1	R8
+      0x7002004E,  //  0025  JMP		#0075
+      0x5422000C,  //  0026  LDINT	R8	13
+      0x1C200C08,  //  0027  EQ	R8	R6	R8
+      0x78220005,  //  0028  JMPF	R8	#002F
+      0x8C200707,  //  0029  GETMET	R8	R3	K7
+      0x88280908,  //  002A  GETMBR	R10	R4	K8
+      0x542E00FE,  //  002B  LDINT	R11	255
+      0x7C200600,  //  002C  CALL	R8	3
+      0x80041000,  //  002D  RET	1	R8
+      0x70020045,  //  002E  JMP		#0075
+      0x5422000D,  //  002F  LDINT	R8	14
+      0x1C200C08,  //  0030  EQ	R8	R6	R8
+      0x78220011,  //  0031  JMPF	R8	#0044
+      0x8820010A,  //  0032  GETMBR	R8	R0	K10
+      0x1C201106,  //  0033  EQ	R8	R8	K6
+      0x78220005,  //  0034  JMPF	R8	#003B
+      0x8820010B,  //  0035  GETMBR	R8	R0	K11
+      0x54260063,  //  0036  LDINT	R9	100
+      0x04201208,  //  0037  SUB	R8	R9	R8
+      0x54260063,  //  0038  LDINT	R9	100
+      0x081C1009,  //  0039  MUL	R7	R8	R9
+      0x70020002,  //  003A  JMP		#003E
+      0x8820010B,  //  003B  GETMBR	R8	R0	K11
+      0x54260063,  //  003C  LDINT	R9	100
+      0x081C1009,  //  003D  MUL	R7	R8	R9
+      0x8C200707,  //  003E  GETMET	R8	R3	K7
+      0x88280909,  //  003F  GETMBR	R10	R4	K9
+      0x5C2C0E00,  //  0040  MOVE	R11	R7
+      0x7C200600,  //  0041  CALL	R8	3
+      0x80041000,  //  0042  RET	1	R8
+      0x70020030,  //  0043  JMP		#0075
+      0x54220009,  //  0044  LDINT	R8	10
+      0x1C200C08,  //  0045  EQ	R8	R6	R8
+      0x78220010,  //  0046  JMPF	R8	#0058
+      0x8820010C,  //  0047  GETMBR	R8	R0	K12
+      0x1C201106,  //  0048  EQ	R8	R8	K6
+      0x78220001,  //  0049  JMPF	R8	#004C
+      0x58200006,  //  004A  LDCONST	R8	K6
+      0x70020005,  //  004B  JMP		#0052
+      0x8820010C,  //  004C  GETMBR	R8	R0	K12
+      0x24201106,  //  004D  GT	R8	R8	K6
+      0x78220001,  //  004E  JMPF	R8	#0051
+      0x5820000D,  //  004F  LDCONST	R8	K13
+      0x70020000,  //  0050  JMP		#0052
+      0x5820000E,  //  0051  LDCONST	R8	K14
+      0x8C240707,  //  0052  GETMET	R9	R3	K7
+      0x882C0908,  //  0053  GETMBR	R11	R4	K8
+      0x5C301000,  //  0054  MOVE	R12	R8
+      0x7C240600,  //  0055  CALL	R9	3
+      0x80041200,  //  0056  RET	1	R9
+      0x7002001C,  //  0057  JMP		#0075
+      0x5422000A,  //  0058  LDINT	R8	11
+      0x1C200C08,  //  0059  EQ	R8	R6	R8
+      0x78220011,  //  005A  JMPF	R8	#006D
+      0x8820010A,  //  005B  GETMBR	R8	R0	K10
+      0x1C201106,  //  005C  EQ	R8	R8	K6
+      0x78220005,  //  005D  JMPF	R8	#0064
+      0x8820010F,  //  005E  GETMBR	R8	R0	K15
+      0x54260063,  //  005F  LDINT	R9	100
+      0x04201208,  //  0060  SUB	R8	R9	R8
+      0x54260063,  //  0061  LDINT	R9	100
+      0x081C1009,  //  0062  MUL	R7	R8	R9
+      0x70020002,  //  0063  JMP		#0067
+      0x8820010F,  //  0064  GETMBR	R8	R0	K15
+      0x54260063,  //  0065  LDINT	R9	100
+      0x081C1009,  //  0066  MUL	R7	R8	R9
+      0x8C200707,  //  0067  GETMET	R8	R3	K7
+      0x88280909,  //  0068  GETMBR	R10	R4	K9
+      0x5C2C0E00,  //  0069  MOVE	R11	R7
+      0x7C200600,  //  006A  CALL	R8	3
+      0x80041000,  //  006B  RET	1	R8
+      0x70020007,  //  006C  JMP		#0075
+      0x54220016,  //  006D  LDINT	R8	23
+      0x1C200C08,  //  006E  EQ	R8	R6	R8
+      0x78220004,  //  006F  JMPF	R8	#0075
+      0x8C200707,  //  0070  GETMET	R8	R3	K7
+      0x88280908,  //  0071  GETMBR	R10	R4	K8
+      0x582C0006,  //  0072  LDCONST	R11	K6
+      0x7C200600,  //  0073  CALL	R8	3
+      0x80041000,  //  0074  RET	1	R8
+      0x60200003,  //  0075  GETGBL	R8	G3
+      0x5C240000,  //  0076  MOVE	R9	R0
+      0x7C200200,  //  0077  CALL	R8	1
+      0x8C201110,  //  0078  GETMET	R8	R8	K16
+      0x5C280200,  //  0079  MOVE	R10	R1
+      0x5C2C0400,  //  007A  MOVE	R11	R2
+      0x5C300600,  //  007B  MOVE	R12	R3
+      0x7C200800,  //  007C  CALL	R8	4
+      0x80041000,  //  007D  RET	1	R8
     })
   )
 );
@@ -424,9 +419,9 @@ be_local_closure(Matter_Plugin_Shutter_parse_sensors,   /* name */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
     ( &(const bvalue[12]) {     /* constants */
-    /* K0   */  be_nested_str_weak(Shutter),
-    /* K1   */  be_nested_str_weak(tasmota_shutter_index),
-    /* K2   */  be_const_int(1),
+    /* K0   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K1   */  be_const_int(1),
+    /* K2   */  be_nested_str_weak(Shutter),
     /* K3   */  be_nested_str_weak(contains),
     /* K4   */  be_nested_str_weak(find),
     /* K5   */  be_nested_str_weak(Position),
@@ -441,10 +436,10 @@ be_local_closure(Matter_Plugin_Shutter_parse_sensors,   /* name */
     &be_const_str_solidified,
     ( &(const binstruction[53]) {  /* code */
       0x60080008,  //  0000  GETGBL	R2	G8
-      0x880C0101,  //  0001  GETMBR	R3	R0	K1
-      0x000C0702,  //  0002  ADD	R3	R3	K2
+      0x880C0100,  //  0001  GETMBR	R3	R0	K0
+      0x000C0701,  //  0002  ADD	R3	R3	K1
       0x7C080200,  //  0003  CALL	R2	1
-      0x000A0002,  //  0004  ADD	R2	K0	R2
+      0x000A0402,  //  0004  ADD	R2	K2	R2
       0x8C0C0303,  //  0005  GETMET	R3	R1	K3
       0x5C140400,  //  0006  MOVE	R5	R2
       0x7C0C0400,  //  0007  CALL	R3	2
@@ -520,8 +515,8 @@ be_local_closure(Matter_Plugin_Shutter_update_inverted,   /* name */
     /* K4   */  be_nested_str_weak(contains),
     /* K5   */  be_nested_str_weak(StatusSHT),
     /* K6   */  be_nested_str_weak(find),
-    /* K7   */  be_nested_str_weak(SHT),
-    /* K8   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K7   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K8   */  be_nested_str_weak(SHT),
     /* K9   */  be_nested_str_weak(Opt),
     /* K10  */  be_const_int(1),
     }),
@@ -544,9 +539,9 @@ be_local_closure(Matter_Plugin_Shutter_update_inverted,   /* name */
       0x94040305,  //  000D  GETIDX	R1	R1	K5
       0x8C080306,  //  000E  GETMET	R2	R1	K6
       0x60100008,  //  000F  GETGBL	R4	G8
-      0x88140108,  //  0010  GETMBR	R5	R0	K8
+      0x88140107,  //  0010  GETMBR	R5	R0	K7
       0x7C100200,  //  0011  CALL	R4	1
-      0x00120E04,  //  0012  ADD	R4	K7	R4
+      0x00121004,  //  0012  ADD	R4	K8	R4
       0x60140013,  //  0013  GETGBL	R5	G19
       0x7C140000,  //  0014  CALL	R5	0
       0x7C080600,  //  0015  CALL	R2	3
@@ -589,9 +584,9 @@ be_local_closure(Matter_Plugin_Shutter_update_shadow,   /* name */
     /* K1   */  be_nested_str_weak(update_inverted),
     /* K2   */  be_nested_str_weak(tasmota),
     /* K3   */  be_nested_str_weak(cmd),
-    /* K4   */  be_nested_str_weak(ShutterPosition),
-    /* K5   */  be_nested_str_weak(tasmota_shutter_index),
-    /* K6   */  be_const_int(1),
+    /* K4   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K5   */  be_const_int(1),
+    /* K6   */  be_nested_str_weak(ShutterPosition),
     /* K7   */  be_nested_str_weak(parse_sensors),
     /* K8   */  be_nested_str_weak(update_shadow),
     }),
@@ -605,10 +600,10 @@ be_local_closure(Matter_Plugin_Shutter_update_shadow,   /* name */
       0xB8060400,  //  0004  GETNGBL	R1	K2
       0x8C040303,  //  0005  GETMET	R1	R1	K3
       0x600C0008,  //  0006  GETGBL	R3	G8
-      0x88100105,  //  0007  GETMBR	R4	R0	K5
-      0x00100906,  //  0008  ADD	R4	R4	K6
+      0x88100104,  //  0007  GETMBR	R4	R0	K4
+      0x00100905,  //  0008  ADD	R4	R4	K5
       0x7C0C0200,  //  0009  CALL	R3	1
-      0x000E0803,  //  000A  ADD	R3	K4	R3
+      0x000E0C03,  //  000A  ADD	R3	K6	R3
       0x50100200,  //  000B  LDBOOL	R4	1	0
       0x7C040600,  //  000C  CALL	R1	3
       0x78060002,  //  000D  JMPF	R1	#0011
@@ -21,8 +21,8 @@ be_local_closure(Matter_Plugin_Bridge_Light0_set_onoff,   /* name */
     1,                          /* has constants */
     ( &(const bvalue[ 6]) {     /* constants */
     /* K0   */  be_nested_str_weak(call_remote_sync),
-    /* K1   */  be_nested_str_weak(Power),
-    /* K2   */  be_nested_str_weak(tasmota_relay_index),
+    /* K1   */  be_nested_str_weak(tasmota_relay_index),
+    /* K2   */  be_nested_str_weak(Power),
     /* K3   */  be_nested_str_weak(1),
     /* K4   */  be_nested_str_weak(0),
     /* K5   */  be_nested_str_weak(parse_update),
@@ -32,9 +32,9 @@ be_local_closure(Matter_Plugin_Bridge_Light0_set_onoff,   /* name */
     ( &(const binstruction[18]) {  /* code */
       0x8C080100,  //  0000  GETMET	R2	R0	K0
       0x60100008,  //  0001  GETGBL	R4	G8
-      0x88140102,  //  0002  GETMBR	R5	R0	K2
+      0x88140101,  //  0002  GETMBR	R5	R0	K1
       0x7C100200,  //  0003  CALL	R4	1
-      0x00120204,  //  0004  ADD	R4	K1	R4
+      0x00120404,  //  0004  ADD	R4	K2	R4
       0x78060001,  //  0005  JMPF	R1	#0008
       0x58140003,  //  0006  LDCONST	R5	K3
       0x70020000,  //  0007  JMP		#0009
@@ -219,48 +219,46 @@ be_local_closure(Matter_Plugin_Bridge_Light0_parse_update,   /* name */
     }),
     be_str_weak(parse_update),
     &be_const_str_solidified,
-    ( &(const binstruction[41]) {  /* code */
+    ( &(const binstruction[39]) {  /* code */
       0x540E000A,  //  0000  LDINT	R3	11
       0x1C0C0403,  //  0001  EQ	R3	R2	R3
-      0x780E0024,  //  0002  JMPF	R3	#0028
+      0x780E0022,  //  0002  JMPF	R3	#0026
       0x500C0000,  //  0003  LDBOOL	R3	0	0
       0x88100100,  //  0004  GETMBR	R4	R0	K0
       0x1C100901,  //  0005  EQ	R4	R4	K1
-      0x78120009,  //  0006  JMPF	R4	#0011
+      0x78120008,  //  0006  JMPF	R4	#0010
       0x8C100302,  //  0007  GETMET	R4	R1	K2
       0x58180003,  //  0008  LDCONST	R6	K3
       0x7C100400,  //  0009  CALL	R4	2
-      0x78120005,  //  000A  JMPF	R4	#0011
+      0x78120004,  //  000A  JMPF	R4	#0010
       0x8C100304,  //  000B  GETMET	R4	R1	K4
       0x58180003,  //  000C  LDCONST	R6	K3
       0x7C100400,  //  000D  CALL	R4	2
-      0x1C100905,  //  000E  EQ	R4	R4	K5
-      0x5C0C0800,  //  000F  MOVE	R3	R4
-      0x70020007,  //  0010  JMP		#0019
-      0x8C100304,  //  0011  GETMET	R4	R1	K4
-      0x60180008,  //  0012  GETGBL	R6	G8
-      0x881C0100,  //  0013  GETMBR	R7	R0	K0
-      0x7C180200,  //  0014  CALL	R6	1
-      0x001A0606,  //  0015  ADD	R6	K3	R6
-      0x7C100400,  //  0016  CALL	R4	2
-      0x1C100905,  //  0017  EQ	R4	R4	K5
-      0x5C0C0800,  //  0018  MOVE	R3	R4
-      0x88100106,  //  0019  GETMBR	R4	R0	K6
-      0x4C140000,  //  001A  LDNIL	R5
-      0x20100805,  //  001B  NE	R4	R4	R5
-      0x78120009,  //  001C  JMPF	R4	#0027
-      0x88100106,  //  001D  GETMBR	R4	R0	K6
-      0x60140017,  //  001E  GETGBL	R5	G23
-      0x5C180600,  //  001F  MOVE	R6	R3
-      0x7C140200,  //  0020  CALL	R5	1
-      0x20100805,  //  0021  NE	R4	R4	R5
-      0x78120003,  //  0022  JMPF	R4	#0027
-      0x8C100107,  //  0023  GETMET	R4	R0	K7
-      0x541A0005,  //  0024  LDINT	R6	6
-      0x581C0008,  //  0025  LDCONST	R7	K8
-      0x7C100600,  //  0026  CALL	R4	3
-      0x90020C03,  //  0027  SETMBR	R0	K6	R3
-      0x80000000,  //  0028  RET	0
+      0x1C0C0905,  //  000E  EQ	R3	R4	K5
+      0x70020006,  //  000F  JMP		#0017
+      0x8C100304,  //  0010  GETMET	R4	R1	K4
+      0x60180008,  //  0011  GETGBL	R6	G8
+      0x881C0100,  //  0012  GETMBR	R7	R0	K0
+      0x7C180200,  //  0013  CALL	R6	1
+      0x001A0606,  //  0014  ADD	R6	K3	R6
+      0x7C100400,  //  0015  CALL	R4	2
+      0x1C0C0905,  //  0016  EQ	R3	R4	K5
+      0x88100106,  //  0017  GETMBR	R4	R0	K6
+      0x4C140000,  //  0018  LDNIL	R5
+      0x20100805,  //  0019  NE	R4	R4	R5
+      0x78120009,  //  001A  JMPF	R4	#0025
+      0x88100106,  //  001B  GETMBR	R4	R0	K6
+      0x60140017,  //  001C  GETGBL	R5	G23
+      0x5C180600,  //  001D  MOVE	R6	R3
+      0x7C140200,  //  001E  CALL	R5	1
+      0x20100805,  //  001F  NE	R4	R4	R5
+      0x78120003,  //  0020  JMPF	R4	#0025
+      0x8C100107,  //  0021  GETMET	R4	R0	K7
+      0x541A0005,  //  0022  LDINT	R6	6
+      0x581C0008,  //  0023  LDCONST	R7	K8
+      0x7C100600,  //  0024  CALL	R4	3
+      0x90020C03,  //  0025  SETMBR	R0	K6	R3
+      0x80000000,  //  0026  RET	0
     })
   )
 );
@@ -410,8 +408,8 @@ be_local_closure(Matter_Plugin_Bridge_Light0_web_values_prefix,   /* name */
     ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_str_weak(webserver),
     /* K1   */  be_nested_str_weak(get_name),
-    /* K2   */  be_nested_str_weak(Power),
-    /* K3   */  be_nested_str_weak(tasmota_relay_index),
+    /* K2   */  be_nested_str_weak(tasmota_relay_index),
+    /* K3   */  be_nested_str_weak(Power),
     /* K4   */  be_nested_str_weak(content_send),
     /* K5   */  be_nested_str_weak(PREFIX),
     /* K6   */  be_nested_str_weak(html_escape),
@@ -419,29 +417,28 @@ be_local_closure(Matter_Plugin_Bridge_Light0_web_values_prefix,   /* name */
     }),
     be_str_weak(web_values_prefix),
     &be_const_str_solidified,
-    ( &(const binstruction[22]) {  /* code */
+    ( &(const binstruction[21]) {  /* code */
       0xA4060000,  //  0000  IMPORT	R1	K0
       0x8C080101,  //  0001  GETMET	R2	R0	K1
       0x7C080200,  //  0002  CALL	R2	1
       0x5C0C0400,  //  0003  MOVE	R3	R2
-      0x740E0004,  //  0004  JMPT	R3	#000A
+      0x740E0003,  //  0004  JMPT	R3	#0009
       0x600C0008,  //  0005  GETGBL	R3	G8
-      0x88100103,  //  0006  GETMBR	R4	R0	K3
+      0x88100102,  //  0006  GETMBR	R4	R0	K2
       0x7C0C0200,  //  0007  CALL	R3	1
-      0x000E0403,  //  0008  ADD	R3	K2	R3
-      0x5C080600,  //  0009  MOVE	R2	R3
-      0x8C0C0304,  //  000A  GETMET	R3	R1	K4
-      0x60140018,  //  000B  GETGBL	R5	G24
-      0x88180105,  //  000C  GETMBR	R6	R0	K5
-      0x780A0003,  //  000D  JMPF	R2	#0012
-      0x8C1C0306,  //  000E  GETMET	R7	R1	K6
-      0x5C240400,  //  000F  MOVE	R9	R2
-      0x7C1C0400,  //  0010  CALL	R7	2
-      0x70020000,  //  0011  JMP		#0013
-      0x581C0007,  //  0012  LDCONST	R7	K7
-      0x7C140400,  //  0013  CALL	R5	2
-      0x7C0C0400,  //  0014  CALL	R3	2
-      0x80000000,  //  0015  RET	0
+      0x000A0603,  //  0008  ADD	R2	K3	R3
+      0x8C0C0304,  //  0009  GETMET	R3	R1	K4
+      0x60140018,  //  000A  GETGBL	R5	G24
+      0x88180105,  //  000B  GETMBR	R6	R0	K5
+      0x780A0003,  //  000C  JMPF	R2	#0011
+      0x8C1C0306,  //  000D  GETMET	R7	R1	K6
+      0x5C240400,  //  000E  MOVE	R9	R2
+      0x7C1C0400,  //  000F  CALL	R7	2
+      0x70020000,  //  0010  JMP		#0012
+      0x581C0007,  //  0011  LDCONST	R7	K7
+      0x7C140400,  //  0012  CALL	R5	2
+      0x7C0C0400,  //  0013  CALL	R3	2
+      0x80000000,  //  0014  RET	0
     })
   )
 );
@@ -99,8 +99,8 @@ be_local_closure(Matter_Plugin_Bridge_Sensor_Contact_web_values_prefix,   /* nam
     ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_str_weak(webserver),
     /* K1   */  be_nested_str_weak(get_name),
-    /* K2   */  be_nested_str_weak(Switch),
-    /* K3   */  be_nested_str_weak(tasmota_switch_index),
+    /* K2   */  be_nested_str_weak(tasmota_switch_index),
+    /* K3   */  be_nested_str_weak(Switch),
     /* K4   */  be_nested_str_weak(content_send),
     /* K5   */  be_nested_str_weak(PREFIX),
     /* K6   */  be_nested_str_weak(html_escape),
@@ -108,29 +108,28 @@ be_local_closure(Matter_Plugin_Bridge_Sensor_Contact_web_values_prefix,   /* nam
     }),
     be_str_weak(web_values_prefix),
     &be_const_str_solidified,
-    ( &(const binstruction[22]) {  /* code */
+    ( &(const binstruction[21]) {  /* code */
       0xA4060000,  //  0000  IMPORT	R1	K0
       0x8C080101,  //  0001  GETMET	R2	R0	K1
       0x7C080200,  //  0002  CALL	R2	1
       0x5C0C0400,  //  0003  MOVE	R3	R2
-      0x740E0004,  //  0004  JMPT	R3	#000A
+      0x740E0003,  //  0004  JMPT	R3	#0009
       0x600C0008,  //  0005  GETGBL	R3	G8
-      0x88100103,  //  0006  GETMBR	R4	R0	K3
+      0x88100102,  //  0006  GETMBR	R4	R0	K2
       0x7C0C0200,  //  0007  CALL	R3	1
-      0x000E0403,  //  0008  ADD	R3	K2	R3
-      0x5C080600,  //  0009  MOVE	R2	R3
-      0x8C0C0304,  //  000A  GETMET	R3	R1	K4
-      0x60140018,  //  000B  GETGBL	R5	G24
-      0x88180105,  //  000C  GETMBR	R6	R0	K5
-      0x780A0003,  //  000D  JMPF	R2	#0012
-      0x8C1C0306,  //  000E  GETMET	R7	R1	K6
-      0x5C240400,  //  000F  MOVE	R9	R2
-      0x7C1C0400,  //  0010  CALL	R7	2
-      0x70020000,  //  0011  JMP		#0013
-      0x581C0007,  //  0012  LDCONST	R7	K7
-      0x7C140400,  //  0013  CALL	R5	2
-      0x7C0C0400,  //  0014  CALL	R3	2
-      0x80000000,  //  0015  RET	0
+      0x000A0603,  //  0008  ADD	R2	K3	R3
+      0x8C0C0304,  //  0009  GETMET	R3	R1	K4
+      0x60140018,  //  000A  GETGBL	R5	G24
+      0x88180105,  //  000B  GETMBR	R6	R0	K5
+      0x780A0003,  //  000C  JMPF	R2	#0011
+      0x8C1C0306,  //  000D  GETMET	R7	R1	K6
+      0x5C240400,  //  000E  MOVE	R9	R2
+      0x7C1C0400,  //  000F  CALL	R7	2
+      0x70020000,  //  0010  JMP		#0012
+      0x581C0007,  //  0011  LDCONST	R7	K7
+      0x7C140400,  //  0012  CALL	R5	2
+      0x7C0C0400,  //  0013  CALL	R3	2
+      0x80000000,  //  0014  RET	0
     })
   )
 );
@@ -152,8 +151,8 @@ be_local_closure(Matter_Plugin_Bridge_Sensor_Contact_parse_update,   /* name */
     1,                          /* has constants */
     ( &(const bvalue[ 7]) {     /* constants */
     /* K0   */  be_nested_str_weak(find),
-    /* K1   */  be_nested_str_weak(Switch),
-    /* K2   */  be_nested_str_weak(tasmota_switch_index),
+    /* K1   */  be_nested_str_weak(tasmota_switch_index),
+    /* K2   */  be_nested_str_weak(Switch),
     /* K3   */  be_nested_str_weak(ON),
     /* K4   */  be_nested_str_weak(shadow_contact),
     /* K5   */  be_nested_str_weak(attribute_updated),
@@ -161,35 +160,34 @@ be_local_closure(Matter_Plugin_Bridge_Sensor_Contact_parse_update,   /* name */
     }),
     be_str_weak(parse_update),
     &be_const_str_solidified,
-    ( &(const binstruction[28]) {  /* code */
+    ( &(const binstruction[27]) {  /* code */
       0x540E0007,  //  0000  LDINT	R3	8
       0x1C0C0403,  //  0001  EQ	R3	R2	R3
-      0x780E0017,  //  0002  JMPF	R3	#001B
+      0x780E0016,  //  0002  JMPF	R3	#001A
       0x500C0000,  //  0003  LDBOOL	R3	0	0
       0x8C100300,  //  0004  GETMET	R4	R1	K0
       0x60180008,  //  0005  GETGBL	R6	G8
-      0x881C0102,  //  0006  GETMBR	R7	R0	K2
+      0x881C0101,  //  0006  GETMBR	R7	R0	K1
       0x7C180200,  //  0007  CALL	R6	1
-      0x001A0206,  //  0008  ADD	R6	K1	R6
+      0x001A0406,  //  0008  ADD	R6	K2	R6
       0x7C100400,  //  0009  CALL	R4	2
-      0x1C100903,  //  000A  EQ	R4	R4	K3
-      0x5C0C0800,  //  000B  MOVE	R3	R4
-      0x88100104,  //  000C  GETMBR	R4	R0	K4
-      0x4C140000,  //  000D  LDNIL	R5
-      0x20100805,  //  000E  NE	R4	R4	R5
-      0x78120009,  //  000F  JMPF	R4	#001A
-      0x88100104,  //  0010  GETMBR	R4	R0	K4
-      0x60140017,  //  0011  GETGBL	R5	G23
-      0x5C180600,  //  0012  MOVE	R6	R3
-      0x7C140200,  //  0013  CALL	R5	1
-      0x20100805,  //  0014  NE	R4	R4	R5
-      0x78120003,  //  0015  JMPF	R4	#001A
-      0x8C100105,  //  0016  GETMET	R4	R0	K5
-      0x541A0044,  //  0017  LDINT	R6	69
-      0x581C0006,  //  0018  LDCONST	R7	K6
-      0x7C100600,  //  0019  CALL	R4	3
-      0x90020803,  //  001A  SETMBR	R0	K4	R3
-      0x80000000,  //  001B  RET	0
+      0x1C0C0903,  //  000A  EQ	R3	R4	K3
+      0x88100104,  //  000B  GETMBR	R4	R0	K4
+      0x4C140000,  //  000C  LDNIL	R5
+      0x20100805,  //  000D  NE	R4	R4	R5
+      0x78120009,  //  000E  JMPF	R4	#0019
+      0x88100104,  //  000F  GETMBR	R4	R0	K4
+      0x60140017,  //  0010  GETGBL	R5	G23
+      0x5C180600,  //  0011  MOVE	R6	R3
+      0x7C140200,  //  0012  CALL	R5	1
+      0x20100805,  //  0013  NE	R4	R4	R5
+      0x78120003,  //  0014  JMPF	R4	#0019
+      0x8C100105,  //  0015  GETMET	R4	R0	K5
+      0x541A0044,  //  0016  LDINT	R6	69
+      0x581C0006,  //  0017  LDCONST	R7	K6
+      0x7C100600,  //  0018  CALL	R4	3
+      0x90020803,  //  0019  SETMBR	R0	K4	R3
+      0x80000000,  //  001A  RET	0
     })
   )
 );
@@ -108,22 +108,22 @@ be_local_closure(Matter_Plugin_Light2_invoke_request,   /* name */
       0x7C240600,  //  001B  CALL	R9	3
       0x50240200,  //  001C  LDBOOL	R9	1	0
       0x80041200,  //  001D  RET	1	R9
-      0x70020010,  //  001E  JMP		#0030
+      0x7002001A,  //  001E  JMP		#003A
       0x54220046,  //  001F  LDINT	R8	71
       0x1C200E08,  //  0020  EQ	R8	R7	R8
       0x78220002,  //  0021  JMPF	R8	#0025
       0x50200200,  //  0022  LDBOOL	R8	1	0
       0x80041000,  //  0023  RET	1	R8
-      0x7002000A,  //  0024  JMP		#0030
+      0x70020014,  //  0024  JMP		#003A
       0x5422004A,  //  0025  LDINT	R8	75
       0x1C200E08,  //  0026  EQ	R8	R7	R8
       0x78220002,  //  0027  JMPF	R8	#002B
       0x50200200,  //  0028  LDBOOL	R8	1	0
       0x80041000,  //  0029  RET	1	R8
-      0x70020004,  //  002A  JMP		#0030
+      0x7002000E,  //  002A  JMP		#003A
       0x5422004B,  //  002B  LDINT	R8	76
       0x1C200E08,  //  002C  EQ	R8	R7	R8
-      0x78220001,  //  002D  JMPF	R8	#0030
+      0x7822000B,  //  002D  JMPF	R8	#003A
       0x50200200,  //  002E  LDBOOL	R8	1	0
       0x80041000,  //  002F  RET	1	R8
       0x70020008,  //  0030  JMP		#003A
@@ -184,7 +184,7 @@ be_local_closure(Matter_Plugin_Light2_update_shadow,   /* name */
       0x7C080200,  //  000B  CALL	R2	1
       0x4C0C0000,  //  000C  LDNIL	R3
       0x200C0403,  //  000D  NE	R3	R2	R3
-      0x780E000F,  //  000E  JMPF	R3	#001F
+      0x780E0015,  //  000E  JMPF	R3	#0025
       0x8C0C0505,  //  000F  GETMET	R3	R2	K5
       0x58140006,  //  0010  LDCONST	R5	K6
       0x4C180000,  //  0011  LDNIL	R6
@@ -195,7 +195,7 @@ be_local_closure(Matter_Plugin_Light2_update_shadow,   /* name */
       0x880C0107,  //  0016  GETMBR	R3	R0	K7
       0x88100107,  //  0017  GETMBR	R4	R0	K7
       0x20100604,  //  0018  NE	R4	R3	R4
-      0x78120004,  //  0019  JMPF	R4	#001F
+      0x7812000A,  //  0019  JMPF	R4	#0025
       0x8C100108,  //  001A  GETMET	R4	R0	K8
       0x541A02FF,  //  001B  LDINT	R6	768
       0x541E0006,  //  001C  LDINT	R7	7
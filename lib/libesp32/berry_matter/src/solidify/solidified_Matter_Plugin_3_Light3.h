@@ -271,17 +271,17 @@ be_local_closure(Matter_Plugin_Light3_invoke_request,   /* name */
       0x7C240600,  //  001B  CALL	R9	3
       0x50240200,  //  001C  LDBOOL	R9	1	0
       0x80041200,  //  001D  RET	1	R9
-      0x7002004F,  //  001E  JMP		#006F
+      0x70020059,  //  001E  JMP		#0079
       0x1C200F0D,  //  001F  EQ	R8	R7	K13
       0x78220002,  //  0020  JMPF	R8	#0024
       0x50200200,  //  0021  LDBOOL	R8	1	0
       0x80041000,  //  0022  RET	1	R8
-      0x7002004A,  //  0023  JMP		#006F
+      0x70020054,  //  0023  JMP		#0079
       0x1C200F0E,  //  0024  EQ	R8	R7	K14
       0x78220002,  //  0025  JMPF	R8	#0029
       0x50200200,  //  0026  LDBOOL	R8	1	0
       0x80041000,  //  0027  RET	1	R8
-      0x70020045,  //  0028  JMP		#006F
+      0x7002004F,  //  0028  JMP		#0079
       0x1C200F0F,  //  0029  EQ	R8	R7	K15
       0x78220012,  //  002A  JMPF	R8	#003E
       0x8C200507,  //  002B  GETMET	R8	R2	K7
@@ -302,19 +302,19 @@ be_local_closure(Matter_Plugin_Light3_invoke_request,   /* name */
       0x7C240600,  //  003A  CALL	R9	3
       0x50240200,  //  003B  LDBOOL	R9	1	0
       0x80041200,  //  003C  RET	1	R9
-      0x70020030,  //  003D  JMP		#006F
+      0x7002003A,  //  003D  JMP		#0079
       0x54220003,  //  003E  LDINT	R8	4
       0x1C200E08,  //  003F  EQ	R8	R7	R8
       0x78220002,  //  0040  JMPF	R8	#0044
       0x50200200,  //  0041  LDBOOL	R8	1	0
       0x80041000,  //  0042  RET	1	R8
-      0x7002002A,  //  0043  JMP		#006F
+      0x70020034,  //  0043  JMP		#0079
       0x54220004,  //  0044  LDINT	R8	5
       0x1C200E08,  //  0045  EQ	R8	R7	R8
       0x78220002,  //  0046  JMPF	R8	#004A
       0x50200200,  //  0047  LDBOOL	R8	1	0
       0x80041000,  //  0048  RET	1	R8
-      0x70020024,  //  0049  JMP		#006F
+      0x7002002E,  //  0049  JMP		#0079
       0x54220005,  //  004A  LDINT	R8	6
       0x1C200E08,  //  004B  EQ	R8	R7	R8
       0x7822001C,  //  004C  JMPF	R8	#006A
@@ -346,10 +346,10 @@ be_local_closure(Matter_Plugin_Light3_invoke_request,   /* name */
       0x7C280A00,  //  0066  CALL	R10	5
       0x50280200,  //  0067  LDBOOL	R10	1	0
       0x80041400,  //  0068  RET	1	R10
-      0x70020004,  //  0069  JMP		#006F
+      0x7002000E,  //  0069  JMP		#0079
       0x54220046,  //  006A  LDINT	R8	71
       0x1C200E08,  //  006B  EQ	R8	R7	R8
-      0x78220001,  //  006C  JMPF	R8	#006F
+      0x7822000B,  //  006C  JMPF	R8	#0079
       0x50200200,  //  006D  LDBOOL	R8	1	0
       0x80041000,  //  006E  RET	1	R8
       0x70020008,  //  006F  JMP		#0079
@@ -87,7 +87,7 @@ be_local_closure(Matter_Plugin_Sensor_Pressure_read_attribute,   /* name */
       0x7C280200,  //  0011  CALL	R10	1
       0x7C1C0600,  //  0012  CALL	R7	3
       0x80040E00,  //  0013  RET	1	R7
-      0x70020004,  //  0014  JMP		#001A
+      0x70020014,  //  0014  JMP		#002A
       0x8C1C0706,  //  0015  GETMET	R7	R3	K6
       0x88240908,  //  0016  GETMBR	R9	R4	K8
       0x4C280000,  //  0017  LDNIL	R10
@@ -85,7 +85,7 @@ be_local_closure(Matter_Plugin_Sensor_Temp_read_attribute,   /* name */
       0x88280105,  //  000F  GETMBR	R10	R0	K5
       0x7C1C0600,  //  0010  CALL	R7	3
       0x80040E00,  //  0011  RET	1	R7
-      0x70020004,  //  0012  JMP		#0018
+      0x70020014,  //  0012  JMP		#0028
       0x8C1C0706,  //  0013  GETMET	R7	R3	K6
       0x88240908,  //  0014  GETMBR	R9	R4	K8
       0x4C280000,  //  0015  LDNIL	R10
@@ -143,27 +143,26 @@ be_local_closure(Matter_Plugin_Sensor_Temp_pre_value,   /* name */
     }),
     be_str_weak(pre_value),
     &be_const_str_solidified,
-    ( &(const binstruction[20]) {  /* code */
+    ( &(const binstruction[19]) {  /* code */
       0xB80A0000,  //  0000  GETNGBL	R2	K0
       0x8C080501,  //  0001  GETMET	R2	R2	K1
       0x54120007,  //  0002  LDINT	R4	8
       0x7C080400,  //  0003  CALL	R2	2
       0x1C080502,  //  0004  EQ	R2	R2	K2
-      0x780A0003,  //  0005  JMPF	R2	#000A
+      0x780A0002,  //  0005  JMPF	R2	#0009
       0x540A001F,  //  0006  LDINT	R2	32
       0x04080202,  //  0007  SUB	R2	R1	R2
-      0x0C080503,  //  0008  DIV	R2	R2	K3
-      0x5C040400,  //  0009  MOVE	R1	R2
-      0x4C080000,  //  000A  LDNIL	R2
-      0x20080202,  //  000B  NE	R2	R1	R2
-      0x780A0004,  //  000C  JMPF	R2	#0012
-      0x60080009,  //  000D  GETGBL	R2	G9
-      0x540E0063,  //  000E  LDINT	R3	100
-      0x080C0203,  //  000F  MUL	R3	R1	R3
-      0x7C080200,  //  0010  CALL	R2	1
-      0x70020000,  //  0011  JMP		#0013
-      0x4C080000,  //  0012  LDNIL	R2
-      0x80040400,  //  0013  RET	1	R2
+      0x0C040503,  //  0008  DIV	R1	R2	K3
+      0x4C080000,  //  0009  LDNIL	R2
+      0x20080202,  //  000A  NE	R2	R1	R2
+      0x780A0004,  //  000B  JMPF	R2	#0011
+      0x60080009,  //  000C  GETGBL	R2	G9
+      0x540E0063,  //  000D  LDINT	R3	100
+      0x080C0203,  //  000E  MUL	R3	R1	R3
+      0x7C080200,  //  000F  CALL	R2	1
+      0x70020000,  //  0010  JMP		#0012
+      0x4C080000,  //  0011  LDNIL	R2
+      0x80040400,  //  0012  RET	1	R2
     })
   )
 );
@@ -26,8 +26,8 @@ be_local_closure(Matter_Plugin_ShutterTilt_update_tilt_min_max,   /* name */
     /* K3   */  be_nested_str_weak(contains),
     /* K4   */  be_nested_str_weak(StatusSHT),
     /* K5   */  be_nested_str_weak(find),
-    /* K6   */  be_nested_str_weak(SHT),
-    /* K7   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K6   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K7   */  be_nested_str_weak(SHT),
     /* K8   */  be_nested_str_weak(TiltConfig),
     /* K9   */  be_nested_str_weak(tilt_min),
     /* K10  */  be_const_int(0),
@@ -49,9 +49,9 @@ be_local_closure(Matter_Plugin_ShutterTilt_update_tilt_min_max,   /* name */
       0x94040304,  //  0009  GETIDX	R1	R1	K4
       0x8C080305,  //  000A  GETMET	R2	R1	K5
       0x60100008,  //  000B  GETGBL	R4	G8
-      0x88140107,  //  000C  GETMBR	R5	R0	K7
+      0x88140106,  //  000C  GETMBR	R5	R0	K6
       0x7C100200,  //  000D  CALL	R4	1
-      0x00120C04,  //  000E  ADD	R4	K6	R4
+      0x00120E04,  //  000E  ADD	R4	K7	R4
       0x60140013,  //  000F  GETGBL	R5	G19
       0x7C140000,  //  0010  CALL	R5	0
       0x7C080600,  //  0011  CALL	R2	3
@@ -89,7 +89,7 @@ be_local_closure(Matter_Plugin_ShutterTilt_read_attribute,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[20]) {     /* constants */
+    ( &(const bvalue[18]) {     /* constants */
     /* K0   */  be_nested_str_weak(matter),
     /* K1   */  be_nested_str_weak(TLV),
     /* K2   */  be_nested_str_weak(cluster),
@@ -97,136 +97,128 @@ be_local_closure(Matter_Plugin_ShutterTilt_read_attribute,   /* name */
     /* K4   */  be_nested_str_weak(update_shadow_lazy),
     /* K5   */  be_nested_str_weak(set),
     /* K6   */  be_nested_str_weak(U1),
-    /* K7   */  be_const_int(1),
-    /* K8   */  be_nested_str_weak(update_tilt_min_max),
-    /* K9   */  be_nested_str_weak(tilt_min),
-    /* K10  */  be_nested_str_weak(tilt_max),
-    /* K11  */  be_nested_str_weak(tasmota),
-    /* K12  */  be_nested_str_weak(scale_uint),
-    /* K13  */  be_nested_str_weak(shadow_shutter_tilt),
-    /* K14  */  be_const_int(0),
-    /* K15  */  be_nested_str_weak(U2),
-    /* K16  */  be_nested_str_weak(NULL),
-    /* K17  */  be_nested_str_weak(U4),
-    /* K18  */  be_const_int(3),
-    /* K19  */  be_nested_str_weak(read_attribute),
+    /* K7   */  be_nested_str_weak(update_tilt_min_max),
+    /* K8   */  be_nested_str_weak(tilt_min),
+    /* K9   */  be_nested_str_weak(tilt_max),
+    /* K10  */  be_nested_str_weak(tasmota),
+    /* K11  */  be_nested_str_weak(scale_uint),
+    /* K12  */  be_nested_str_weak(shadow_shutter_tilt),
+    /* K13  */  be_const_int(0),
+    /* K14  */  be_nested_str_weak(U2),
+    /* K15  */  be_nested_str_weak(NULL),
+    /* K16  */  be_nested_str_weak(U4),
+    /* K17  */  be_nested_str_weak(read_attribute),
     }),
     be_str_weak(read_attribute),
     &be_const_str_solidified,
-    ( &(const binstruction[113]) {  /* code */
+    ( &(const binstruction[107]) {  /* code */
       0xB8120000,  //  0000  GETNGBL	R4	K0
       0x88100901,  //  0001  GETMBR	R4	R4	K1
       0x88140502,  //  0002  GETMBR	R5	R2	K2
       0x88180503,  //  0003  GETMBR	R6	R2	K3
       0x541E0101,  //  0004  LDINT	R7	258
       0x1C1C0A07,  //  0005  EQ	R7	R5	R7
-      0x781E0060,  //  0006  JMPF	R7	#0068
+      0x781E005A,  //  0006  JMPF	R7	#0062
       0x8C1C0104,  //  0007  GETMET	R7	R0	K4
       0x7C1C0200,  //  0008  CALL	R7	1
       0x541E0006,  //  0009  LDINT	R7	7
       0x1C1C0C07,  //  000A  EQ	R7	R6	R7
-      0x781E0008,  //  000B  JMPF	R7	#0015
+      0x781E0005,  //  000B  JMPF	R7	#0012
       0x8C1C0705,  //  000C  GETMET	R7	R3	K5
       0x88240906,  //  000D  GETMBR	R9	R4	K6
-      0x542A0007,  //  000E  LDINT	R10	8
-      0x002A0E0A,  //  000F  ADD	R10	K7	R10
-      0x542E000F,  //  0010  LDINT	R11	16
-      0x0028140B,  //  0011  ADD	R10	R10	R11
-      0x7C1C0600,  //  0012  CALL	R7	3
-      0x80040E00,  //  0013  RET	1	R7
-      0x70020052,  //  0014  JMP		#0068
-      0x541E000E,  //  0015  LDINT	R7	15
-      0x1C1C0C07,  //  0016  EQ	R7	R6	R7
-      0x781E0021,  //  0017  JMPF	R7	#003A
-      0x8C1C0108,  //  0018  GETMET	R7	R0	K8
-      0x7C1C0200,  //  0019  CALL	R7	1
-      0x881C0109,  //  001A  GETMBR	R7	R0	K9
-      0x4C200000,  //  001B  LDNIL	R8
-      0x201C0E08,  //  001C  NE	R7	R7	R8
-      0x781E0015,  //  001D  JMPF	R7	#0034
-      0x881C010A,  //  001E  GETMBR	R7	R0	K10
-      0x4C200000,  //  001F  LDNIL	R8
-      0x201C0E08,  //  0020  NE	R7	R7	R8
-      0x781E0011,  //  0021  JMPF	R7	#0034
-      0xB81E1600,  //  0022  GETNGBL	R7	K11
-      0x8C1C0F0C,  //  0023  GETMET	R7	R7	K12
-      0x8824010D,  //  0024  GETMBR	R9	R0	K13
-      0x88280109,  //  0025  GETMBR	R10	R0	K9
-      0x0424120A,  //  0026  SUB	R9	R9	R10
-      0x5828000E,  //  0027  LDCONST	R10	K14
-      0x882C010A,  //  0028  GETMBR	R11	R0	K10
-      0x88300109,  //  0029  GETMBR	R12	R0	K9
-      0x042C160C,  //  002A  SUB	R11	R11	R12
-      0x5830000E,  //  002B  LDCONST	R12	K14
-      0x5436270F,  //  002C  LDINT	R13	10000
-      0x7C1C0C00,  //  002D  CALL	R7	6
-      0x8C200705,  //  002E  GETMET	R8	R3	K5
-      0x8828090F,  //  002F  GETMBR	R10	R4	K15
-      0x5C2C0E00,  //  0030  MOVE	R11	R7
-      0x7C200600,  //  0031  CALL	R8	3
-      0x80041000,  //  0032  RET	1	R8
-      0x70020004,  //  0033  JMP		#0039
-      0x8C1C0705,  //  0034  GETMET	R7	R3	K5
-      0x88240910,  //  0035  GETMBR	R9	R4	K16
-      0x4C280000,  //  0036  LDNIL	R10
-      0x7C1C0600,  //  0037  CALL	R7	3
-      0x80040E00,  //  0038  RET	1	R7
-      0x7002002D,  //  0039  JMP		#0068
-      0x541E000B,  //  003A  LDINT	R7	12
-      0x1C1C0C07,  //  003B  EQ	R7	R6	R7
-      0x781E001F,  //  003C  JMPF	R7	#005D
-      0x881C0109,  //  003D  GETMBR	R7	R0	K9
-      0x4C200000,  //  003E  LDNIL	R8
-      0x201C0E08,  //  003F  NE	R7	R7	R8
-      0x781E0015,  //  0040  JMPF	R7	#0057
-      0x881C010A,  //  0041  GETMBR	R7	R0	K10
-      0x4C200000,  //  0042  LDNIL	R8
-      0x201C0E08,  //  0043  NE	R7	R7	R8
-      0x781E0011,  //  0044  JMPF	R7	#0057
-      0xB81E1600,  //  0045  GETNGBL	R7	K11
-      0x8C1C0F0C,  //  0046  GETMET	R7	R7	K12
-      0x8824010D,  //  0047  GETMBR	R9	R0	K13
-      0x88280109,  //  0048  GETMBR	R10	R0	K9
-      0x0424120A,  //  0049  SUB	R9	R9	R10
-      0x5828000E,  //  004A  LDCONST	R10	K14
-      0x882C010A,  //  004B  GETMBR	R11	R0	K10
-      0x88300109,  //  004C  GETMBR	R12	R0	K9
-      0x042C160C,  //  004D  SUB	R11	R11	R12
-      0x5830000E,  //  004E  LDCONST	R12	K14
-      0x5436270F,  //  004F  LDINT	R13	10000
-      0x7C1C0C00,  //  0050  CALL	R7	6
-      0x8C200705,  //  0051  GETMET	R8	R3	K5
-      0x8828090F,  //  0052  GETMBR	R10	R4	K15
-      0x5C2C0E00,  //  0053  MOVE	R11	R7
-      0x7C200600,  //  0054  CALL	R8	3
-      0x80041000,  //  0055  RET	1	R8
-      0x70020004,  //  0056  JMP		#005C
-      0x8C1C0705,  //  0057  GETMET	R7	R3	K5
-      0x88240910,  //  0058  GETMBR	R9	R4	K16
-      0x4C280000,  //  0059  LDNIL	R10
-      0x7C1C0600,  //  005A  CALL	R7	3
-      0x80040E00,  //  005B  RET	1	R7
-      0x7002000A,  //  005C  JMP		#0068
-      0x541EFFFB,  //  005D  LDINT	R7	65532
-      0x1C1C0C07,  //  005E  EQ	R7	R6	R7
-      0x781E0007,  //  005F  JMPF	R7	#0068
-      0x8C1C0705,  //  0060  GETMET	R7	R3	K5
-      0x88240911,  //  0061  GETMBR	R9	R4	K17
-      0x542A0003,  //  0062  LDINT	R10	4
-      0x002A240A,  //  0063  ADD	R10	K18	R10
-      0x542E000F,  //  0064  LDINT	R11	16
-      0x0028140B,  //  0065  ADD	R10	R10	R11
-      0x7C1C0600,  //  0066  CALL	R7	3
-      0x80040E00,  //  0067  RET	1	R7
-      0x601C0003,  //  0068  GETGBL	R7	G3
-      0x5C200000,  //  0069  MOVE	R8	R0
-      0x7C1C0200,  //  006A  CALL	R7	1
-      0x8C1C0F13,  //  006B  GETMET	R7	R7	K19
-      0x5C240200,  //  006C  MOVE	R9	R1
-      0x5C280400,  //  006D  MOVE	R10	R2
-      0x5C2C0600,  //  006E  MOVE	R11	R3
-      0x7C1C0800,  //  006F  CALL	R7	4
-      0x80040E00,  //  0070  RET	1	R7
+      0x542A0018,  //  000E  LDINT	R10	25
+      0x7C1C0600,  //  000F  CALL	R7	3
+      0x80040E00,  //  0010  RET	1	R7
+      0x7002004F,  //  0011  JMP		#0062
+      0x541E000E,  //  0012  LDINT	R7	15
+      0x1C1C0C07,  //  0013  EQ	R7	R6	R7
+      0x781E0021,  //  0014  JMPF	R7	#0037
+      0x8C1C0107,  //  0015  GETMET	R7	R0	K7
+      0x7C1C0200,  //  0016  CALL	R7	1
+      0x881C0108,  //  0017  GETMBR	R7	R0	K8
+      0x4C200000,  //  0018  LDNIL	R8
+      0x201C0E08,  //  0019  NE	R7	R7	R8
+      0x781E0015,  //  001A  JMPF	R7	#0031
+      0x881C0109,  //  001B  GETMBR	R7	R0	K9
+      0x4C200000,  //  001C  LDNIL	R8
+      0x201C0E08,  //  001D  NE	R7	R7	R8
+      0x781E0011,  //  001E  JMPF	R7	#0031
+      0xB81E1400,  //  001F  GETNGBL	R7	K10
+      0x8C1C0F0B,  //  0020  GETMET	R7	R7	K11
+      0x8824010C,  //  0021  GETMBR	R9	R0	K12
+      0x88280108,  //  0022  GETMBR	R10	R0	K8
+      0x0424120A,  //  0023  SUB	R9	R9	R10
+      0x5828000D,  //  0024  LDCONST	R10	K13
+      0x882C0109,  //  0025  GETMBR	R11	R0	K9
+      0x88300108,  //  0026  GETMBR	R12	R0	K8
+      0x042C160C,  //  0027  SUB	R11	R11	R12
+      0x5830000D,  //  0028  LDCONST	R12	K13
+      0x5436270F,  //  0029  LDINT	R13	10000
+      0x7C1C0C00,  //  002A  CALL	R7	6
+      0x8C200705,  //  002B  GETMET	R8	R3	K5
+      0x8828090E,  //  002C  GETMBR	R10	R4	K14
+      0x5C2C0E00,  //  002D  MOVE	R11	R7
+      0x7C200600,  //  002E  CALL	R8	3
+      0x80041000,  //  002F  RET	1	R8
+      0x70020030,  //  0030  JMP		#0062
+      0x8C1C0705,  //  0031  GETMET	R7	R3	K5
+      0x8824090F,  //  0032  GETMBR	R9	R4	K15
+      0x4C280000,  //  0033  LDNIL	R10
+      0x7C1C0600,  //  0034  CALL	R7	3
+      0x80040E00,  //  0035  RET	1	R7
+      0x7002002A,  //  0036  JMP		#0062
+      0x541E000B,  //  0037  LDINT	R7	12
+      0x1C1C0C07,  //  0038  EQ	R7	R6	R7
+      0x781E001F,  //  0039  JMPF	R7	#005A
+      0x881C0108,  //  003A  GETMBR	R7	R0	K8
+      0x4C200000,  //  003B  LDNIL	R8
+      0x201C0E08,  //  003C  NE	R7	R7	R8
+      0x781E0015,  //  003D  JMPF	R7	#0054
+      0x881C0109,  //  003E  GETMBR	R7	R0	K9
+      0x4C200000,  //  003F  LDNIL	R8
+      0x201C0E08,  //  0040  NE	R7	R7	R8
+      0x781E0011,  //  0041  JMPF	R7	#0054
+      0xB81E1400,  //  0042  GETNGBL	R7	K10
+      0x8C1C0F0B,  //  0043  GETMET	R7	R7	K11
+      0x8824010C,  //  0044  GETMBR	R9	R0	K12
+      0x88280108,  //  0045  GETMBR	R10	R0	K8
+      0x0424120A,  //  0046  SUB	R9	R9	R10
+      0x5828000D,  //  0047  LDCONST	R10	K13
+      0x882C0109,  //  0048  GETMBR	R11	R0	K9
+      0x88300108,  //  0049  GETMBR	R12	R0	K8
+      0x042C160C,  //  004A  SUB	R11	R11	R12
+      0x5830000D,  //  004B  LDCONST	R12	K13
+      0x5436270F,  //  004C  LDINT	R13	10000
+      0x7C1C0C00,  //  004D  CALL	R7	6
+      0x8C200705,  //  004E  GETMET	R8	R3	K5
+      0x8828090E,  //  004F  GETMBR	R10	R4	K14
+      0x5C2C0E00,  //  0050  MOVE	R11	R7
+      0x7C200600,  //  0051  CALL	R8	3
+      0x80041000,  //  0052  RET	1	R8
+      0x7002000D,  //  0053  JMP		#0062
+      0x8C1C0705,  //  0054  GETMET	R7	R3	K5
+      0x8824090F,  //  0055  GETMBR	R9	R4	K15
+      0x4C280000,  //  0056  LDNIL	R10
+      0x7C1C0600,  //  0057  CALL	R7	3
+      0x80040E00,  //  0058  RET	1	R7
+      0x70020007,  //  0059  JMP		#0062
+      0x541EFFFB,  //  005A  LDINT	R7	65532
+      0x1C1C0C07,  //  005B  EQ	R7	R6	R7
+      0x781E0004,  //  005C  JMPF	R7	#0062
+      0x8C1C0705,  //  005D  GETMET	R7	R3	K5
+      0x88240910,  //  005E  GETMBR	R9	R4	K16
+      0x542A0016,  //  005F  LDINT	R10	23
+      0x7C1C0600,  //  0060  CALL	R7	3
+      0x80040E00,  //  0061  RET	1	R7
+      0x601C0003,  //  0062  GETGBL	R7	G3
+      0x5C200000,  //  0063  MOVE	R8	R0
+      0x7C1C0200,  //  0064  CALL	R7	1
+      0x8C1C0F11,  //  0065  GETMET	R7	R7	K17
+      0x5C240200,  //  0066  MOVE	R9	R1
+      0x5C280400,  //  0067  MOVE	R10	R2
+      0x5C2C0600,  //  0068  MOVE	R11	R3
+      0x7C1C0800,  //  0069  CALL	R7	4
+      0x80040E00,  //  006A  RET	1	R7
     })
   )
 );
@@ -247,9 +239,9 @@ be_local_closure(Matter_Plugin_ShutterTilt_parse_sensors,   /* name */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
     ( &(const bvalue[ 9]) {     /* constants */
-    /* K0   */  be_nested_str_weak(Shutter),
-    /* K1   */  be_nested_str_weak(tasmota_shutter_index),
-    /* K2   */  be_const_int(1),
+    /* K0   */  be_nested_str_weak(tasmota_shutter_index),
+    /* K1   */  be_const_int(1),
+    /* K2   */  be_nested_str_weak(Shutter),
     /* K3   */  be_nested_str_weak(contains),
     /* K4   */  be_nested_str_weak(find),
     /* K5   */  be_nested_str_weak(Tilt),
@@ -261,10 +253,10 @@ be_local_closure(Matter_Plugin_ShutterTilt_parse_sensors,   /* name */
     &be_const_str_solidified,
     ( &(const binstruction[31]) {  /* code */
       0x60080008,  //  0000  GETGBL	R2	G8
-      0x880C0101,  //  0001  GETMBR	R3	R0	K1
-      0x000C0702,  //  0002  ADD	R3	R3	K2
+      0x880C0100,  //  0001  GETMBR	R3	R0	K0
+      0x000C0701,  //  0002  ADD	R3	R3	K1
       0x7C080200,  //  0003  CALL	R2	1
-      0x000A0002,  //  0004  ADD	R2	K0	R2
+      0x000A0402,  //  0004  ADD	R2	K2	R2
       0x8C0C0303,  //  0005  GETMET	R3	R1	K3
       0x5C140400,  //  0006  MOVE	R5	R2
       0x7C0C0400,  //  0007  CALL	R3	2
@@ -325,9 +317,9 @@ be_local_closure(Matter_Plugin_ShutterTilt_invoke_request,   /* name */
     /* K11  */  be_nested_str_weak(tasmota),
     /* K12  */  be_nested_str_weak(scale_uint),
     /* K13  */  be_nested_str_weak(cmd),
-    /* K14  */  be_nested_str_weak(ShutterTilt),
-    /* K15  */  be_nested_str_weak(tasmota_shutter_index),
-    /* K16  */  be_const_int(1),
+    /* K14  */  be_nested_str_weak(tasmota_shutter_index),
+    /* K15  */  be_const_int(1),
+    /* K16  */  be_nested_str_weak(ShutterTilt),
     /* K17  */  be_nested_str_weak(_X20),
     /* K18  */  be_nested_str_weak(update_shadow),
     /* K19  */  be_nested_str_weak(log),
@@ -382,10 +374,10 @@ be_local_closure(Matter_Plugin_ShutterTilt_invoke_request,   /* name */
       0xB82A1600,  //  0029  GETNGBL	R10	K11
       0x8C28150D,  //  002A  GETMET	R10	R10	K13
       0x60300008,  //  002B  GETGBL	R12	G8
-      0x8834010F,  //  002C  GETMBR	R13	R0	K15
-      0x00341B10,  //  002D  ADD	R13	R13	K16
+      0x8834010E,  //  002C  GETMBR	R13	R0	K14
+      0x00341B0F,  //  002D  ADD	R13	R13	K15
       0x7C300200,  //  002E  CALL	R12	1
-      0x00321C0C,  //  002F  ADD	R12	K14	R12
+      0x0032200C,  //  002F  ADD	R12	K16	R12
       0x00301911,  //  0030  ADD	R12	R12	K17
       0x60340008,  //  0031  GETGBL	R13	G8
       0x5C381200,  //  0032  MOVE	R14	R9
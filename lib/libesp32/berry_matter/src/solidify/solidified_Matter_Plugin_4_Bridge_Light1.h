@@ -86,22 +86,22 @@ be_local_closure(Matter_Plugin_Bridge_Light1_invoke_request,   /* name */
       0x7C200A00,  //  0027  CALL	R8	5
       0x50200200,  //  0028  LDBOOL	R8	1	0
       0x80041000,  //  0029  RET	1	R8
-      0x7002004D,  //  002A  JMP		#0079
+      0x70020057,  //  002A  JMP		#0083
       0x1C1C0D0E,  //  002B  EQ	R7	R6	K14
       0x781E0002,  //  002C  JMPF	R7	#0030
       0x501C0200,  //  002D  LDBOOL	R7	1	0
       0x80040E00,  //  002E  RET	1	R7
-      0x70020048,  //  002F  JMP		#0079
+      0x70020052,  //  002F  JMP		#0083
       0x1C1C0D0F,  //  0030  EQ	R7	R6	K15
       0x781E0002,  //  0031  JMPF	R7	#0035
       0x501C0200,  //  0032  LDBOOL	R7	1	0
       0x80040E00,  //  0033  RET	1	R7
-      0x70020043,  //  0034  JMP		#0079
+      0x7002004D,  //  0034  JMP		#0083
       0x1C1C0D10,  //  0035  EQ	R7	R6	K16
       0x781E0002,  //  0036  JMPF	R7	#003A
       0x501C0200,  //  0037  LDBOOL	R7	1	0
       0x80040E00,  //  0038  RET	1	R7
-      0x7002003E,  //  0039  JMP		#0079
+      0x70020048,  //  0039  JMP		#0083
       0x541E0003,  //  003A  LDINT	R7	4
       0x1C1C0C07,  //  003B  EQ	R7	R6	R7
       0x781E002A,  //  003C  JMPF	R7	#0068
@@ -147,22 +147,22 @@ be_local_closure(Matter_Plugin_Bridge_Light1_invoke_request,   /* name */
       0x7C240E00,  //  0064  CALL	R9	7
       0x50240200,  //  0065  LDBOOL	R9	1	0
       0x80041200,  //  0066  RET	1	R9
-      0x70020010,  //  0067  JMP		#0079
+      0x7002001A,  //  0067  JMP		#0083
       0x541E0004,  //  0068  LDINT	R7	5
       0x1C1C0C07,  //  0069  EQ	R7	R6	R7
       0x781E0002,  //  006A  JMPF	R7	#006E
       0x501C0200,  //  006B  LDBOOL	R7	1	0
       0x80040E00,  //  006C  RET	1	R7
-      0x7002000A,  //  006D  JMP		#0079
+      0x70020014,  //  006D  JMP		#0083
       0x541E0005,  //  006E  LDINT	R7	6
       0x1C1C0C07,  //  006F  EQ	R7	R6	R7
       0x781E0002,  //  0070  JMPF	R7	#0074
       0x501C0200,  //  0071  LDBOOL	R7	1	0
       0x80040E00,  //  0072  RET	1	R7
-      0x70020004,  //  0073  JMP		#0079
+      0x7002000E,  //  0073  JMP		#0083
       0x541E0006,  //  0074  LDINT	R7	7
       0x1C1C0C07,  //  0075  EQ	R7	R6	R7
-      0x781E0001,  //  0076  JMPF	R7	#0079
+      0x781E000B,  //  0076  JMPF	R7	#0083
       0x501C0200,  //  0077  LDBOOL	R7	1	0
       0x80040E00,  //  0078  RET	1	R7
       0x70020008,  //  0079  JMP		#0083
@@ -233,7 +233,7 @@ be_local_closure(Matter_Plugin_Bridge_Light1_read_attribute,   /* name */
       0x88280106,  //  0011  GETMBR	R10	R0	K6
       0x7C1C0600,  //  0012  CALL	R7	3
       0x80040E00,  //  0013  RET	1	R7
-      0x70020004,  //  0014  JMP		#001A
+      0x70020030,  //  0014  JMP		#0046
       0x8C1C0707,  //  0015  GETMET	R7	R3	K7
       0x88240909,  //  0016  GETMBR	R9	R4	K9
       0x4C280000,  //  0017  LDNIL	R10
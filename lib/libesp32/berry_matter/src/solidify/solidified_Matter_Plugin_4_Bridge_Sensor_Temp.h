@@ -26,25 +26,24 @@ be_local_closure(Matter_Plugin_Bridge_Sensor_Temp_pre_value,   /* name */
     }),
     be_str_weak(pre_value),
     &be_const_str_solidified,
-    ( &(const binstruction[18]) {  /* code */
+    ( &(const binstruction[17]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
       0x880C0101,  //  0001  GETMBR	R3	R0	K1
       0x1C080403,  //  0002  EQ	R2	R2	R3
-      0x780A0003,  //  0003  JMPF	R2	#0008
+      0x780A0002,  //  0003  JMPF	R2	#0007
       0x540A001F,  //  0004  LDINT	R2	32
       0x04080202,  //  0005  SUB	R2	R1	R2
-      0x0C080502,  //  0006  DIV	R2	R2	K2
-      0x5C040400,  //  0007  MOVE	R1	R2
-      0x4C080000,  //  0008  LDNIL	R2
-      0x20080202,  //  0009  NE	R2	R1	R2
-      0x780A0004,  //  000A  JMPF	R2	#0010
-      0x60080009,  //  000B  GETGBL	R2	G9
-      0x540E0063,  //  000C  LDINT	R3	100
-      0x080C0203,  //  000D  MUL	R3	R1	R3
-      0x7C080200,  //  000E  CALL	R2	1
-      0x70020000,  //  000F  JMP		#0011
-      0x4C080000,  //  0010  LDNIL	R2
-      0x80040400,  //  0011  RET	1	R2
+      0x0C040502,  //  0006  DIV	R1	R2	K2
+      0x4C080000,  //  0007  LDNIL	R2
+      0x20080202,  //  0008  NE	R2	R1	R2
+      0x780A0004,  //  0009  JMPF	R2	#000F
+      0x60080009,  //  000A  GETGBL	R2	G9
+      0x540E0063,  //  000B  LDINT	R3	100
+      0x080C0203,  //  000C  MUL	R3	R1	R3
+      0x7C080200,  //  000D  CALL	R2	1
+      0x70020000,  //  000E  JMP		#0010
+      0x4C080000,  //  000F  LDNIL	R2
+      0x80040400,  //  0010  RET	1	R2
     })
   )
 );
@@ -130,7 +129,7 @@ be_local_closure(Matter_Plugin_Bridge_Sensor_Temp_read_attribute,   /* name */
       0x88280105,  //  000F  GETMBR	R10	R0	K5
       0x7C1C0600,  //  0010  CALL	R7	3
       0x80040E00,  //  0011  RET	1	R7
-      0x70020004,  //  0012  JMP		#0018
+      0x70020014,  //  0012  JMP		#0028
       0x8C1C0706,  //  0013  GETMET	R7	R3	K6
       0x88240908,  //  0014  GETMBR	R9	R4	K8
       0x4C280000,  //  0015  LDNIL	R10
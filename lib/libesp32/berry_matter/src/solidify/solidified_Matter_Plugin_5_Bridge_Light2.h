@@ -314,22 +314,22 @@ be_local_closure(Matter_Plugin_Bridge_Light2_invoke_request,   /* name */
       0x7C200600,  //  0020  CALL	R8	3
       0x50200200,  //  0021  LDBOOL	R8	1	0
       0x80041000,  //  0022  RET	1	R8
-      0x70020010,  //  0023  JMP		#0035
+      0x7002001A,  //  0023  JMP		#003F
       0x541E0046,  //  0024  LDINT	R7	71
       0x1C1C0C07,  //  0025  EQ	R7	R6	R7
       0x781E0002,  //  0026  JMPF	R7	#002A
       0x501C0200,  //  0027  LDBOOL	R7	1	0
       0x80040E00,  //  0028  RET	1	R7
-      0x7002000A,  //  0029  JMP		#0035
+      0x70020014,  //  0029  JMP		#003F
       0x541E004A,  //  002A  LDINT	R7	75
       0x1C1C0C07,  //  002B  EQ	R7	R6	R7
       0x781E0002,  //  002C  JMPF	R7	#0030
       0x501C0200,  //  002D  LDBOOL	R7	1	0
       0x80040E00,  //  002E  RET	1	R7
-      0x70020004,  //  002F  JMP		#0035
+      0x7002000E,  //  002F  JMP		#003F
       0x541E004B,  //  0030  LDINT	R7	76
       0x1C1C0C07,  //  0031  EQ	R7	R6	R7
-      0x781E0001,  //  0032  JMPF	R7	#0035
+      0x781E000B,  //  0032  JMPF	R7	#003F
       0x501C0200,  //  0033  LDBOOL	R7	1	0
       0x80040E00,  //  0034  RET	1	R7
       0x70020008,  //  0035  JMP		#003F
@@ -403,7 +403,7 @@ be_local_closure(Matter_Plugin_Bridge_Light2_read_attribute,   /* name */
       0x88280105,  //  0012  GETMBR	R10	R0	K5
       0x7C1C0600,  //  0013  CALL	R7	3
       0x80040E00,  //  0014  RET	1	R7
-      0x70020004,  //  0015  JMP		#001B
+      0x70020031,  //  0015  JMP		#0048
       0x8C1C0706,  //  0016  GETMET	R7	R3	K6
       0x88240908,  //  0017  GETMBR	R9	R4	K8
       0x4C280000,  //  0018  LDNIL	R10
@@ -347,7 +347,7 @@ be_local_closure(Matter_Plugin_Bridge_Light3_read_attribute,   /* name */
       0x88280106,  //  0011  GETMBR	R10	R0	K6
       0x7C1C0600,  //  0012  CALL	R7	3
       0x80040E00,  //  0013  RET	1	R7
-      0x70020004,  //  0014  JMP		#001A
+      0x7002004C,  //  0014  JMP		#0062
       0x8C1C0707,  //  0015  GETMET	R7	R3	K7
       0x88240909,  //  0016  GETMBR	R9	R4	K9
       0x4C280000,  //  0017  LDNIL	R10
@@ -365,7 +365,7 @@ be_local_closure(Matter_Plugin_Bridge_Light3_read_attribute,   /* name */
       0x8828010B,  //  0023  GETMBR	R10	R0	K11
       0x7C1C0600,  //  0024  CALL	R7	3
       0x80040E00,  //  0025  RET	1	R7
-      0x70020004,  //  0026  JMP		#002C
+      0x7002003A,  //  0026  JMP		#0062
       0x8C1C0707,  //  0027  GETMET	R7	R3	K7
       0x88240909,  //  0028  GETMBR	R9	R4	K9
       0x4C280000,  //  0029  LDNIL	R10
@@ -503,17 +503,17 @@ be_local_closure(Matter_Plugin_Bridge_Light3_invoke_request,   /* name */
       0x7C200600,  //  0017  CALL	R8	3
       0x50200200,  //  0018  LDBOOL	R8	1	0
       0x80041000,  //  0019  RET	1	R8
-      0x70020050,  //  001A  JMP		#006C
+      0x7002005A,  //  001A  JMP		#0076
       0x1C1C0D0B,  //  001B  EQ	R7	R6	K11
       0x781E0002,  //  001C  JMPF	R7	#0020
       0x501C0200,  //  001D  LDBOOL	R7	1	0
       0x80040E00,  //  001E  RET	1	R7
-      0x7002004B,  //  001F  JMP		#006C
+      0x70020055,  //  001F  JMP		#0076
       0x1C1C0D0C,  //  0020  EQ	R7	R6	K12
       0x781E0002,  //  0021  JMPF	R7	#0025
       0x501C0200,  //  0022  LDBOOL	R7	1	0
       0x80040E00,  //  0023  RET	1	R7
-      0x70020046,  //  0024  JMP		#006C
+      0x70020050,  //  0024  JMP		#0076
       0x1C1C0D0D,  //  0025  EQ	R7	R6	K13
       0x781E0011,  //  0026  JMPF	R7	#0039
       0x8C1C0505,  //  0027  GETMET	R7	R2	K5
@@ -533,19 +533,19 @@ be_local_closure(Matter_Plugin_Bridge_Light3_invoke_request,   /* name */
       0x7C200600,  //  0035  CALL	R8	3
       0x50200200,  //  0036  LDBOOL	R8	1	0
       0x80041000,  //  0037  RET	1	R8
-      0x70020032,  //  0038  JMP		#006C
+      0x7002003C,  //  0038  JMP		#0076
       0x541E0003,  //  0039  LDINT	R7	4
       0x1C1C0C07,  //  003A  EQ	R7	R6	R7
       0x781E0002,  //  003B  JMPF	R7	#003F
       0x501C0200,  //  003C  LDBOOL	R7	1	0
       0x80040E00,  //  003D  RET	1	R7
-      0x7002002C,  //  003E  JMP		#006C
+      0x70020036,  //  003E  JMP		#0076
       0x541E0004,  //  003F  LDINT	R7	5
       0x1C1C0C07,  //  0040  EQ	R7	R6	R7
       0x781E0002,  //  0041  JMPF	R7	#0045
       0x501C0200,  //  0042  LDBOOL	R7	1	0
       0x80040E00,  //  0043  RET	1	R7
-      0x70020026,  //  0044  JMP		#006C
+      0x70020030,  //  0044  JMP		#0076
       0x541E0005,  //  0045  LDINT	R7	6
       0x1C1C0C07,  //  0046  EQ	R7	R6	R7
       0x781E001E,  //  0047  JMPF	R7	#0067
@@ -579,10 +579,10 @@ be_local_closure(Matter_Plugin_Bridge_Light3_invoke_request,   /* name */
       0x7C240A00,  //  0063  CALL	R9	5
       0x50240200,  //  0064  LDBOOL	R9	1	0
       0x80041200,  //  0065  RET	1	R9
-      0x70020004,  //  0066  JMP		#006C
+      0x7002000E,  //  0066  JMP		#0076
       0x541E0046,  //  0067  LDINT	R7	71
       0x1C1C0C07,  //  0068  EQ	R7	R6	R7
-      0x781E0001,  //  0069  JMPF	R7	#006C
+      0x781E000B,  //  0069  JMPF	R7	#0076
       0x501C0200,  //  006A  LDBOOL	R7	1	0
       0x80040E00,  //  006B  RET	1	R7
       0x70020008,  //  006C  JMP		#0076
@@ -87,18 +87,18 @@ be_local_closure(Matter_Session_close,   /* name */
       0x5C180800,  //  0025  MOVE	R6	R4
       0x7C140200,  //  0026  CALL	R5	1
       0x20140B12,  //  0027  NE	R5	R5	K18
-      0x7816000C,  //  0028  JMPF	R5	#0036
+      0x7815FFF4,  //  0028  JMPF	R5	#001E
       0x60140004,  //  0029  GETGBL	R5	G4
       0x5C180800,  //  002A  MOVE	R6	R4
       0x7C140200,  //  002B  CALL	R5	1
       0x20140B13,  //  002C  NE	R5	R5	K19
-      0x78160007,  //  002D  JMPF	R5	#0036
+      0x7815FFEF,  //  002D  JMPF	R5	#001E
       0x94140708,  //  002E  GETIDX	R5	R3	K8
       0x1C140B14,  //  002F  EQ	R5	R5	K20
-      0x78160004,  //  0030  JMPF	R5	#0036
+      0x7815FFEC,  //  0030  JMPF	R5	#001E
       0x94140715,  //  0031  GETIDX	R5	R3	K21
       0x1C140B14,  //  0032  EQ	R5	R5	K20
-      0x78160001,  //  0033  JMPF	R5	#0036
+      0x7815FFE9,  //  0033  JMPF	R5	#001E
       0x4C140000,  //  0034  LDNIL	R5
       0x90000605,  //  0035  SETMBR	R0	R3	R5
       0x7001FFE6,  //  0036  JMP		#001E
@@ -384,20 +384,20 @@ be_local_closure(Matter_Session_tojson,   /* name */
     /* K9   */  be_nested_str_weak(stop_iteration),
     /* K10  */  be_nested_str_weak(matter),
     /* K11  */  be_nested_str_weak(sort),
-    /* K12  */  be_nested_str_weak(_X24_X24),
-    /* K13  */  be_nested_str_weak(tob64),
+    /* K12  */  be_nested_str_weak(tob64),
+    /* K13  */  be_nested_str_weak(_X24_X24),
     /* K14  */  be_nested_str_weak(instance),
     /* K15  */  be_nested_str_weak(_X25s_X3A_X25s),
     /* K16  */  be_nested_str_weak(dump),
     /* K17  */  be_nested_str_weak(persist_post),
-    /* K18  */  be_nested_str_weak(_X7B),
-    /* K19  */  be_nested_str_weak(concat),
-    /* K20  */  be_nested_str_weak(_X2C),
+    /* K18  */  be_nested_str_weak(concat),
+    /* K19  */  be_nested_str_weak(_X2C),
+    /* K20  */  be_nested_str_weak(_X7B),
     /* K21  */  be_nested_str_weak(_X7D),
     }),
     be_str_weak(tojson),
     &be_const_str_solidified,
-    ( &(const binstruction[95]) {  /* code */
+    ( &(const binstruction[94]) {  /* code */
       0xA4060000,  //  0000  IMPORT	R1	K0
       0xA40A0200,  //  0001  IMPORT	R2	K1
       0x8C0C0102,  //  0002  GETMET	R3	R0	K2
@@ -420,10 +420,10 @@ be_local_closure(Matter_Session_tojson,   /* name */
       0x5C200C00,  //  0013  MOVE	R8	R6
       0x7C1C0200,  //  0014  CALL	R7	1
       0x201C0F05,  //  0015  NE	R7	R7	K5
-      0x781E0005,  //  0016  JMPF	R7	#001D
+      0x781DFFF4,  //  0016  JMPF	R7	#000C
       0x941C0B06,  //  0017  GETIDX	R7	R5	K6
       0x201C0F07,  //  0018  NE	R7	R7	K7
-      0x781E0002,  //  0019  JMPF	R7	#001D
+      0x781DFFF1,  //  0019  JMPF	R7	#000C
       0x8C1C0708,  //  001A  GETMET	R7	R3	K8
       0x5C240A00,  //  001B  MOVE	R9	R5
       0x7C1C0400,  //  001C  CALL	R7	2
@@ -441,7 +441,7 @@ be_local_closure(Matter_Session_tojson,   /* name */
       0x60140010,  //  0028  GETGBL	R5	G16
       0x5C180600,  //  0029  MOVE	R6	R3
       0x7C140200,  //  002A  CALL	R5	1
-      0xA8020027,  //  002B  EXBLK	0	#0054
+      0xA8020026,  //  002B  EXBLK	0	#0053
       0x5C180A00,  //  002C  MOVE	R6	R5
       0x7C180000,  //  002D  CALL	R6	0
       0x8C1C0504,  //  002E  GETMET	R7	R2	K4
@@ -456,43 +456,42 @@ be_local_closure(Matter_Session_tojson,   /* name */
       0x5C240E00,  //  0037  MOVE	R9	R7
       0x60280015,  //  0038  GETGBL	R10	G21
       0x7C200400,  //  0039  CALL	R8	2
-      0x78220004,  //  003A  JMPF	R8	#0040
-      0x8C200F0D,  //  003B  GETMET	R8	R7	K13
+      0x78220003,  //  003A  JMPF	R8	#003F
+      0x8C200F0C,  //  003B  GETMET	R8	R7	K12
       0x7C200200,  //  003C  CALL	R8	1
-      0x00221808,  //  003D  ADD	R8	K12	R8
-      0x5C1C1000,  //  003E  MOVE	R7	R8
-      0x70020005,  //  003F  JMP		#0046
-      0x60200004,  //  0040  GETGBL	R8	G4
-      0x5C240E00,  //  0041  MOVE	R9	R7
-      0x7C200200,  //  0042  CALL	R8	1
-      0x1C20110E,  //  0043  EQ	R8	R8	K14
-      0x78220000,  //  0044  JMPF	R8	#0046
-      0x7001FFE5,  //  0045  JMP		#002C
-      0x8C200908,  //  0046  GETMET	R8	R4	K8
-      0x60280018,  //  0047  GETGBL	R10	G24
-      0x582C000F,  //  0048  LDCONST	R11	K15
-      0x8C300310,  //  0049  GETMET	R12	R1	K16
-      0x60380008,  //  004A  GETGBL	R14	G8
-      0x5C3C0C00,  //  004B  MOVE	R15	R6
-      0x7C380200,  //  004C  CALL	R14	1
-      0x7C300400,  //  004D  CALL	R12	2
-      0x8C340310,  //  004E  GETMET	R13	R1	K16
-      0x5C3C0E00,  //  004F  MOVE	R15	R7
-      0x7C340400,  //  0050  CALL	R13	2
-      0x7C280600,  //  0051  CALL	R10	3
-      0x7C200400,  //  0052  CALL	R8	2
-      0x7001FFD7,  //  0053  JMP		#002C
-      0x58140009,  //  0054  LDCONST	R5	K9
-      0xAC140200,  //  0055  CATCH	R5	1	0
-      0xB0080000,  //  0056  RAISE	2	R0	R0
-      0x8C140111,  //  0057  GETMET	R5	R0	K17
-      0x7C140200,  //  0058  CALL	R5	1
-      0x8C140913,  //  0059  GETMET	R5	R4	K19
-      0x581C0014,  //  005A  LDCONST	R7	K20
-      0x7C140400,  //  005B  CALL	R5	2
-      0x00162405,  //  005C  ADD	R5	K18	R5
-      0x00140B15,  //  005D  ADD	R5	R5	K21
-      0x80040A00,  //  005E  RET	1	R5
+      0x001E1A08,  //  003D  ADD	R7	K13	R8
+      0x70020005,  //  003E  JMP		#0045
+      0x60200004,  //  003F  GETGBL	R8	G4
+      0x5C240E00,  //  0040  MOVE	R9	R7
+      0x7C200200,  //  0041  CALL	R8	1
+      0x1C20110E,  //  0042  EQ	R8	R8	K14
+      0x78220000,  //  0043  JMPF	R8	#0045
+      0x7001FFE6,  //  0044  JMP		#002C
+      0x8C200908,  //  0045  GETMET	R8	R4	K8
+      0x60280018,  //  0046  GETGBL	R10	G24
+      0x582C000F,  //  0047  LDCONST	R11	K15
+      0x8C300310,  //  0048  GETMET	R12	R1	K16
+      0x60380008,  //  0049  GETGBL	R14	G8
+      0x5C3C0C00,  //  004A  MOVE	R15	R6
+      0x7C380200,  //  004B  CALL	R14	1
+      0x7C300400,  //  004C  CALL	R12	2
+      0x8C340310,  //  004D  GETMET	R13	R1	K16
+      0x5C3C0E00,  //  004E  MOVE	R15	R7
+      0x7C340400,  //  004F  CALL	R13	2
+      0x7C280600,  //  0050  CALL	R10	3
+      0x7C200400,  //  0051  CALL	R8	2
+      0x7001FFD8,  //  0052  JMP		#002C
+      0x58140009,  //  0053  LDCONST	R5	K9
+      0xAC140200,  //  0054  CATCH	R5	1	0
+      0xB0080000,  //  0055  RAISE	2	R0	R0
+      0x8C140111,  //  0056  GETMET	R5	R0	K17
+      0x7C140200,  //  0057  CALL	R5	1
+      0x8C140912,  //  0058  GETMET	R5	R4	K18
+      0x581C0013,  //  0059  LDCONST	R7	K19
+      0x7C140400,  //  005A  CALL	R5	2
+      0x00162805,  //  005B  ADD	R5	K20	R5
+      0x00140B15,  //  005C  ADD	R5	R5	K21
+      0x80040A00,  //  005D  RET	1	R5
     })
   )
 );
@@ -524,8 +523,8 @@ be_local_closure(Matter_Session_fromjson,   /* name */
     /* K8   */  be_const_int(0),
     /* K9   */  be_nested_str_weak(set),
     /* K10  */  be_nested_str_weak(fromhex),
-    /* K11  */  be_const_int(2),
-    /* K12  */  be_const_int(2147483647),
+    /* K11  */  be_const_int(2147483647),
+    /* K12  */  be_const_int(2),
     /* K13  */  be_nested_str_weak(_X24_X24),
     /* K14  */  be_nested_str_weak(fromb64),
     /* K15  */  be_nested_str_weak(stop_iteration),
@@ -569,11 +568,11 @@ be_local_closure(Matter_Session_fromjson,   /* name */
       0x60380015,  //  0020  GETGBL	R14	G21
       0x7C380000,  //  0021  CALL	R14	0
       0x8C381D0A,  //  0022  GETMET	R14	R14	K10
-      0x4042170C,  //  0023  CONNECT	R16	K11	K12
+      0x4042190B,  //  0023  CONNECT	R16	K12	K11
       0x94401210,  //  0024  GETIDX	R16	R9	R16
       0x7C380400,  //  0025  CALL	R14	2
       0x7C280800,  //  0026  CALL	R10	4
-      0x70020015,  //  0027  JMP		#003E
+      0x7001FFE6,  //  0027  JMP		#000F
       0x8C280906,  //  0028  GETMET	R10	R4	K6
       0x5C301200,  //  0029  MOVE	R12	R9
       0x5834000D,  //  002A  LDCONST	R13	K13
@@ -586,17 +585,17 @@ be_local_closure(Matter_Session_fromjson,   /* name */
       0x60380015,  //  0031  GETGBL	R14	G21
       0x7C380000,  //  0032  CALL	R14	0
       0x8C381D0E,  //  0033  GETMET	R14	R14	K14
-      0x4042170C,  //  0034  CONNECT	R16	K11	K12
+      0x4042190B,  //  0034  CONNECT	R16	K12	K11
       0x94401210,  //  0035  GETIDX	R16	R9	R16
       0x7C380400,  //  0036  CALL	R14	2
       0x7C280800,  //  0037  CALL	R10	4
-      0x70020004,  //  0038  JMP		#003E
+      0x7001FFD5,  //  0038  JMP		#000F
       0x8C280B09,  //  0039  GETMET	R10	R5	K9
       0x5C300C00,  //  003A  MOVE	R12	R6
       0x5C341000,  //  003B  MOVE	R13	R8
       0x5C381200,  //  003C  MOVE	R14	R9
       0x7C280800,  //  003D  CALL	R10	4
-      0x70020004,  //  003E  JMP		#0044
+      0x7001FFCF,  //  003E  JMP		#000F
       0x8C280B09,  //  003F  GETMET	R10	R5	K9
       0x5C300C00,  //  0040  MOVE	R12	R6
       0x5C341000,  //  0041  MOVE	R13	R8
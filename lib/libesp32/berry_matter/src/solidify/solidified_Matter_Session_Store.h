@@ -41,7 +41,7 @@ be_local_closure(Matter_Session_Store_remove_session,   /* name */
       0x8C100702,  //  000A  GETMET	R4	R3	K2
       0x5C180400,  //  000B  MOVE	R6	R2
       0x7C100400,  //  000C  CALL	R4	2
-      0x70020000,  //  000D  JMP		#000F
+      0x7001FFF3,  //  000D  JMP		#0002
       0x00080503,  //  000E  ADD	R2	R2	K3
       0x7001FFF1,  //  000F  JMP		#0002
       0x80000000,  //  0010  RET	0
@@ -90,7 +90,7 @@ be_local_closure(Matter_Session_Store_gen_local_session_id,   /* name */
       0x7C0C0400,  //  000C  CALL	R3	2
       0x4C100000,  //  000D  LDNIL	R4
       0x1C0C0604,  //  000E  EQ	R3	R3	R4
-      0x780E0000,  //  000F  JMPF	R3	#0011
+      0x780DFFF0,  //  000F  JMPF	R3	#0001
       0x80040400,  //  0010  RET	1	R2
       0x7001FFEE,  //  0011  JMP		#0001
       0x80000000,  //  0012  RET	0
@@ -206,7 +206,7 @@ be_local_closure(Matter_Session_Store_load_fabrics,   /* name */
       0x7C2C0800,  //  003A  CALL	R11	4
       0x4C300000,  //  003B  LDNIL	R12
       0x2030160C,  //  003C  NE	R12	R11	R12
-      0x7832000A,  //  003D  JMPF	R12	#0049
+      0x7831FFF3,  //  003D  JMPF	R12	#0032
       0x8C30170D,  //  003E  GETMET	R12	R11	K13
       0x7C300200,  //  003F  CALL	R12	1
       0x8C30170E,  //  0040  GETMET	R12	R11	K14
@@ -245,7 +245,7 @@ be_local_closure(Matter_Session_Store_load_fabrics,   /* name */
       0xAC040002,  //  0061  CATCH	R1	0	2
       0x7002000F,  //  0062  JMP		#0073
       0x200C0318,  //  0063  NE	R3	R1	K24
-      0x780E000C,  //  0064  JMPF	R3	#0072
+      0x780E000E,  //  0064  JMPF	R3	#0074
       0xB80E1200,  //  0065  GETNGBL	R3	K9
       0x8C0C0715,  //  0066  GETMET	R3	R3	K21
       0x60140008,  //  0067  GETGBL	R5	G8
@@ -314,13 +314,13 @@ be_local_closure(Matter_Session_Store_find_children_fabrics,   /* name */
           0x7C080000,  //  0007  CALL	R2	0
           0x880C0501,  //  0008  GETMBR	R3	R2	K1
           0x1C0C0600,  //  0009  EQ	R3	R3	R0
-          0x780E000D,  //  000A  JMPF	R3	#0019
+          0x780DFFFA,  //  000A  JMPF	R3	#0006
           0x680C0001,  //  000B  GETUPV	R3	U1
           0x8C0C0702,  //  000C  GETMET	R3	R3	K2
           0x7C0C0200,  //  000D  CALL	R3	1
           0x4C100000,  //  000E  LDNIL	R4
           0x1C0C0604,  //  000F  EQ	R3	R3	R4
-          0x780E0007,  //  0010  JMPF	R3	#0019
+          0x780DFFF4,  //  0010  JMPF	R3	#0006
           0x880C0503,  //  0011  GETMBR	R3	R2	K3
           0x68100001,  //  0012  GETUPV	R4	U1
           0x8C100904,  //  0013  GETMET	R4	R4	K4
@@ -446,7 +446,7 @@ be_local_closure(Matter_Session_Store_find_fabric_by_index,   /* name */
       0x8C100701,  //  0007  GETMET	R4	R3	K1
       0x7C100200,  //  0008  CALL	R4	1
       0x1C100801,  //  0009  EQ	R4	R4	R1
-      0x78120001,  //  000A  JMPF	R4	#000D
+      0x7811FFF9,  //  000A  JMPF	R4	#0005
       0xA8040001,  //  000B  EXBLK	1	1
       0x80040600,  //  000C  RET	1	R3
       0x7001FFF6,  //  000D  JMP		#0005
@@ -930,7 +930,7 @@ be_local_closure(Matter_Session_Store_remove_redundant_fabric,   /* name */
       0x8C100904,  //  0013  GETMET	R4	R4	K4
       0x5C180400,  //  0014  MOVE	R6	R2
       0x7C100400,  //  0015  CALL	R4	2
-      0x70020000,  //  0016  JMP		#0018
+      0x7001FFE9,  //  0016  JMP		#0001
       0x00080505,  //  0017  ADD	R2	R2	K5
       0x7001FFE7,  //  0018  JMP		#0001
       0x80000000,  //  0019  RET	0
@@ -1068,7 +1068,7 @@ be_local_closure(Matter_Session_Store_next_fabric_idx,   /* name */
     }),
     be_str_weak(next_fabric_idx),
     &be_const_str_solidified,
-    ( &(const binstruction[25]) {  /* code */
+    ( &(const binstruction[24]) {  /* code */
       0x8C040100,  //  0000  GETMET	R1	R0	K0
       0x7C040200,  //  0001  CALL	R1	1
       0x58040001,  //  0002  LDCONST	R1	K1
@@ -1076,7 +1076,7 @@ be_local_closure(Matter_Session_Store_next_fabric_idx,   /* name */
       0x8C0C0102,  //  0004  GETMET	R3	R0	K2
       0x7C0C0200,  //  0005  CALL	R3	1
       0x7C080200,  //  0006  CALL	R2	1
-      0xA802000C,  //  0007  EXBLK	0	#0015
+      0xA802000B,  //  0007  EXBLK	0	#0014
       0x5C0C0400,  //  0008  MOVE	R3	R2
       0x7C0C0000,  //  0009  CALL	R3	0
       0x88100703,  //  000A  GETMBR	R4	R3	K3
@@ -1084,16 +1084,15 @@ be_local_closure(Matter_Session_Store_next_fabric_idx,   /* name */
       0x5C180800,  //  000C  MOVE	R6	R4
       0x7C140200,  //  000D  CALL	R5	1
       0x1C140B04,  //  000E  EQ	R5	R5	K4
-      0x78160003,  //  000F  JMPF	R5	#0014
+      0x7815FFF7,  //  000F  JMPF	R5	#0008
       0x28140801,  //  0010  GE	R5	R4	R1
-      0x78160001,  //  0011  JMPF	R5	#0014
-      0x00140901,  //  0012  ADD	R5	R4	K1
-      0x5C040A00,  //  0013  MOVE	R1	R5
-      0x7001FFF2,  //  0014  JMP		#0008
-      0x58080005,  //  0015  LDCONST	R2	K5
-      0xAC080200,  //  0016  CATCH	R2	1	0
-      0xB0080000,  //  0017  RAISE	2	R0	R0
-      0x80040200,  //  0018  RET	1	R1
+      0x7815FFF5,  //  0011  JMPF	R5	#0008
+      0x00040901,  //  0012  ADD	R1	R4	K1
+      0x7001FFF3,  //  0013  JMP		#0008
+      0x58080005,  //  0014  LDCONST	R2	K5
+      0xAC080200,  //  0015  CATCH	R2	1	0
+      0xB0080000,  //  0016  RAISE	2	R0	R0
+      0x80040200,  //  0017  RET	1	R1
     })
   )
 );
@@ -1224,9 +1223,9 @@ be_local_closure(Matter_Session_Store_save_fabrics,   /* name */
       0x8C180D19,  //  0047  GETMET	R6	R6	K25
       0x7C180200,  //  0048  CALL	R6	1
       0x1C180903,  //  0049  EQ	R6	R4	K3
-      0x781A000D,  //  004A  JMPF	R6	#0059
+      0x781A0015,  //  004A  JMPF	R6	#0061
       0x1C180703,  //  004B  EQ	R6	R3	K3
-      0x781A000B,  //  004C  JMPF	R6	#0059
+      0x781A0013,  //  004C  JMPF	R6	#0061
       0xB81A2800,  //  004D  GETNGBL	R6	K20
       0x8C180D15,  //  004E  GETMET	R6	R6	K21
       0x60200018,  //  004F  GETGBL	R8	G24
@@ -1368,7 +1367,7 @@ be_local_closure(Matter_Session_Store_remove_fabric,   /* name */
       0x8C0C0703,  //  0010  GETMET	R3	R3	K3
       0x5C140400,  //  0011  MOVE	R5	R2
       0x7C0C0400,  //  0012  CALL	R3	2
-      0x70020000,  //  0013  JMP		#0015
+      0x7001FFF0,  //  0013  JMP		#0005
       0x00080504,  //  0014  ADD	R2	R2	K4
       0x7001FFEE,  //  0015  JMP		#0005
       0x88080105,  //  0016  GETMBR	R2	R0	K5
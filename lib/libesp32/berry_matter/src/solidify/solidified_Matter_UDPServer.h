@@ -248,7 +248,7 @@ be_local_closure(Matter_UDPServer_received_ack,   /* name */
       0x8C180D07,  //  0019  GETMET	R6	R6	K7
       0x54220003,  //  001A  LDINT	R8	4
       0x7C180400,  //  001B  CALL	R6	2
-      0x781A0007,  //  001C  JMPF	R6	#0025
+      0x7819FFE9,  //  001C  JMPF	R6	#0007
       0xB81A0C00,  //  001D  GETNGBL	R6	K6
       0x8C180D08,  //  001E  GETMET	R6	R6	K8
       0x60200008,  //  001F  GETGBL	R8	G8
@@ -257,7 +257,7 @@ be_local_closure(Matter_UDPServer_received_ack,   /* name */
       0x00221208,  //  0022  ADD	R8	K9	R8
       0x54260003,  //  0023  LDINT	R9	4
       0x7C180600,  //  0024  CALL	R6	3
-      0x70020000,  //  0025  JMP		#0027
+      0x7001FFE0,  //  0025  JMP		#0007
       0x0010090A,  //  0026  ADD	R4	R4	K10
       0x7001FFDE,  //  0027  JMP		#0007
       0x80000000,  //  0028  RET	0
@@ -376,7 +376,7 @@ be_local_closure(Matter_UDPServer_send,   /* name */
       0x8C0C0708,  //  0012  GETMET	R3	R3	K8
       0x54160003,  //  0013  LDINT	R5	4
       0x7C0C0400,  //  0014  CALL	R3	2
-      0x780E0008,  //  0015  JMPF	R3	#001F
+      0x780E0017,  //  0015  JMPF	R3	#002E
       0xB80E0E00,  //  0016  GETNGBL	R3	K7
       0x8C0C0709,  //  0017  GETMET	R3	R3	K9
       0x60140018,  //  0018  GETGBL	R5	G24
@@ -547,8 +547,8 @@ be_local_closure(Matter_UDPServer__resend_packets,   /* name */
     /* K5   */  be_nested_str_weak(retries),
     /* K6   */  be_nested_str_weak(RETRIES),
     /* K7   */  be_nested_str_weak(log),
-    /* K8   */  be_nested_str_weak(MTR_X3A_X20_X2E_X20_X20_X20_X20_X20_X20_X20_X20_X20_X20Resending_X20packet_X20id_X3D),
-    /* K9   */  be_nested_str_weak(msg_id),
+    /* K8   */  be_nested_str_weak(msg_id),
+    /* K9   */  be_nested_str_weak(MTR_X3A_X20_X2E_X20_X20_X20_X20_X20_X20_X20_X20_X20_X20Resending_X20packet_X20id_X3D),
     /* K10  */  be_nested_str_weak(send),
     /* K11  */  be_nested_str_weak(millis),
     /* K12  */  be_nested_str_weak(_backoff_time),
@@ -583,9 +583,9 @@ be_local_closure(Matter_UDPServer__resend_packets,   /* name */
       0xB80E0400,  //  0011  GETNGBL	R3	K2
       0x8C0C0707,  //  0012  GETMET	R3	R3	K7
       0x60140008,  //  0013  GETGBL	R5	G8
-      0x88180509,  //  0014  GETMBR	R6	R2	K9
+      0x88180508,  //  0014  GETMBR	R6	R2	K8
       0x7C140200,  //  0015  CALL	R5	1
-      0x00161005,  //  0016  ADD	R5	K8	R5
+      0x00161205,  //  0016  ADD	R5	K9	R5
       0x541A0003,  //  0017  LDINT	R6	4
       0x7C0C0600,  //  0018  CALL	R3	3
       0x8C0C010A,  //  0019  GETMET	R3	R0	K10
@@ -603,7 +603,7 @@ be_local_closure(Matter_UDPServer__resend_packets,   /* name */
       0x000C070D,  //  0025  ADD	R3	R3	K13
       0x900A0A03,  //  0026  SETMBR	R2	K5	R3
       0x0004030D,  //  0027  ADD	R1	R1	K13
-      0x7002000E,  //  0028  JMP		#0038
+      0x7001FFD7,  //  0028  JMP		#0001
       0x880C0101,  //  0029  GETMBR	R3	R0	K1
       0x8C0C070E,  //  002A  GETMET	R3	R3	K14
       0x5C140200,  //  002B  MOVE	R5	R1
@@ -615,11 +615,11 @@ be_local_closure(Matter_UDPServer__resend_packets,   /* name */
       0x881C0510,  //  0031  GETMBR	R7	R2	K16
       0x88200511,  //  0032  GETMBR	R8	R2	K17
       0x88240512,  //  0033  GETMBR	R9	R2	K18
-      0x88280509,  //  0034  GETMBR	R10	R2	K9
+      0x88280508,  //  0034  GETMBR	R10	R2	K8
       0x7C140A00,  //  0035  CALL	R5	5
       0x58180013,  //  0036  LDCONST	R6	K19
       0x7C0C0600,  //  0037  CALL	R3	3
-      0x70020000,  //  0038  JMP		#003A
+      0x7001FFC7,  //  0038  JMP		#0001
       0x0004030D,  //  0039  ADD	R1	R1	K13
       0x7001FFC5,  //  003A  JMP		#0001
       0x80000000,  //  003B  RET	0
@@ -675,8 +675,8 @@ be_local_closure(Matter_UDPServer__backoff_time,   /* name */
     /* K3   */  be_const_int(0),
     /* K4   */  be_const_int(1),
     /* K5   */  be_const_real_hex(0x3FCCCCCD),
-    /* K6   */  be_const_real_hex(0x3F800000),
-    /* K7   */  be_const_real_hex(0x3E800000),
+    /* K6   */  be_const_real_hex(0x3E800000),
+    /* K7   */  be_const_real_hex(0x3F800000),
     }),
     be_str_weak(_backoff_time),
     &be_const_str_solidified,
@@ -703,8 +703,8 @@ be_local_closure(Matter_UDPServer__backoff_time,   /* name */
       0x5C240C00,  //  0013  MOVE	R9	R6
       0x7C1C0400,  //  0014  CALL	R7	2
       0x081C0807,  //  0015  MUL	R7	R4	R7
-      0x08200B07,  //  0016  MUL	R8	R5	K7
-      0x00220C08,  //  0017  ADD	R8	K6	R8
+      0x08200B06,  //  0016  MUL	R8	R5	K6
+      0x00220E08,  //  0017  ADD	R8	K7	R8
       0x081C0E08,  //  0018  MUL	R7	R7	R8
       0x60200009,  //  0019  GETGBL	R8	G9
       0x5C240E00,  //  001A  MOVE	R9	R7
@@ -811,7 +811,7 @@ be_local_closure(Matter_UDPServer_loop,   /* name */
       0x8C180D04,  //  0036  GETMET	R6	R6	K4
       0x7C180200,  //  0037  CALL	R6	1
       0x5C0C0C00,  //  0038  MOVE	R3	R6
-      0x70020000,  //  0039  JMP		#003B
+      0x7001FFD1,  //  0039  JMP		#000C
       0x4C0C0000,  //  003A  LDNIL	R3
       0x7001FFCF,  //  003B  JMP		#000C
       0x8C100113,  //  003C  GETMET	R4	R0	K19
@@ -46,7 +46,7 @@ be_local_closure(Matter_UI_equal_map,   /* name */
       0x94140204,  //  000F  GETIDX	R5	R1	R4
       0x94180004,  //  0010  GETIDX	R6	R0	R4
       0x20140A06,  //  0011  NE	R5	R5	R6
-      0x78160002,  //  0012  JMPF	R5	#0016
+      0x7815FFF2,  //  0012  JMPF	R5	#0006
       0x50140000,  //  0013  LDBOOL	R5	0	0
       0xA8040001,  //  0014  EXBLK	1	1
       0x80040A00,  //  0015  RET	1	R5
@@ -71,7 +71,7 @@ be_local_closure(Matter_UI_equal_map,   /* name */
       0x94140204,  //  0028  GETIDX	R5	R1	R4
       0x94180004,  //  0029  GETIDX	R6	R0	R4
       0x20140A06,  //  002A  NE	R5	R5	R6
-      0x78160002,  //  002B  JMPF	R5	#002F
+      0x7815FFF2,  //  002B  JMPF	R5	#001F
       0x50140000,  //  002C  LDBOOL	R5	0	0
       0xA8040001,  //  002D  EXBLK	1	1
       0x80040A00,  //  002E  RET	1	R5
@@ -336,10 +336,10 @@ be_local_closure(Matter_UI_generate_config_from_status,   /* name */
       0x7C200200,  //  000F  CALL	R8	1
       0x00220408,  //  0010  ADD	R8	K2	R8
       0x7C180400,  //  0011  CALL	R6	2
-      0x781A0002,  //  0012  JMPF	R6	#0016
+      0x781A0004,  //  0012  JMPF	R6	#0018
       0x5C100A00,  //  0013  MOVE	R4	R5
       0x00140B03,  //  0014  ADD	R5	R5	K3
-      0x70020000,  //  0015  JMP		#0017
+      0x7001FFF3,  //  0015  JMP		#000A
       0x70020000,  //  0016  JMP		#0018
       0x7001FFF1,  //  0017  JMP		#000A
       0x4C140000,  //  0018  LDNIL	R5
@@ -801,7 +801,7 @@ be_local_closure(Matter_UI_show_plugins_configuration,   /* name */
       0x7C280400,  //  0091  CALL	R10	2
       0x4C2C0000,  //  0092  LDNIL	R11
       0x202C140B,  //  0093  NE	R11	R10	R11
-      0x782E0002,  //  0094  JMPF	R11	#0098
+      0x782DFFF7,  //  0094  JMPF	R11	#008D
       0x8C2C0F21,  //  0095  GETMET	R11	R7	K33
       0x5C341400,  //  0096  MOVE	R13	R10
       0x7C2C0400,  //  0097  CALL	R11	2
@@ -1087,9 +1087,9 @@ be_local_closure(Matter_UI_show_commissioning_info,   /* name */
       0x58200009,  //  001B  LDCONST	R8	K9
       0x40260B0A,  //  001C  CONNECT	R9	K5	K10
       0x94240809,  //  001D  GETIDX	R9	R4	R9
-      0x542A0003,  //  001E  LDINT	R10	4
-      0x542E0005,  //  001F  LDINT	R11	6
-      0x4028140B,  //  0020  CONNECT	R10	R10	R11
+      0x542A0005,  //  001E  LDINT	R10	6
+      0x542E0003,  //  001F  LDINT	R11	4
+      0x4028160A,  //  0020  CONNECT	R10	R11	R10
       0x9428080A,  //  0021  GETIDX	R10	R4	R10
       0x542E0006,  //  0022  LDINT	R11	7
       0x402C170B,  //  0023  CONNECT	R11	R11	K11
@@ -2242,9 +2242,9 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
     /* K27  */  be_nested_str_weak(matter_enabled),
     /* K28  */  be_nested_str_weak(enable),
     /* K29  */  be_nested_str_weak(cmd),
-    /* K30  */  be_nested_str_weak(SetOption),
-    /* K31  */  be_nested_str_weak(matter),
-    /* K32  */  be_nested_str_weak(MATTER_OPTION),
+    /* K30  */  be_nested_str_weak(matter),
+    /* K31  */  be_nested_str_weak(MATTER_OPTION),
+    /* K32  */  be_nested_str_weak(SetOption),
     /* K33  */  be_nested_str_weak(_X201),
     /* K34  */  be_nested_str_weak(disable),
     /* K35  */  be_nested_str_weak(_X200),
@@ -2418,10 +2418,10 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0xB8261000,  //  0062  GETNGBL	R9	K8
       0x8C24131D,  //  0063  GETMET	R9	R9	K29
       0x602C0008,  //  0064  GETGBL	R11	G8
-      0xB8323E00,  //  0065  GETNGBL	R12	K31
-      0x88301920,  //  0066  GETMBR	R12	R12	K32
+      0xB8323C00,  //  0065  GETNGBL	R12	K30
+      0x8830191F,  //  0066  GETMBR	R12	R12	K31
       0x7C2C0200,  //  0067  CALL	R11	1
-      0x002E3C0B,  //  0068  ADD	R11	K30	R11
+      0x002E400B,  //  0068  ADD	R11	K32	R11
       0x002C1721,  //  0069  ADD	R11	R11	K33
       0x7C240400,  //  006A  CALL	R9	2
       0x70020010,  //  006B  JMP		#007D
@@ -2436,16 +2436,16 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0xB8261000,  //  0074  GETNGBL	R9	K8
       0x8C24131D,  //  0075  GETMET	R9	R9	K29
       0x602C0008,  //  0076  GETGBL	R11	G8
-      0xB8323E00,  //  0077  GETNGBL	R12	K31
-      0x88301920,  //  0078  GETMBR	R12	R12	K32
+      0xB8323C00,  //  0077  GETNGBL	R12	K30
+      0x8830191F,  //  0078  GETMBR	R12	R12	K31
       0x7C2C0200,  //  0079  CALL	R11	1
-      0x002E3C0B,  //  007A  ADD	R11	K30	R11
+      0x002E400B,  //  007A  ADD	R11	K32	R11
       0x002C1723,  //  007B  ADD	R11	R11	K35
       0x7C240400,  //  007C  CALL	R9	2
       0x8C240314,  //  007D  GETMET	R9	R1	K20
       0x582C0015,  //  007E  LDCONST	R11	K21
       0x7C240400,  //  007F  CALL	R9	2
-      0x70020014,  //  0080  JMP		#0096
+      0x700201ED,  //  0080  JMP		#026F
       0x8824010C,  //  0081  GETMBR	R9	R0	K12
       0x88241324,  //  0082  GETMBR	R9	R9	K36
       0x4C280000,  //  0083  LDNIL	R10
@@ -2463,7 +2463,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x8C240314,  //  008F  GETMET	R9	R1	K20
       0x582C0027,  //  0090  LDCONST	R11	K39
       0x7C240400,  //  0091  CALL	R9	2
-      0x70020002,  //  0092  JMP		#0096
+      0x700201DB,  //  0092  JMP		#026F
       0x8C240314,  //  0093  GETMET	R9	R1	K20
       0x582C0027,  //  0094  LDCONST	R11	K39
       0x7C240400,  //  0095  CALL	R9	2
@@ -2504,7 +2504,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x942C1007,  //  00B8  GETIDX	R11	R8	R7
       0x7C240400,  //  00B9  CALL	R9	2
       0x70020002,  //  00BA  JMP		#00BE
-      0x70020000,  //  00BB  JMP		#00BD
+      0x7001FFEF,  //  00BB  JMP		#00AC
       0x001C0F2E,  //  00BC  ADD	R7	R7	K46
       0x7001FFED,  //  00BD  JMP		#00AC
       0x8C240314,  //  00BE  GETMET	R9	R1	K20
@@ -2591,7 +2591,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x7C340400,  //  010F  CALL	R13	2
       0x4C380000,  //  0110  LDNIL	R14
       0x20381A0E,  //  0111  NE	R14	R13	R14
-      0x783A0035,  //  0112  JMPF	R14	#0149
+      0x7839FFD8,  //  0112  JMPF	R14	#00EC
       0xB83A1000,  //  0113  GETNGBL	R14	K8
       0x8C381D09,  //  0114  GETMET	R14	R14	K9
       0x60400018,  //  0115  GETGBL	R16	G24
@@ -2621,7 +2621,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x7C480A00,  //  012D  CALL	R18	5
       0x584C000B,  //  012E  LDCONST	R19	K11
       0x7C400600,  //  012F  CALL	R16	3
-      0x783E0017,  //  0130  JMPF	R15	#0149
+      0x783DFFBA,  //  0130  JMPF	R15	#00EC
       0x50180200,  //  0131  LDBOOL	R6	1	0
       0x8C401B3F,  //  0132  GETMET	R16	R13	K63
       0x5C481A00,  //  0133  MOVE	R18	R13
@@ -2632,7 +2632,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x8C402140,  //  0138  GETMET	R16	R16	K64
       0x5C481400,  //  0139  MOVE	R18	R10
       0x7C400400,  //  013A  CALL	R16	2
-      0x7842000C,  //  013B  JMPF	R16	#0149
+      0x7841FFAF,  //  013B  JMPF	R16	#00EC
       0xB8461000,  //  013C  GETNGBL	R17	K8
       0x8C442309,  //  013D  GETMET	R17	R17	K9
       0x604C0018,  //  013E  GETGBL	R19	G24
@@ -2646,7 +2646,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x8C442142,  //  0146  GETMET	R17	R16	K66
       0x5C4C1800,  //  0147  MOVE	R19	R12
       0x7C440400,  //  0148  CALL	R17	2
-      0x70020007,  //  0149  JMP		#0152
+      0x7001FFA1,  //  0149  JMP		#00EC
       0xB8361000,  //  014A  GETNGBL	R13	K8
       0x8C341B09,  //  014B  GETMET	R13	R13	K9
       0x603C0018,  //  014C  GETGBL	R15	G24
@@ -2655,13 +2655,13 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x7C3C0400,  //  014F  CALL	R15	2
       0x5840000B,  //  0150  LDCONST	R16	K11
       0x7C340600,  //  0151  CALL	R13	3
-      0x70020038,  //  0152  JMP		#018C
+      0x7001FF98,  //  0152  JMP		#00EC
       0x8C280535,  //  0153  GETMET	R10	R2	K53
       0x5C301200,  //  0154  MOVE	R12	R9
       0x58340044,  //  0155  LDCONST	R13	K68
       0x7C280600,  //  0156  CALL	R10	3
       0x1C281529,  //  0157  EQ	R10	R10	K41
-      0x782A0032,  //  0158  JMPF	R10	#018C
+      0x7829FF92,  //  0158  JMPF	R10	#00EC
       0x60280009,  //  0159  GETGBL	R10	G9
       0x402E1736,  //  015A  CONNECT	R11	K11	K54
       0x942C120B,  //  015B  GETIDX	R11	R9	R11
@@ -2678,19 +2678,19 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x7C300400,  //  0166  CALL	R12	2
       0x4C340000,  //  0167  LDNIL	R13
       0x2034180D,  //  0168  NE	R13	R12	R13
-      0x78360021,  //  0169  JMPF	R13	#018C
+      0x7835FF81,  //  0169  JMPF	R13	#00EC
       0x8C341935,  //  016A  GETMET	R13	R12	K53
       0x583C0045,  //  016B  LDCONST	R15	K69
       0x5840003A,  //  016C  LDCONST	R16	K58
       0x7C340600,  //  016D  CALL	R13	3
       0x20381A0B,  //  016E  NE	R14	R13	R11
-      0x783A001B,  //  016F  JMPF	R14	#018C
+      0x7839FF7B,  //  016F  JMPF	R14	#00EC
       0x50180200,  //  0170  LDBOOL	R6	1	0
       0x883C010C,  //  0171  GETMBR	R15	R0	K12
       0x8C3C1F40,  //  0172  GETMET	R15	R15	K64
       0x5C441400,  //  0173  MOVE	R17	R10
       0x7C3C0400,  //  0174  CALL	R15	2
-      0x783E0015,  //  0175  JMPF	R15	#018C
+      0x783DFF75,  //  0175  JMPF	R15	#00EC
       0x8C401F46,  //  0176  GETMET	R16	R15	K70
       0x5C481600,  //  0177  MOVE	R18	R11
       0x7C400400,  //  0178  CALL	R16	2
@@ -2737,7 +2737,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x7C240400,  //  01A1  CALL	R9	2
       0x5828000B,  //  01A2  LDCONST	R10	K11
       0x7C1C0600,  //  01A3  CALL	R7	3
-      0x7002000C,  //  01A4  JMP		#01B2
+      0x700200C9,  //  01A4  JMP		#026F
       0x741A0002,  //  01A5  JMPT	R6	#01A9
       0x881C010C,  //  01A6  GETMBR	R7	R0	K12
       0x881C0F31,  //  01A7  GETMBR	R7	R7	K49
@@ -2863,7 +2863,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x5C4C2000,  //  021F  MOVE	R19	R16
       0x5C501A00,  //  0220  MOVE	R20	R13
       0x7C440600,  //  0221  CALL	R17	3
-      0x78460001,  //  0222  JMPF	R17	#0225
+      0x7845FFF8,  //  0222  JMPF	R17	#021C
       0x50380200,  //  0223  LDBOOL	R14	1	0
       0x70020000,  //  0224  JMP		#0226
       0x7001FFF5,  //  0225  JMP		#021C
@@ -2917,7 +2917,7 @@ be_local_closure(Matter_UI_page_part_ctl,   /* name */
       0x58340057,  //  0255  LDCONST	R13	K87
       0x7C280600,  //  0256  CALL	R10	3
       0x1C281529,  //  0257  EQ	R10	R10	K41
-      0x782A0005,  //  0258  JMPF	R10	#025F
+      0x7829FFF4,  //  0258  JMPF	R10	#024E
       0x60280009,  //  0259  GETGBL	R10	G9
       0x402E1736,  //  025A  CONNECT	R11	K11	K54
       0x942C120B,  //  025B  GETIDX	R11	R9	R11
@@ -3027,8 +3027,8 @@ be_local_closure(Matter_UI_show_qrcode,   /* name */
     /* K12  */  be_nested_str_weak(_X3Cdiv_X20style_X3D_X27transform_X3Ascale_X28_X2E8_X2C1_X29_X3B_X20display_X3Ainline_X2Dblock_X3B_X27_X3E),
     /* K13  */  be_nested_str_weak(_X3Cdiv_X20class_X3D_X27qr_X27_X3E),
     /* K14  */  be_nested_str_weak(),
-    /* K15  */  be_const_int(0),
-    /* K16  */  be_const_int(1),
+    /* K15  */  be_const_int(1),
+    /* K16  */  be_const_int(0),
     /* K17  */  be_nested_str_weak(stop_iteration),
     /* K18  */  be_nested_str_weak(_X3C_X2Fdiv_X3E),
     /* K19  */  be_const_int(2),
@@ -3037,7 +3037,7 @@ be_local_closure(Matter_UI_show_qrcode,   /* name */
     }),
     be_str_weak(show_qrcode),
     &be_const_str_solidified,
-    ( &(const binstruction[120]) {  /* code */
+    ( &(const binstruction[119]) {  /* code */
       0xA40A0000,  //  0000  IMPORT	R2	K0
       0x580C0001,  //  0001  LDCONST	R3	K1
       0x58100002,  //  0002  LDCONST	R4	K2
@@ -3062,8 +3062,8 @@ be_local_closure(Matter_UI_show_qrcode,   /* name */
       0x7C2C0400,  //  0015  CALL	R11	2
       0x5828000E,  //  0016  LDCONST	R10	K14
       0x602C0010,  //  0017  GETGBL	R11	G16
-      0x00301310,  //  0018  ADD	R12	R9	K16
-      0x40321E0C,  //  0019  CONNECT	R12	K15	R12
+      0x0030130F,  //  0018  ADD	R12	R9	K15
+      0x4032200C,  //  0019  CONNECT	R12	K16	R12
       0x7C2C0200,  //  001A  CALL	R11	1
       0xA8020003,  //  001B  EXBLK	0	#0020
       0x5C301600,  //  001C  MOVE	R12	R11
@@ -3078,86 +3078,85 @@ be_local_closure(Matter_UI_show_qrcode,   /* name */
       0x5C341400,  //  0025  MOVE	R13	R10
       0x7C2C0400,  //  0026  CALL	R11	2
       0x602C0010,  //  0027  GETGBL	R11	G16
-      0x00301310,  //  0028  ADD	R12	R9	K16
+      0x0030130F,  //  0028  ADD	R12	R9	K15
       0x0C301913,  //  0029  DIV	R12	R12	K19
-      0x04301910,  //  002A  SUB	R12	R12	K16
-      0x40321E0C,  //  002B  CONNECT	R12	K15	R12
+      0x0430190F,  //  002A  SUB	R12	R12	K15
+      0x4032200C,  //  002B  CONNECT	R12	K16	R12
       0x7C2C0200,  //  002C  CALL	R11	1
-      0xA802002E,  //  002D  EXBLK	0	#005D
+      0xA802002D,  //  002D  EXBLK	0	#005C
       0x5C301600,  //  002E  MOVE	R12	R11
       0x7C300000,  //  002F  CALL	R12	0
-      0x00362806,  //  0030  ADD	R13	K20	R6
-      0x5C281A00,  //  0031  MOVE	R10	R13
-      0x60340010,  //  0032  GETGBL	R13	G16
-      0x04381310,  //  0033  SUB	R14	R9	K16
-      0x403A1E0E,  //  0034  CONNECT	R14	K15	R14
-      0x7C340200,  //  0035  CALL	R13	1
-      0xA802001C,  //  0036  EXBLK	0	#0054
-      0x5C381A00,  //  0037  MOVE	R14	R13
-      0x7C380000,  //  0038  CALL	R14	0
-      0x083C1913,  //  0039  MUL	R15	R12	K19
-      0x943C100F,  //  003A  GETIDX	R15	R8	R15
-      0x943C1E0E,  //  003B  GETIDX	R15	R15	R14
-      0x1C3C1F01,  //  003C  EQ	R15	R15	K1
-      0x08401913,  //  003D  MUL	R16	R12	K19
-      0x00402110,  //  003E  ADD	R16	R16	K16
-      0x14402009,  //  003F  LT	R16	R16	R9
-      0x78420005,  //  0040  JMPF	R16	#0047
-      0x08401913,  //  0041  MUL	R16	R12	K19
-      0x00402110,  //  0042  ADD	R16	R16	K16
-      0x94401010,  //  0043  GETIDX	R16	R8	R16
-      0x9440200E,  //  0044  GETIDX	R16	R16	R14
-      0x1C402101,  //  0045  EQ	R16	R16	K1
-      0x70020000,  //  0046  JMP		#0048
-      0x50400200,  //  0047  LDBOOL	R16	1	0
-      0x783E0004,  //  0048  JMPF	R15	#004E
-      0x78420001,  //  0049  JMPF	R16	#004C
-      0x5C440C00,  //  004A  MOVE	R17	R6
-      0x70020000,  //  004B  JMP		#004D
-      0x5C440A00,  //  004C  MOVE	R17	R5
-      0x70020003,  //  004D  JMP		#0052
-      0x78420001,  //  004E  JMPF	R16	#0051
-      0x5C440800,  //  004F  MOVE	R17	R4
-      0x70020000,  //  0050  JMP		#0052
-      0x5C440600,  //  0051  MOVE	R17	R3
-      0x00281411,  //  0052  ADD	R10	R10	R17
-      0x7001FFE2,  //  0053  JMP		#0037
-      0x58340011,  //  0054  LDCONST	R13	K17
-      0xAC340200,  //  0055  CATCH	R13	1	0
-      0xB0080000,  //  0056  RAISE	2	R0	R0
-      0x00281406,  //  0057  ADD	R10	R10	R6
-      0x00281512,  //  0058  ADD	R10	R10	K18
-      0x8C34050A,  //  0059  GETMET	R13	R2	K10
-      0x5C3C1400,  //  005A  MOVE	R15	R10
-      0x7C340400,  //  005B  CALL	R13	2
-      0x7001FFD0,  //  005C  JMP		#002E
-      0x582C0011,  //  005D  LDCONST	R11	K17
-      0xAC2C0200,  //  005E  CATCH	R11	1	0
-      0xB0080000,  //  005F  RAISE	2	R0	R0
-      0x102C1313,  //  0060  MOD	R11	R9	K19
-      0x1C2C170F,  //  0061  EQ	R11	R11	K15
-      0x782E0010,  //  0062  JMPF	R11	#0074
-      0x58280014,  //  0063  LDCONST	R10	K20
-      0x602C0010,  //  0064  GETGBL	R11	G16
-      0x00301310,  //  0065  ADD	R12	R9	K16
-      0x40321E0C,  //  0066  CONNECT	R12	K15	R12
-      0x7C2C0200,  //  0067  CALL	R11	1
-      0xA8020003,  //  0068  EXBLK	0	#006D
-      0x5C301600,  //  0069  MOVE	R12	R11
-      0x7C300000,  //  006A  CALL	R12	0
-      0x00281405,  //  006B  ADD	R10	R10	R5
-      0x7001FFFB,  //  006C  JMP		#0069
-      0x582C0011,  //  006D  LDCONST	R11	K17
-      0xAC2C0200,  //  006E  CATCH	R11	1	0
-      0xB0080000,  //  006F  RAISE	2	R0	R0
-      0x00281515,  //  0070  ADD	R10	R10	K21
-      0x8C2C050A,  //  0071  GETMET	R11	R2	K10
-      0x5C341400,  //  0072  MOVE	R13	R10
-      0x7C2C0400,  //  0073  CALL	R11	2
-      0x8C2C050A,  //  0074  GETMET	R11	R2	K10
-      0x58340012,  //  0075  LDCONST	R13	K18
-      0x7C2C0400,  //  0076  CALL	R11	2
-      0x80000000,  //  0077  RET	0
+      0x002A2806,  //  0030  ADD	R10	K20	R6
+      0x60340010,  //  0031  GETGBL	R13	G16
+      0x0438130F,  //  0032  SUB	R14	R9	K15
+      0x403A200E,  //  0033  CONNECT	R14	K16	R14
+      0x7C340200,  //  0034  CALL	R13	1
+      0xA802001C,  //  0035  EXBLK	0	#0053
+      0x5C381A00,  //  0036  MOVE	R14	R13
+      0x7C380000,  //  0037  CALL	R14	0
+      0x083C1913,  //  0038  MUL	R15	R12	K19
+      0x943C100F,  //  0039  GETIDX	R15	R8	R15
+      0x943C1E0E,  //  003A  GETIDX	R15	R15	R14
+      0x1C3C1F01,  //  003B  EQ	R15	R15	K1
+      0x08401913,  //  003C  MUL	R16	R12	K19
+      0x0040210F,  //  003D  ADD	R16	R16	K15
+      0x14402009,  //  003E  LT	R16	R16	R9
+      0x78420005,  //  003F  JMPF	R16	#0046
+      0x08401913,  //  0040  MUL	R16	R12	K19
+      0x0040210F,  //  0041  ADD	R16	R16	K15
+      0x94401010,  //  0042  GETIDX	R16	R8	R16
+      0x9440200E,  //  0043  GETIDX	R16	R16	R14
+      0x1C402101,  //  0044  EQ	R16	R16	K1
+      0x70020000,  //  0045  JMP		#0047
+      0x50400200,  //  0046  LDBOOL	R16	1	0
+      0x783E0004,  //  0047  JMPF	R15	#004D
+      0x78420001,  //  0048  JMPF	R16	#004B
+      0x5C440C00,  //  0049  MOVE	R17	R6
+      0x70020005,  //  004A  JMP		#0051
+      0x5C440A00,  //  004B  MOVE	R17	R5
+      0x70020003,  //  004C  JMP		#0051
+      0x78420001,  //  004D  JMPF	R16	#0050
+      0x5C440800,  //  004E  MOVE	R17	R4
+      0x70020000,  //  004F  JMP		#0051
+      0x5C440600,  //  0050  MOVE	R17	R3
+      0x00281411,  //  0051  ADD	R10	R10	R17
+      0x7001FFE2,  //  0052  JMP		#0036
+      0x58340011,  //  0053  LDCONST	R13	K17
+      0xAC340200,  //  0054  CATCH	R13	1	0
+      0xB0080000,  //  0055  RAISE	2	R0	R0
+      0x00281406,  //  0056  ADD	R10	R10	R6
+      0x00281512,  //  0057  ADD	R10	R10	K18
+      0x8C34050A,  //  0058  GETMET	R13	R2	K10
+      0x5C3C1400,  //  0059  MOVE	R15	R10
+      0x7C340400,  //  005A  CALL	R13	2
+      0x7001FFD1,  //  005B  JMP		#002E
+      0x582C0011,  //  005C  LDCONST	R11	K17
+      0xAC2C0200,  //  005D  CATCH	R11	1	0
+      0xB0080000,  //  005E  RAISE	2	R0	R0
+      0x102C1313,  //  005F  MOD	R11	R9	K19
+      0x1C2C1710,  //  0060  EQ	R11	R11	K16
+      0x782E0010,  //  0061  JMPF	R11	#0073
+      0x58280014,  //  0062  LDCONST	R10	K20
+      0x602C0010,  //  0063  GETGBL	R11	G16
+      0x0030130F,  //  0064  ADD	R12	R9	K15
+      0x4032200C,  //  0065  CONNECT	R12	K16	R12
+      0x7C2C0200,  //  0066  CALL	R11	1
+      0xA8020003,  //  0067  EXBLK	0	#006C
+      0x5C301600,  //  0068  MOVE	R12	R11
+      0x7C300000,  //  0069  CALL	R12	0
+      0x00281405,  //  006A  ADD	R10	R10	R5
+      0x7001FFFB,  //  006B  JMP		#0068
+      0x582C0011,  //  006C  LDCONST	R11	K17
+      0xAC2C0200,  //  006D  CATCH	R11	1	0
+      0xB0080000,  //  006E  RAISE	2	R0	R0
+      0x00281515,  //  006F  ADD	R10	R10	K21
+      0x8C2C050A,  //  0070  GETMET	R11	R2	K10
+      0x5C341400,  //  0071  MOVE	R13	R10
+      0x7C2C0400,  //  0072  CALL	R11	2
+      0x8C2C050A,  //  0073  GETMET	R11	R2	K10
+      0x58340012,  //  0074  LDCONST	R13	K18
+      0x7C2C0400,  //  0075  CALL	R11	2
+      0x80000000,  //  0076  RET	0
     })
   )
 );
@@ -3335,11 +3334,11 @@ be_local_closure(Matter_UI_show_plugins_hints_js,   /* name */
       0x7C280400,  //  0025  CALL	R10	2
       0x4C2C0000,  //  0026  LDNIL	R11
       0x202C140B,  //  0027  NE	R11	R10	R11
-      0x782E0011,  //  0028  JMPF	R11	#003B
+      0x782DFFF2,  //  0028  JMPF	R11	#001C
       0x882C150A,  //  0029  GETMBR	R11	R10	K10
       0x4C300000,  //  002A  LDNIL	R12
       0x2030160C,  //  002B  NE	R12	R11	R12
-      0x7832000D,  //  002C  JMPF	R12	#003B
+      0x7831FFEE,  //  002C  JMPF	R12	#001C
       0x8C300F09,  //  002D  GETMET	R12	R7	K9
       0x5C381600,  //  002E  MOVE	R14	R11
       0x7C300400,  //  002F  CALL	R12	2
@@ -67,6 +67,8 @@ extern int l_getswitch(bvm *vm);
 extern int l_i2cenabled(bvm *vm);
 extern int tasm_find_op(bvm *vm);
 extern int tasm_apply_str_op(bvm *vm);
+extern int tasm_heap_push(bvm *vm);
+extern int tasm_heap_pop(bvm *vm);
 
 // tasmota.version() -> int
 extern int32_t be_Tasmota_version(void);
@@ -85,10 +87,12 @@ BE_FUNC_CTYPE_DECLARE(BerryBECLoader, "b", "s")
 class be_class_tasmota (scope: global, name: Tasmota) {
     _fl, var                            // list of active fast-loop object (faster than drivers)
     _rules, var                         // list of active rules
-    _timers, var                        // list of active timers
-    _crons, var                         // list of active crons
+    _rules_idx, var                     // index of rules by first key of pattern
+    _timers, var                        // list of active timers, min-heap by deadline
+    _crons, var                         // list of active crons, min-heap by next trigger time
     _ccmd, var                          // list of active Tasmota commands implemented in Berry
     _drivers, var                       // list of active drivers
+    _drivers_ev, var                    // cache of drivers methods per event name
     wire1, var                          // Tasmota I2C Wire1
     wire2, var                          // Tasmota I2C Wire2
     cmd_res, var                        // store the command result, nil if disables, true if capture enabled, contains return value
@@ -166,9 +170,14 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     find_op, closure(Tasmota_find_op_closure)
     add_rule, closure(Tasmota_add_rule_closure)
     remove_rule, closure(Tasmota_remove_rule_closure)
+    _rules_index, closure(Tasmota__rules_index_closure)
+    _rules_candidates, closure(Tasmota__rules_candidates_closure)
     try_rule, closure(Tasmota_try_rule_closure)
     exec_rules, closure(Tasmota_exec_rules_closure)
     exec_tele, closure(Tasmota_exec_tele_closure)
+    _heap_push, static_func(tasm_heap_push)
+    _heap_pop, static_func(tasm_heap_pop)
+    _heap_remove, closure(Tasmota__heap_remove_closure)
     set_timer, closure(Tasmota_set_timer_closure)
     run_deferred, closure(Tasmota_run_deferred_closure)
     remove_timer, closure(Tasmota_remove_timer_closure)
@@ -176,6 +185,7 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     remove_cmd, closure(Tasmota_remove_cmd_closure)
     exec_cmd, closure(Tasmota_exec_cmd_closure)
     gc, closure(Tasmota_gc_closure)
+    _event_handlers, closure(Tasmota__event_handlers_closure)
     event, closure(Tasmota_event_closure)
     add_driver, closure(Tasmota_add_driver_closure)
     remove_driver, closure(Tasmota_remove_driver_closure)
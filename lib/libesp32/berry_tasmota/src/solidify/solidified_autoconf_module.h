@@ -232,7 +232,7 @@ be_local_closure(Autoconf_autoexec,   /* name */
     }),
     &be_const_str_autoexec,
     &be_const_str_solidified,
-    ( &(const binstruction[147]) {  /* code */
+    ( &(const binstruction[144]) {  /* code */
       0x88040100,  //  0000  GETMBR	R1	R0	K0
       0x4C080000,  //  0001  LDNIL	R2
       0x1C040202,  //  0002  EQ	R1	R1	R2
@@ -262,124 +262,121 @@ be_local_closure(Autoconf_autoexec,   /* name */
       0x50080200,  //  001A  LDBOOL	R2	1	0
       0x80000800,  //  001B  RET	0
       0x88100100,  //  001C  GETMBR	R4	R0	K0
-      0x0010090B,  //  001D  ADD	R4	R4	K11
-      0x5C0C0800,  //  001E  MOVE	R3	R4
-      0x8C100304,  //  001F  GETMET	R4	R1	K4
-      0x5C180600,  //  0020  MOVE	R6	R3
-      0x7C100400,  //  0021  CALL	R4	2
-      0x78120040,  //  0022  JMPF	R4	#0064
-      0x8C100103,  //  0023  GETMET	R4	R0	K3
-      0x7C100200,  //  0024  CALL	R4	1
-      0x74120003,  //  0025  JMPT	R4	#002A
-      0x8C100304,  //  0026  GETMET	R4	R1	K4
-      0x5818000C,  //  0027  LDCONST	R6	K12
-      0x7C100400,  //  0028  CALL	R4	2
-      0x74120039,  //  0029  JMPT	R4	#0064
-      0x8C100103,  //  002A  GETMET	R4	R0	K3
-      0x7C100200,  //  002B  CALL	R4	1
-      0x78120003,  //  002C  JMPF	R4	#0031
-      0x5C100400,  //  002D  MOVE	R4	R2
-      0x74120001,  //  002E  JMPT	R4	#0031
-      0x8C100105,  //  002F  GETMET	R4	R0	K5
-      0x7C100200,  //  0030  CALL	R4	1
-      0x4C100000,  //  0031  LDNIL	R4
-      0x4C140000,  //  0032  LDNIL	R5
-      0xA802001A,  //  0033  EXBLK	0	#004F
-      0x60180011,  //  0034  GETGBL	R6	G17
-      0x5C1C0600,  //  0035  MOVE	R7	R3
-      0x5820000D,  //  0036  LDCONST	R8	K13
-      0x7C180400,  //  0037  CALL	R6	2
-      0x5C100C00,  //  0038  MOVE	R4	R6
-      0x60180011,  //  0039  GETGBL	R6	G17
-      0x581C000C,  //  003A  LDCONST	R7	K12
-      0x5820000E,  //  003B  LDCONST	R8	K14
-      0x7C180400,  //  003C  CALL	R6	2
-      0x5C140C00,  //  003D  MOVE	R5	R6
-      0x8C18090F,  //  003E  GETMET	R6	R4	K15
-      0x7C180200,  //  003F  CALL	R6	1
-      0x8C1C0B10,  //  0040  GETMET	R7	R5	K16
-      0x5C240C00,  //  0041  MOVE	R9	R6
-      0x7C1C0400,  //  0042  CALL	R7	2
-      0x8C1C0911,  //  0043  GETMET	R7	R4	K17
-      0x7C1C0200,  //  0044  CALL	R7	1
-      0x8C1C0B11,  //  0045  GETMET	R7	R5	K17
-      0x7C1C0200,  //  0046  CALL	R7	1
-      0x50080200,  //  0047  LDBOOL	R2	1	0
-      0xB81E0E00,  //  0048  GETNGBL	R7	K7
-      0x8C1C0F08,  //  0049  GETMET	R7	R7	K8
-      0x58240012,  //  004A  LDCONST	R9	K18
-      0x5828000A,  //  004B  LDCONST	R10	K10
-      0x7C1C0600,  //  004C  CALL	R7	3
-      0xA8040001,  //  004D  EXBLK	1	1
-      0x70020014,  //  004E  JMP		#0064
-      0xAC180002,  //  004F  CATCH	R6	0	2
-      0x70020011,  //  0050  JMP		#0063
-      0x60200001,  //  0051  GETGBL	R8	G1
-      0x60240018,  //  0052  GETGBL	R9	G24
-      0x58280013,  //  0053  LDCONST	R10	K19
-      0x5C2C0C00,  //  0054  MOVE	R11	R6
-      0x5C300E00,  //  0055  MOVE	R12	R7
-      0x7C240600,  //  0056  CALL	R9	3
-      0x7C200200,  //  0057  CALL	R8	1
-      0x4C200000,  //  0058  LDNIL	R8
-      0x20200808,  //  0059  NE	R8	R4	R8
-      0x78220001,  //  005A  JMPF	R8	#005D
-      0x8C200911,  //  005B  GETMET	R8	R4	K17
-      0x7C200200,  //  005C  CALL	R8	1
-      0x4C200000,  //  005D  LDNIL	R8
-      0x20200A08,  //  005E  NE	R8	R5	R8
-      0x78220001,  //  005F  JMPF	R8	#0062
-      0x8C200B11,  //  0060  GETMET	R8	R5	K17
-      0x7C200200,  //  0061  CALL	R8	1
-      0x70020000,  //  0062  JMP		#0064
-      0xB0080000,  //  0063  RAISE	2	R0	R0
-      0x780A0004,  //  0064  JMPF	R2	#006A
-      0xB8120E00,  //  0065  GETNGBL	R4	K7
-      0x8C100914,  //  0066  GETMET	R4	R4	K20
-      0x58180015,  //  0067  LDCONST	R6	K21
-      0x7C100400,  //  0068  CALL	R4	2
-      0x80000800,  //  0069  RET	0
-      0x88100100,  //  006A  GETMBR	R4	R0	K0
-      0x00100916,  //  006B  ADD	R4	R4	K22
-      0x5C0C0800,  //  006C  MOVE	R3	R4
-      0x8C100304,  //  006D  GETMET	R4	R1	K4
-      0x5C180600,  //  006E  MOVE	R6	R3
-      0x7C100400,  //  006F  CALL	R4	2
-      0x7812000C,  //  0070  JMPF	R4	#007E
-      0xB8120E00,  //  0071  GETNGBL	R4	K7
-      0x8C100908,  //  0072  GETMET	R4	R4	K8
-      0x001A2E03,  //  0073  ADD	R6	K23	R3
-      0x581C0018,  //  0074  LDCONST	R7	K24
-      0x7C100600,  //  0075  CALL	R4	3
-      0x8C100106,  //  0076  GETMET	R4	R0	K6
-      0x5C180600,  //  0077  MOVE	R6	R3
-      0x7C100400,  //  0078  CALL	R4	2
-      0xB8120E00,  //  0079  GETNGBL	R4	K7
-      0x8C100908,  //  007A  GETMET	R4	R4	K8
-      0x001A3203,  //  007B  ADD	R6	K25	R3
-      0x581C0018,  //  007C  LDCONST	R7	K24
-      0x7C100600,  //  007D  CALL	R4	3
-      0x88100100,  //  007E  GETMBR	R4	R0	K0
-      0x0010091A,  //  007F  ADD	R4	R4	K26
-      0x5C0C0800,  //  0080  MOVE	R3	R4
-      0x8C100304,  //  0081  GETMET	R4	R1	K4
-      0x5C180600,  //  0082  MOVE	R6	R3
-      0x7C100400,  //  0083  CALL	R4	2
-      0x7812000C,  //  0084  JMPF	R4	#0092
-      0xB8120E00,  //  0085  GETNGBL	R4	K7
-      0x8C100908,  //  0086  GETMET	R4	R4	K8
-      0x001A3603,  //  0087  ADD	R6	K27	R3
-      0x581C0018,  //  0088  LDCONST	R7	K24
-      0x7C100600,  //  0089  CALL	R4	3
-      0xB8123800,  //  008A  GETNGBL	R4	K28
-      0x5C140600,  //  008B  MOVE	R5	R3
-      0x7C100200,  //  008C  CALL	R4	1
-      0xB8120E00,  //  008D  GETNGBL	R4	K7
-      0x8C100908,  //  008E  GETMET	R4	R4	K8
-      0x001A3A03,  //  008F  ADD	R6	K29	R3
-      0x581C0018,  //  0090  LDCONST	R7	K24
-      0x7C100600,  //  0091  CALL	R4	3
-      0x80000000,  //  0092  RET	0
+      0x000C090B,  //  001D  ADD	R3	R4	K11
+      0x8C100304,  //  001E  GETMET	R4	R1	K4
+      0x5C180600,  //  001F  MOVE	R6	R3
+      0x7C100400,  //  0020  CALL	R4	2
+      0x78120040,  //  0021  JMPF	R4	#0063
+      0x8C100103,  //  0022  GETMET	R4	R0	K3
+      0x7C100200,  //  0023  CALL	R4	1
+      0x74120003,  //  0024  JMPT	R4	#0029
+      0x8C100304,  //  0025  GETMET	R4	R1	K4
+      0x5818000C,  //  0026  LDCONST	R6	K12
+      0x7C100400,  //  0027  CALL	R4	2
+      0x74120039,  //  0028  JMPT	R4	#0063
+      0x8C100103,  //  0029  GETMET	R4	R0	K3
+      0x7C100200,  //  002A  CALL	R4	1
+      0x78120003,  //  002B  JMPF	R4	#0030
+      0x5C100400,  //  002C  MOVE	R4	R2
+      0x74120001,  //  002D  JMPT	R4	#0030
+      0x8C100105,  //  002E  GETMET	R4	R0	K5
+      0x7C100200,  //  002F  CALL	R4	1
+      0x4C100000,  //  0030  LDNIL	R4
+      0x4C140000,  //  0031  LDNIL	R5
+      0xA802001A,  //  0032  EXBLK	0	#004E
+      0x60180011,  //  0033  GETGBL	R6	G17
+      0x5C1C0600,  //  0034  MOVE	R7	R3
+      0x5820000D,  //  0035  LDCONST	R8	K13
+      0x7C180400,  //  0036  CALL	R6	2
+      0x5C100C00,  //  0037  MOVE	R4	R6
+      0x60180011,  //  0038  GETGBL	R6	G17
+      0x581C000C,  //  0039  LDCONST	R7	K12
+      0x5820000E,  //  003A  LDCONST	R8	K14
+      0x7C180400,  //  003B  CALL	R6	2
+      0x5C140C00,  //  003C  MOVE	R5	R6
+      0x8C18090F,  //  003D  GETMET	R6	R4	K15
+      0x7C180200,  //  003E  CALL	R6	1
+      0x8C1C0B10,  //  003F  GETMET	R7	R5	K16
+      0x5C240C00,  //  0040  MOVE	R9	R6
+      0x7C1C0400,  //  0041  CALL	R7	2
+      0x8C1C0911,  //  0042  GETMET	R7	R4	K17
+      0x7C1C0200,  //  0043  CALL	R7	1
+      0x8C1C0B11,  //  0044  GETMET	R7	R5	K17
+      0x7C1C0200,  //  0045  CALL	R7	1
+      0x50080200,  //  0046  LDBOOL	R2	1	0
+      0xB81E0E00,  //  0047  GETNGBL	R7	K7
+      0x8C1C0F08,  //  0048  GETMET	R7	R7	K8
+      0x58240012,  //  0049  LDCONST	R9	K18
+      0x5828000A,  //  004A  LDCONST	R10	K10
+      0x7C1C0600,  //  004B  CALL	R7	3
+      0xA8040001,  //  004C  EXBLK	1	1
+      0x70020014,  //  004D  JMP		#0063
+      0xAC180002,  //  004E  CATCH	R6	0	2
+      0x70020011,  //  004F  JMP		#0062
+      0x60200001,  //  0050  GETGBL	R8	G1
+      0x60240018,  //  0051  GETGBL	R9	G24
+      0x58280013,  //  0052  LDCONST	R10	K19
+      0x5C2C0C00,  //  0053  MOVE	R11	R6
+      0x5C300E00,  //  0054  MOVE	R12	R7
+      0x7C240600,  //  0055  CALL	R9	3
+      0x7C200200,  //  0056  CALL	R8	1
+      0x4C200000,  //  0057  LDNIL	R8
+      0x20200808,  //  0058  NE	R8	R4	R8
+      0x78220001,  //  0059  JMPF	R8	#005C
+      0x8C200911,  //  005A  GETMET	R8	R4	K17
+      0x7C200200,  //  005B  CALL	R8	1
+      0x4C200000,  //  005C  LDNIL	R8
+      0x20200A08,  //  005D  NE	R8	R5	R8
+      0x78220003,  //  005E  JMPF	R8	#0063
+      0x8C200B11,  //  005F  GETMET	R8	R5	K17
+      0x7C200200,  //  0060  CALL	R8	1
+      0x70020000,  //  0061  JMP		#0063
+      0xB0080000,  //  0062  RAISE	2	R0	R0
+      0x780A0004,  //  0063  JMPF	R2	#0069
+      0xB8120E00,  //  0064  GETNGBL	R4	K7
+      0x8C100914,  //  0065  GETMET	R4	R4	K20
+      0x58180015,  //  0066  LDCONST	R6	K21
+      0x7C100400,  //  0067  CALL	R4	2
+      0x80000800,  //  0068  RET	0
+      0x88100100,  //  0069  GETMBR	R4	R0	K0
+      0x000C0916,  //  006A  ADD	R3	R4	K22
+      0x8C100304,  //  006B  GETMET	R4	R1	K4
+      0x5C180600,  //  006C  MOVE	R6	R3
+      0x7C100400,  //  006D  CALL	R4	2
+      0x7812000C,  //  006E  JMPF	R4	#007C
+      0xB8120E00,  //  006F  GETNGBL	R4	K7
+      0x8C100908,  //  0070  GETMET	R4	R4	K8
+      0x001A2E03,  //  0071  ADD	R6	K23	R3
+      0x581C0018,  //  0072  LDCONST	R7	K24
+      0x7C100600,  //  0073  CALL	R4	3
+      0x8C100106,  //  0074  GETMET	R4	R0	K6
+      0x5C180600,  //  0075  MOVE	R6	R3
+      0x7C100400,  //  0076  CALL	R4	2
+      0xB8120E00,  //  0077  GETNGBL	R4	K7
+      0x8C100908,  //  0078  GETMET	R4	R4	K8
+      0x001A3203,  //  0079  ADD	R6	K25	R3
+      0x581C0018,  //  007A  LDCONST	R7	K24
+      0x7C100600,  //  007B  CALL	R4	3
+      0x88100100,  //  007C  GETMBR	R4	R0	K0
+      0x000C091A,  //  007D  ADD	R3	R4	K26
+      0x8C100304,  //  007E  GETMET	R4	R1	K4
+      0x5C180600,  //  007F  MOVE	R6	R3
+      0x7C100400,  //  0080  CALL	R4	2
+      0x7812000C,  //  0081  JMPF	R4	#008F
+      0xB8120E00,  //  0082  GETNGBL	R4	K7
+      0x8C100908,  //  0083  GETMET	R4	R4	K8
+      0x001A3603,  //  0084  ADD	R6	K27	R3
+      0x581C0018,  //  0085  LDCONST	R7	K24
+      0x7C100600,  //  0086  CALL	R4	3
+      0xB8123800,  //  0087  GETNGBL	R4	K28
+      0x5C140600,  //  0088  MOVE	R5	R3
+      0x7C100200,  //  0089  CALL	R4	1
+      0xB8120E00,  //  008A  GETNGBL	R4	K7
+      0x8C100908,  //  008B  GETMET	R4	R4	K8
+      0x001A3A03,  //  008C  ADD	R6	K29	R3
+      0x581C0018,  //  008D  LDCONST	R7	K24
+      0x7C100600,  //  008E  CALL	R4	3
+      0x80000000,  //  008F  RET	0
     })
   )
 );
@@ -453,7 +450,7 @@ be_local_closure(Autoconf_run_bat,   /* name */
       0x5C140600,  //  0023  MOVE	R5	R3
       0x7C100200,  //  0024  CALL	R4	1
       0x24100902,  //  0025  GT	R4	R4	K2
-      0x78120003,  //  0026  JMPF	R4	#002B
+      0x7811FFDF,  //  0026  JMPF	R4	#0007
       0xB8120A00,  //  0027  GETNGBL	R4	K5
       0x8C100906,  //  0028  GETMET	R4	R4	K6
       0x5C180600,  //  0029  MOVE	R6	R3
@@ -477,7 +474,7 @@ be_local_closure(Autoconf_run_bat,   /* name */
       0x7C140600,  //  003B  CALL	R5	3
       0x4C140000,  //  003C  LDNIL	R5
       0x20140405,  //  003D  NE	R5	R2	R5
-      0x78160001,  //  003E  JMPF	R5	#0041
+      0x78160003,  //  003E  JMPF	R5	#0043
       0x8C140507,  //  003F  GETMET	R5	R2	K7
       0x7C140200,  //  0040  CALL	R5	1
       0x70020000,  //  0041  JMP		#0043
@@ -749,7 +746,7 @@ be_local_closure(Autoconf_delete_all_configs,   /* name */
       0x58240005,  //  000D  LDCONST	R9	K5
       0x7C180600,  //  000E  CALL	R6	3
       0x24180D06,  //  000F  GT	R6	R6	K6
-      0x781A0002,  //  0010  JMPF	R6	#0014
+      0x7819FFF7,  //  0010  JMPF	R6	#0009
       0x8C180307,  //  0011  GETMET	R6	R1	K7
       0x5C200A00,  //  0012  MOVE	R8	R5
       0x7C180400,  //  0013  CALL	R6	2
@@ -280,9 +280,9 @@ be_local_closure(SPAKE2P_Matter_compute_TT_hash,   /* name */
       0x7C140200,  //  0025  CALL	R5	1
       0x90021A05,  //  0026  SETMBR	R0	K13	R5
       0x7806000A,  //  0027  JMPF	R1	#0033
-      0x5416000F,  //  0028  LDINT	R5	16
-      0x541A001E,  //  0029  LDINT	R6	31
-      0x40140A06,  //  002A  CONNECT	R5	R5	R6
+      0x5416001E,  //  0028  LDINT	R5	31
+      0x541A000F,  //  0029  LDINT	R6	16
+      0x40140C05,  //  002A  CONNECT	R5	R6	R5
       0x8818010D,  //  002B  GETMBR	R6	R0	K13
       0x94140C05,  //  002C  GETIDX	R5	R6	R5
       0x90021E05,  //  002D  SETMBR	R0	K15	R5
@@ -314,14 +314,14 @@ be_local_closure(SPAKE2P_Matter_compute_TT_hash,   /* name */
       0x941C0C07,  //  0047  GETIDX	R7	R6	R7
       0x90022A07,  //  0048  SETMBR	R0	K21	R7
       0x78060004,  //  0049  JMPF	R1	#004F
-      0x541E000F,  //  004A  LDINT	R7	16
-      0x5422001E,  //  004B  LDINT	R8	31
-      0x401C0E08,  //  004C  CONNECT	R7	R7	R8
+      0x541E001E,  //  004A  LDINT	R7	31
+      0x5422000F,  //  004B  LDINT	R8	16
+      0x401C1007,  //  004C  CONNECT	R7	R8	R7
       0x941C0C07,  //  004D  GETIDX	R7	R6	R7
       0x70020003,  //  004E  JMP		#0053
-      0x541E001F,  //  004F  LDINT	R7	32
-      0x5422003E,  //  0050  LDINT	R8	63
-      0x401C0E08,  //  0051  CONNECT	R7	R7	R8
+      0x541E003E,  //  004F  LDINT	R7	63
+      0x5422001F,  //  0050  LDINT	R8	32
+      0x401C1007,  //  0051  CONNECT	R7	R8	R7
       0x941C0C07,  //  0052  GETIDX	R7	R6	R7
       0x90022C07,  //  0053  SETMBR	R0	K22	R7
       0x8C1C0B12,  //  0054  GETMET	R7	R5	K18
@@ -283,7 +283,7 @@ be_local_closure(hue_bridge_monad_discover,   /* name */
       0x8C180104,  //  000C  GETMET	R6	R0	K4
       0x5C200A00,  //  000D  MOVE	R8	R5
       0x7C180400,  //  000E  CALL	R6	2
-      0x781A0008,  //  000F  JMPF	R6	#0019
+      0x7819FFF9,  //  000F  JMPF	R6	#000A
       0x601C0008,  //  0010  GETGBL	R7	G8
       0x5C200A00,  //  0011  MOVE	R8	R5
       0x7C1C0200,  //  0012  CALL	R7	1
@@ -347,7 +347,7 @@ be_local_closure(hue_bridge_monad_light_to_id,   /* name */
       0x94100803,  //  0009  GETIDX	R4	R4	R3
       0x94100902,  //  000A  GETIDX	R4	R4	K2
       0x1C100204,  //  000B  EQ	R4	R1	R4
-      0x78120001,  //  000C  JMPF	R4	#000F
+      0x7811FFF8,  //  000C  JMPF	R4	#0006
       0xA8040001,  //  000D  EXBLK	1	1
       0x80040600,  //  000E  RET	1	R3
       0x7001FFF5,  //  000F  JMP		#0006
@@ -465,46 +465,45 @@ be_local_closure(AXP192_set_ldo_voltage,   /* name */
     }),
     &be_const_str_set_ldo_voltage,
     &be_const_str_solidified,
-    ( &(const binstruction[39]) {  /* code */
+    ( &(const binstruction[38]) {  /* code */
       0x540E0CE3,  //  0000  LDINT	R3	3300
       0x240C0403,  //  0001  GT	R3	R2	R3
       0x780E0001,  //  0002  JMPF	R3	#0005
       0x540A000E,  //  0003  LDINT	R2	15
-      0x70020004,  //  0004  JMP		#000A
+      0x70020003,  //  0004  JMP		#0009
       0x540E0063,  //  0005  LDINT	R3	100
       0x0C0C0403,  //  0006  DIV	R3	R2	R3
       0x54120011,  //  0007  LDINT	R4	18
-      0x040C0604,  //  0008  SUB	R3	R3	R4
-      0x5C080600,  //  0009  MOVE	R2	R3
-      0x1C0C0300,  //  000A  EQ	R3	R1	K0
-      0x780E000C,  //  000B  JMPF	R3	#0019
-      0x8C0C0101,  //  000C  GETMET	R3	R0	K1
-      0x54160027,  //  000D  LDINT	R5	40
-      0x8C180102,  //  000E  GETMET	R6	R0	K2
-      0x54220027,  //  000F  LDINT	R8	40
-      0x7C180400,  //  0010  CALL	R6	2
-      0x541E000E,  //  0011  LDINT	R7	15
-      0x2C180C07,  //  0012  AND	R6	R6	R7
-      0x541E000E,  //  0013  LDINT	R7	15
-      0x2C1C0407,  //  0014  AND	R7	R2	R7
-      0x54220003,  //  0015  LDINT	R8	4
-      0x381C0E08,  //  0016  SHL	R7	R7	R8
-      0x30180C07,  //  0017  OR	R6	R6	R7
-      0x7C0C0600,  //  0018  CALL	R3	3
-      0x1C0C0303,  //  0019  EQ	R3	R1	K3
-      0x780E000A,  //  001A  JMPF	R3	#0026
-      0x8C0C0101,  //  001B  GETMET	R3	R0	K1
-      0x54160027,  //  001C  LDINT	R5	40
-      0x8C180102,  //  001D  GETMET	R6	R0	K2
-      0x54220027,  //  001E  LDINT	R8	40
-      0x7C180400,  //  001F  CALL	R6	2
-      0x541E00EF,  //  0020  LDINT	R7	240
-      0x2C180C07,  //  0021  AND	R6	R6	R7
-      0x541E000E,  //  0022  LDINT	R7	15
-      0x2C1C0407,  //  0023  AND	R7	R2	R7
-      0x30180C07,  //  0024  OR	R6	R6	R7
-      0x7C0C0600,  //  0025  CALL	R3	3
-      0x80000000,  //  0026  RET	0
+      0x04080604,  //  0008  SUB	R2	R3	R4
+      0x1C0C0300,  //  0009  EQ	R3	R1	K0
+      0x780E000C,  //  000A  JMPF	R3	#0018
+      0x8C0C0101,  //  000B  GETMET	R3	R0	K1
+      0x54160027,  //  000C  LDINT	R5	40
+      0x8C180102,  //  000D  GETMET	R6	R0	K2
+      0x54220027,  //  000E  LDINT	R8	40
+      0x7C180400,  //  000F  CALL	R6	2
+      0x541E000E,  //  0010  LDINT	R7	15
+      0x2C180C07,  //  0011  AND	R6	R6	R7
+      0x541E000E,  //  0012  LDINT	R7	15
+      0x2C1C0407,  //  0013  AND	R7	R2	R7
+      0x54220003,  //  0014  LDINT	R8	4
+      0x381C0E08,  //  0015  SHL	R7	R7	R8
+      0x30180C07,  //  0016  OR	R6	R6	R7
+      0x7C0C0600,  //  0017  CALL	R3	3
+      0x1C0C0303,  //  0018  EQ	R3	R1	K3
+      0x780E000A,  //  0019  JMPF	R3	#0025
+      0x8C0C0101,  //  001A  GETMET	R3	R0	K1
+      0x54160027,  //  001B  LDINT	R5	40
+      0x8C180102,  //  001C  GETMET	R6	R0	K2
+      0x54220027,  //  001D  LDINT	R8	40
+      0x7C180400,  //  001E  CALL	R6	2
+      0x541E00EF,  //  001F  LDINT	R7	240
+      0x2C180C07,  //  0020  AND	R6	R6	R7
+      0x541E000E,  //  0021  LDINT	R7	15
+      0x2C1C0407,  //  0022  AND	R7	R2	R7
+      0x30180C07,  //  0023  OR	R6	R6	R7
+      0x7C0C0600,  //  0024  CALL	R3	3
+      0x80000000,  //  0025  RET	0
     })
   )
 );
@@ -649,48 +648,41 @@ be_local_closure(AXP192_web_sensor,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[12]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_str(wire),
-    /* K1   */  be_nested_str(_X7Bs_X7DVBus_X20Voltage_X7Bm_X7D_X25_X2E3f_X20V_X7Be_X7D),
-    /* K2   */  be_nested_str(_X7Bs_X7DVBus_X20Current_X7Bm_X7D_X25_X2E1f_X20mA_X7Be_X7D),
-    /* K3   */  be_nested_str(_X7Bs_X7DBatt_X20Voltage_X7Bm_X7D_X25_X2E3f_X20V_X7Be_X7D),
-    /* K4   */  be_nested_str(_X7Bs_X7DBatt_X20Current_X7Bm_X7D_X25_X2E1f_X20mA_X7Be_X7D),
-    /* K5   */  be_nested_str(_X7Bs_X7DAXP_X20Temperature_X7Bm_X7D_X25_X2E1f_X20_X26deg_X3BC_X7Be_X7D),
-    /* K6   */  be_nested_str(get_vbus_voltage),
-    /* K7   */  be_nested_str(get_bat_voltage),
-    /* K8   */  be_nested_str(get_bat_current),
-    /* K9   */  be_nested_str(get_temp),
-    /* K10  */  be_nested_str(tasmota),
-    /* K11  */  be_nested_str(web_send_decimal),
+    /* K1   */  be_nested_str(_X7Bs_X7DVBus_X20Voltage_X7Bm_X7D_X25_X2E3f_X20V_X7Be_X7D_X7Bs_X7DVBus_X20Current_X7Bm_X7D_X25_X2E1f_X20mA_X7Be_X7D_X7Bs_X7DBatt_X20Voltage_X7Bm_X7D_X25_X2E3f_X20V_X7Be_X7D_X7Bs_X7DBatt_X20Current_X7Bm_X7D_X25_X2E1f_X20mA_X7Be_X7D_X7Bs_X7DAXP_X20Temperature_X7Bm_X7D_X25_X2E1f_X20_X26deg_X3BC_X7Be_X7D),
+    /* K2   */  be_nested_str(get_vbus_voltage),
+    /* K3   */  be_nested_str(get_bat_voltage),
+    /* K4   */  be_nested_str(get_bat_current),
+    /* K5   */  be_nested_str(get_temp),
+    /* K6   */  be_nested_str(tasmota),
+    /* K7   */  be_nested_str(web_send_decimal),
     }),
     &be_const_str_web_sensor,
     &be_const_str_solidified,
-    ( &(const binstruction[25]) {  /* code */
+    ( &(const binstruction[22]) {  /* code */
       0x88040100,  //  0000  GETMBR	R1	R0	K0
       0x74060001,  //  0001  JMPT	R1	#0004
       0x4C040000,  //  0002  LDNIL	R1
       0x80040200,  //  0003  RET	1	R1
       0x60040018,  //  0004  GETGBL	R1	G24
-      0x400A0302,  //  0005  CONNECT	R2	K1	K2
-      0x40080503,  //  0006  CONNECT	R2	R2	K3
-      0x40080504,  //  0007  CONNECT	R2	R2	K4
-      0x40080505,  //  0008  CONNECT	R2	R2	K5
-      0x8C0C0106,  //  0009  GETMET	R3	R0	K6
-      0x7C0C0200,  //  000A  CALL	R3	1
-      0x8C100106,  //  000B  GETMET	R4	R0	K6
-      0x7C100200,  //  000C  CALL	R4	1
-      0x8C140107,  //  000D  GETMET	R5	R0	K7
-      0x7C140200,  //  000E  CALL	R5	1
-      0x8C180108,  //  000F  GETMET	R6	R0	K8
-      0x7C180200,  //  0010  CALL	R6	1
-      0x8C1C0109,  //  0011  GETMET	R7	R0	K9
-      0x7C1C0200,  //  0012  CALL	R7	1
-      0x7C040C00,  //  0013  CALL	R1	6
-      0xB80A1400,  //  0014  GETNGBL	R2	K10
-      0x8C08050B,  //  0015  GETMET	R2	R2	K11
-      0x5C100200,  //  0016  MOVE	R4	R1
-      0x7C080400,  //  0017  CALL	R2	2
-      0x80000000,  //  0018  RET	0
+      0x58080001,  //  0005  LDCONST	R2	K1
+      0x8C0C0102,  //  0006  GETMET	R3	R0	K2
+      0x7C0C0200,  //  0007  CALL	R3	1
+      0x8C100102,  //  0008  GETMET	R4	R0	K2
+      0x7C100200,  //  0009  CALL	R4	1
+      0x8C140103,  //  000A  GETMET	R5	R0	K3
+      0x7C140200,  //  000B  CALL	R5	1
+      0x8C180104,  //  000C  GETMET	R6	R0	K4
+      0x7C180200,  //  000D  CALL	R6	1
+      0x8C1C0105,  //  000E  GETMET	R7	R0	K5
+      0x7C1C0200,  //  000F  CALL	R7	1
+      0x7C040C00,  //  0010  CALL	R1	6
+      0xB80A0C00,  //  0011  GETNGBL	R2	K6
+      0x8C080507,  //  0012  GETMET	R2	R2	K7
+      0x5C100200,  //  0013  MOVE	R4	R1
+      0x7C080400,  //  0014  CALL	R2	2
+      0x80000000,  //  0015  RET	0
     })
   )
 );
@@ -791,7 +783,7 @@ be_local_closure(AXP192_set_dc_voltage,   /* name */
     }),
     &be_const_str_set_dc_voltage,
     &be_const_str_solidified,
-    ( &(const binstruction[48]) {  /* code */
+    ( &(const binstruction[47]) {  /* code */
       0x140C0300,  //  0000  LT	R3	R1	K0
       0x740E0001,  //  0001  JMPT	R3	#0004
       0x240C0301,  //  0002  GT	R3	R1	K1
@@ -802,44 +794,43 @@ be_local_closure(AXP192_set_dc_voltage,   /* name */
       0x14100404,  //  0007  LT	R4	R2	R4
       0x78120001,  //  0008  JMPF	R4	#000B
       0x580C0002,  //  0009  LDCONST	R3	K2
-      0x70020010,  //  000A  JMP		#001C
+      0x7002000F,  //  000A  JMP		#001B
       0x54120DAB,  //  000B  LDINT	R4	3500
       0x24100404,  //  000C  GT	R4	R2	R4
       0x78120001,  //  000D  JMPF	R4	#0010
       0x540E006F,  //  000E  LDINT	R3	112
-      0x7002000B,  //  000F  JMP		#001C
+      0x7002000A,  //  000F  JMP		#001B
       0x1C100303,  //  0010  EQ	R4	R1	K3
       0x78120004,  //  0011  JMPF	R4	#0017
       0x541208E2,  //  0012  LDINT	R4	2275
       0x24100404,  //  0013  GT	R4	R2	R4
       0x78120001,  //  0014  JMPF	R4	#0017
       0x540E003E,  //  0015  LDINT	R3	63
-      0x70020004,  //  0016  JMP		#001C
+      0x70020003,  //  0016  JMP		#001B
       0x541202BB,  //  0017  LDINT	R4	700
       0x04100404,  //  0018  SUB	R4	R2	R4
       0x54160018,  //  0019  LDINT	R5	25
-      0x0C100805,  //  001A  DIV	R4	R4	R5
-      0x5C0C0800,  //  001B  MOVE	R3	R4
-      0x54120025,  //  001C  LDINT	R4	38
-      0x1C140301,  //  001D  EQ	R5	R1	K1
-      0x78160001,  //  001E  JMPF	R5	#0021
-      0x54120026,  //  001F  LDINT	R4	39
-      0x70020002,  //  0020  JMP		#0024
-      0x1C140303,  //  0021  EQ	R5	R1	K3
-      0x78160000,  //  0022  JMPF	R5	#0024
-      0x54120022,  //  0023  LDINT	R4	35
-      0x8C140104,  //  0024  GETMET	R5	R0	K4
-      0x5C1C0800,  //  0025  MOVE	R7	R4
-      0x8C200105,  //  0026  GETMET	R8	R0	K5
-      0x5C280800,  //  0027  MOVE	R10	R4
-      0x7C200400,  //  0028  CALL	R8	2
-      0x5426007F,  //  0029  LDINT	R9	128
-      0x2C201009,  //  002A  AND	R8	R8	R9
-      0x5426007E,  //  002B  LDINT	R9	127
-      0x2C240609,  //  002C  AND	R9	R3	R9
-      0x30201009,  //  002D  OR	R8	R8	R9
-      0x7C140600,  //  002E  CALL	R5	3
-      0x80000000,  //  002F  RET	0
+      0x0C0C0805,  //  001A  DIV	R3	R4	R5
+      0x54120025,  //  001B  LDINT	R4	38
+      0x1C140301,  //  001C  EQ	R5	R1	K1
+      0x78160001,  //  001D  JMPF	R5	#0020
+      0x54120026,  //  001E  LDINT	R4	39
+      0x70020002,  //  001F  JMP		#0023
+      0x1C140303,  //  0020  EQ	R5	R1	K3
+      0x78160000,  //  0021  JMPF	R5	#0023
+      0x54120022,  //  0022  LDINT	R4	35
+      0x8C140104,  //  0023  GETMET	R5	R0	K4
+      0x5C1C0800,  //  0024  MOVE	R7	R4
+      0x8C200105,  //  0025  GETMET	R8	R0	K5
+      0x5C280800,  //  0026  MOVE	R10	R4
+      0x7C200400,  //  0027  CALL	R8	2
+      0x5426007F,  //  0028  LDINT	R9	128
+      0x2C201009,  //  0029  AND	R8	R8	R9
+      0x5426007E,  //  002A  LDINT	R9	127
+      0x2C240609,  //  002B  AND	R9	R3	R9
+      0x30201009,  //  002C  OR	R8	R8	R9
+      0x7C140600,  //  002D  CALL	R5	3
+      0x80000000,  //  002E  RET	0
     })
   )
 );
@@ -448,24 +448,23 @@ be_local_closure(AXP202_set_chg_led_mode,   /* name */
     }),
     &be_const_str_set_chg_led_mode,
     &be_const_str_solidified,
-    ( &(const binstruction[17]) {  /* code */
+    ( &(const binstruction[16]) {  /* code */
       0x8C080100,  //  0000  GETMET	R2	R0	K0
       0x54120031,  //  0001  LDINT	R4	50
       0x7C080400,  //  0002  CALL	R2	2
       0x540E00CE,  //  0003  LDINT	R3	207
       0x2C0C0403,  //  0004  AND	R3	R2	R3
       0x54120007,  //  0005  LDINT	R4	8
-      0x300C0604,  //  0006  OR	R3	R3	R4
-      0x5C080600,  //  0007  MOVE	R2	R3
-      0x2C0C0301,  //  0008  AND	R3	R1	K1
-      0x54120003,  //  0009  LDINT	R4	4
-      0x380C0604,  //  000A  SHL	R3	R3	R4
-      0x30080403,  //  000B  OR	R2	R2	R3
-      0x8C0C0102,  //  000C  GETMET	R3	R0	K2
-      0x54160031,  //  000D  LDINT	R5	50
-      0x5C180400,  //  000E  MOVE	R6	R2
-      0x7C0C0600,  //  000F  CALL	R3	3
-      0x80000000,  //  0010  RET	0
+      0x30080604,  //  0006  OR	R2	R3	R4
+      0x2C0C0301,  //  0007  AND	R3	R1	K1
+      0x54120003,  //  0008  LDINT	R4	4
+      0x380C0604,  //  0009  SHL	R3	R3	R4
+      0x30080403,  //  000A  OR	R2	R2	R3
+      0x8C0C0102,  //  000B  GETMET	R3	R0	K2
+      0x54160031,  //  000C  LDINT	R5	50
+      0x5C180400,  //  000D  MOVE	R6	R2
+      0x7C0C0600,  //  000E  CALL	R3	3
+      0x80000000,  //  000F  RET	0
     })
   )
 );
@@ -597,7 +596,7 @@ be_local_closure(AXP202_set_dc_voltage,   /* name */
     }),
     &be_const_str_set_dc_voltage,
     &be_const_str_solidified,
-    ( &(const binstruction[44]) {  /* code */
+    ( &(const binstruction[43]) {  /* code */
       0x140C0300,  //  0000  LT	R3	R1	K0
       0x740E0001,  //  0001  JMPT	R3	#0004
       0x240C0301,  //  0002  GT	R3	R1	K1
@@ -608,40 +607,39 @@ be_local_closure(AXP202_set_dc_voltage,   /* name */
       0x14100404,  //  0007  LT	R4	R2	R4
       0x78120001,  //  0008  JMPF	R4	#000B
       0x580C0002,  //  0009  LDCONST	R3	K2
-      0x70020010,  //  000A  JMP		#001C
+      0x7002000F,  //  000A  JMP		#001B
       0x54120DAB,  //  000B  LDINT	R4	3500
       0x24100404,  //  000C  GT	R4	R2	R4
       0x78120001,  //  000D  JMPF	R4	#0010
       0x540E006F,  //  000E  LDINT	R3	112
-      0x7002000B,  //  000F  JMP		#001C
+      0x7002000A,  //  000F  JMP		#001B
       0x1C100300,  //  0010  EQ	R4	R1	K0
       0x78120004,  //  0011  JMPF	R4	#0017
       0x541208E2,  //  0012  LDINT	R4	2275
       0x24100404,  //  0013  GT	R4	R2	R4
       0x78120001,  //  0014  JMPF	R4	#0017
       0x540E003E,  //  0015  LDINT	R3	63
-      0x70020004,  //  0016  JMP		#001C
+      0x70020003,  //  0016  JMP		#001B
       0x541202BB,  //  0017  LDINT	R4	700
       0x04100404,  //  0018  SUB	R4	R2	R4
       0x54160018,  //  0019  LDINT	R5	25
-      0x0C100805,  //  001A  DIV	R4	R4	R5
-      0x5C0C0800,  //  001B  MOVE	R3	R4
-      0x54120022,  //  001C  LDINT	R4	35
-      0x1C140301,  //  001D  EQ	R5	R1	K1
-      0x78160000,  //  001E  JMPF	R5	#0020
-      0x54120026,  //  001F  LDINT	R4	39
-      0x8C140103,  //  0020  GETMET	R5	R0	K3
-      0x5C1C0800,  //  0021  MOVE	R7	R4
-      0x8C200104,  //  0022  GETMET	R8	R0	K4
-      0x5C280800,  //  0023  MOVE	R10	R4
-      0x7C200400,  //  0024  CALL	R8	2
-      0x5426007F,  //  0025  LDINT	R9	128
-      0x2C201009,  //  0026  AND	R8	R8	R9
-      0x5426007E,  //  0027  LDINT	R9	127
-      0x2C240609,  //  0028  AND	R9	R3	R9
-      0x30201009,  //  0029  OR	R8	R8	R9
-      0x7C140600,  //  002A  CALL	R5	3
-      0x80000000,  //  002B  RET	0
+      0x0C0C0805,  //  001A  DIV	R3	R4	R5
+      0x54120022,  //  001B  LDINT	R4	35
+      0x1C140301,  //  001C  EQ	R5	R1	K1
+      0x78160000,  //  001D  JMPF	R5	#001F
+      0x54120026,  //  001E  LDINT	R4	39
+      0x8C140103,  //  001F  GETMET	R5	R0	K3
+      0x5C1C0800,  //  0020  MOVE	R7	R4
+      0x8C200104,  //  0021  GETMET	R8	R0	K4
+      0x5C280800,  //  0022  MOVE	R10	R4
+      0x7C200400,  //  0023  CALL	R8	2
+      0x5426007F,  //  0024  LDINT	R9	128
+      0x2C201009,  //  0025  AND	R8	R8	R9
+      0x5426007E,  //  0026  LDINT	R9	127
+      0x2C240609,  //  0027  AND	R9	R3	R9
+      0x30201009,  //  0028  OR	R8	R8	R9
+      0x7C140600,  //  0029  CALL	R5	3
+      0x80000000,  //  002A  RET	0
     })
   )
 );
@@ -732,7 +730,7 @@ be_local_closure(AXP202_set_ldo_voltage,   /* name */
     }),
     &be_const_str_set_ldo_voltage,
     &be_const_str_solidified,
-    ( &(const binstruction[59]) {  /* code */
+    ( &(const binstruction[57]) {  /* code */
       0x540E0CE3,  //  0000  LDINT	R3	3300
       0x240C0403,  //  0001  GT	R3	R2	R3
       0x780E0000,  //  0002  JMPF	R3	#0004
@@ -741,57 +739,55 @@ be_local_closure(AXP202_set_ldo_voltage,   /* name */
       0x740E0002,  //  0005  JMPT	R3	#0009
       0x540E0003,  //  0006  LDINT	R3	4
       0x1C0C0203,  //  0007  EQ	R3	R1	R3
-      0x780E0020,  //  0008  JMPF	R3	#002A
+      0x780E001F,  //  0008  JMPF	R3	#0029
       0x540E0063,  //  0009  LDINT	R3	100
       0x0C0C0403,  //  000A  DIV	R3	R2	R3
       0x54120011,  //  000B  LDINT	R4	18
-      0x040C0604,  //  000C  SUB	R3	R3	R4
-      0x5C080600,  //  000D  MOVE	R2	R3
-      0x1C0C0300,  //  000E  EQ	R3	R1	K0
-      0x780E000D,  //  000F  JMPF	R3	#001E
-      0x8C0C0101,  //  0010  GETMET	R3	R0	K1
-      0x54160027,  //  0011  LDINT	R5	40
-      0x8C180102,  //  0012  GETMET	R6	R0	K2
-      0x54220027,  //  0013  LDINT	R8	40
-      0x7C180400,  //  0014  CALL	R6	2
-      0x541E000E,  //  0015  LDINT	R7	15
-      0x2C180C07,  //  0016  AND	R6	R6	R7
-      0x541E000E,  //  0017  LDINT	R7	15
-      0x2C1C0407,  //  0018  AND	R7	R2	R7
-      0x54220003,  //  0019  LDINT	R8	4
-      0x381C0E08,  //  001A  SHL	R7	R7	R8
-      0x30180C07,  //  001B  OR	R6	R6	R7
-      0x7C0C0600,  //  001C  CALL	R3	3
-      0x7002000A,  //  001D  JMP		#0029
-      0x8C0C0101,  //  001E  GETMET	R3	R0	K1
-      0x54160027,  //  001F  LDINT	R5	40
-      0x8C180102,  //  0020  GETMET	R6	R0	K2
-      0x54220027,  //  0021  LDINT	R8	40
-      0x7C180400,  //  0022  CALL	R6	2
-      0x541E00EF,  //  0023  LDINT	R7	240
-      0x2C180C07,  //  0024  AND	R6	R6	R7
-      0x541E000E,  //  0025  LDINT	R7	15
-      0x2C1C0407,  //  0026  AND	R7	R2	R7
-      0x30180C07,  //  0027  OR	R6	R6	R7
-      0x7C0C0600,  //  0028  CALL	R3	3
-      0x7002000F,  //  0029  JMP		#003A
-      0x540E0018,  //  002A  LDINT	R3	25
-      0x0C0C0403,  //  002B  DIV	R3	R2	R3
-      0x5412001B,  //  002C  LDINT	R4	28
-      0x040C0604,  //  002D  SUB	R3	R3	R4
-      0x5C080600,  //  002E  MOVE	R2	R3
-      0x8C0C0101,  //  002F  GETMET	R3	R0	K1
-      0x54160027,  //  0030  LDINT	R5	40
-      0x8C180102,  //  0031  GETMET	R6	R0	K2
-      0x54220028,  //  0032  LDINT	R8	41
-      0x7C180400,  //  0033  CALL	R6	2
-      0x541E007F,  //  0034  LDINT	R7	128
-      0x2C180C07,  //  0035  AND	R6	R6	R7
-      0x541E007E,  //  0036  LDINT	R7	127
-      0x2C1C0407,  //  0037  AND	R7	R2	R7
-      0x30180C07,  //  0038  OR	R6	R6	R7
-      0x7C0C0600,  //  0039  CALL	R3	3
-      0x80000000,  //  003A  RET	0
+      0x04080604,  //  000C  SUB	R2	R3	R4
+      0x1C0C0300,  //  000D  EQ	R3	R1	K0
+      0x780E000D,  //  000E  JMPF	R3	#001D
+      0x8C0C0101,  //  000F  GETMET	R3	R0	K1
+      0x54160027,  //  0010  LDINT	R5	40
+      0x8C180102,  //  0011  GETMET	R6	R0	K2
+      0x54220027,  //  0012  LDINT	R8	40
+      0x7C180400,  //  0013  CALL	R6	2
+      0x541E000E,  //  0014  LDINT	R7	15
+      0x2C180C07,  //  0015  AND	R6	R6	R7
+      0x541E000E,  //  0016  LDINT	R7	15
+      0x2C1C0407,  //  0017  AND	R7	R2	R7
+      0x54220003,  //  0018  LDINT	R8	4
+      0x381C0E08,  //  0019  SHL	R7	R7	R8
+      0x30180C07,  //  001A  OR	R6	R6	R7
+      0x7C0C0600,  //  001B  CALL	R3	3
+      0x7002001A,  //  001C  JMP		#0038
+      0x8C0C0101,  //  001D  GETMET	R3	R0	K1
+      0x54160027,  //  001E  LDINT	R5	40
+      0x8C180102,  //  001F  GETMET	R6	R0	K2
+      0x54220027,  //  0020  LDINT	R8	40
+      0x7C180400,  //  0021  CALL	R6	2
+      0x541E00EF,  //  0022  LDINT	R7	240
+      0x2C180C07,  //  0023  AND	R6	R6	R7
+      0x541E000E,  //  0024  LDINT	R7	15
+      0x2C1C0407,  //  0025  AND	R7	R2	R7
+      0x30180C07,  //  0026  OR	R6	R6	R7
+      0x7C0C0600,  //  0027  CALL	R3	3
+      0x7002000E,  //  0028  JMP		#0038
+      0x540E0018,  //  0029  LDINT	R3	25
+      0x0C0C0403,  //  002A  DIV	R3	R2	R3
+      0x5412001B,  //  002B  LDINT	R4	28
+      0x04080604,  //  002C  SUB	R2	R3	R4
+      0x8C0C0101,  //  002D  GETMET	R3	R0	K1
+      0x54160027,  //  002E  LDINT	R5	40
+      0x8C180102,  //  002F  GETMET	R6	R0	K2
+      0x54220028,  //  0030  LDINT	R8	41
+      0x7C180400,  //  0031  CALL	R6	2
+      0x541E007F,  //  0032  LDINT	R7	128
+      0x2C180C07,  //  0033  AND	R6	R6	R7
+      0x541E007E,  //  0034  LDINT	R7	127
+      0x2C1C0407,  //  0035  AND	R7	R2	R7
+      0x30180C07,  //  0036  OR	R6	R6	R7
+      0x7C0C0600,  //  0037  CALL	R3	3
+      0x80000000,  //  0038  RET	0
     })
   )
 );
@@ -458,7 +458,7 @@ be_local_closure(lv_tasmota_splash,   /* name */
       0x781E0007,  //  0066  JMPF	R7	#006F
       0x4C1C0000,  //  0067  LDNIL	R7
       0x201C0407,  //  0068  NE	R7	R2	R7
-      0x781E0003,  //  0069  JMPF	R7	#006E
+      0x781E000B,  //  0069  JMPF	R7	#0076
       0x8C1C0D20,  //  006A  GETMET	R7	R6	K32
       0x5C240400,  //  006B  MOVE	R9	R2
       0x5828000A,  //  006C  LDCONST	R10	K10
@@ -399,7 +399,7 @@ extern const bclass be_class_lv_signal_arcs;
 ********************************************************************/
 be_local_closure(lv_signal_arcs_widget_event,   /* name */
   be_nested_proto(
-    28,                          /* nstack */
+    27,                          /* nstack */
     2,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -538,19 +538,19 @@ be_local_closure(lv_signal_arcs_widget_event,   /* name */
       0x0C480D04,  //  0040  DIV	R18	R6	K4
       0x04482409,  //  0041  SUB	R18	R18	R9
       0x604C0009,  //  0042  GETGBL	R19	G9
-      0x54520059,  //  0043  LDINT	R20	90
-      0x8C540718,  //  0044  GETMET	R21	R3	K24
-      0x8C5C0719,  //  0045  GETMET	R23	R3	K25
-      0x6064000A,  //  0046  GETGBL	R25	G10
-      0x5C682400,  //  0047  MOVE	R26	R18
-      0x7C640200,  //  0048  CALL	R25	1
-      0x6068000A,  //  0049  GETGBL	R26	G10
-      0x5C6C2200,  //  004A  MOVE	R27	R17
-      0x7C680200,  //  004B  CALL	R26	1
-      0x0C64321A,  //  004C  DIV	R25	R25	R26
-      0x7C5C0400,  //  004D  CALL	R23	2
-      0x7C540400,  //  004E  CALL	R21	2
-      0x04502815,  //  004F  SUB	R20	R20	R21
+      0x8C500718,  //  0043  GETMET	R20	R3	K24
+      0x8C580719,  //  0044  GETMET	R22	R3	K25
+      0x6060000A,  //  0045  GETGBL	R24	G10
+      0x5C642400,  //  0046  MOVE	R25	R18
+      0x7C600200,  //  0047  CALL	R24	1
+      0x6064000A,  //  0048  GETGBL	R25	G10
+      0x5C682200,  //  0049  MOVE	R26	R17
+      0x7C640200,  //  004A  CALL	R25	1
+      0x0C603019,  //  004B  DIV	R24	R24	R25
+      0x7C580400,  //  004C  CALL	R22	2
+      0x7C500400,  //  004D  CALL	R20	2
+      0x54560059,  //  004E  LDINT	R21	90
+      0x04502A14,  //  004F  SUB	R20	R21	R20
       0x7C4C0200,  //  0050  CALL	R19	1
       0x5452002C,  //  0051  LDINT	R20	45
       0x24502614,  //  0052  GT	R20	R19	R20
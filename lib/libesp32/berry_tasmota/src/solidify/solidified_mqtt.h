@@ -43,7 +43,7 @@ be_local_closure(MQTT_mqtt_data,   /* name */
       0x88200F01,  //  000C  GETMBR	R8	R7	K1
       0x4C240000,  //  000D  LDNIL	R9
       0x20201009,  //  000E  NE	R8	R8	R9
-      0x78220009,  //  000F  JMPF	R8	#001A
+      0x7821FFF9,  //  000F  JMPF	R8	#000A
       0x8C200F02,  //  0010  GETMET	R8	R7	K2
       0x5C280200,  //  0011  MOVE	R10	R1
       0x5C2C0400,  //  0012  MOVE	R11	R2
@@ -191,7 +191,7 @@ be_local_closure(MQTT_unsubscribe,   /* name */
       0x8C0C0704,  //  001C  GETMET	R3	R3	K4
       0x5C140400,  //  001D  MOVE	R5	R2
       0x7C0C0400,  //  001E  CALL	R3	2
-      0x70020000,  //  001F  JMP		#0021
+      0x7001FFE5,  //  001F  JMP		#0006
       0x00080505,  //  0020  ADD	R2	R2	K5
       0x7001FFE3,  //  0021  JMP		#0006
       0x4C0C0000,  //  0022  LDNIL	R3
@@ -508,10 +508,10 @@ be_local_closure(MQTT_subscribe,   /* name */
       0x7C140000,  //  0008  CALL	R5	0
       0x88180B02,  //  0009  GETMBR	R6	R5	K2
       0x1C180C01,  //  000A  EQ	R6	R6	R1
-      0x781A0004,  //  000B  JMPF	R6	#0011
+      0x7819FFFA,  //  000B  JMPF	R6	#0007
       0x88180B03,  //  000C  GETMBR	R6	R5	K3
       0x1C180C02,  //  000D  EQ	R6	R6	R2
-      0x781A0001,  //  000E  JMPF	R6	#0011
+      0x7819FFF7,  //  000E  JMPF	R6	#0007
       0xA8040001,  //  000F  EXBLK	1	1
       0x80000C00,  //  0010  RET	0
       0x7001FFF4,  //  0011  JMP		#0007
@@ -711,10 +711,10 @@ be_local_closure(Partition_parse,   /* name */
       0x8C180D08,  //  001D  GETMET	R6	R6	K8
       0x5C200A00,  //  001E  MOVE	R8	R5
       0x7C180400,  //  001F  CALL	R6	2
-      0x70020010,  //  0020  JMP		#0032
+      0x7001FFE3,  //  0020  JMP		#0005
       0x5416EBEA,  //  0021  LDINT	R5	60395
       0x1C140805,  //  0022  EQ	R5	R4	R5
-      0x7816000C,  //  0023  JMPF	R5	#0031
+      0x7816000E,  //  0023  JMPF	R5	#0033
       0x5416001F,  //  0024  LDINT	R5	32
       0x08140405,  //  0025  MUL	R5	R2	R5
       0x541A000F,  //  0026  LDINT	R6	16
@@ -727,7 +727,7 @@ be_local_closure(Partition_parse,   /* name */
       0x94140C05,  //  002D  GETIDX	R5	R6	R5
       0x90021205,  //  002E  SETMBR	R0	K9	R5
       0x70020002,  //  002F  JMP		#0033
-      0x70020000,  //  0030  JMP		#0032
+      0x7001FFD3,  //  0030  JMP		#0005
       0x70020000,  //  0031  JMP		#0033
       0x7001FFD1,  //  0032  JMP		#0005
       0xA8040001,  //  0033  EXBLK	1	1
@@ -942,8 +942,8 @@ be_local_closure(Partition_get_flash_definition_sector,   /* name */
     ( &(const bvalue[ 7]) {     /* constants */
     /* K0   */  be_const_class(be_class_Partition),
     /* K1   */  be_nested_str(flash),
-    /* K2   */  be_const_int(0),
-    /* K3   */  be_const_int(1),
+    /* K2   */  be_const_int(1),
+    /* K3   */  be_const_int(0),
     /* K4   */  be_nested_str(read),
     /* K5   */  be_nested_str(E9),
     /* K6   */  be_nested_str(stop_iteration),
@@ -954,7 +954,7 @@ be_local_closure(Partition_get_flash_definition_sector,   /* name */
       0x58000000,  //  0000  LDCONST	R0	K0
       0xA4060200,  //  0001  IMPORT	R1	K1
       0x60080010,  //  0002  GETGBL	R2	G16
-      0x400E0503,  //  0003  CONNECT	R3	K2	K3
+      0x400E0702,  //  0003  CONNECT	R3	K3	K2
       0x7C080200,  //  0004  CALL	R2	1
       0xA802000F,  //  0005  EXBLK	0	#0016
       0x5C0C0400,  //  0006  MOVE	R3	R2
@@ -963,13 +963,13 @@ be_local_closure(Partition_get_flash_definition_sector,   /* name */
       0x08100604,  //  0009  MUL	R4	R3	R4
       0x8C140304,  //  000A  GETMET	R5	R1	K4
       0x5C1C0800,  //  000B  MOVE	R7	R4
-      0x58200003,  //  000C  LDCONST	R8	K3
+      0x58200002,  //  000C  LDCONST	R8	K2
       0x7C140600,  //  000D  CALL	R5	3
       0x60180015,  //  000E  GETGBL	R6	G21
       0x581C0005,  //  000F  LDCONST	R7	K5
       0x7C180200,  //  0010  CALL	R6	1
       0x1C140A06,  //  0011  EQ	R5	R5	R6
-      0x78160001,  //  0012  JMPF	R5	#0015
+      0x7815FFF2,  //  0012  JMPF	R5	#0006
       0xA8040001,  //  0013  EXBLK	1	1
       0x80040800,  //  0014  RET	1	R4
       0x7001FFEF,  //  0015  JMP		#0006
@@ -1145,10 +1145,10 @@ be_local_closure(Partition_load_otadata,   /* name */
       0x7C100000,  //  0008  CALL	R4	0
       0x88140902,  //  0009  GETMBR	R5	R4	K2
       0x1C140B03,  //  000A  EQ	R5	R5	K3
-      0x78160003,  //  000B  JMPF	R5	#0010
+      0x7815FFFA,  //  000B  JMPF	R5	#0007
       0x88140904,  //  000C  GETMBR	R5	R4	K4
       0x1C140B05,  //  000D  EQ	R5	R5	K5
-      0x78160000,  //  000E  JMPF	R5	#0010
+      0x7815FFF7,  //  000E  JMPF	R5	#0007
       0x88040906,  //  000F  GETMBR	R1	R4	K6
       0x7001FFF5,  //  0010  JMP		#0007
       0x580C0007,  //  0011  LDCONST	R3	K7
@@ -1355,15 +1355,15 @@ be_local_closure(Partition_ota_max,   /* name */
       0x7C0C0000,  //  0006  CALL	R3	0
       0x88100701,  //  0007  GETMBR	R4	R3	K1
       0x1C100902,  //  0008  EQ	R4	R4	K2
-      0x78120010,  //  0009  JMPF	R4	#001B
+      0x7811FFFA,  //  0009  JMPF	R4	#0005
       0x88100703,  //  000A  GETMBR	R4	R3	K3
       0x5416000F,  //  000B  LDINT	R5	16
       0x28100805,  //  000C  GE	R4	R4	R5
-      0x7812000C,  //  000D  JMPF	R4	#001B
+      0x7811FFF6,  //  000D  JMPF	R4	#0005
       0x88100703,  //  000E  GETMBR	R4	R3	K3
       0x5416001F,  //  000F  LDINT	R5	32
       0x14100805,  //  0010  LT	R4	R4	R5
-      0x78120008,  //  0011  JMPF	R4	#001B
+      0x7811FFF2,  //  0011  JMPF	R4	#0005
       0x88100703,  //  0012  GETMBR	R4	R3	K3
       0x5416000F,  //  0013  LDINT	R5	16
       0x04100805,  //  0014  SUB	R4	R4	R5
@@ -1371,7 +1371,7 @@ be_local_closure(Partition_ota_max,   /* name */
       0x1C140205,  //  0016  EQ	R5	R1	R5
       0x74160001,  //  0017  JMPT	R5	#001A
       0x24140801,  //  0018  GT	R5	R4	R1
-      0x78160000,  //  0019  JMPF	R5	#001B
+      0x7815FFEA,  //  0019  JMPF	R5	#0005
       0x5C040800,  //  001A  MOVE	R1	R4
       0x7001FFE8,  //  001B  JMP		#0005
       0x58080004,  //  001C  LDCONST	R2	K4
@@ -1467,7 +1467,7 @@ be_local_closure(Partition_get_factory_slot,   /* name */
       0x7C080000,  //  0005  CALL	R2	0
       0x8C0C0501,  //  0006  GETMET	R3	R2	K1
       0x7C0C0200,  //  0007  CALL	R3	1
-      0x780E0001,  //  0008  JMPF	R3	#000B
+      0x780DFFFA,  //  0008  JMPF	R3	#0004
       0xA8040001,  //  0009  EXBLK	1	1
       0x80040400,  //  000A  RET	1	R2
       0x7001FFF7,  //  000B  JMP		#0004
@@ -1607,7 +1607,7 @@ be_local_closure(Partition_get_ota_slot,   /* name */
       0x8C100701,  //  0006  GETMET	R4	R3	K1
       0x7C100200,  //  0007  CALL	R4	1
       0x1C100801,  //  0008  EQ	R4	R4	R1
-      0x78120001,  //  0009  JMPF	R4	#000C
+      0x7811FFF9,  //  0009  JMPF	R4	#0004
       0xA8040001,  //  000A  EXBLK	1	1
       0x80040600,  //  000B  RET	1	R3
       0x7001FFF6,  //  000C  JMP		#0004
@@ -1814,9 +1814,9 @@ be_local_closure(Partition_info_init,   /* name */
       0x7C0C0600,  //  0025  CALL	R3	3
       0x90020803,  //  0026  SETMBR	R0	K4	R3
       0x8C0C010C,  //  0027  GETMET	R3	R0	K12
-      0x5416000B,  //  0028  LDINT	R5	12
-      0x541A001A,  //  0029  LDINT	R6	27
-      0x40140A06,  //  002A  CONNECT	R5	R5	R6
+      0x5416001A,  //  0028  LDINT	R5	27
+      0x541A000B,  //  0029  LDINT	R6	12
+      0x40140C05,  //  002A  CONNECT	R5	R6	R5
       0x94140205,  //  002B  GETIDX	R5	R1	R5
       0x7C0C0400,  //  002C  CALL	R3	2
       0x8C0C070D,  //  002D  GETMET	R3	R3	K13
@@ -1884,7 +1884,7 @@ be_local_closure(Partition_info_subtype_to_string,   /* name */
       0x1C040301,  //  0004  EQ	R1	R1	K1
       0x78060001,  //  0005  JMPF	R1	#0008
       0x80060600,  //  0006  RET	1	K3
-      0x70020014,  //  0007  JMP		#001D
+      0x70020049,  //  0007  JMP		#0052
       0x88040102,  //  0008  GETMBR	R1	R0	K2
       0x540A000F,  //  0009  LDINT	R2	16
       0x28040202,  //  000A  GE	R1	R1	R2
@@ -1900,11 +1900,11 @@ be_local_closure(Partition_info_subtype_to_string,   /* name */
       0x7C040200,  //  0014  CALL	R1	1
       0x00060801,  //  0015  ADD	R1	K4	R1
       0x80040200,  //  0016  RET	1	R1
-      0x70020004,  //  0017  JMP		#001D
+      0x70020039,  //  0017  JMP		#0052
       0x88040102,  //  0018  GETMBR	R1	R0	K2
       0x540A001F,  //  0019  LDINT	R2	32
       0x1C040202,  //  001A  EQ	R1	R1	R2
-      0x78060000,  //  001B  JMPF	R1	#001D
+      0x78060035,  //  001B  JMPF	R1	#0052
       0x80060A00,  //  001C  RET	1	K5
       0x70020033,  //  001D  JMP		#0052
       0x88040100,  //  001E  GETMBR	R1	R0	K0
@@ -1999,33 +1999,31 @@ be_local_closure(Partition_info_tostring,   /* name */
     }),
     &be_const_str_tostring,
     &be_const_str_solidified,
-    ( &(const binstruction[26]) {  /* code */
+    ( &(const binstruction[24]) {  /* code */
       0x8C040100,  //  0000  GETMET	R1	R0	K0
       0x7C040200,  //  0001  CALL	R1	1
       0x8C080101,  //  0002  GETMET	R2	R0	K1
       0x7C080200,  //  0003  CALL	R2	1
       0x200C0302,  //  0004  NE	R3	R1	K2
-      0x780E0002,  //  0005  JMPF	R3	#0009
+      0x780E0001,  //  0005  JMPF	R3	#0008
       0x000E0601,  //  0006  ADD	R3	K3	R1
-      0x000C0704,  //  0007  ADD	R3	R3	K4
-      0x5C040600,  //  0008  MOVE	R1	R3
-      0x200C0502,  //  0009  NE	R3	R2	K2
-      0x780E0002,  //  000A  JMPF	R3	#000E
-      0x000E0602,  //  000B  ADD	R3	K3	R2
-      0x000C0704,  //  000C  ADD	R3	R3	K4
-      0x5C080600,  //  000D  MOVE	R2	R3
-      0x600C0018,  //  000E  GETGBL	R3	G24
-      0x58100005,  //  000F  LDCONST	R4	K5
-      0x88140106,  //  0010  GETMBR	R5	R0	K6
-      0x5C180200,  //  0011  MOVE	R6	R1
-      0x881C0107,  //  0012  GETMBR	R7	R0	K7
-      0x5C200400,  //  0013  MOVE	R8	R2
-      0x88240108,  //  0014  GETMBR	R9	R0	K8
-      0x88280109,  //  0015  GETMBR	R10	R0	K9
-      0x882C010A,  //  0016  GETMBR	R11	R0	K10
-      0x8830010B,  //  0017  GETMBR	R12	R0	K11
-      0x7C0C1200,  //  0018  CALL	R3	9
-      0x80040600,  //  0019  RET	1	R3
+      0x00040704,  //  0007  ADD	R1	R3	K4
+      0x200C0502,  //  0008  NE	R3	R2	K2
+      0x780E0001,  //  0009  JMPF	R3	#000C
+      0x000E0602,  //  000A  ADD	R3	K3	R2
+      0x00080704,  //  000B  ADD	R2	R3	K4
+      0x600C0018,  //  000C  GETGBL	R3	G24
+      0x58100005,  //  000D  LDCONST	R4	K5
+      0x88140106,  //  000E  GETMBR	R5	R0	K6
+      0x5C180200,  //  000F  MOVE	R6	R1
+      0x881C0107,  //  0010  GETMBR	R7	R0	K7
+      0x5C200400,  //  0011  MOVE	R8	R2
+      0x88240108,  //  0012  GETMBR	R9	R0	K8
+      0x88280109,  //  0013  GETMBR	R10	R0	K9
+      0x882C010A,  //  0014  GETMBR	R11	R0	K10
+      0x8830010B,  //  0015  GETMBR	R12	R0	K11
+      0x7C0C1200,  //  0016  CALL	R3	9
+      0x80040600,  //  0017  RET	1	R3
     })
   )
 );
@@ -20,17 +20,17 @@ be_local_closure(Rule_Matcher_Key_tostring,   /* name */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
     ( &(const bvalue[ 3]) {     /* constants */
-    /* K0   */  be_nested_str(_X3CMatcher_X20key_X3D_X27),
-    /* K1   */  be_nested_str(name),
+    /* K0   */  be_nested_str(name),
+    /* K1   */  be_nested_str(_X3CMatcher_X20key_X3D_X27),
     /* K2   */  be_nested_str(_X27_X3E),
     }),
     &be_const_str_tostring,
     &be_const_str_solidified,
     ( &(const binstruction[ 6]) {  /* code */
       0x60040008,  //  0000  GETGBL	R1	G8
-      0x88080101,  //  0001  GETMBR	R2	R0	K1
+      0x88080100,  //  0001  GETMBR	R2	R0	K0
       0x7C040200,  //  0002  CALL	R1	1
-      0x00060001,  //  0003  ADD	R1	K0	R1
+      0x00060201,  //  0003  ADD	R1	K1	R1
       0x00040302,  //  0004  ADD	R1	R1	K2
       0x80040200,  //  0005  RET	1	R1
     })
@@ -85,7 +85,7 @@ be_local_closure(Rule_Matcher_Key_find_key_i,   /* name */
       0x7C240200,  //  0014  CALL	R9	1
       0x7C1C0400,  //  0015  CALL	R7	2
       0x1C1C0E04,  //  0016  EQ	R7	R7	R4
-      0x781E0001,  //  0017  JMPF	R7	#001A
+      0x781DFFF6,  //  0017  JMPF	R7	#000F
       0xA8040001,  //  0018  EXBLK	1	1
       0x80040C00,  //  0019  RET	1	R6
       0x7001FFF3,  //  001A  JMP		#000F
@@ -787,7 +787,7 @@ be_local_closure(Rule_Matcher_Operator_op_parse,   /* name */
       0x20502913,  //  0056  NE	R20	R20	K19
       0x78520001,  //  0057  JMPF	R20	#005A
       0xB0062915,  //  0058  RAISE	1	K20	K21
-      0x70020000,  //  0059  JMP		#005B
+      0x70020005,  //  0059  JMP		#0060
       0x90022C13,  //  005A  SETMBR	R0	K22	R19
       0x70020003,  //  005B  JMP		#0060
       0x60480008,  //  005C  GETGBL	R18	G8
@@ -817,8 +817,8 @@ be_local_closure(Rule_Matcher_Operator_tostring,   /* name */
     ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_str(op_value),
     /* K1   */  be_nested_str(string),
-    /* K2   */  be_nested_str(_X3CMatcher_X20op_X20_X27),
-    /* K3   */  be_nested_str(op_str),
+    /* K2   */  be_nested_str(op_str),
+    /* K3   */  be_nested_str(_X3CMatcher_X20op_X20_X27),
     /* K4   */  be_nested_str(_X27_X20val_X3D_X27),
     /* K5   */  be_nested_str(_X27_X3E),
     /* K6   */  be_nested_str(_X27_X20val_X3D),
@@ -832,8 +832,8 @@ be_local_closure(Rule_Matcher_Operator_tostring,   /* name */
       0x7C040200,  //  0002  CALL	R1	1
       0x1C040301,  //  0003  EQ	R1	R1	K1
       0x78060009,  //  0004  JMPF	R1	#000F
-      0x88040103,  //  0005  GETMBR	R1	R0	K3
-      0x00060401,  //  0006  ADD	R1	K2	R1
+      0x88040102,  //  0005  GETMBR	R1	R0	K2
+      0x00060601,  //  0006  ADD	R1	K3	R1
       0x00040304,  //  0007  ADD	R1	R1	K4
       0x60080008,  //  0008  GETGBL	R2	G8
       0x880C0100,  //  0009  GETMBR	R3	R0	K0
@@ -842,8 +842,8 @@ be_local_closure(Rule_Matcher_Operator_tostring,   /* name */
       0x00040305,  //  000C  ADD	R1	R1	K5
       0x80040200,  //  000D  RET	1	R1
       0x70020008,  //  000E  JMP		#0018
-      0x88040103,  //  000F  GETMBR	R1	R0	K3
-      0x00060401,  //  0010  ADD	R1	K2	R1
+      0x88040102,  //  000F  GETMBR	R1	R0	K2
+      0x00060601,  //  0010  ADD	R1	K3	R1
       0x00040306,  //  0011  ADD	R1	R1	K6
       0x60080008,  //  0012  GETGBL	R2	G8
       0x880C0100,  //  0013  GETMBR	R3	R0	K0
@@ -957,17 +957,17 @@ be_local_closure(Rule_Matcher_Array_tostring,   /* name */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
     ( &(const bvalue[ 3]) {     /* constants */
-    /* K0   */  be_nested_str(_X3CMatcher_X20_X5B),
-    /* K1   */  be_nested_str(index),
+    /* K0   */  be_nested_str(index),
+    /* K1   */  be_nested_str(_X3CMatcher_X20_X5B),
     /* K2   */  be_nested_str(_X5D_X3E),
     }),
     &be_const_str_tostring,
     &be_const_str_solidified,
     ( &(const binstruction[ 6]) {  /* code */
       0x60040008,  //  0000  GETGBL	R1	G8
-      0x88080101,  //  0001  GETMBR	R2	R0	K1
+      0x88080100,  //  0001  GETMBR	R2	R0	K0
       0x7C040200,  //  0002  CALL	R1	1
-      0x00060001,  //  0003  ADD	R1	K0	R1
+      0x00060201,  //  0003  ADD	R1	K1	R1
       0x00040302,  //  0004  ADD	R1	R1	K2
       0x80040200,  //  0005  RET	1	R1
     })
@@ -1097,17 +1097,17 @@ be_local_closure(Rule_Matcher_AND_List_tostring,   /* name */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
     ( &(const bvalue[ 3]) {     /* constants */
-    /* K0   */  be_nested_str(_X3CMatcher_AND_List_X20),
-    /* K1   */  be_nested_str(and_list),
+    /* K0   */  be_nested_str(and_list),
+    /* K1   */  be_nested_str(_X3CMatcher_AND_List_X20),
     /* K2   */  be_nested_str(_X3E),
     }),
     &be_const_str_tostring,
     &be_const_str_solidified,
     ( &(const binstruction[ 6]) {  /* code */
       0x60040008,  //  0000  GETGBL	R1	G8
-      0x88080101,  //  0001  GETMBR	R2	R0	K1
+      0x88080100,  //  0001  GETMBR	R2	R0	K0
       0x7C040200,  //  0002  CALL	R1	1
-      0x00060001,  //  0003  ADD	R1	K0	R1
+      0x00060201,  //  0003  ADD	R1	K1	R1
       0x00040302,  //  0004  ADD	R1	R1	K2
       0x80040200,  //  0005  RET	1	R1
     })
@@ -1222,32 +1222,109 @@ be_local_closure(Rule_Matcher_tostring,   /* name */
 );
 /*******************************************************************/
 
+--> Unsupported upvals in closure <---
+/********************************************************************
+** Solidified function: first_key
+********************************************************************/
+be_local_closure(Rule_Matcher_first_key,   /* name */
+  be_nested_proto(
+    5,                          /* nstack */
+    1,                          /* argc */
+    2,                          /* varg */
+    1,                          /* has upvals */
+    ( &(const bupvaldesc[ 1]) {  /* upvals */
+      be_local_const_upval(1, 0),
+    }),
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 6]) {     /* constants */
+    /* K0   */  be_nested_str(string),
+    /* K1   */  be_nested_str(matchers),
+    /* K2   */  be_const_int(0),
+    /* K3   */  be_nested_str(Rule_Matcher_Key),
+    /* K4   */  be_nested_str(toupper),
+    /* K5   */  be_nested_str(name),
+    }),
+    &be_const_str_first_key,
+    &be_const_str_solidified,
+    ( &(const binstruction[21]) {  /* code */
+      0xA4060000,  //  0000  IMPORT	R1	K0
+      0x6008000C,  //  0001  GETGBL	R2	G12
+      0x880C0101,  //  0002  GETMBR	R3	R0	K1
+      0x7C080200,  //  0003  CALL	R2	1
+      0x24080502,  //  0004  GT	R2	R2	K2
+      0x780A000C,  //  0005  JMPF	R2	#0013
+      0x6008000F,  //  0006  GETGBL	R2	G15
+      0x880C0101,  //  0007  GETMBR	R3	R0	K1
+      0x940C0702,  //  0008  GETIDX	R3	R3	K2
+      0x68100000,  //  0009  GETUPV	R4	U0
+      0x88100903,  //  000A  GETMBR	R4	R4	K3
+      0x7C080400,  //  000B  CALL	R2	2
+      0x780A0005,  //  000C  JMPF	R2	#0013
+      0x8C080304,  //  000D  GETMET	R2	R1	K4
+      0x88100101,  //  000E  GETMBR	R4	R0	K1
+      0x94100902,  //  000F  GETIDX	R4	R4	K2
+      0x88100905,  //  0010  GETMBR	R4	R4	K5
+      0x7C080400,  //  0011  CALL	R2	2
+      0x80040400,  //  0012  RET	1	R2
+      0x4C080000,  //  0013  LDNIL	R2
+      0x80040400,  //  0014  RET	1	R2
+    })
+  )
+);
+/*******************************************************************/
+
 
 /********************************************************************
-** Solidified function: init
+** Solidified function: match
 ********************************************************************/
-be_local_closure(Rule_Matcher_init,   /* name */
+be_local_closure(Rule_Matcher_match,   /* name */
   be_nested_proto(
-    4,                          /* nstack */
-    4,                          /* argc */
+    7,                          /* nstack */
+    2,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
     NULL,                       /* no upvals */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 3]) {     /* constants */
-    /* K0   */  be_nested_str(rule),
-    /* K1   */  be_nested_str(trigger),
-    /* K2   */  be_nested_str(matchers),
+    ( &(const bvalue[ 4]) {     /* constants */
+    /* K0   */  be_nested_str(matchers),
+    /* K1   */  be_const_int(0),
+    /* K2   */  be_nested_str(match),
+    /* K3   */  be_const_int(1),
     }),
-    &be_const_str_init,
+    &be_const_str_match,
     &be_const_str_solidified,
-    ( &(const binstruction[ 4]) {  /* code */
-      0x90020001,  //  0000  SETMBR	R0	K0	R1
-      0x90020202,  //  0001  SETMBR	R0	K1	R2
-      0x90020403,  //  0002  SETMBR	R0	K2	R3
-      0x80000000,  //  0003  RET	0
+    ( &(const binstruction[27]) {  /* code */
+      0x88080100,  //  0000  GETMBR	R2	R0	K0
+      0x4C0C0000,  //  0001  LDNIL	R3
+      0x1C080403,  //  0002  EQ	R2	R2	R3
+      0x780A0001,  //  0003  JMPF	R2	#0006
+      0x4C080000,  //  0004  LDNIL	R2
+      0x80040400,  //  0005  RET	1	R2
+      0x5C080200,  //  0006  MOVE	R2	R1
+      0x580C0001,  //  0007  LDCONST	R3	K1
+      0x6010000C,  //  0008  GETGBL	R4	G12
+      0x88140100,  //  0009  GETMBR	R5	R0	K0
+      0x7C100200,  //  000A  CALL	R4	1
+      0x14100604,  //  000B  LT	R4	R3	R4
+      0x7812000C,  //  000C  JMPF	R4	#001A
+      0x88100100,  //  000D  GETMBR	R4	R0	K0
+      0x94100803,  //  000E  GETIDX	R4	R4	R3
+      0x8C100902,  //  000F  GETMET	R4	R4	K2
+      0x5C180400,  //  0010  MOVE	R6	R2
+      0x7C100400,  //  0011  CALL	R4	2
+      0x5C080800,  //  0012  MOVE	R2	R4
+      0x4C100000,  //  0013  LDNIL	R4
+      0x1C100404,  //  0014  EQ	R4	R2	R4
+      0x78120001,  //  0015  JMPF	R4	#0018
+      0x4C100000,  //  0016  LDNIL	R4
+      0x80040800,  //  0017  RET	1	R4
+      0x000C0703,  //  0018  ADD	R3	R3	K3
+      0x7001FFED,  //  0019  JMP		#0008
+      0x80040400,  //  001A  RET	1	R2
     })
   )
 );
@@ -1297,7 +1374,7 @@ be_local_closure(Rule_Matcher_parse,   /* name */
     }),
     &be_const_str_parse,
     &be_const_str_solidified,
-    ( &(const binstruction[147]) {  /* code */
+    ( &(const binstruction[146]) {  /* code */
       0x58040000,  //  0000  LDCONST	R1	K0
       0xA40A0200,  //  0001  IMPORT	R2	K1
       0x4C0C0000,  //  0002  LDNIL	R3
@@ -1359,7 +1436,7 @@ be_local_closure(Rule_Matcher_parse,   /* name */
       0x58240009,  //  003A  LDCONST	R9	K9
       0x5429FFFE,  //  003B  LDINT	R10	-1
       0x142C1208,  //  003C  LT	R11	R9	R8
-      0x782E0042,  //  003D  JMPF	R11	#0081
+      0x782E0041,  //  003D  JMPF	R11	#0080
       0x8C2C050C,  //  003E  GETMET	R11	R2	K12
       0x5C340A00,  //  003F  MOVE	R13	R5
       0x5838000D,  //  0040  LDCONST	R14	K13
@@ -1367,84 +1444,83 @@ be_local_closure(Rule_Matcher_parse,   /* name */
       0x7C2C0800,  //  0042  CALL	R11	4
       0x4C300000,  //  0043  LDNIL	R12
       0x28341709,  //  0044  GE	R13	R11	K9
-      0x78360008,  //  0045  JMPF	R13	#004F
+      0x78360007,  //  0045  JMPF	R13	#004E
       0x1C341609,  //  0046  EQ	R13	R11	R9
       0x78360000,  //  0047  JMPF	R13	#0049
       0xB0061D0F,  //  0048  RAISE	1	K14	K15
       0x0434170A,  //  0049  SUB	R13	R11	K10
       0x4034120D,  //  004A  CONNECT	R13	R9	R13
       0x94300A0D,  //  004B  GETIDX	R12	R5	R13
-      0x0034170A,  //  004C  ADD	R13	R11	K10
-      0x5C241A00,  //  004D  MOVE	R9	R13
-      0x70020002,  //  004E  JMP		#0052
-      0x40341310,  //  004F  CONNECT	R13	R9	K16
-      0x94300A0D,  //  0050  GETIDX	R12	R5	R13
-      0x5C241000,  //  0051  MOVE	R9	R8
-      0x8C34050C,  //  0052  GETMET	R13	R2	K12
-      0x5C3C1800,  //  0053  MOVE	R15	R12
-      0x58400011,  //  0054  LDCONST	R16	K17
-      0x7C340600,  //  0055  CALL	R13	3
-      0x4C380000,  //  0056  LDNIL	R14
-      0x283C1B09,  //  0057  GE	R15	R13	K9
-      0x783E0012,  //  0058  JMPF	R15	#006C
-      0x8C3C050C,  //  0059  GETMET	R15	R2	K12
-      0x5C441800,  //  005A  MOVE	R17	R12
-      0x58480012,  //  005B  LDCONST	R18	K18
-      0x5C4C1A00,  //  005C  MOVE	R19	R13
-      0x7C3C0800,  //  005D  CALL	R15	4
-      0x14401F09,  //  005E  LT	R16	R15	K9
-      0x78420000,  //  005F  JMPF	R16	#0061
-      0xB0062714,  //  0060  RAISE	1	K19	K20
-      0x00401B0A,  //  0061  ADD	R16	R13	K10
-      0x04441F0A,  //  0062  SUB	R17	R15	K10
-      0x40402011,  //  0063  CONNECT	R16	R16	R17
-      0x94401810,  //  0064  GETIDX	R16	R12	R16
-      0x04441B0A,  //  0065  SUB	R17	R13	K10
-      0x40461211,  //  0066  CONNECT	R17	K9	R17
-      0x94301811,  //  0067  GETIDX	R12	R12	R17
-      0x60440009,  //  0068  GETGBL	R17	G9
-      0x5C482000,  //  0069  MOVE	R18	R16
-      0x7C440200,  //  006A  CALL	R17	1
-      0x5C382200,  //  006B  MOVE	R14	R17
-      0x1C3C1915,  //  006C  EQ	R15	R12	K21
-      0x783E0004,  //  006D  JMPF	R15	#0073
-      0x8C3C0703,  //  006E  GETMET	R15	R3	K3
-      0x8C440316,  //  006F  GETMET	R17	R1	K22
-      0x7C440200,  //  0070  CALL	R17	1
-      0x7C3C0400,  //  0071  CALL	R15	2
-      0x70020004,  //  0072  JMP		#0078
-      0x8C3C0703,  //  0073  GETMET	R15	R3	K3
-      0x8C440317,  //  0074  GETMET	R17	R1	K23
-      0x5C4C1800,  //  0075  MOVE	R19	R12
-      0x7C440400,  //  0076  CALL	R17	2
-      0x7C3C0400,  //  0077  CALL	R15	2
-      0x4C3C0000,  //  0078  LDNIL	R15
-      0x203C1C0F,  //  0079  NE	R15	R14	R15
-      0x783E0004,  //  007A  JMPF	R15	#0080
-      0x8C3C0703,  //  007B  GETMET	R15	R3	K3
-      0x8C440318,  //  007C  GETMET	R17	R1	K24
-      0x5C4C1C00,  //  007D  MOVE	R19	R14
-      0x7C440400,  //  007E  CALL	R17	2
-      0x7C3C0400,  //  007F  CALL	R15	2
-      0x7001FFBA,  //  0080  JMP		#003C
-      0x4C2C0000,  //  0081  LDNIL	R11
-      0x202C0C0B,  //  0082  NE	R11	R6	R11
-      0x782E0008,  //  0083  JMPF	R11	#008D
-      0x4C2C0000,  //  0084  LDNIL	R11
-      0x202C0E0B,  //  0085  NE	R11	R7	R11
-      0x782E0005,  //  0086  JMPF	R11	#008D
-      0x8C2C0703,  //  0087  GETMET	R11	R3	K3
-      0x8C340319,  //  0088  GETMET	R13	R1	K25
-      0x5C3C0C00,  //  0089  MOVE	R15	R6
-      0x5C400E00,  //  008A  MOVE	R16	R7
-      0x7C340600,  //  008B  CALL	R13	3
-      0x7C2C0400,  //  008C  CALL	R11	2
-      0x5C2C0200,  //  008D  MOVE	R11	R1
-      0x5C300000,  //  008E  MOVE	R12	R0
-      0x5C340A00,  //  008F  MOVE	R13	R5
-      0x5C380600,  //  0090  MOVE	R14	R3
-      0x7C2C0600,  //  0091  CALL	R11	3
-      0x80041600,  //  0092  RET	1	R11
+      0x0024170A,  //  004C  ADD	R9	R11	K10
+      0x70020002,  //  004D  JMP		#0051
+      0x40341310,  //  004E  CONNECT	R13	R9	K16
+      0x94300A0D,  //  004F  GETIDX	R12	R5	R13
+      0x5C241000,  //  0050  MOVE	R9	R8
+      0x8C34050C,  //  0051  GETMET	R13	R2	K12
+      0x5C3C1800,  //  0052  MOVE	R15	R12
+      0x58400011,  //  0053  LDCONST	R16	K17
+      0x7C340600,  //  0054  CALL	R13	3
+      0x4C380000,  //  0055  LDNIL	R14
+      0x283C1B09,  //  0056  GE	R15	R13	K9
+      0x783E0012,  //  0057  JMPF	R15	#006B
+      0x8C3C050C,  //  0058  GETMET	R15	R2	K12
+      0x5C441800,  //  0059  MOVE	R17	R12
+      0x58480012,  //  005A  LDCONST	R18	K18
+      0x5C4C1A00,  //  005B  MOVE	R19	R13
+      0x7C3C0800,  //  005C  CALL	R15	4
+      0x14401F09,  //  005D  LT	R16	R15	K9
+      0x78420000,  //  005E  JMPF	R16	#0060
+      0xB0062714,  //  005F  RAISE	1	K19	K20
+      0x00401B0A,  //  0060  ADD	R16	R13	K10
+      0x04441F0A,  //  0061  SUB	R17	R15	K10
+      0x40402011,  //  0062  CONNECT	R16	R16	R17
+      0x94401810,  //  0063  GETIDX	R16	R12	R16
+      0x04441B0A,  //  0064  SUB	R17	R13	K10
+      0x40461211,  //  0065  CONNECT	R17	K9	R17
+      0x94301811,  //  0066  GETIDX	R12	R12	R17
+      0x60440009,  //  0067  GETGBL	R17	G9
+      0x5C482000,  //  0068  MOVE	R18	R16
+      0x7C440200,  //  0069  CALL	R17	1
+      0x5C382200,  //  006A  MOVE	R14	R17
+      0x1C3C1915,  //  006B  EQ	R15	R12	K21
+      0x783E0004,  //  006C  JMPF	R15	#0072
+      0x8C3C0703,  //  006D  GETMET	R15	R3	K3
+      0x8C440316,  //  006E  GETMET	R17	R1	K22
+      0x7C440200,  //  006F  CALL	R17	1
+      0x7C3C0400,  //  0070  CALL	R15	2
+      0x70020004,  //  0071  JMP		#0077
+      0x8C3C0703,  //  0072  GETMET	R15	R3	K3
+      0x8C440317,  //  0073  GETMET	R17	R1	K23
+      0x5C4C1800,  //  0074  MOVE	R19	R12
+      0x7C440400,  //  0075  CALL	R17	2
+      0x7C3C0400,  //  0076  CALL	R15	2
+      0x4C3C0000,  //  0077  LDNIL	R15
+      0x203C1C0F,  //  0078  NE	R15	R14	R15
+      0x783DFFC1,  //  0079  JMPF	R15	#003C
+      0x8C3C0703,  //  007A  GETMET	R15	R3	K3
+      0x8C440318,  //  007B  GETMET	R17	R1	K24
+      0x5C4C1C00,  //  007C  MOVE	R19	R14
+      0x7C440400,  //  007D  CALL	R17	2
+      0x7C3C0400,  //  007E  CALL	R15	2
+      0x7001FFBB,  //  007F  JMP		#003C
+      0x4C2C0000,  //  0080  LDNIL	R11
+      0x202C0C0B,  //  0081  NE	R11	R6	R11
+      0x782E0008,  //  0082  JMPF	R11	#008C
+      0x4C2C0000,  //  0083  LDNIL	R11
+      0x202C0E0B,  //  0084  NE	R11	R7	R11
+      0x782E0005,  //  0085  JMPF	R11	#008C
+      0x8C2C0703,  //  0086  GETMET	R11	R3	K3
+      0x8C340319,  //  0087  GETMET	R13	R1	K25
+      0x5C3C0C00,  //  0088  MOVE	R15	R6
+      0x5C400E00,  //  0089  MOVE	R16	R7
+      0x7C340600,  //  008A  CALL	R13	3
+      0x7C2C0400,  //  008B  CALL	R11	2
+      0x5C2C0200,  //  008C  MOVE	R11	R1
+      0x5C300000,  //  008D  MOVE	R12	R0
+      0x5C340A00,  //  008E  MOVE	R13	R5
+      0x5C380600,  //  008F  MOVE	R14	R3
+      0x7C2C0600,  //  0090  CALL	R11	3
+      0x80041600,  //  0091  RET	1	R11
     })
   )
 );
@@ -1452,54 +1528,30 @@ be_local_closure(Rule_Matcher_parse,   /* name */
 
 
 /********************************************************************
-** Solidified function: match
+** Solidified function: init
 ********************************************************************/
-be_local_closure(Rule_Matcher_match,   /* name */
+be_local_closure(Rule_Matcher_init,   /* name */
   be_nested_proto(
-    7,                          /* nstack */
-    2,                          /* argc */
+    4,                          /* nstack */
+    4,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
     NULL,                       /* no upvals */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 4]) {     /* constants */
-    /* K0   */  be_nested_str(matchers),
-    /* K1   */  be_const_int(0),
-    /* K2   */  be_nested_str(match),
-    /* K3   */  be_const_int(1),
+    ( &(const bvalue[ 3]) {     /* constants */
+    /* K0   */  be_nested_str(rule),
+    /* K1   */  be_nested_str(trigger),
+    /* K2   */  be_nested_str(matchers),
     }),
-    &be_const_str_match,
+    &be_const_str_init,
     &be_const_str_solidified,
-    ( &(const binstruction[27]) {  /* code */
-      0x88080100,  //  0000  GETMBR	R2	R0	K0
-      0x4C0C0000,  //  0001  LDNIL	R3
-      0x1C080403,  //  0002  EQ	R2	R2	R3
-      0x780A0001,  //  0003  JMPF	R2	#0006
-      0x4C080000,  //  0004  LDNIL	R2
-      0x80040400,  //  0005  RET	1	R2
-      0x5C080200,  //  0006  MOVE	R2	R1
-      0x580C0001,  //  0007  LDCONST	R3	K1
-      0x6010000C,  //  0008  GETGBL	R4	G12
-      0x88140100,  //  0009  GETMBR	R5	R0	K0
-      0x7C100200,  //  000A  CALL	R4	1
-      0x14100604,  //  000B  LT	R4	R3	R4
-      0x7812000C,  //  000C  JMPF	R4	#001A
-      0x88100100,  //  000D  GETMBR	R4	R0	K0
-      0x94100803,  //  000E  GETIDX	R4	R4	R3
-      0x8C100902,  //  000F  GETMET	R4	R4	K2
-      0x5C180400,  //  0010  MOVE	R6	R2
-      0x7C100400,  //  0011  CALL	R4	2
-      0x5C080800,  //  0012  MOVE	R2	R4
-      0x4C100000,  //  0013  LDNIL	R4
-      0x1C100404,  //  0014  EQ	R4	R2	R4
-      0x78120001,  //  0015  JMPF	R4	#0018
-      0x4C100000,  //  0016  LDNIL	R4
-      0x80040800,  //  0017  RET	1	R4
-      0x000C0703,  //  0018  ADD	R3	R3	K3
-      0x7001FFED,  //  0019  JMP		#0008
-      0x80040400,  //  001A  RET	1	R2
+    ( &(const binstruction[ 4]) {  /* code */
+      0x90020001,  //  0000  SETMBR	R0	K0	R1
+      0x90020202,  //  0001  SETMBR	R0	K1	R2
+      0x90020403,  //  0002  SETMBR	R0	K2	R3
+      0x80000000,  //  0003  RET	0
     })
   )
 );
@@ -1512,20 +1564,21 @@ be_local_closure(Rule_Matcher_match,   /* name */
 be_local_class(Rule_Matcher,
     3,
     NULL,
-    be_nested_map(12,
+    be_nested_map(13,
     ( (struct bmapnode*) &(const bmapnode[]) {
-        { be_const_key(Rule_Matcher_AND_List, -1), be_const_class(be_class_Rule_Matcher_AND_List) },
-        { be_const_key(tostring, 0), be_const_closure(Rule_Matcher_tostring_closure) },
-        { be_const_key(match, 6), be_const_closure(Rule_Matcher_match_closure) },
-        { be_const_key(init, 5), be_const_closure(Rule_Matcher_init_closure) },
-        { be_const_key(Rule_Matcher_Array, 11), be_const_class(be_class_Rule_Matcher_Array) },
-        { be_const_key(rule, -1), be_const_var(0) },
-        { be_const_key(Rule_Matcher_Key, -1), be_const_class(be_class_Rule_Matcher_Key) },
-        { be_const_key(Rule_Matcher_Operator, 8), be_const_class(be_class_Rule_Matcher_Operator) },
-        { be_const_key(trigger, -1), be_const_var(1) },
+        { be_const_key(tostring, 1), be_const_closure(Rule_Matcher_tostring_closure) },
         { be_const_key(Rule_Matcher_Wildcard, -1), be_const_class(be_class_Rule_Matcher_Wildcard) },
-        { be_const_key(matchers, 2), be_const_var(2) },
-        { be_const_key(parse, -1), be_const_static_closure(Rule_Matcher_parse_closure) },
+        { be_const_key(first_key, 12), be_const_closure(Rule_Matcher_first_key_closure) },
+        { be_const_key(Rule_Matcher_Operator, -1), be_const_class(be_class_Rule_Matcher_Operator) },
+        { be_const_key(Rule_Matcher_Array, -1), be_const_class(be_class_Rule_Matcher_Array) },
+        { be_const_key(matchers, -1), be_const_var(2) },
+        { be_const_key(init, -1), be_const_closure(Rule_Matcher_init_closure) },
+        { be_const_key(parse, 10), be_const_static_closure(Rule_Matcher_parse_closure) },
+        { be_const_key(Rule_Matcher_AND_List, 9), be_const_class(be_class_Rule_Matcher_AND_List) },
+        { be_const_key(Rule_Matcher_Key, -1), be_const_class(be_class_Rule_Matcher_Key) },
+        { be_const_key(rule, -1), be_const_var(0) },
+        { be_const_key(trigger, 3), be_const_var(1) },
+        { be_const_key(match, -1), be_const_closure(Rule_Matcher_match_closure) },
     })),
     (bstring*) &be_const_str_Rule_Matcher
 );
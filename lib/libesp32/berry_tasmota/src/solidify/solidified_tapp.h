@@ -85,7 +85,7 @@ be_local_closure(Tapp_autoexec,   /* name */
       0x58240005,  //  000D  LDCONST	R9	K5
       0x7C180600,  //  000E  CALL	R6	3
       0x24180D06,  //  000F  GT	R6	R6	K6
-      0x781A000B,  //  0010  JMPF	R6	#001D
+      0x7819FFF7,  //  0010  JMPF	R6	#0009
       0xB81A0E00,  //  0011  GETNGBL	R6	K7
       0x8C180D08,  //  0012  GETMET	R6	R6	K8
       0x60200018,  //  0013  GETGBL	R8	G24
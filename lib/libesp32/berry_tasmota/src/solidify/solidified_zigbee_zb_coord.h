@@ -75,7 +75,7 @@ be_local_closure(zb_coord_add_handler,   /* name */
       0x7C080400,  //  000B  CALL	R2	2
       0x4C0C0000,  //  000C  LDNIL	R3
       0x1C080403,  //  000D  EQ	R2	R2	R3
-      0x780A0003,  //  000E  JMPF	R2	#0013
+      0x780A0008,  //  000E  JMPF	R2	#0018
       0x88080103,  //  000F  GETMBR	R2	R0	K3
       0x8C080505,  //  0010  GETMET	R2	R2	K5
       0x5C100200,  //  0011  MOVE	R4	R1
@@ -185,7 +185,7 @@ be_local_closure(zb_coord_dispatch,   /* name */
       0x7C380200,  //  003A  CALL	R14	1
       0xB83A1200,  //  003B  GETNGBL	R14	K9
       0x88381D0A,  //  003C  GETMBR	R14	R14	K10
-      0x783A0002,  //  003D  JMPF	R14	#0041
+      0x783A0004,  //  003D  JMPF	R14	#0043
       0xA43A1600,  //  003E  IMPORT	R14	K11
       0x8C3C1D0C,  //  003F  GETMET	R15	R14	K12
       0x7C3C0200,  //  0040  CALL	R15	1
@@ -94,7 +94,7 @@ be_local_closure(zcl_attribute_key_tostring,   /* name */
       0x5C040400,  //  0005  MOVE	R1	R2
       0x880C0102,  //  0006  GETMBR	R3	R0	K2
       0x240C0703,  //  0007  GT	R3	R3	K3
-      0x780E0003,  //  0008  JMPF	R3	#000D
+      0x780E003A,  //  0008  JMPF	R3	#0044
       0x600C0008,  //  0009  GETGBL	R3	G8
       0x88100102,  //  000A  GETMBR	R4	R0	K2
       0x7C0C0200,  //  000B  CALL	R3	1
@@ -116,7 +116,7 @@ be_local_closure(zcl_attribute_key_tostring,   /* name */
       0x5C040600,  //  001B  MOVE	R1	R3
       0x880C0102,  //  001C  GETMBR	R3	R0	K2
       0x240C0703,  //  001D  GT	R3	R3	K3
-      0x780E0004,  //  001E  JMPF	R3	#0024
+      0x780E0024,  //  001E  JMPF	R3	#0044
       0x600C0008,  //  001F  GETGBL	R3	G8
       0x88100102,  //  0020  GETMBR	R4	R0	K2
       0x7C0C0200,  //  0021  CALL	R3	1
@@ -202,7 +202,7 @@ be_local_closure(zcl_attribute_setmember,   /* name */
       0x780E0002,  //  0004  JMPF	R3	#0008
       0x540EFFFE,  //  0005  LDINT	R3	65535
       0x90020203,  //  0006  SETMBR	R0	K1	R3
-      0x70020000,  //  0007  JMP		#0009
+      0x70020038,  //  0007  JMP		#0041
       0x90020202,  //  0008  SETMBR	R0	K1	R2
       0x70020036,  //  0009  JMP		#0041
       0x1C0C0302,  //  000A  EQ	R3	R1	K2
@@ -212,7 +212,7 @@ be_local_closure(zcl_attribute_setmember,   /* name */
       0x780E0002,  //  000E  JMPF	R3	#0012
       0x540EFFFE,  //  000F  LDINT	R3	65535
       0x90020603,  //  0010  SETMBR	R0	K3	R3
-      0x70020001,  //  0011  JMP		#0014
+      0x7002002E,  //  0011  JMP		#0041
       0x90020602,  //  0012  SETMBR	R0	K3	R2
       0x90020905,  //  0013  SETMBR	R0	K4	K5
       0x7002002B,  //  0014  JMP		#0041
@@ -223,7 +223,7 @@ be_local_closure(zcl_attribute_setmember,   /* name */
       0x780E0002,  //  0019  JMPF	R3	#001D
       0x540E00FE,  //  001A  LDINT	R3	255
       0x90020E03,  //  001B  SETMBR	R0	K7	R3
-      0x70020001,  //  001C  JMP		#001F
+      0x70020023,  //  001C  JMP		#0041
       0x90020E02,  //  001D  SETMBR	R0	K7	R2
       0x90020908,  //  001E  SETMBR	R0	K4	K8
       0x70020020,  //  001F  JMP		#0041
@@ -233,7 +233,7 @@ be_local_closure(zcl_attribute_setmember,   /* name */
       0x1C0C0403,  //  0023  EQ	R3	R2	R3
       0x780E0001,  //  0024  JMPF	R3	#0027
       0x90021505,  //  0025  SETMBR	R0	K10	K5
-      0x70020005,  //  0026  JMP		#002D
+      0x70020019,  //  0026  JMP		#0041
       0x780A0001,  //  0027  JMPF	R2	#002A
       0x580C0008,  //  0028  LDCONST	R3	K8
       0x70020000,  //  0029  JMP		#002B
@@ -808,9 +808,9 @@ be_local_closure(zcl_attribute_list_tostring,   /* name */
     /* K11  */  be_nested_str_weak(_X22Endpoint_X22_X3A_X25s),
     /* K12  */  be_nested_str_weak(lqi),
     /* K13  */  be_nested_str_weak(_X22LinkQuality_X22_X3A_X25s),
-    /* K14  */  be_nested_str_weak(_X7B),
-    /* K15  */  be_nested_str_weak(concat),
-    /* K16  */  be_nested_str_weak(_X2C),
+    /* K14  */  be_nested_str_weak(concat),
+    /* K15  */  be_nested_str_weak(_X2C),
+    /* K16  */  be_nested_str_weak(_X7B),
     /* K17  */  be_nested_str_weak(_X7D),
     }),
     be_str_weak(tostring),
@@ -872,10 +872,10 @@ be_local_closure(zcl_attribute_list_tostring,   /* name */
       0x5C280600,  //  0035  MOVE	R10	R3
       0x7C200400,  //  0036  CALL	R8	2
       0x7C180400,  //  0037  CALL	R6	2
-      0x8C18050F,  //  0038  GETMET	R6	R2	K15
-      0x58200010,  //  0039  LDCONST	R8	K16
+      0x8C18050E,  //  0038  GETMET	R6	R2	K14
+      0x5820000F,  //  0039  LDCONST	R8	K15
       0x7C180400,  //  003A  CALL	R6	2
-      0x001A1C06,  //  003B  ADD	R6	K14	R6
+      0x001A2006,  //  003B  ADD	R6	K16	R6
       0x00180D11,  //  003C  ADD	R6	R6	K17
       0x80040C00,  //  003D  RET	1	R6
     })
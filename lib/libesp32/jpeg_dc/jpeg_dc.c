@@ -0,0 +1,383 @@
+/*
+  jpeg_dc.c - 1/8 scale luminance of a JPEG from the DC coefficients only
+
+  Copyright (C) 2024  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "jpeg_dc.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Huffman codes up to this length are decoded with a single table lookup
+#define JPEG_DC_LOOKUP    9
+
+typedef struct {
+  uint16_t lookup[1 << JPEG_DC_LOOKUP];  // (length << 8) | symbol, 0 for longer codes
+  int32_t maxcode[17];                   // largest code of each length, -1 if none
+  int32_t valoff[17];                    // index of a symbol is code + valoff[length]
+  uint8_t symbols[256];
+  bool defined;
+} jpeg_dc_huff_t;
+
+typedef struct {
+  uint8_t id;
+  uint8_t h, v;                          // sampling factors
+  uint8_t tq;                            // quantization table
+  uint8_t td, ta;                        // DC and AC Huffman tables
+} jpeg_dc_comp_t;
+
+typedef struct {
+  // entropy coded data
+  const uint8_t *p, *end;
+  uint32_t bits;                         // left aligned bit buffer
+  int32_t nbits;
+  int32_t pad;                           // zero bytes fed after the data
+  bool marker;                           // a marker stops the data
+  // headers
+  uint16_t width, height;
+  uint16_t restart;
+  uint8_t ncomp;
+  jpeg_dc_comp_t comp[4];
+  uint16_t qdc[4];                       // DC quantizer of each table
+  jpeg_dc_huff_t dc[4], ac[4];
+} jpeg_dc_t;
+
+/*********************************************************************************************\
+ * Bit reader
+\*********************************************************************************************/
+
+static void jpeg_dc_fill(jpeg_dc_t *j) {
+  while (j->nbits <= 24) {
+    uint32_t b = 0;
+    if (!j->marker && j->p < j->end) {
+      b = *j->p++;
+      if (b == 0xFF) {
+        if (j->p < j->end && *j->p == 0x00) {
+          j->p++;                        // stuffed byte
+        } else {
+          j->marker = true;              // keep the marker for the restart
+          j->p--;
+          b = 0;
+          j->pad++;
+        }
+      }
+    } else {
+      j->pad++;
+    }
+    j->bits |= b << (24 - j->nbits);
+    j->nbits += 8;
+  }
+}
+
+static inline uint32_t jpeg_dc_getbits(jpeg_dc_t *j, int32_t n) {
+  if (j->nbits < n) { jpeg_dc_fill(j); }
+  uint32_t v = j->bits >> (32 - n);
+  j->bits <<= n;
+  j->nbits -= n;
+  return v;
+}
+
+static inline void jpeg_dc_skipbits(jpeg_dc_t *j, int32_t n) {
+  if (j->nbits < n) { jpeg_dc_fill(j); }
+  j->bits <<= n;
+  j->nbits -= n;
+}
+
+// true if bits after the end of the data were used
+static bool jpeg_dc_overrun(jpeg_dc_t *j) {
+  return j->pad * 8 > j->nbits;
+}
+
+static int32_t jpeg_dc_decode(jpeg_dc_t *j, const jpeg_dc_huff_t *h) {
+  if (j->nbits < 16) { jpeg_dc_fill(j); }
+  uint16_t e = h->lookup[j->bits >> (32 - JPEG_DC_LOOKUP)];
+  if (e) {
+    j->bits <<= (e >> 8);
+    j->nbits -= (e >> 8);
+    return e & 0xFF;
+  }
+  int32_t len = JPEG_DC_LOOKUP + 1;
+  int32_t code = j->bits >> (32 - len);
+  while (len <= 16 && code > h->maxcode[len]) {
+    len++;
+    code = j->bits >> (32 - len);
+  }
+  if (len > 16) { return -1; }
+  j->bits <<= len;
+  j->nbits -= len;
+  return h->symbols[code + h->valoff[len]];
+}
+
+/*********************************************************************************************\
+ * Headers
+\*********************************************************************************************/
+
+static inline uint16_t jpeg_dc_u16(const uint8_t *p) {
+  return (p[0] << 8) | p[1];
+}
+
+// DHT segment, may hold several tables
+static int jpeg_dc_dht(jpeg_dc_t *j, const uint8_t *p, const uint8_t *end) {
+  while (p < end) {
+    if (end - p < 17) { return JPEG_DC_ERR_FORMAT; }
+    uint8_t tc = p[0] >> 4, th = p[0] & 0x0F;
+    if (tc > 1 || th > 3) { return JPEG_DC_ERR_FORMAT; }
+    jpeg_dc_huff_t *h = tc ? &j->ac[th] : &j->dc[th];
+    const uint8_t *counts = p + 1;
+    int32_t total = 0;
+    for (int32_t i = 0; i < 16; i++) { total += counts[i]; }
+    p += 17;
+    if (total > 256 || end - p < total) { return JPEG_DC_ERR_FORMAT; }
+    memcpy(h->symbols, p, total);
+    p += total;
+
+    // canonical codes, see JPEG Annex C
+    memset(h->lookup, 0, sizeof(h->lookup));
+    int32_t code = 0, k = 0;
+    for (int32_t len = 1; len <= 16; len++) {
+      int32_t n = counts[len - 1];
+      h->valoff[len] = k - code;
+      h->maxcode[len] = n ? code + n - 1 : -1;
+      if (code + n > (1 << len)) { return JPEG_DC_ERR_FORMAT; }
+      for (int32_t i = 0; i < n; i++, code++, k++) {
+        if (len <= JPEG_DC_LOOKUP) {
+          int32_t shift = JPEG_DC_LOOKUP - len;
+          for (int32_t f = 0; f < (1 << shift); f++) {
+            h->lookup[(code << shift) | f] = (len << 8) | h->symbols[k];
+          }
+        }
+      }
+      code <<= 1;
+    }
+    h->defined = true;
+  }
+  return JPEG_DC_OK;
+}
+
+// DQT segment, only the DC entry of each table is kept
+static int jpeg_dc_dqt(jpeg_dc_t *j, const uint8_t *p, const uint8_t *end) {
+  while (p < end) {
+    uint8_t pq = p[0] >> 4, tq = p[0] & 0x0F;
+    int32_t size = pq ? 129 : 65;
+    if (pq > 1 || tq > 3 || end - p < size) { return JPEG_DC_ERR_FORMAT; }
+    j->qdc[tq] = pq ? jpeg_dc_u16(p + 1) : p[1];
+    p += size;
+  }
+  return JPEG_DC_OK;
+}
+
+static int jpeg_dc_sof(jpeg_dc_t *j, const uint8_t *p, const uint8_t *end) {
+  if (end - p < 6) { return JPEG_DC_ERR_FORMAT; }
+  if (p[0] != 8) { return JPEG_DC_ERR_UNSUPPORTED; }
+  j->height = jpeg_dc_u16(p + 1);
+  j->width = jpeg_dc_u16(p + 3);
+  j->ncomp = p[5];
+  if (!j->width || !j->height) { return JPEG_DC_ERR_UNSUPPORTED; }   // height from a DNL marker
+  if (j->ncomp < 1 || j->ncomp > 4) { return JPEG_DC_ERR_UNSUPPORTED; }
+  if (end - p < 6 + 3 * j->ncomp) { return JPEG_DC_ERR_FORMAT; }
+  p += 6;
+  for (int32_t i = 0; i < j->ncomp; i++, p += 3) {
+    jpeg_dc_comp_t *c = &j->comp[i];
+    c->id = p[0];
+    c->h = p[1] >> 4;
+    c->v = p[1] & 0x0F;
+    c->tq = p[2] & 0x03;
+    if (c->h < 1 || c->h > 4 || c->v < 1 || c->v > 4) { return JPEG_DC_ERR_FORMAT; }
+  }
+  return JPEG_DC_OK;
+}
+
+// walk the markers until the frame header, or until the start of scan if `sos` is set
+// returns the start of the scan header in `*scan`
+static int jpeg_dc_headers(jpeg_dc_t *j, const uint8_t *jpg, size_t len, bool sos, const uint8_t **scan, const uint8_t **scan_end) {
+  const uint8_t *p = jpg, *end = jpg + len;
+  bool frame = false;
+  if (len < 4 || p[0] != 0xFF || p[1] != 0xD8) { return JPEG_DC_ERR_FORMAT; }
+  p += 2;
+  while (true) {
+    while (p < end && *p != 0xFF) { p++; }   // garbage between segments
+    while (p < end && *p == 0xFF) { p++; }   // fill bytes
+    if (end - p < 3) { return JPEG_DC_ERR_FORMAT; }
+    uint8_t marker = *p++;
+    if (marker == 0xD9) { return JPEG_DC_ERR_FORMAT; }                      // EOI before any scan
+    if ((marker >= 0xD0 && marker <= 0xD7) || marker == 0x01) { continue; } // no length
+    uint16_t seglen = jpeg_dc_u16(p);
+    if (seglen < 2 || end - p < seglen) { return JPEG_DC_ERR_FORMAT; }
+    const uint8_t *seg = p + 2, *seg_end = p + seglen;
+    p = seg_end;
+    int res = JPEG_DC_OK;
+    switch (marker) {
+      case 0xC0:                       // baseline
+      case 0xC1:                       // extended sequential, Huffman
+        res = jpeg_dc_sof(j, seg, seg_end);
+        if (res != JPEG_DC_OK) { return res; }
+        frame = true;
+        if (!sos) { return JPEG_DC_OK; }
+        break;
+      case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+      case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+        return JPEG_DC_ERR_UNSUPPORTED;     // progressive, lossless, hierarchical or arithmetic
+      case 0xC4:
+        if (sos) { res = jpeg_dc_dht(j, seg, seg_end); }
+        break;
+      case 0xDB:
+        if (sos) { res = jpeg_dc_dqt(j, seg, seg_end); }
+        break;
+      case 0xDD:
+        if (seglen < 4) { return JPEG_DC_ERR_FORMAT; }
+        j->restart = jpeg_dc_u16(seg);
+        break;
+      case 0xDA:
+        if (!frame) { return JPEG_DC_ERR_FORMAT; }
+        *scan = seg;
+        *scan_end = seg_end;
+        return JPEG_DC_OK;
+    }
+    if (res != JPEG_DC_OK) { return res; }
+  }
+}
+
+/*********************************************************************************************\
+ * API
+\*********************************************************************************************/
+
+int jpeg_dc_size(const uint8_t *jpg, size_t len, uint16_t *width, uint16_t *height) {
+  jpeg_dc_t j;
+  const uint8_t *scan, *scan_end;
+  memset(&j, 0, offsetof(jpeg_dc_t, dc));       // the Huffman tables are not needed
+  int res = jpeg_dc_headers(&j, jpg, len, false, &scan, &scan_end);
+  if (res == JPEG_DC_OK) {
+    *width = j.width;
+    *height = j.height;
+  }
+  return res;
+}
+
+int jpeg_dc_luma(const uint8_t *jpg, size_t len, uint8_t *out, uint16_t out_w, uint16_t out_h) {
+  const uint8_t *scan, *scan_end;
+  // about 5KB, too much for the stack of the tasks
+  jpeg_dc_t *j = (jpeg_dc_t*)calloc(1, sizeof(jpeg_dc_t));
+  if (!j) { return JPEG_DC_ERR_MEMORY; }
+  int res = jpeg_dc_headers(j, jpg, len, true, &scan, &scan_end);
+  if (res != JPEG_DC_OK) { goto exit; }
+
+  {
+    // scan header, all the components must be in this scan
+    uint8_t ns = scan[0];
+    jpeg_dc_comp_t *order[4];
+    if (ns != j->ncomp || scan_end - scan < 1 + 2 * ns + 3) { res = JPEG_DC_ERR_UNSUPPORTED; goto exit; }
+    for (int32_t i = 0; i < ns; i++) {
+      const uint8_t *s = scan + 1 + 2 * i;
+      order[i] = NULL;
+      for (int32_t c = 0; c < j->ncomp; c++) {
+        if (j->comp[c].id == s[0]) { order[i] = &j->comp[c]; }
+      }
+      if (!order[i]) { res = JPEG_DC_ERR_FORMAT; goto exit; }
+      order[i]->td = s[1] >> 4;
+      order[i]->ta = s[1] & 0x0F;
+      if (order[i]->td > 3 || order[i]->ta > 3 ||
+          !j->dc[order[i]->td].defined || !j->ac[order[i]->ta].defined) { res = JPEG_DC_ERR_FORMAT; goto exit; }
+    }
+
+    // MCU layout, a single component is not interleaved and its MCU is one block
+    uint8_t hmax = 1, vmax = 1;
+    if (ns > 1) {
+      for (int32_t i = 0; i < ns; i++) {
+        if (order[i]->h > hmax) { hmax = order[i]->h; }
+        if (order[i]->v > vmax) { vmax = order[i]->v; }
+      }
+    } else {
+      order[0]->h = order[0]->v = 1;
+    }
+    uint32_t mcux = (j->width + 8 * hmax - 1) / (8 * hmax);
+    uint32_t mcuy = (j->height + 8 * vmax - 1) / (8 * vmax);
+    jpeg_dc_comp_t *luma = &j->comp[0];
+    // DC to pixel value: DC / 8 + 128, rounded
+    int32_t q = j->qdc[luma->tq];
+    int32_t pred[4] = { 0, 0, 0, 0 };
+    uint32_t to_restart = j->restart;
+
+    j->p = scan_end;
+    j->end = jpg + len;
+    for (uint32_t my = 0; my < mcuy; my++) {
+      for (uint32_t mx = 0; mx < mcux; mx++) {
+        if (j->restart) {
+          if (!to_restart) {
+            // the data of the interval must be complete, then skip to the RSTn marker
+            if (jpeg_dc_overrun(j)) { res = JPEG_DC_ERR_DATA; goto exit; }
+            while (j->p + 1 < j->end && !(j->p[0] == 0xFF && j->p[1] >= 0xD0 && j->p[1] <= 0xD7)) { j->p++; }
+            if (j->p + 1 >= j->end) { res = JPEG_DC_ERR_DATA; goto exit; }
+            j->p += 2;
+            j->bits = 0;
+            j->nbits = 0;
+            j->pad = 0;
+            j->marker = false;
+            memset(pred, 0, sizeof(pred));
+            to_restart = j->restart;
+          }
+          to_restart--;
+        }
+        for (int32_t i = 0; i < ns; i++) {
+          jpeg_dc_comp_t *c = order[i];
+          const jpeg_dc_huff_t *hdc = &j->dc[c->td];
+          const jpeg_dc_huff_t *hac = &j->ac[c->ta];
+          for (uint32_t by = 0; by < c->v; by++) {
+            for (uint32_t bx = 0; bx < c->h; bx++) {
+              // DC difference
+              int32_t s = jpeg_dc_decode(j, hdc);
+              if (s < 0 || s > 11) { res = JPEG_DC_ERR_DATA; goto exit; }
+              if (s) {
+                int32_t v = jpeg_dc_getbits(j, s);
+                if (v < (1 << (s - 1))) { v -= (1 << s) - 1; }
+                pred[i] += v;
+              }
+              // AC coefficients are only skipped
+              for (int32_t k = 1; k < 64; k++) {
+                int32_t rs = jpeg_dc_decode(j, hac);
+                if (rs < 0) { res = JPEG_DC_ERR_DATA; goto exit; }
+                if (rs & 0x0F) {
+                  k += rs >> 4;
+                  jpeg_dc_skipbits(j, rs & 0x0F);
+                } else if (rs == 0xF0) {
+                  k += 15;                 // run of 16 zeros
+                } else {
+                  break;                   // end of block
+                }
+              }
+              if (c == luma) {
+                uint32_t x = mx * c->h + bx;
+                uint32_t y = my * c->v + by;
+                if (x < out_w && y < out_h) {
+                  int32_t v = pred[i];
+                  v = (v < -2048) ? -2048 : (v > 2047) ? 2047 : v;   // only reached by corrupted data
+                  v = v * q + 1028;
+                  v = (v < 0) ? 0 : v >> 3;
+                  out[y * out_w + x] = (v > 255) ? 255 : v;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    if (jpeg_dc_overrun(j)) { res = JPEG_DC_ERR_DATA; }
+  }
+
+exit:
+  free(j);
+  return res;
+}
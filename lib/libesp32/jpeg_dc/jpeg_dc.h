@@ -0,0 +1,60 @@
+/*
+  jpeg_dc.h - 1/8 scale luminance of a JPEG from the DC coefficients only
+
+  Copyright (C) 2024  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JPEG_DC_H
+#define JPEG_DC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The DC coefficient of an 8x8 block is the average of its 64 pixels,
+ * so the luminance DC of each block is the image scaled down to 1/8,
+ * without dequantizing the AC coefficients nor running the IDCT.
+ * The AC coefficients are still Huffman decoded, only to be skipped.
+ *
+ * Supports baseline and extended Huffman JPEG, gray or YCbCr with any
+ * sampling factors, in a single interleaved scan, with restart markers.
+ * Progressive and arithmetic coded files are refused.
+ */
+
+enum {
+  JPEG_DC_OK = 0,
+  JPEG_DC_ERR_FORMAT,         // not a JPEG, or truncated headers
+  JPEG_DC_ERR_UNSUPPORTED,    // progressive, arithmetic, 12 bits or multiple scans
+  JPEG_DC_ERR_DATA,           // corrupted entropy coded data
+  JPEG_DC_ERR_MEMORY,
+};
+
+// width and height of the picture, in pixels
+int jpeg_dc_size(const uint8_t *jpg, size_t len, uint16_t *width, uint16_t *height);
+
+// luminance of each 8x8 block, one byte per block, in `out` of `out_w` x `out_h` bytes
+// blocks outside of `out_w` x `out_h` are dropped, missing blocks are left untouched
+int jpeg_dc_luma(const uint8_t *jpg, size_t len, uint8_t *out, uint16_t out_w, uint16_t out_h);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JPEG_DC_H
@@ -0,0 +1,191 @@
+/*
+  jpeg_dc_test.cpp - host test of jpeg_dc with the sample pictures of the rtsp library
+
+  The 1/8 luminance from the DC coefficients is compared with the decoding
+  done today by the webcam motion detection, TJpgDec at 1/8 scale to RGB
+  then averaged to gray, for the speed, the pixel values, and the motion
+  values computed like WcDetectMotionFn() on frames with simulated motion.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "JPEGSamples.h"
+#include "jpeg_dc.h"
+#include "tjpgd.h"
+
+static int errors = 0;
+#define CHECK(c) do { if (!(c)) { printf("FAIL line %d: %s\n", __LINE__, #c); errors++; } } while (0)
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*********************************************************************************************\
+ * Current path, like wc_jpg2mono() at scale 3
+\*********************************************************************************************/
+
+struct tj_io {
+  const uint8_t *src;
+  size_t len, pos;
+};
+
+static size_t tj_in(JDEC *jd, uint8_t *buf, size_t len) {
+  tj_io *io = (tj_io*)jd->device;
+  if (len > io->len - io->pos) { len = io->len - io->pos; }
+  if (buf) { memcpy(buf, io->src + io->pos, len); }
+  io->pos += len;
+  return len;
+}
+
+static inline uint8_t clip(int v) { return (v < 0) ? 0 : (v > 255) ? 255 : v; }
+
+// the TJpgDec of LVGL has no 1/8 output, it is done here like in the original TJpgDec
+// and in esp_jpg_decode(): DC of each block to RGB, then gray like _mono_write()
+static bool tjpgd_mono8(const uint8_t *jpg, size_t len, uint8_t *out, int w, int h) {
+  static uint8_t pool[4096];
+  JDEC jd;
+  tj_io io = { jpg, len, 0 };
+  if (jd_prepare(&jd, tj_in, pool, sizeof(pool), &io) != JDR_OK) { return false; }
+  jd.scale = 3;
+  int mx = jd.msx * 8, my = jd.msy * 8;
+  for (int y = 0; y < jd.height; y += my) {
+    for (int x = 0; x < jd.width; x += mx) {
+      if (jd_mcu_load(&jd) != JDR_OK) { return false; }
+      const jd_yuv_t *pc = jd.mcubuf + mx * my;
+      int cb = (jd.ncomp > 1) ? pc[0] - 128 : 0;
+      int cr = (jd.ncomp > 1) ? pc[64] - 128 : 0;
+      for (int iy = 0; iy < jd.msy; iy++) {
+        for (int ix = 0; ix < jd.msx; ix++) {
+          int yy = jd.mcubuf[(iy * jd.msx + ix) * 64];
+          int r = clip(yy + (int)(1.402 * 1024) * cr / 1024);
+          int g = clip(yy - ((int)(0.344 * 1024) * cb + (int)(0.714 * 1024) * cr) / 1024);
+          int b = clip(yy + (int)(1.772 * 1024) * cb / 1024);
+          int ox = x / 8 + ix, oy = y / 8 + iy;
+          if (ox < w && oy < h) { out[oy * w + ox] = (r + g + b) / 3; }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/*********************************************************************************************\
+ * Motion values, like WcDetectMotionFn() without mask nor background
+\*********************************************************************************************/
+
+struct motion {
+  int trigger;            // accumulated difference, per 100 pixels
+  int changed;            // pixels over the threshold, per 10000
+};
+
+static motion motion_of(const uint8_t *a, const uint8_t *b, int n, uint8_t thresh, uint8_t *changed_map) {
+  uint32_t accu = 0, changed = 0;
+  for (int i = 0; i < n; i++) {
+    uint8_t diff = abs((int)a[i] - (int)b[i]);
+    accu += diff;
+    changed_map[i] = diff > thresh;
+    changed += changed_map[i];
+  }
+  float divider = (float)n / 100.0f;
+  motion m = { (int)(accu / divider), (int)(changed / divider) };
+  return m;
+}
+
+// simulated motion on a decoded frame
+static void move(const uint8_t *src, uint8_t *dst, int w, int h, int kind) {
+  memcpy(dst, src, w * h);
+  if (kind == 1) {                       // pan by one block
+    for (int y = 0; y < h; y++) {
+      memmove(dst + y * w + 1, src + y * w, w - 1);
+    }
+  } else if (kind == 2) {                // object moving into the middle
+    int s = w / 6;
+    for (int y = 0; y < s; y++) {
+      memcpy(dst + (h / 2 + y) * w + w / 2, src + y * w, s);
+    }
+  }
+}
+
+/*********************************************************************************************/
+
+static void test_picture(const char *name, const uint8_t *jpg, size_t len) {
+  uint16_t jw = 0, jh = 0;
+  CHECK(jpeg_dc_size(jpg, len, &jw, &jh) == JPEG_DC_OK);
+  int w = jw / 8, h = jh / 8, n = w * h;
+  uint8_t *ref = (uint8_t*)calloc(n, 1), *dc = (uint8_t*)calloc(n, 1);
+  uint8_t *ref_m = (uint8_t*)calloc(n, 1), *dc_m = (uint8_t*)calloc(n, 1);
+  uint8_t *ref_c = (uint8_t*)calloc(n, 1), *dc_c = (uint8_t*)calloc(n, 1);
+
+  CHECK(tjpgd_mono8(jpg, len, ref, w, h));
+  CHECK(jpeg_dc_luma(jpg, len, dc, w, h) == JPEG_DC_OK);
+
+  // speed
+  const int runs = 200;
+  double t = now();
+  for (int i = 0; i < runs; i++) { tjpgd_mono8(jpg, len, ref, w, h); }
+  double t_ref = (now() - t) / runs;
+  t = now();
+  for (int i = 0; i < runs; i++) { jpeg_dc_luma(jpg, len, dc, w, h); }
+  double t_dc = (now() - t) / runs;
+  printf("%s %dx%d -> %dx%d: TJpgDec 1/8 %.0f us, DC only %.0f us, x%.1f\n",
+         name, jw, jh, w, h, t_ref * 1e6, t_dc * 1e6, t_ref / t_dc);
+
+  // pixel values, gray from RGB is close to the luminance
+  uint32_t sum = 0;
+  int max = 0;
+  for (int i = 0; i < n; i++) {
+    int d = abs((int)ref[i] - (int)dc[i]);
+    sum += d;
+    if (d > max) { max = d; }
+  }
+  printf("  luminance difference: mean %.2f, max %d\n", (float)sum / n, max);
+  CHECK((float)sum / n < 4.0f);
+
+  // motion, same decision for the default trigger limit of 1000,
+  // and the same changed pixels for a threshold of 10
+  static const char *kinds[] = { "still", "pan", "object" };
+  for (int kind = 0; kind < 3; kind++) {
+    move(ref, ref_m, w, h, kind);
+    move(dc, dc_m, w, h, kind);
+    motion mr = motion_of(ref, ref_m, n, 10, ref_c);
+    motion md = motion_of(dc, dc_m, n, 10, dc_c);
+    int same = 0;
+    for (int i = 0; i < n; i++) { same += ref_c[i] == dc_c[i]; }
+    printf("  %-6s trigger %5d / %5d, changed %4d / %4d per 10000, same changed pixels %.1f%%\n",
+           kinds[kind], mr.trigger, md.trigger, mr.changed, md.changed, same * 100.0f / n);
+    CHECK((mr.trigger > 1000) == (md.trigger > 1000));
+    CHECK(same * 100 >= n * 95);
+  }
+
+  // broken pictures are refused or reported, never read out of bounds
+  uint8_t *cut = (uint8_t*)malloc(len / 2);
+  memcpy(cut, jpg, len / 2);
+  CHECK(jpeg_dc_luma(cut, len / 2, dc, w, h) == JPEG_DC_ERR_DATA);
+  CHECK(jpeg_dc_luma(cut, 200, dc, w, h) == JPEG_DC_ERR_FORMAT);
+  free(cut);
+
+  free(ref); free(dc); free(ref_m); free(dc_m); free(ref_c); free(dc_c);
+}
+
+int main(void) {
+  test_picture("capture_jpg", capture_jpg, capture_jpg_len);
+  test_picture("octo_jpg", octo_jpg, octo_jpg_len);
+
+  uint8_t out[4];
+  static const uint8_t not_jpeg[] = { 0x89, 'P', 'N', 'G', 0, 0, 0, 0 };
+  CHECK(jpeg_dc_luma(not_jpeg, sizeof(not_jpeg), out, 2, 2) == JPEG_DC_ERR_FORMAT);
+  uint8_t *progressive = (uint8_t*)malloc(capture_jpg_len);
+  memcpy(progressive, capture_jpg, capture_jpg_len);
+  for (size_t i = 2; i + 1 < capture_jpg_len; i++) {
+    if (progressive[i] == 0xFF && progressive[i + 1] == 0xC0) { progressive[i + 1] = 0xC2; break; }
+  }
+  CHECK(jpeg_dc_luma(progressive, capture_jpg_len, out, 2, 2) == JPEG_DC_ERR_UNSUPPORTED);
+  free(progressive);
+
+  printf(errors ? "%d errors\n" : "all passed\n", errors);
+  return errors ? 1 : 0;
+}
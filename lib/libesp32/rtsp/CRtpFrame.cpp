@@ -0,0 +1,90 @@
+#include "CRtpFrame.h"
+#include "CStreamer.h"
+
+#define KJpegHeaderSize 8           // size of the special JPEG payload header
+#define KQuantHeaderSize (4 + 64 * 2) // quant table header and two 64 byte tables
+
+#define MAX_FRAGMENT_SIZE 1100 // FIXME, pick more carefully
+
+CRtpFrame *CRtpFrame::create(BufPtr jpeg, uint32_t len, u_short width, u_short height)
+{
+    // locate quant tables if possible
+    BufPtr qtable0, qtable1;
+
+    if (!decodeJPEGfile(&jpeg, &len, &qtable0, &qtable1))
+        return NULL;
+
+    bool includeQuantTbl = qtable0 && qtable1;
+    int count = len ? (len + MAX_FRAGMENT_SIZE - 1) / MAX_FRAGMENT_SIZE : 1;
+
+    CRtpFrame *frame = new CRtpFrame();
+    frame->m_RefCount = 1;
+    frame->m_FragmentCount = count;
+    frame->m_Fragments = new RtpFragment[count];
+    frame->m_Headers = new uint8_t[count * KJpegHeaderSize + (includeQuantTbl ? KQuantHeaderSize : 0)];
+
+    uint8_t *h = frame->m_Headers;
+    uint32_t fragmentOffset = 0;
+    for (int i = 0; i < count; i++)
+    {
+        RtpFragment &f = frame->m_Fragments[i];
+        uint32_t fragmentLen = MAX_FRAGMENT_SIZE;
+        if (fragmentLen + fragmentOffset > len) // Shrink last fragment if needed
+            fragmentLen = len - fragmentOffset;
+
+        // Do we have custom quant tables? If so include them per RFC, in the first fragment
+        bool withQuant = includeQuantTbl && fragmentOffset == 0;
+
+        f.header = h;
+        f.data = jpeg + fragmentOffset;
+        f.dataLen = fragmentLen;
+        f.last = (fragmentOffset + fragmentLen) == len;
+
+        // Prepare the 8 byte payload JPEG header
+        h[0] = 0x00;                                // type specific
+        h[1] = (fragmentOffset & 0x00FF0000) >> 16; // 3 byte fragmentation offset for fragmented images
+        h[2] = (fragmentOffset & 0x0000FF00) >> 8;
+        h[3] = (fragmentOffset & 0x000000FF);
+
+        /*    These sampling factors indicate that the chrominance components of
+           type 0 video is downsampled horizontally by 2 (often called 4:2:2)
+           while the chrominance components of type 1 video are downsampled both
+           horizontally and vertically by 2 (often called 4:2:0). */
+        h[4] = 0x00;                                // type (fixme might be wrong for camera data) https://tools.ietf.org/html/rfc2435
+        h[5] = withQuant ? 128 : 0x5e;              // quality scale factor was 0x5e
+        h[6] = width / 8;                           // width  / 8
+        h[7] = height / 8;                          // height / 8
+        h += KJpegHeaderSize;
+
+        if (withQuant) { // we need a quant header - but only in first packet of the frame
+            h[0] = 0; // MBZ
+            h[1] = 0; // 8 bit precision
+            h[2] = 0; // MSB of lentgh
+            h[3] = 2 * 64; // LSB of length, two 64 byte tables
+            memcpy(h + 4, qtable0, 64);
+            memcpy(h + 4 + 64, qtable1, 64);
+            h += KQuantHeaderSize;
+        }
+        f.headerLen = h - f.header;
+        fragmentOffset += fragmentLen;
+    }
+    return frame;
+}
+
+CRtpFrame::~CRtpFrame()
+{
+    delete[] m_Fragments;
+    delete[] m_Headers;
+}
+
+// frames are built and sent from the same task, no need for atomics
+void CRtpFrame::retain()
+{
+    m_RefCount++;
+}
+
+void CRtpFrame::release()
+{
+    if (--m_RefCount == 0)
+        delete this;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "platglue.h"
+
+typedef unsigned const char *BufPtr;
+
+// One fragment of a frame, the RTP header is added by each session
+struct RtpFragment
+{
+    const uint8_t *header;  // JPEG payload header, and quant tables in the first fragment
+    uint16_t headerLen;
+    BufPtr data;            // slice of the JPEG scan data, not copied
+    uint16_t dataLen;
+    bool last;              // RTP marker bit
+};
+
+// A JPEG frame packetized once per RFC 2435 and shared by all the sessions
+// streaming it, each session only adds its own sequence number and timestamp.
+// The fragments point into the JPEG data, which must stay valid as long as
+// the frame is referenced.
+class CRtpFrame
+{
+public:
+    // returns NULL if the data is not a JPEG, else the frame with one reference
+    static CRtpFrame *create(BufPtr jpeg, uint32_t len, u_short width, u_short height);
+
+    void retain();
+    void release();             // the last release deletes the frame
+
+    int fragmentCount() const { return m_FragmentCount; }
+    const RtpFragment &fragment(int i) const { return m_Fragments[i]; }
+
+private:
+    CRtpFrame() {}
+    ~CRtpFrame();
+
+    int m_RefCount;
+    int m_FragmentCount;
+    RtpFragment *m_Fragments;
+    uint8_t *m_Headers;
+};
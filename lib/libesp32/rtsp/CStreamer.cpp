@@ -31,100 +31,6 @@ CStreamer::~CStreamer()
     udpsocketclose(m_RtcpSocket);
 };
 
-int CStreamer::SendRtpPacket(unsigned const char * jpeg, int jpegLen, int fragmentOffset, BufPtr quant0tbl, BufPtr quant1tbl)
-{
-#define KRtpHeaderSize 12           // size of the RTP header
-#define KJpegHeaderSize 8           // size of the special JPEG payload header
-
-#define MAX_FRAGMENT_SIZE 1100 // FIXME, pick more carefully
-    int fragmentLen = MAX_FRAGMENT_SIZE;
-    if(fragmentLen + fragmentOffset > jpegLen) // Shrink last fragment if needed
-        fragmentLen = jpegLen - fragmentOffset;
-
-    bool isLastFragment = (fragmentOffset + fragmentLen) == jpegLen;
-
-    // Do we have custom quant tables? If so include them per RFC
-
-    bool includeQuantTbl = quant0tbl && quant1tbl && fragmentOffset == 0;
-    uint8_t q = includeQuantTbl ? 128 : 0x5e;
-
-    //static char RtpBuf[2048]; // Note: we assume single threaded, this large buf we keep off of the tiny stack
-    int RtpPacketSize = fragmentLen + KRtpHeaderSize + KJpegHeaderSize + (includeQuantTbl ? (4 + 64 * 2) : 0);
-
-    memset(RtpBuf,0x00,sizeof(RtpBuf));
-    // Prepare the first 4 byte of the packet. This is the Rtp over Rtsp header in case of TCP based transport
-    RtpBuf[0]  = '$';        // magic number
-    RtpBuf[1]  = 0;          // number of multiplexed subchannel on RTPS connection - here the RTP channel
-    RtpBuf[2]  = (RtpPacketSize & 0x0000FF00) >> 8;
-    RtpBuf[3]  = (RtpPacketSize & 0x000000FF);
-    // Prepare the 12 byte RTP header
-    RtpBuf[4]  = 0x80;                               // RTP version
-    RtpBuf[5]  = 0x1a | (isLastFragment ? 0x80 : 0x00);                               // JPEG payload (26) and marker bit
-    RtpBuf[7]  = m_SequenceNumber & 0x0FF;           // each packet is counted with a sequence counter
-    RtpBuf[6]  = m_SequenceNumber >> 8;
-    RtpBuf[8]  = (m_Timestamp & 0xFF000000) >> 24;   // each image gets a timestamp
-    RtpBuf[9]  = (m_Timestamp & 0x00FF0000) >> 16;
-    RtpBuf[10] = (m_Timestamp & 0x0000FF00) >> 8;
-    RtpBuf[11] = (m_Timestamp & 0x000000FF);
-    RtpBuf[12] = 0x13;                               // 4 byte SSRC (sychronization source identifier)
-    RtpBuf[13] = 0xf9;                               // we just an arbitrary number here to keep it simple
-    RtpBuf[14] = 0x7e;
-    RtpBuf[15] = 0x67;
-
-    // Prepare the 8 byte payload JPEG header
-    RtpBuf[16] = 0x00;                               // type specific
-    RtpBuf[17] = (fragmentOffset & 0x00FF0000) >> 16;                               // 3 byte fragmentation offset for fragmented images
-    RtpBuf[18] = (fragmentOffset & 0x0000FF00) >> 8;
-    RtpBuf[19] = (fragmentOffset & 0x000000FF);
-
-    /*    These sampling factors indicate that the chrominance components of
-       type 0 video is downsampled horizontally by 2 (often called 4:2:2)
-       while the chrominance components of type 1 video are downsampled both
-       horizontally and vertically by 2 (often called 4:2:0). */
-    RtpBuf[20] = 0x00;                               // type (fixme might be wrong for camera data) https://tools.ietf.org/html/rfc2435
-    RtpBuf[21] = q;                               // quality scale factor was 0x5e
-    RtpBuf[22] = m_width / 8;                           // width  / 8
-    RtpBuf[23] = m_height / 8;                           // height / 8
-
-    int headerLen = 24; // Inlcuding jpeg header but not qant table header
-    if(includeQuantTbl) { // we need a quant header - but only in first packet of the frame
-        //printf("inserting quanttbl\n");
-        RtpBuf[24] = 0; // MBZ
-        RtpBuf[25] = 0; // 8 bit precision
-        RtpBuf[26] = 0; // MSB of lentgh
-
-        int numQantBytes = 64; // Two 64 byte tables
-        RtpBuf[27] = 2 * numQantBytes; // LSB of length
-
-        headerLen += 4;
-
-        memcpy(RtpBuf + headerLen, quant0tbl, numQantBytes);
-        headerLen += numQantBytes;
-
-        memcpy(RtpBuf + headerLen, quant1tbl, numQantBytes);
-        headerLen += numQantBytes;
-    }
-    // printf("Sending timestamp %d, seq %d, fragoff %d, fraglen %d, jpegLen %d\n", m_Timestamp, m_SequenceNumber, fragmentOffset, fragmentLen, jpegLen);
-
-    // append the JPEG scan data to the RTP buffer
-    memcpy(RtpBuf + headerLen,jpeg + fragmentOffset, fragmentLen);
-    fragmentOffset += fragmentLen;
-
-    m_SequenceNumber++;                              // prepare the packet counter for the next packet
-
-    IPADDRESS otherip;
-    IPPORT otherport;
-    socketpeeraddr(m_Client, &otherip, &otherport);
-
-    // RTP marker bit must be set on last fragment
-    if (m_TCPTransport) // RTP over RTSP - we send the buffer + 4 byte additional header
-        socketsend(m_Client,RtpBuf,RtpPacketSize + 4);
-    else                // UDP - we send just the buffer by skipping the 4 byte RTP over RTSP header
-        udpsocketsend(m_RtpSocket,&RtpBuf[4],RtpPacketSize, otherip, m_RtpClientPort);
-
-    return isLastFragment ? 0 : fragmentOffset;
-};
-
 void CStreamer::InitTransport(u_short aRtpPort, u_short aRtcpPort, bool TCP)
 {
     m_RtpClientPort  = aRtpPort;
@@ -167,6 +73,21 @@ u_short CStreamer::GetRtcpServerPort()
 
 void CStreamer::streamFrame(unsigned const char *data, uint32_t dataLen, uint32_t curMsec)
 {
+    CRtpFrame *frame = CRtpFrame::create(data, dataLen, m_width, m_height);
+    if (!frame) {
+#ifdef STREAM_DEBUG
+        printf("can't decode jpeg data\n");
+#endif
+        return;
+    }
+    streamFrame(frame, curMsec);
+    frame->release();
+};
+
+void CStreamer::streamFrame(const CRtpFrame *frame, uint32_t curMsec)
+{
+#define KRtpHeaderSize 12           // size of the RTP header
+
     if(m_prevMsec == 0) // first frame init our timestamp
         m_prevMsec = curMsec;
 
@@ -174,20 +95,52 @@ void CStreamer::streamFrame(unsigned const char *data, uint32_t dataLen, uint32_
     uint32_t deltams = (curMsec >= m_prevMsec) ? curMsec - m_prevMsec : 100;
     m_prevMsec = curMsec;
 
-    // locate quant tables if possible
-    BufPtr qtable0, qtable1;
+    IPADDRESS otherip;
+    IPPORT otherport;
+    socketpeeraddr(m_Client, &otherip, &otherport);
 
-    if (!decodeJPEGfile(&data, &dataLen, &qtable0, &qtable1)) {
-#ifdef STREAM_DEBUG
-        printf("can't decode jpeg data\n");
-#endif
-        return;
-    }
+    uint8_t RtpHdr[4 + KRtpHeaderSize];
+    for (int i = 0; i < frame->fragmentCount(); i++) {
+        const RtpFragment &f = frame->fragment(i);
+        int RtpPacketSize = KRtpHeaderSize + f.headerLen + f.dataLen;
+
+        // Prepare the first 4 byte of the packet. This is the Rtp over Rtsp header in case of TCP based transport
+        RtpHdr[0]  = '$';        // magic number
+        RtpHdr[1]  = 0;          // number of multiplexed subchannel on RTPS connection - here the RTP channel
+        RtpHdr[2]  = (RtpPacketSize & 0x0000FF00) >> 8;
+        RtpHdr[3]  = (RtpPacketSize & 0x000000FF);
+        // Prepare the 12 byte RTP header
+        RtpHdr[4]  = 0x80;                               // RTP version
+        RtpHdr[5]  = 0x1a | (f.last ? 0x80 : 0x00);      // JPEG payload (26) and marker bit
+        RtpHdr[7]  = m_SequenceNumber & 0x0FF;           // each packet is counted with a sequence counter
+        RtpHdr[6]  = m_SequenceNumber >> 8;
+        RtpHdr[8]  = (m_Timestamp & 0xFF000000) >> 24;   // each image gets a timestamp
+        RtpHdr[9]  = (m_Timestamp & 0x00FF0000) >> 16;
+        RtpHdr[10] = (m_Timestamp & 0x0000FF00) >> 8;
+        RtpHdr[11] = (m_Timestamp & 0x000000FF);
+        RtpHdr[12] = 0x13;                               // 4 byte SSRC (sychronization source identifier)
+        RtpHdr[13] = 0xf9;                               // we just an arbitrary number here to keep it simple
+        RtpHdr[14] = 0x7e;
+        RtpHdr[15] = 0x67;
+
+        m_SequenceNumber++;                              // prepare the packet counter for the next packet
+
+        // the headers and the JPEG scan data are sent without copying them to a packet buffer
+        SENDSLICE slices[3] = {
+            { RtpHdr, sizeof(RtpHdr) },
+            { f.header, f.headerLen },
+            { f.data, f.dataLen }
+        };
 
-    int offset = 0;
-    do {
-        offset = SendRtpPacket(data, dataLen, offset, qtable0, qtable1);
-    } while(offset != 0);
+        // RTP marker bit must be set on last fragment
+        if (m_TCPTransport) // RTP over RTSP - we send the buffer + 4 byte additional header
+            socketsendv(m_Client, slices, 3);
+        else {              // UDP - we send just the buffer by skipping the 4 byte RTP over RTSP header
+            slices[0].data = RtpHdr + 4;
+            slices[0].len = KRtpHeaderSize;
+            udpsocketsendv(m_RtpSocket, slices, 3, otherip, m_RtpClientPort);
+        }
+    }
 
     // Increment ONLY after a full frame
     uint32_t units = 90000; // Hz per RFC 2435
@@ -1,8 +1,7 @@
 #pragma once
 
 #include "platglue.h"
-
-typedef unsigned const char *BufPtr;
+#include "CRtpFrame.h"
 
 class CStreamer
 {
@@ -18,9 +17,9 @@ public:
 protected:
 
     void    streamFrame(unsigned const char *data, uint32_t dataLen, uint32_t curMsec);
+    void    streamFrame(const CRtpFrame *frame, uint32_t curMsec); // send a frame shared with other sessions
 
 private:
-    int    SendRtpPacket(unsigned const char *jpeg, int jpegLen, int fragmentOffset, BufPtr quant0tbl = NULL, BufPtr quant1tbl = NULL);// returns new fragmentOffset or 0 if finished with frame
 
     UDPSOCKET m_RtpSocket;           // RTP socket for streaming RTP packets to client
     UDPSOCKET m_RtcpSocket;          // RTCP socket for sending/receiving RTCP packages
@@ -39,7 +38,6 @@ private:
 
     u_short m_width; // image data info
     u_short m_height;
-    char RtpBuf[2048];
 };
 
 
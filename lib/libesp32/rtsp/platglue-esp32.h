@@ -76,6 +76,50 @@ inline ssize_t udpsocketsend(UDPSOCKET sockfd, const void *buf, size_t len,
     return len;
 }
 
+// TCP sending of a packet made of several parts
+// WiFiClient has no writev, the parts are gathered in a staging buffer so that the
+// packet goes out with a single write instead of one per part
+#define SENDV_STAGING_SIZE 1460     // one TCP segment, larger packets are sent part by part
+
+inline ssize_t socketsendv(SOCKET sockfd, const SENDSLICE *slices, int count)
+{
+    static uint8_t staging[SENDV_STAGING_SIZE];    // only used by the streaming task
+    size_t total = 0;
+    for(int i = 0; i < count; i++) {
+        total += slices[i].len;
+    }
+    if(total <= sizeof(staging)) {
+        uint8_t *p = staging;
+        for(int i = 0; i < count; i++) {
+            memcpy(p, slices[i].data, slices[i].len);
+            p += slices[i].len;
+        }
+        return sockfd->write(staging, total);
+    }
+
+    ssize_t len = 0;
+    for(int i = 0; i < count; i++) {
+        len += sockfd->write((const uint8_t *) slices[i].data, slices[i].len);
+    }
+    return len;
+}
+
+// WiFiUDP assembles the datagram in its own buffer
+inline ssize_t udpsocketsendv(UDPSOCKET sockfd, const SENDSLICE *slices, int count,
+                              IPADDRESS destaddr, IPPORT destport)
+{
+    ssize_t len = 0;
+    sockfd->beginPacket(destaddr, destport);
+    for(int i = 0; i < count; i++) {
+        len += sockfd->write((const uint8_t *) slices[i].data, slices[i].len);
+    }
+    if(!sockfd->endPacket()) {
+//        printf("error sending udp packet\n");
+    }
+
+    return len;
+}
+
 /**
    Read from a socket with a timeout.
 
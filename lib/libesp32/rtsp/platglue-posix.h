@@ -1,6 +1,7 @@
 #pragma once
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
@@ -82,6 +83,42 @@ inline ssize_t udpsocketsend(UDPSOCKET sockfd, const void *buf, size_t len,
     return sendto(sockfd, buf, len, 0, (sockaddr *) &addr, sizeof(addr));
 }
 
+// TCP sending of a packet made of several parts
+inline ssize_t socketsendv(SOCKET sockfd, const SENDSLICE *slices, int count)
+{
+    struct iovec iov[8];
+    if(count > 8) return -1;
+    for(int i = 0; i < count; i++) {
+        iov[i].iov_base = (void *) slices[i].data;
+        iov[i].iov_len = slices[i].len;
+    }
+    return writev(sockfd, iov, count);
+}
+
+inline ssize_t udpsocketsendv(UDPSOCKET sockfd, const SENDSLICE *slices, int count,
+                              IPADDRESS destaddr, uint16_t destport)
+{
+    sockaddr_in addr;
+    struct iovec iov[8];
+    struct msghdr msg;
+
+    if(count > 8) return -1;
+    for(int i = 0; i < count; i++) {
+        iov[i].iov_base = (void *) slices[i].data;
+        iov[i].iov_len = slices[i].len;
+    }
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = destaddr;
+    addr.sin_port = htons(destport);
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &addr;
+    msg.msg_namelen = sizeof(addr);
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+
+    return sendmsg(sockfd, &msg, 0);
+}
+
 /**
    Read from a socket with a timeout.
 
@@ -1,5 +1,13 @@
 #pragma once
 
+#include <stddef.h>
+
+// a part of a packet, packets are sent from several parts without copying them
+typedef struct {
+    const void *data;
+    size_t len;
+} SENDSLICE;
+
 #ifdef ARDUINO_ARCH_ESP32
 #include "platglue-esp32.h"
 #else
@@ -0,0 +1,239 @@
+// Host test of the RTP fan-out to several sessions, run with `make` from this folder
+//
+// Each session streams RTP over its RTSP connection (TCP interleaved), here a local
+// socket pair drained by a thread. Checks that the packets are valid and identical
+// for a frame packetized once and shared, a frame packetized by each session, and
+// the former copy of each packet to a buffer, then measures frames/sec for 1-8 sessions.
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SimStreamer.h"
+#include "CRtpFrame.h"
+
+static int errors = 0;
+#define CHECK(c) do { if (!(c)) { printf("FAIL line %d: %s\n", __LINE__, #c); errors++; } } while (0)
+
+// frame shared by the sessions, like localOV2640Streamer in Tasmota
+class SharedStreamer : public CStreamer
+{
+    const CRtpFrame *m_frame;
+public:
+    SharedStreamer(SOCKET aClient) : CStreamer(aClient, 800, 600), m_frame(NULL) {}
+    void setframe(const CRtpFrame *frame) { m_frame = frame; }
+    virtual void streamImage(uint32_t curMsec) { if (m_frame) streamFrame(m_frame, curMsec); }
+};
+
+// the packetization before the fan-out, each packet copied to a cleared 2KB buffer
+class CopyStreamer
+{
+    SOCKET m_Client;
+    u_short m_SequenceNumber = 0;
+    uint32_t m_Timestamp = 0;
+    uint32_t m_prevMsec = 0;
+    char RtpBuf[2048];
+public:
+    CopyStreamer(SOCKET aClient) : m_Client(aClient) {}
+    void streamImage(uint32_t curMsec)
+    {
+        BufPtr data = capture_jpg, qtable0, qtable1;
+        uint32_t dataLen = capture_jpg_len;
+        if (m_prevMsec == 0) m_prevMsec = curMsec;
+        uint32_t deltams = (curMsec >= m_prevMsec) ? curMsec - m_prevMsec : 100;
+        m_prevMsec = curMsec;
+        if (!decodeJPEGfile(&data, &dataLen, &qtable0, &qtable1)) return;
+        int offset = 0;
+        do {
+            int fragmentLen = 1100;
+            if (fragmentLen + offset > (int)dataLen) fragmentLen = dataLen - offset;
+            bool last = offset + fragmentLen == (int)dataLen;
+            bool quant = qtable0 && qtable1 && offset == 0;
+            int size = fragmentLen + 12 + 8 + (quant ? 4 + 128 : 0);
+            memset(RtpBuf, 0, sizeof(RtpBuf));
+            uint8_t *b = (uint8_t *)RtpBuf;
+            b[0] = '$'; b[1] = 0; b[2] = size >> 8; b[3] = size & 0xFF;
+            b[4] = 0x80; b[5] = 0x1a | (last ? 0x80 : 0);
+            b[6] = m_SequenceNumber >> 8; b[7] = m_SequenceNumber & 0xFF;
+            b[8] = m_Timestamp >> 24; b[9] = m_Timestamp >> 16; b[10] = m_Timestamp >> 8; b[11] = m_Timestamp;
+            b[12] = 0x13; b[13] = 0xf9; b[14] = 0x7e; b[15] = 0x67;
+            b[16] = 0; b[17] = offset >> 16; b[18] = offset >> 8; b[19] = offset;
+            b[20] = 0; b[21] = quant ? 128 : 0x5e; b[22] = 800 / 8; b[23] = 600 / 8;
+            int h = 24;
+            if (quant) {
+                b[24] = 0; b[25] = 0; b[26] = 0; b[27] = 128; h += 4;
+                memcpy(b + h, qtable0, 64); h += 64;
+                memcpy(b + h, qtable1, 64); h += 64;
+            }
+            memcpy(b + h, data + offset, fragmentLen);
+            offset += fragmentLen;
+            m_SequenceNumber++;
+            socketsend(m_Client, RtpBuf, size + 4);
+            if (last) offset = 0;
+        } while (offset != 0);
+        m_Timestamp += 90000 * deltams / 1000;
+    }
+};
+
+// sessions on socket pairs, a thread reads the other ends
+struct Sessions
+{
+    std::vector<int> fds, peers;
+    std::vector<std::string> received;
+    bool keep;
+    std::thread reader;
+
+    Sessions(int n, bool keepData) : received(n), keep(keepData)
+    {
+        for (int i = 0; i < n; i++) {
+            int sv[2];
+            socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+            fds.push_back(sv[0]);
+            peers.push_back(sv[1]);
+        }
+        reader = std::thread([this] { read(); });
+    }
+    ~Sessions() { finish(); }
+    void finish()                       // waits until all the data is read
+    {
+        if (!reader.joinable()) return;
+        for (int fd : fds) close(fd);   // the reader sees the end of each stream
+        reader.join();
+        for (int fd : peers) close(fd);
+    }
+    void read()
+    {
+        std::vector<pollfd> p;
+        for (int fd : peers) p.push_back({ fd, POLLIN, 0 });
+        size_t open = p.size();
+        char buf[65536];
+        while (open) {
+            poll(p.data(), p.size(), 100);
+            for (size_t i = 0; i < p.size(); i++) {
+                if (p[i].fd < 0 || !(p[i].revents & (POLLIN | POLLHUP))) continue;
+                ssize_t n = ::read(p[i].fd, buf, sizeof(buf));
+                if (n <= 0) { p[i].fd = -1; open--; continue; }
+                if (keep) received[i].append(buf, n);
+            }
+        }
+    }
+};
+
+// parse one session stream and check the RTP/JPEG packets
+static void check_stream(const std::string &s, int frames)
+{
+    BufPtr scan = capture_jpg, q0, q1;
+    uint32_t scanLen = capture_jpg_len;
+    CHECK(decodeJPEGfile(&scan, &scanLen, &q0, &q1));
+    const uint8_t *p = (const uint8_t *)s.data(), *end = p + s.size();
+    uint16_t seq = 0;
+    for (int f = 0; f < frames; f++) {
+        std::string payload;
+        uint32_t ts = 0;
+        bool last = false;
+        while (!last && p + 4 <= end) {
+            CHECK(p[0] == '$' && p[1] == 0);
+            int size = p[2] << 8 | p[3];
+            const uint8_t *r = p + 4;
+            p += 4 + size;
+            CHECK(p <= end);
+            CHECK(r[0] == 0x80 && (r[1] & 0x7F) == 26);
+            CHECK((uint16_t)(r[2] << 8 | r[3]) == seq);
+            seq++;
+            uint32_t t = (uint32_t)r[4] << 24 | r[5] << 16 | r[6] << 8 | r[7];
+            uint32_t offset = r[13] << 16 | r[14] << 8 | r[15];
+            if (offset == 0) ts = t;
+            CHECK(t == ts);
+            CHECK(offset == payload.size());
+            int h = 12 + 8;
+            if (r[17] == 128) {
+                CHECK(offset == 0 && !memcmp(r + h + 4, q0, 64) && !memcmp(r + h + 68, q1, 64));
+                h += 4 + 128;
+            }
+            payload.append((const char *)r + h, size - h);
+            last = r[1] & 0x80;
+        }
+        CHECK(last);
+        CHECK(payload.size() == scanLen && !memcmp(payload.data(), scan, scanLen));
+    }
+    CHECK(p == end);
+}
+
+enum { MODE_COPY, MODE_SESSION, MODE_SHARED };
+
+// streams `frames` frames to `n` sessions, returns frames/sec
+static double stream(int n, int mode, int frames, Sessions &sessions)
+{
+    std::vector<CStreamer *> streamers;
+    std::vector<CopyStreamer *> copiers;
+    for (int i = 0; i < n; i++) {
+        if (mode == MODE_COPY) {
+            copiers.push_back(new CopyStreamer(sessions.fds[i]));
+        } else {
+            CStreamer *s = (mode == MODE_SHARED) ? (CStreamer *)new SharedStreamer(sessions.fds[i])
+                                                 : (CStreamer *)new SimStreamer(sessions.fds[i], true);
+            s->InitTransport(0, 0, true);
+            streamers.push_back(s);
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+        uint32_t ms = 1000 + f * 100;
+        if (mode == MODE_COPY) {
+            for (CopyStreamer *c : copiers) c->streamImage(ms);
+        } else if (mode == MODE_SESSION) {
+            for (CStreamer *s : streamers) s->streamImage(ms);
+        } else {
+            CRtpFrame *frame = CRtpFrame::create(capture_jpg, capture_jpg_len, 800, 600);
+            for (CStreamer *s : streamers) {
+                ((SharedStreamer *)s)->setframe(frame);
+                s->streamImage(ms);
+                ((SharedStreamer *)s)->setframe(NULL);
+            }
+            frame->release();
+        }
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (CStreamer *s : streamers) delete s;
+    for (CopyStreamer *c : copiers) delete c;
+    return frames / secs;
+}
+
+int main()
+{
+    // valid packets, and the same bytes in the three modes
+    const int sessions = 2, frames = 5;
+    std::string streams[3][sessions];
+    for (int mode = MODE_COPY; mode <= MODE_SHARED; mode++) {
+        Sessions s(sessions, true);
+        stream(sessions, mode, frames, s);
+        s.finish();
+        for (int i = 0; i < sessions; i++) {
+            check_stream(s.received[i], frames);
+            streams[mode][i] = s.received[i];
+        }
+    }
+    for (int i = 0; i < sessions; i++) {
+        CHECK(streams[MODE_SESSION][i] == streams[MODE_COPY][i]);
+        CHECK(streams[MODE_SHARED][i] == streams[MODE_COPY][i]);
+    }
+    CHECK(CRtpFrame::create(octo_jpg, 100, 640, 480) == NULL);
+
+    // frames/sec streamed to all the sessions
+    printf("sessions  copy fps  per session fps  shared fps\n");
+    for (int n = 1; n <= 8; n++) {
+        double fps[3];
+        for (int mode = MODE_COPY; mode <= MODE_SHARED; mode++) {
+            Sessions s(n, false);
+            fps[mode] = stream(n, mode, 2000 / n, s);
+        }
+        printf("%8d  %8.0f  %15.0f  %10.0f\n", n, fps[MODE_COPY], fps[MODE_SESSION], fps[MODE_SHARED]);
+    }
+
+    printf(errors ? "%d errors\n" : "all passed\n", errors);
+    return errors ? 1 : 0;
+}
@@ -796,6 +796,7 @@
 #define D_PRFX_BR "Br"
 #define D_CMND_BR_RUN ""
 #define D_CMND_BR_RESTART "Restart"
+#define D_CMND_BR_PROFILE "Profile"
 #define D_BR_NOT_STARTED  "Berry not started"
 
 // Commands xdrv_60_shift595.ino - 74x595 family shift register driver
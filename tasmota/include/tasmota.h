@@ -436,6 +436,8 @@ enum XsnsFunctions { FUNC_SETTINGS_OVERRIDE, FUNC_SETUP_RING1, FUNC_SETUP_RING2,
                      FUNC_last_function         // Insert functions WITH return results before here
                      };
 
+const uint8_t FUNC_SUBSCRIPTIONS = FUNC_EVERY_SECOND - FUNC_LOOP +1;  // High frequency functions only dispatched to subscribed drivers
+
 enum AddressConfigSteps { ADDR_IDLE, ADDR_RECEIVE, ADDR_SEND };
 
 enum SettingsTextIndex { SET_OTAURL,
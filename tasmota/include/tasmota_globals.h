@@ -570,6 +570,7 @@ bool first_device_group_is_local = true;
 #ifndef USE_PROFILING
 #undef USE_PROFILE_DRIVER
 #undef USE_PROFILE_FUNCTION
+#undef USE_PROFILE_DISPATCH
 #endif
 
 #ifdef USE_PROFILE_DRIVER
@@ -584,6 +585,12 @@ bool first_device_group_is_local = true;
 #define PROFILE_FUNCTION(DRIVER, INDEX, FUNCTION, START)
 #endif  // USE_PROFILE_DRIVER
 
+#ifdef USE_PROFILE_DISPATCH
+#define PROFILE_DISPATCH(DRIVER, FUNCTION, CALLS, SKIPPED, START) AddLogDispatch(DRIVER, FUNCTION, CALLS, SKIPPED, START)
+#else
+#define PROFILE_DISPATCH(DRIVER, FUNCTION, CALLS, SKIPPED, START)
+#endif  // USE_PROFILE_DISPATCH
+
 /*********************************************************************************************\
  * Macro for SetOption synonyms
  *
@@ -1179,6 +1179,7 @@ https://rya.nc/tasmota-fingerprint.html"
   #define USE_BERRY_FAST_LOOP_SLEEP_MS  5        // Minimum time in milliseconds to before calling again `tasmota.fast_loop()`, a smaller value will consume more CPU (min 1ms)
   // #define USE_BERRY_DEBUG                        // Compile Berry bytecode with line number information, makes exceptions easier to debug. Adds +8% of memory consumption for compiled code
   //   #define UBE_BERRY_DEBUG_GC                   // Print low-level GC metrics
+  // #define USE_BERRY_BEC_PARTITION  "berry"       // Run precompiled bytecode from data partition "berry" before `autoexec.be`, instructions are used in place from flash
   // #define USE_BERRY_INT64                        // Add 64 bits integer support (+1.7KB Flash)
   #define USE_WEBCLIENT                          // Enable `webclient` to make HTTP/HTTPS requests. Can be disabled for security reasons.
     // #define USE_WEBCLIENT_HTTPS                  // Enable HTTPS outgoing requests based on BearSSL (much ligher then mbedTLS, 42KB vs 150KB) in insecure mode (no verification of server's certificate)
@@ -1274,6 +1275,7 @@ https://rya.nc/tasmota-fingerprint.html"
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_DISPATCH                     // Enable high frequency function dispatch profiling
 
 /*********************************************************************************************\
  * Optional firmware configurations
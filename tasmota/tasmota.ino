@@ -251,6 +251,11 @@ HardwareSerial TasConsole = Serial;         // Only serial interface
 
 char EmptyStr[1] = { 0 };                   // Provide a pointer destination to an empty char string
 
+typedef struct {
+  uint16_t offset;                          // Offset of entry (loglevel followed by log data) in log buffer
+  uint16_t length;                          // Length of log data including terminating '\1' (0 = no entry)
+} TasLogIndex;
+
 struct TasmotaGlobal_t {
   uint32_t global_update;                   // Timestamp of last global temperature and humidity update
   uint32_t baudrate;                        // Current Serial baudrate
@@ -286,6 +291,7 @@ struct TasmotaGlobal_t {
   uint16_t gpio_pin[MAX_GPIO_PIN];          // GPIO functions indexed by pin number
   myio my_module;                           // Active copy of Module GPIOs (17 x 16 bits)
   uint16_t blink_counter;                   // Number of blink cycles
+  uint16_t log_buffer_head;                 // Offset in log buffer where next entry is stored
   uint16_t seriallog_timer;                 // Timer to disable Seriallog
   uint16_t syslog_timer;                    // Timer to re-enable syslog_level
   uint16_t tele_period;                     // Tele period timer
@@ -323,6 +329,7 @@ struct TasmotaGlobal_t {
 
   uint8_t user_globals[3];                  // User set global temp/hum/press
   uint8_t busy_time;                        // Time in ms to allow executing of time critical functions
+  uint8_t log_buffer_oldest;                // Index of oldest entry in log buffer (0 = empty)
   uint8_t init_state;                       // Tasmota init state
   uint8_t heartbeat_inverted;               // Heartbeat pulse inverted flag
   uint8_t spi_enabled;                      // SPI configured
@@ -363,7 +370,9 @@ struct TasmotaGlobal_t {
   uint8_t restore_powered_off_led_counter;  // Seconds before powered-off LED (LEDLink) is restored
   uint8_t pwm_dimmer_led_bri;               // Adjusted brightness LED level
 #endif  // USE_PWM_DIMMER
-  String mqtt_data;                         // Buffer filled by Response functions
+  char* response_data;                      // Buffer filled by Response functions (grows when needed)
+  size_t response_size;                     // Allocated size of response buffer
+  uint32_t response_length;                 // Length of response in response buffer
   char version[16];                         // Composed version string like 255.255.255.255
   char image_name[33];                      // Code image and/or commit
   char hostname[33];                        // Composed Wifi hostname
@@ -376,6 +385,7 @@ struct TasmotaGlobal_t {
 #else
   char log_buffer[LOG_BUFFER_SIZE];         // Log buffer in DRAM
 #endif  // PIO_FRAMEWORK_ARDUINO_MMU_CACHE16_IRAM48_SECHEAP_SHARED
+  TasLogIndex log_index[256];               // Log buffer entry location by log index (index 0 is not used)
 
 #ifdef USE_BERRY
   bool berry_fast_loop_enabled = false;     // is Berry fast loop enabled, i.e. control is passed at each loop iteration
@@ -1295,7 +1295,7 @@ char* ResponseGetTime(uint32_t format, char* time_str)
 }
 
 char* ResponseData(void) {
-  return (char*)TasmotaGlobal.mqtt_data.c_str();
+  return (TasmotaGlobal.response_data) ? TasmotaGlobal.response_data : EmptyStr;
 }
 
 uint32_t ResponseSize(void) {
@@ -1303,51 +1303,68 @@ uint32_t ResponseSize(void) {
 }
 
 uint32_t ResponseLength(void) {
-  return TasmotaGlobal.mqtt_data.length();
+  return TasmotaGlobal.response_length;
 }
 
 void ResponseClear(void) {
-  // Reset string length to zero
-  TasmotaGlobal.mqtt_data = "";
-//  TasmotaGlobal.mqtt_data = (const char*) nullptr;  // Doesn't work on ESP32 as strlen() (in MqttPublishPayload) will fail (for obvious reasons)
+  // Reset string length to zero but keep the buffer for reuse
+  TasmotaGlobal.response_length = 0;
+  if (TasmotaGlobal.response_data) {
+    TasmotaGlobal.response_data[0] = '\0';
+  }
 }
 
 void ResponseJsonStart(void) {
   // Insert a JSON start bracket {
-  TasmotaGlobal.mqtt_data.setCharAt(0,'{');
+  if (TasmotaGlobal.response_length) {
+    TasmotaGlobal.response_data[0] = '{';
+  }
+}
+
+int _ResponseFormat(uint32_t start, const char* formatP, va_list arg) {
+  // Format behind the string terminator of the response, which only grows if the result does not fit,
+  // so arguments pointing into the current response stay intact. The output is then moved to start
+  uint32_t scratch = TasmotaGlobal.response_length + 1;
+  int32_t len = ext_vsnprintf_append_P(&TasmotaGlobal.response_data, &TasmotaGlobal.response_size,
+                                       scratch, formatP, arg);
+  if (TasmotaGlobal.response_data) {
+    if (len > 0) {
+      memmove(TasmotaGlobal.response_data + start, TasmotaGlobal.response_data + scratch, len);
+    } else {
+      len = 0;
+    }
+    TasmotaGlobal.response_length = start + len;
+    TasmotaGlobal.response_data[TasmotaGlobal.response_length] = '\0';
+  }
+  return TasmotaGlobal.response_length;
+}
+
+int _ResponseAppend(const char* formatP, va_list arg) {
+  return _ResponseFormat(TasmotaGlobal.response_length, formatP, arg);
 }
 
 int Response_P(const char* format, ...)        // Content send snprintf_P char data
 {
   // This uses char strings. Be aware of sending %% if % is needed
+  // The response is replaced only after formatting so ResponseData() can be used as argument
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  _ResponseFormat(0, format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data = mqtt_data;
-    free(mqtt_data);
-  } else {
-    TasmotaGlobal.mqtt_data = "";
-  }
-  return TasmotaGlobal.mqtt_data.length();
+  return TasmotaGlobal.response_length;
 }
 
 int ResponseTime_P(const char* format, ...)    // Content send snprintf_P char data
 {
   // This uses char strings. Be aware of sending %% if % is needed
   char timestr[100];
-  TasmotaGlobal.mqtt_data = ResponseGetTime(Settings->flag2.time_format, timestr);
+  Response_P(PSTR("%s"), ResponseGetTime(Settings->flag2.time_format, timestr));
 
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  _ResponseAppend(format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data += mqtt_data;
-    free(mqtt_data);
-  }
-  return TasmotaGlobal.mqtt_data.length();
+  return TasmotaGlobal.response_length;
 }
 
 int ResponseAppend_P(const char* format, ...)  // Content send snprintf_P char data
@@ -1355,13 +1372,9 @@ int ResponseAppend_P(const char* format, ...)  // Content send snprintf_P char d
   // This uses char strings. Be aware of sending %% if % is needed
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  _ResponseAppend(format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data += mqtt_data;
-    free(mqtt_data);
-  }
-  return TasmotaGlobal.mqtt_data.length();
+  return TasmotaGlobal.response_length;
 }
 
 int ResponseAppendTimeFormat(uint32_t format)
@@ -1401,9 +1414,6 @@ int ResponseJsonEndEnd(void)
 }
 
 bool ResponseContains_P(const char* needle) {
-/*
-  return (strstr_P(TasmotaGlobal.mqtt_data.c_str(), needle) != nullptr);
-*/
   return (strstr_P(ResponseData(), needle) != nullptr);
 }
 
@@ -2447,6 +2457,28 @@ void SyslogAsync(bool refresh) {
   }
 }
 
+/*********************************************************************************************\
+ * Log buffer
+ *
+ * Ring buffer of log entries. Each entry is stored contiguously as [loglevel][log data]['\1'].
+ * TasmotaGlobal.log_index holds offset and length of each entry by log index (1..255) allowing
+ * constant time append and lookup. Readers keep their own log index as cursor.
+\*********************************************************************************************/
+
+uint32_t LogBufferDistance(uint32_t offset) {
+  // Number of bytes from oldest entry up to offset
+  uint32_t tail = TasmotaGlobal.log_index[TasmotaGlobal.log_buffer_oldest].offset;
+  return (offset >= tail) ? offset - tail : LOG_BUFFER_SIZE - tail + offset;
+}
+
+void LogBufferRemoveOldest(void) {
+  uint32_t index = TasmotaGlobal.log_buffer_oldest;
+  TasmotaGlobal.log_index[index].length = 0;
+  index++;
+  if (index > 255) { index = 1; }          // Skip 0 as it is not allowed
+  TasmotaGlobal.log_buffer_oldest = (index == TasmotaGlobal.log_buffer_pointer) ? 0 : index;
+}
+
 bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
   if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
 
@@ -2456,13 +2488,16 @@ bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
   TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
 #endif  // ESP32
 
-  // Skip initial buffer fill
-  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+  if (!TasmotaGlobal.log_buffer_oldest) { return false; }  // Log buffer is empty
+
+  // Skip initial buffer fill (head at oldest entry means buffer is full)
+  uint32_t used = LogBufferDistance(TasmotaGlobal.log_buffer_head);
+  if (used && (used < LOG_BUFFER_SIZE / 2)) { return false; }
 
   char* line;
   size_t len;
   if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
-  return ((line - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+  return (LogBufferDistance(line - TasmotaGlobal.log_buffer -1) < LOG_BUFFER_SIZE / 4);  // -1 = loglevel
 }
 
 bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
@@ -2478,38 +2513,24 @@ bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* l
   TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
 #endif  // ESP32
 
-  if (!index) {                            // Dump all
-    index = TasmotaGlobal.log_buffer[0];
-  }
+  if (!TasmotaGlobal.log_buffer_oldest) { return false; }  // Log buffer is empty
 
   do {
-    size_t len = 0;
-    uint32_t loglevel = 0;
-    char* entry_p = TasmotaGlobal.log_buffer;
-    do {
-      uint32_t cur_idx = *entry_p;
-      entry_p++;
-      size_t tmp = strchrspn(entry_p, '\1');
-      tmp++;                               // Skip terminating '\1'
-      if (cur_idx == index) {              // Found the requested entry
-        loglevel = *entry_p - '0';
-        entry_p++;                         // Skip loglevel
-        len = tmp -1;
-        break;
-      }
-      entry_p += tmp;
-    } while (entry_p < TasmotaGlobal.log_buffer + LOG_BUFFER_SIZE && *entry_p != '\0');
+    if (!index || !TasmotaGlobal.log_index[index].length) {  // Dump all or requested entry is already overwritten
+      index = TasmotaGlobal.log_buffer_oldest;
+    }
+    char* entry_p = TasmotaGlobal.log_buffer + TasmotaGlobal.log_index[index].offset;
+    size_t len = TasmotaGlobal.log_index[index].length;
+    uint32_t loglevel = *entry_p - '0';
     index++;
     if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
     *index_p = index;
-    if ((len > 0) &&
-        (loglevel <= req_loglevel) &&
+    if ((loglevel <= req_loglevel) &&
         (TasmotaGlobal.masterlog_level <= req_loglevel)) {
-      *entry_pp = entry_p;
+      *entry_pp = entry_p +1;              // Skip loglevel
       *len_p = len;
       return true;
     }
-    delay(0);
   } while (index != TasmotaGlobal.log_buffer_pointer);
   return false;
 }
@@ -2562,8 +2583,8 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
   if ((loglevel <= highest_loglevel) &&    // Log only when needed
       (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
-    // Delimited, zero-terminated buffer of log lines.
-    // Each entry has this format: [index][loglevel][log data]['\1']
+    // Ring buffer of log lines indexed by TasmotaGlobal.log_index.
+    // Each entry has this format: [loglevel][log data]['\1']
 
     // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
     uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
@@ -2578,22 +2599,51 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
     if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it requests all entries
     }
-    while (TasmotaGlobal.log_buffer_pointer == TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
-           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
-    {
-      char* it = TasmotaGlobal.log_buffer;
-      it++;                                // Skip log_buffer_pointer
-      it += strchrspn(it, '\1');           // Skip log line
-      it++;                                // Skip delimiting "\1"
-      memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
-    }
-    snprintf_P(TasmotaGlobal.log_buffer, LOG_BUFFER_SIZE, PSTR("%s%c%c%s%s%s%s\1"),
-      TasmotaGlobal.log_buffer, TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
+
+    const char* parts[4] = { mxtime, log_data, log_data_payload, log_data_retained };
+    size_t parts_len[4];
+    uint32_t length = 1;                   // 1 = '\1'
+    for (uint32_t i = 0; i < 4; i++) {
+      parts_len[i] = strlen(parts[i]);
+      length += parts_len[i];
+    }
+
+    // Make room for [loglevel][log data]['\1'] by removing oldest entries
+    uint32_t head = TasmotaGlobal.log_buffer_head;
+    if (head + length +1 > LOG_BUFFER_SIZE) {  // Entry does not fit at buffer end so wrap to buffer start
+      while (TasmotaGlobal.log_buffer_oldest &&
+             (TasmotaGlobal.log_index[TasmotaGlobal.log_buffer_oldest].offset >= head)) {
+        LogBufferRemoveOldest();           // Remove entries between head and buffer end
+      }
+      head = 0;
+    }
+    while (TasmotaGlobal.log_buffer_oldest &&
+           ((TasmotaGlobal.log_buffer_oldest == TasmotaGlobal.log_buffer_pointer) ||  // If log already holds the next index, remove it
+            ((TasmotaGlobal.log_index[TasmotaGlobal.log_buffer_oldest].offset >= head) &&
+             (TasmotaGlobal.log_index[TasmotaGlobal.log_buffer_oldest].offset <= head + length)))) {
+      LogBufferRemoveOldest();
+    }
+
+    char* entry_p = TasmotaGlobal.log_buffer + head;
+    *entry_p++ = '0' + loglevel;
+    for (uint32_t i = 0; i < 4; i++) {
+      memcpy(entry_p, parts[i], parts_len[i]);
+      entry_p += parts_len[i];
+    }
+    *entry_p = '\1';
+
+    TasmotaGlobal.log_index[TasmotaGlobal.log_buffer_pointer].offset = head;
+    TasmotaGlobal.log_index[TasmotaGlobal.log_buffer_pointer].length = length;
+    if (!TasmotaGlobal.log_buffer_oldest) {
+      TasmotaGlobal.log_buffer_oldest = TasmotaGlobal.log_buffer_pointer;
+    }
+    TasmotaGlobal.log_buffer_head = head + length +1;  // 1 = loglevel
+    TasmotaGlobal.log_buffer_pointer++;
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
     if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it requests all entries
     }
   }
 }
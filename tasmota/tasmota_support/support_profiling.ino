@@ -26,6 +26,7 @@
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_DISPATCH                     // Enable high frequency function dispatch profiling
 
 /*
 // Moved to tasmota_globals.h fixing compile warnings
@@ -89,4 +90,42 @@ void AddLogFunction(const char *driver, uint8_t index, uint8_t function, uint32_
 }
 #endif  // USE_PROFILE_DRIVER
 
+#ifdef USE_PROFILE_DISPATCH
+#ifndef PROFILE_DISPATCH_INTERVAL
+#define PROFILE_DISPATCH_INTERVAL    60       // Number of FUNC_EVERY_SECOND dispatches between reports
+#endif
+
+// Below needs to be inline with enum XsnsFunctions from FUNC_LOOP up to FUNC_EVERY_SECOND
+const char kDispatchFunctions[] PROGMEM = "LOOP|SLEEP_LOOP|EVERY_50_MSECOND|EVERY_100_MSECOND|EVERY_200_MSECOND|EVERY_250_MSECOND|EVERY_SECOND";
+
+struct PROFILE_DISPATCH_T {
+  uint32_t dispatches[FUNC_SUBSCRIPTIONS];    // Number of times the function was dispatched
+  uint32_t calls[FUNC_SUBSCRIPTIONS];         // Number of driver calls
+  uint32_t skipped[FUNC_SUBSCRIPTIONS];       // Number of driver calls saved as driver is not subscribed
+  uint32_t micros[FUNC_SUBSCRIPTIONS];        // Total dispatch duration in microseconds
+} ProfileDispatch[2];                         // 0 = xdrv, 1 = xsns
+
+void AddLogDispatch(const char *driver, uint8_t function, uint32_t calls, uint32_t skipped, uint32_t start) {
+  uint32_t profile_micros = micros() - start;
+  uint32_t type = ('s' == driver[0]) ? 1 : 0;
+  uint32_t index = function - FUNC_LOOP;
+  ProfileDispatch[type].dispatches[index]++;
+  ProfileDispatch[type].calls[index] += calls;
+  ProfileDispatch[type].skipped[index] += skipped;
+  ProfileDispatch[type].micros[index] += profile_micros;
+
+  if ((FUNC_EVERY_SECOND == function) && (ProfileDispatch[type].dispatches[index] >= PROFILE_DISPATCH_INTERVAL)) {
+    for (uint32_t i = 0; i < FUNC_SUBSCRIPTIONS; i++) {
+      if (!ProfileDispatch[type].dispatches[i]) { continue; }
+      char stemp1[20];
+      AddLog(LOG_LEVEL_DEBUG, PSTR("PRF: x%s FUNC_%s dispatched %u, calls %u, skipped %u, %u us per dispatch"),
+        driver, GetTextIndexed(stemp1, sizeof(stemp1), i, kDispatchFunctions),
+        ProfileDispatch[type].dispatches[i], ProfileDispatch[type].calls[i], ProfileDispatch[type].skipped[i],
+        ProfileDispatch[type].micros[i] / ProfileDispatch[type].dispatches[i]);
+    }
+    memset(&ProfileDispatch[type], 0, sizeof(PROFILE_DISPATCH_T));
+  }
+}
+#endif  // USE_PROFILE_DISPATCH
+
 #endif  // USE_PROFILING
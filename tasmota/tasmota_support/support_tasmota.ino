@@ -946,12 +946,12 @@ String GetSwitchText(uint32_t i) {
 const char kGlobalValues[] PROGMEM = D_JSON_TEMPERATURE "|" D_JSON_HUMIDITY "|" D_JSON_PRESSURE;
 
 void GetSensorValues(void) {
-  char *start = ResponseData();
   int data_start = ResponseLength();
 
   XsnsXdrvCall(FUNC_JSON_APPEND);
 
   if (data_start == ResponseLength()) { return; }
+  char *start = ResponseData();          // Response buffer may have been reallocated while appending
 
   for (uint32_t type = 0; type < 3; type++) {
     if (!Settings->global_sensor_index[type] || TasmotaGlobal.user_globals[type]) { continue; }
@@ -1185,10 +1185,12 @@ void PerformEverySecond(void)
       if (TasmotaGlobal.tele_period >= Settings->tele_period) {
         TasmotaGlobal.tele_period = 0;
 
+        uint32_t allocs = ext_printf_allocs;
         MqttPublishTeleState();
         MqttPublishTeleperiodSensor();
 
         XsnsXdrvCall(FUNC_AFTER_TELEPERIOD);
+        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("APP: Teleperiod used %d format allocations"), ext_printf_allocs - allocs);
       } else {
         // Global values (Temperature, Humidity and Pressure) update every 10 seconds
         if (!(TasmotaGlobal.tele_period % 10)) {
@@ -324,6 +324,8 @@ void CmndSSerialConfig(void) {
 bool Xdrv08(uint32_t function) {
   bool result = false;
 
+  if ((FUNC_INIT == function) && !serial_bridge_buffer) { XdrvUnsubscribeAll(); }  // Periodic calls only with configured device
+
   if (FUNC_PRE_INIT == function) {
     SerialBridgeInit();
   }
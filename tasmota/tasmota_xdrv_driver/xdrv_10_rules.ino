@@ -76,6 +76,10 @@
 #define RULE_MAX_MQTT_EVENTSZ   256
 #endif
 
+#ifndef RULE_MAX_EVENT_KEYS
+#define RULE_MAX_EVENT_KEYS     16         // Max number of first level event keys used to skip triggers
+#endif
+
 //#define DEBUG_RULES
 
 #include <unishox.h>
@@ -164,8 +168,24 @@ void (* const RulesCommand[])(void) PROGMEM = {
 #endif
   };
 
+// Rule set compiled once into a trigger table, rebuilt only when the rule text changes
+typedef struct {
+  String trigger;                // "INA219#CURRENT>0.100"
+  uint32_t key_hash;             // Hash of first JSON level "INA219"
+  uint32_t tele_key_hash;        // Hash of first JSON level after "TELE-" used during teleperiod
+  uint16_t commands_start;       // Offset of "Backlog Dimmer 10;Color 100000" in rule text
+  uint16_t commands_end;
+  bool tele;                     // Trigger contains "TELE-"
+  bool stop;                     // Trigger terminated by BREAK instead of ENDON
+} RuleTrigger;
+
 struct RULES {
   String event_value;
+  LList<RuleTrigger> compiled[MAX_RULE_SETS];
+  uint32_t event_keys[RULE_MAX_EVENT_KEYS];
+  uint8_t event_key_count = 0;
+  uint8_t compiled_valid = 0;    // Bitmask of rule sets with an up to date trigger table
+  bool event_keys_valid = false; // Event_keys holds all first level keys of the current event
   unsigned long timer[MAX_RULE_TIMERS] = { 0 };
   uint32_t triggers[MAX_RULE_SETS] = { 0 };
   uint8_t trigger_count[MAX_RULE_SETS] = { 0 };
@@ -331,6 +351,7 @@ int32_t SetRule_compress(uint32_t idx, const char *in, size_t in_len, char *out,
 //   <0 : not enough space
 int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
   if (nullptr == content) { content = ""; }   // if nullptr, use empty string
+  RulesInvalidate(idx);
   size_t len_in = strlen(content);
   bool needsCompress = false;
   size_t offset = 0;
@@ -706,56 +727,130 @@ void RulesVarReplace(String &commands, const String &sfind, const String &replac
 
 /*******************************************************************************************/
 
-bool RuleSetProcess(uint8_t rule_set, String &event_saved)
-{
-  bool serviced = false;
-  char stemp[10];
-
-  delay(0);                                               // Prohibit possible loop software watchdog
+void RulesInvalidate(uint32_t rule_set) {
+  bitClear(Rules.compiled_valid, rule_set);
+  Rules.compiled[rule_set].reset();
+}
 
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event '%s', Rule '%s'"), event_saved.c_str(), Settings->rules[rule_set]);
-#endif
+// Hash of the first JSON level addressed by a trigger like "INA219" in "INA219#CURRENT[1]>0.100"
+uint32_t RulesTriggerKeyHash(String &trigger) {
+  String rule_name, rule_param;
+  parseCompareExpression(trigger, rule_name, rule_param);
+  int pos;
+  if ((pos = rule_name.indexOf(F("["))) > 0) { rule_name = rule_name.substring(0, pos); }
+  if ((pos = rule_name.indexOf(F("#"))) > 0) { rule_name = rule_name.substring(0, pos); }
+  return GetHash(rule_name.c_str(), rule_name.length());
+}
 
+void RulesCompile(uint32_t rule_set) {
+  // Split "ON <trigger> DO <commands> ENDON|BREAK" once using the same syntax rules as before
+  RulesInvalidate(rule_set);
   String rules = GetRule(rule_set);
+  rules.toUpperCase();                                    // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
 
-  Rules.trigger_count[rule_set] = 0;
+  uint32_t base = 0;
   int plen = 0;
   int plen2 = 0;
-  bool stop_all_rules = false;
   while (true) {
-    rules = rules.substring(plen);                        // Select relative to last rule
-    rules.trim();
-    if (!rules.length()) { return serviced; }             // No more rules
-
-    String rule = rules;
-    rule.toUpperCase();                                   // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
-    if (!rule.startsWith(F("ON "))) { return serviced; }     // Bad syntax - Nothing to start on
+    base += plen;                                         // Select relative to last rule
+    while ((base < rules.length()) && isspace(rules[base])) { base++; }
+    String rule = rules.substring(base);
+    rule.trim();
+    if (!rule.length()) { break; }                        // No more rules
+    if (!rule.startsWith(F("ON "))) { break; }            // Bad syntax - Nothing to start on
 
     int pevt = rule.indexOf(F(" DO "));
-    if (pevt == -1) { return serviced; }                  // Bad syntax - Nothing to do
-    String event_trigger = rule.substring(3, pevt);       // "INA219#CURRENT>0.100"
-    event_trigger.trim();
+    if (pevt == -1) { break; }                            // Bad syntax - Nothing to do
 
     plen = rule.indexOf(F(" ENDON"));
     plen2 = rule.indexOf(F(" BREAK"));
-    if ((plen == -1) && (plen2 == -1)) { return serviced; } // Bad syntax - No ENDON neither BREAK
+    if ((plen == -1) && (plen2 == -1)) { break; }         // Bad syntax - No ENDON neither BREAK
 
     if (plen == -1) { plen = 9999; }
     if (plen2 == -1) { plen2 = 9999; }
     plen = tmin(plen, plen2);
 
-    String commands = rules.substring(pevt +4, plen);     // "Backlog Dimmer 10;Color 100000"
+    RuleTrigger &entry = Rules.compiled[rule_set].addToLast();
+    entry.trigger = rule.substring(3, pevt);              // "INA219#CURRENT>0.100"
+    entry.trigger.trim();
+    entry.tele = (entry.trigger.indexOf(F("TELE-")) != -1);
+    entry.key_hash = RulesTriggerKeyHash(entry.trigger);
+    if (entry.tele) {
+      String tele_trigger = entry.trigger.substring(5);   // "INA219#CURRENT>0.100"
+      entry.tele_key_hash = RulesTriggerKeyHash(tele_trigger);
+    }
+    entry.commands_start = base + tmin(pevt +4, plen);
+    entry.commands_end = base + tmax(pevt +4, plen);      // Same bounds as String.substring()
+    entry.stop = (plen == plen2);
+
+    plen += 6;
+  }
+  bitSet(Rules.compiled_valid, rule_set);
+}
+
+// Collect hashes of the first level keys of the event so triggers on other keys can be skipped
+void RulesEventKeys(String &event_saved) {
+  Rules.event_keys_valid = false;
+  Rules.event_key_count = 0;
+  String buf = event_saved;                               // Copy the string into a new buffer that will be modified
+  JsonParser parser((char*)buf.c_str());
+  JsonParserObject root = parser.getRootObject();
+  if (!root) { return; }                                  // Let RulesRuleMatch report invalid JSON
+  for (auto key : root) {
+    if (Rules.event_key_count >= RULE_MAX_EVENT_KEYS) { return; }
+    const char* name = key.getStr();
+    Rules.event_keys[Rules.event_key_count++] = GetHash(name, strlen(name));
+  }
+  Rules.event_keys_valid = true;
+}
+
+bool RulesEventHasKey(uint32_t hash) {
+  if (!Rules.event_keys_valid) { return true; }           // Unknown, let RulesRuleMatch decide
+  for (uint32_t i = 0; i < Rules.event_key_count; i++) {
+    if (Rules.event_keys[i] == hash) { return true; }
+  }
+  return false;
+}
+
+bool RuleSetProcess(uint8_t rule_set, String &event_saved)
+{
+  bool serviced = false;
+  char stemp[10];
+
+  delay(0);                                               // Prohibit possible loop software watchdog
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event '%s', Rule '%s'"), event_saved.c_str(), Settings->rules[rule_set]);
+#endif
+
+  if (!bitRead(Rules.compiled_valid, rule_set)) { RulesCompile(rule_set); }
+
+  Rules.trigger_count[rule_set] = 0;
+  bool stop_all_rules = false;
+  for (auto &entry : Rules.compiled[rule_set]) {
+    bool skip = entry.trigger.startsWith(F("FILE#"));
+    if (Rules.teleperiod) {
+      skip |= !entry.tele || !RulesEventHasKey(entry.tele_key_hash);  // No pre-amble in rule or other sensor
+    } else {
+      skip |= !RulesEventHasKey(entry.key_hash);
+    }
+    if (skip) {
+      Rules.trigger_count[rule_set]++;                    // Keep rule_once trigger bits aligned
+      continue;
+    }
+
+    String &event_trigger = entry.trigger;
     Rules.event_value = "";
     String event = event_saved;
 
 #ifdef DEBUG_RULES
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event '%s', Rule '%s', Command(s) '%s'"), event.c_str(), event_trigger.c_str(), commands.c_str());
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event '%s', Rule '%s'"), event.c_str(), event_trigger.c_str());
 #endif
 
-    if (!event_trigger.startsWith(F("FILE#")) && RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
+    if (RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
       if (Rules.no_execute) return true;
-      if (plen == plen2) { stop_all_rules = true; }       // If BREAK was used on a triggered rule, Stop execution of this rule set
+      if (entry.stop) { stop_all_rules = true; }          // If BREAK was used on a triggered rule, Stop execution of this rule set
+      String commands = GetRule(rule_set).substring(entry.commands_start, entry.commands_end);  // "Backlog Dimmer 10;Color 100000"
       commands.trim();
       String ucommand = commands;
       ucommand.toUpperCase();
@@ -830,8 +925,8 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
 #endif  // SUPPORT_IF_STATEMENT
       ExecuteCommand(command, SRC_RULE);
       serviced = true;
+      if (!bitRead(Rules.compiled_valid, rule_set)) { return serviced; }  // Command changed this rule set
     }
-    plen += 6;
     Rules.trigger_count[rule_set]++;
   }
   return serviced;
@@ -903,6 +998,8 @@ bool RulesProcessEvent(const char *json_event)
   AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event '%s'"), event_saved.c_str());
 #endif
 
+  RulesEventKeys(event_saved);
+
   for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
     if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
       if (RuleSetProcess(i, event_saved)) { serviced = true; }
@@ -935,6 +1032,7 @@ void RulesInit(void)
 
   TasmotaGlobal.rules_flag.data = 0;
   for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    RulesInvalidate(i);
     if (0 == GetRuleLen(i)) {
       bitWrite(Settings->rule_enabled, i, 0);
       bitWrite(Settings->rule_once, i, 0);
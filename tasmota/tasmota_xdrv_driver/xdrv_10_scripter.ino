@@ -95,6 +95,18 @@ const uint8_t SCRIPT_VERS[2] = {5, 3};
 #ifndef SCRIPT_CMDMEM
 #define SCRIPT_CMDMEM 512
 #endif
+
+// number of resolved variable references kept, indexed by position in script
+#ifndef SCRIPT_VAR_CACHE
+#ifdef ESP8266
+#define SCRIPT_VAR_CACHE 16
+#else
+#define SCRIPT_VAR_CACHE 64
+#endif
+#endif
+
+// log execution time of >F, >S and >T sections every minute
+//#define SCRIPT_SECTION_PROFILE
 #define MAX_SCRIPT_CMDBUFFER 4096
 
 #define SPI_FLASH_2SEC_SIZE SPI_FLASH_SEC_SIZE*2
@@ -423,6 +435,24 @@ struct T_INDEX {
   SCRIPT_TYPE bits;
 };
 
+// variable resolved at script position lp
+struct SCRIPT_VAR_REF {
+  char *lp;
+  uint16_t index;
+};
+
+#ifdef SCRIPT_SECTION_PROFILE
+#define SCRIPT_PROFILE_F 0
+#define SCRIPT_PROFILE_S 1
+#define SCRIPT_PROFILE_T 2
+#define SCRIPT_PROFILE_NUM 3
+#define SCRIPT_PROFILE_START uint32_t profile_start = micros();
+#define SCRIPT_PROFILE_END(SECTION) Script_Profile(SECTION, profile_start);
+#else
+#define SCRIPT_PROFILE_START
+#define SCRIPT_PROFILE_END(SECTION)
+#endif // SCRIPT_SECTION_PROFILE
+
 struct M_FILT {
 #ifdef LARGE_ARRAYS
   uint16_t numvals;
@@ -722,6 +752,20 @@ typedef struct {
 
   uint16_t ufs_script_size;
 
+  struct SCRIPT_VAR_REF var_cache[SCRIPT_VAR_CACHE];
+  // lines of the main script starting with a section or subroutine label
+  char **labels;
+  uint16_t numlabels;
+
+#ifdef SCRIPT_SECTION_PROFILE
+  struct {
+    uint32_t calls[SCRIPT_PROFILE_NUM];
+    uint32_t time[SCRIPT_PROFILE_NUM];
+    uint32_t max[SCRIPT_PROFILE_NUM];
+    uint8_t seconds;
+  } profile;
+#endif // SCRIPT_SECTION_PROFILE
+
 } SCRIPT_MEM;
 
 SCRIPT_MEM glob_script_mem;
@@ -793,6 +837,33 @@ int32_t script_logfile_write(char *path, char *payload, uint32_t size);
 void script_sort_array(TS_FLOAT *array, uint16_t size);
 uint32_t Touch_Status(int32_t sel);
 
+#ifdef SCRIPT_SECTION_PROFILE
+void Script_Profile(uint32_t section, uint32_t start) {
+  uint32_t time = micros() - start;
+  glob_script_mem.profile.calls[section]++;
+  glob_script_mem.profile.time[section] += time;
+  if (time > glob_script_mem.profile.max[section]) {
+    glob_script_mem.profile.max[section] = time;
+  }
+}
+
+void Script_ProfileLog(void) {
+  glob_script_mem.profile.seconds++;
+  if (glob_script_mem.profile.seconds < 60) return;
+  glob_script_mem.profile.seconds = 0;
+  const char sections[] = "FST";
+  for (uint32_t cnt = 0; cnt < SCRIPT_PROFILE_NUM; cnt++) {
+    uint32_t calls = glob_script_mem.profile.calls[cnt];
+    if (calls) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR("SCR: Section >%c %d calls, avg %d us, max %d us"), sections[cnt], calls, glob_script_mem.profile.time[cnt] / calls, glob_script_mem.profile.max[cnt]);
+    }
+    glob_script_mem.profile.calls[cnt] = 0;
+    glob_script_mem.profile.time[cnt] = 0;
+    glob_script_mem.profile.max[cnt] = 0;
+  }
+}
+#endif // SCRIPT_SECTION_PROFILE
+
 void ScriptEverySecond(void) {
 
   if (bitRead(Settings->rule_enabled, 0)) {
@@ -817,7 +888,13 @@ void ScriptEverySecond(void) {
         }
       }
     }
+    SCRIPT_PROFILE_START
     Run_Scripter1(">S", 2, 0);
+    SCRIPT_PROFILE_END(SCRIPT_PROFILE_S)
+
+#ifdef SCRIPT_SECTION_PROFILE
+    Script_ProfileLog();
+#endif // SCRIPT_SECTION_PROFILE
 
 #ifdef USE_HOMEKIT
     if (glob_script_mem.homekit_running == false) {
@@ -882,11 +959,49 @@ uint32_t Script_Find_Vars(char *sp) {
 }
 
 
+void Script_FreeLabels(void) {
+  if (glob_script_mem.labels) {
+    free(glob_script_mem.labels);
+    glob_script_mem.labels = 0;
+  }
+  glob_script_mem.numlabels = 0;
+}
+
+// collect all lines starting with '>' or '#' in script order, Run_script_sub()
+// then finds a label without scanning the lines of the preceding sections
+void Script_IndexLabels(void) {
+  Script_FreeLabels();
+  uint16_t count = 0;
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    char *lp = glob_script_mem.scriptptr;
+    count = 0;
+    while (lp) {
+      while (*lp == '\t' || *lp == ' ' || *lp == SCRIPT_EOL) {
+        lp++;
+      }
+      if (*lp == '>' || *lp == '#') {
+        if (pass) glob_script_mem.labels[count] = lp;
+        count++;
+      }
+      lp = strchr(lp, SCRIPT_EOL);
+    }
+    if (!pass) {
+      if (!count) return;
+      glob_script_mem.labels = (char**)malloc(count * sizeof(char*));
+      // without index labels are searched line by line
+      if (!glob_script_mem.labels) return;
+    }
+  }
+  glob_script_mem.numlabels = count;
+}
+
 // allocates all variables and presets them
 int16_t Init_Scripter(void) {
 char *script;
 
     int16_t err = 0;
+    memset(glob_script_mem.var_cache, 0, sizeof(glob_script_mem.var_cache));
+    Script_FreeLabels();
     script = glob_script_mem.script_ram;
     if (!*script) return -999;
 
@@ -1360,6 +1475,7 @@ char *script;
     // store start of actual program here
     glob_script_mem.scriptptr = lp - 1;
     glob_script_mem.scriptptr_bu = glob_script_mem.scriptptr;
+    Script_IndexLabels();
 
 #ifdef USE_SCRIPT_GLOBVARS
     if (glob_script_mem.udp_flags.udp_used) {
@@ -2796,11 +2912,22 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, TS_FLOAT *fp, char *
 
 
     glob_script_mem.arres = 0;
-    for (count = 0; count < glob_script_mem.numvars; count++) {
+    // start at the variable found last time at this position, all earlier names did not match
+    struct SCRIPT_VAR_REF *vref = &glob_script_mem.var_cache[((uint32_t)lp >> 1) % SCRIPT_VAR_CACHE];
+    count = 0;
+    if (vref->lp == lp && vref->index < glob_script_mem.numvars) {
+      char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[vref->index];
+      if (strlen(cp) == olen && !strncmp(cp, dvnam, olen)) {
+        count = vref->index;
+      }
+    }
+    for (; count < glob_script_mem.numvars; count++) {
         char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
         uint8_t slen = strlen(cp);
         if (slen == olen && *cp == dvnam[0]) {
             if (!strncmp(cp, dvnam, olen)) {
+                vref->lp = lp;
+                vref->index = count;
                 uint16_t index = vtp[count].index;
                 *tind = vtp[count];
                 tind->index = count; // overwrite with global var index
@@ -7494,6 +7621,16 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
       check = 1;
     }
 
+    // labels of the main script are resolved with the index built at load
+    if (tlen > 1 && (*type == '>' || *type == '#') && glob_script_mem.labels && glob_script_mem.scriptptr == glob_script_mem.scriptptr_bu) {
+      uint16_t cnt;
+      for (cnt = 0; cnt < glob_script_mem.numlabels; cnt++) {
+        if (!strncmp(glob_script_mem.labels[cnt], type, tlen)) break;
+      }
+      if (cnt >= glob_script_mem.numlabels) return -1;
+      lp = glob_script_mem.labels[cnt];
+    }
+
 
     while (1) {
         // check line
@@ -8800,7 +8937,11 @@ void ScripterEvery100ms(void) {
     }
   }
   if (bitRead(Settings->rule_enabled, 0)) {
-    if (glob_script_mem.fast_script) Run_Scripter1(glob_script_mem.fast_script, 0, 0);
+    if (glob_script_mem.fast_script) {
+      SCRIPT_PROFILE_START
+      Run_Scripter1(glob_script_mem.fast_script, 0, 0);
+      SCRIPT_PROFILE_END(SCRIPT_PROFILE_F)
+    }
   }
 }
 
@@ -9254,7 +9395,8 @@ void SaveScriptEnd(void) {
 #endif //USE_SCRIPT_GLOBVARS
 
   if (glob_script_mem.script_mem) {
-    // script was restarted
+    // script was restarted, the label index may point into replaced text
+    Script_FreeLabels();
     Run_Scripter1(">R\n", 3, 0);
     Scripter_save_pvars();
     free(glob_script_mem.script_mem);
@@ -12654,11 +12796,11 @@ int32_t http_req(char *host, char *header, char *request) {
 #endif
 
 #ifdef USE_WEBSEND_RESPONSE
-  TasmotaGlobal.mqtt_data = http.getString();
+  Response_P(PSTR("%s"), http.getString().c_str());
 
 //#ifdef HTTP_DEBUG
   if (debug) {
-    AddLog(LOG_LEVEL_INFO, PSTR("SCR: HTTP MQTT BUFFER %s"), TasmotaGlobal.mqtt_data.c_str());
+    AddLog(LOG_LEVEL_INFO, PSTR("SCR: HTTP MQTT BUFFER %s"), ResponseData());
   }
 //#endif
 
@@ -12723,7 +12865,7 @@ int32_t call2pwl(const char *url) {
     AddLog(LOG_LEVEL_INFO, PSTR("PWL: result overflow: %d"), result.length());
   }
 
-  TasmotaGlobal.mqtt_data = result;
+  Response_P(PSTR("%s"), result.c_str());
 
   // meter aggregates has also too many tokens
   char *cp = (char*)result.c_str();
@@ -13580,7 +13722,11 @@ bool Xdrv10(uint32_t function) {
       if (bitRead(Settings->rule_enabled, 0)) {
         if (ResponseLength()) {
           //Run_Scripter(">T", 2, ResponseData());
-          if (glob_script_mem.teleperiod) Run_Scripter(glob_script_mem.teleperiod, 0, ResponseData());
+          if (glob_script_mem.teleperiod) {
+            SCRIPT_PROFILE_START
+            Run_Scripter(glob_script_mem.teleperiod, 0, ResponseData());
+            SCRIPT_PROFILE_END(SCRIPT_PROFILE_T)
+          }
         }
       }
       break;
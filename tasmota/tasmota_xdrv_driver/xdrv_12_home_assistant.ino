@@ -447,12 +447,8 @@ void NewHAssDiscovery(void) {
 void TryResponseAppend_P(const char *format, ...) {
   va_list arg;
   va_start(arg, format);
-  char* mqtt_data = ext_vsnprintf_malloc_P(format, arg);
+  _ResponseAppend(format, arg);
   va_end(arg);
-  if (mqtt_data != nullptr) {
-    TasmotaGlobal.mqtt_data += mqtt_data;
-    free(mqtt_data);
-  }
 }
 
 void HAssAnnounceRelayLight(void)
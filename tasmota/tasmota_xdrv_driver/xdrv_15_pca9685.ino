@@ -215,6 +215,7 @@ bool Xdrv15(uint32_t function)
 
   if (FUNC_INIT == function) {
     PCA9685_Detect();
+    if (pca9685_detected) { XdrvSubscribeAll(); } else { XdrvUnsubscribeAll(); }  // Periodic calls only with detected device
   }
   else if (pca9685_detected) {
     switch (function) {
@@ -1664,6 +1664,8 @@ bool Xnrg32(uint32_t function)
 bool Xdrv16(uint32_t function) {
   bool result = false;
 
+  if ((FUNC_INIT == function) && !Tuya.active) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (FUNC_MODULE_INIT == function) {
     result = TuyaModuleSelected();
     Tuya.active = result;
@@ -2457,6 +2457,8 @@ bool Xnrg32(uint32_t function)
 bool Xdrv16(uint32_t function) {
   bool result = false;
 
+  if ((FUNC_INIT == function) && !(pTuya && pTuya->active)) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (FUNC_MODULE_INIT == function) {
     result = TuyaModuleSelected();
     if (pTuya) pTuya->active = result;
@@ -232,6 +232,8 @@ bool Xdrv17(uint32_t function)
 {
   bool result = false;
 
+  if ((FUNC_INIT == function) && (!PinUsed(GPIO_RFSEND) && !PinUsed(GPIO_RFRECV))) { XdrvUnsubscribeAll(); }  // Periodic calls only with configured device
+
   if (PinUsed(GPIO_RFSEND) || PinUsed(GPIO_RFRECV)) {
     switch (function) {
       case FUNC_EVERY_50_MSECOND:
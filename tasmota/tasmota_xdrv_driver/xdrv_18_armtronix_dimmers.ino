@@ -171,6 +171,8 @@ bool Xdrv18(uint32_t function)
 {
   bool result = false;
 
+  if ((FUNC_INIT == function) && (ARMTRONIX_DIMMERS != TasmotaGlobal.module_type)) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (ARMTRONIX_DIMMERS == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_LOOP:
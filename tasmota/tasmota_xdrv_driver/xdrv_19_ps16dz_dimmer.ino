@@ -213,6 +213,8 @@ bool Xdrv19(uint32_t function)
 {
   bool result = false;
 
+  if ((FUNC_INIT == function) && (PS_16_DZ != TasmotaGlobal.module_type)) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (PS_16_DZ == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_LOOP:
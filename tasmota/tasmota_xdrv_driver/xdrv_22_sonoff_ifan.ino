@@ -247,6 +247,8 @@ void SonoffIfanUpdate(void)
 bool Xdrv22(uint32_t function) {
   bool result = false;
 
+  if ((FUNC_INIT == function) && !IsModuleIfan()) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (IsModuleIfan()) {
     switch (function) {
       case FUNC_EVERY_250_MSECOND:
@@ -1280,6 +1280,15 @@ private:
   LList<Z_Deferred>         _deferred;    // list of deferred calls
   uint32_t                  _saveTimer = 0;
   uint8_t                   _seqnumber = 0;     // global seqNumber if device is unknown
+  // open addressing index of _devices by shortaddr and longaddr, first device in list wins
+  // added devices are inserted, removed or readdressed devices trigger a rebuild
+  Z_Device **               _short_index = nullptr;
+  Z_Device **               _long_index = nullptr;
+  uint32_t                  _index_size = 0;    // power of 2, 0 if not allocated (fall back to scan)
+  uint32_t                  _index_count = 0;
+
+  void indexAdd(Z_Device *device);
+  void indexRebuild(void);
 
   //int32_t findShortAddrIdx(uint16_t shortaddr) const;
   // Create a new entry in the devices list - must be called if it is sure it does not already exist
@@ -41,11 +41,79 @@ Z_Device & Z_Devices::createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
   Z_Device & device = _devices.addToLast();
   device.shortaddr = shortaddr;
   device.longaddr = longaddr;
+  indexAdd(&device);
 
   dirty();
   return device;
 }
 
+static inline uint32_t Z_IndexHashShort(uint16_t shortaddr) {
+  uint32_t h = shortaddr * 0x9E3779B1;
+  return h ^ (h >> 16);
+}
+
+static inline uint32_t Z_IndexHashLong(uint64_t longaddr) {
+  uint32_t h = ((uint32_t)longaddr ^ (uint32_t)(longaddr >> 32)) * 0x9E3779B1;
+  return h ^ (h >> 16);
+}
+
+//
+// Insert device in the shortaddr and longaddr index, keep the first device if the key is already present
+// The index is kept at most half full
+//
+void Z_Devices::indexAdd(Z_Device *device) {
+  if ((_index_count + 1) * 2 > _index_size) {
+    indexRebuild();     // grows the index and inserts all devices including this one
+    return;
+  }
+  uint32_t mask = _index_size - 1;
+  uint32_t i = Z_IndexHashShort(device->shortaddr) & mask;
+  while (_short_index[i]) {
+    if (_short_index[i]->shortaddr == device->shortaddr) { break; }
+    i = (i + 1) & mask;
+  }
+  if (!_short_index[i]) { _short_index[i] = device; }
+  if (device->longaddr) {
+    i = Z_IndexHashLong(device->longaddr) & mask;
+    while (_long_index[i]) {
+      if (_long_index[i]->longaddr == device->longaddr) { break; }
+      i = (i + 1) & mask;
+    }
+    if (!_long_index[i]) { _long_index[i] = device; }
+  }
+  _index_count++;
+}
+
+//
+// Rebuild the index from scratch, in list order
+//
+void Z_Devices::indexRebuild(void) {
+  uint32_t size = 16;
+  while (size < (_devices.length() + 1) * 2) { size *= 2; }
+  if (size != _index_size) {
+    free(_short_index);
+    free(_long_index);
+    _short_index = (Z_Device**) malloc(size * sizeof(Z_Device*));
+    _long_index = (Z_Device**) malloc(size * sizeof(Z_Device*));
+    _index_size = size;
+    if (!_short_index || !_long_index) {
+      free(_short_index);
+      free(_long_index);
+      _short_index = nullptr;
+      _long_index = nullptr;
+      _index_size = 0;
+      _index_count = 0;
+      return;       // no memory, lookups scan the list
+    }
+  }
+  memset(_short_index, 0, size * sizeof(Z_Device*));
+  memset(_long_index, 0, size * sizeof(Z_Device*));
+  _index_count = 0;
+  for (auto & elem : _devices) {
+    indexAdd(&elem);
+  }
+}
+
 void Z_Devices::freeDeviceEntry(Z_Device *device) {
   if (device->manufacturerId) { free(device->manufacturerId); }
   if (device->modelId) { free(device->modelId); }
@@ -62,12 +130,16 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
 //    reference to device, or to device_unk if not found
 //    (use foundDevice() to check if found)
 Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
-  for (auto & elem : _devices) {
-    if (elem.shortaddr == shortaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findShortAddr(shortaddr);
 }
 const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
+  if (_index_size) {
+    uint32_t mask = _index_size - 1;
+    for (uint32_t i = Z_IndexHashShort(shortaddr) & mask; _short_index[i]; i = (i + 1) & mask) {
+      if (_short_index[i]->shortaddr == shortaddr) { return *_short_index[i]; }
+    }
+    return device_unk;
+  }
   for (const auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
@@ -82,14 +154,17 @@ const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
 //    index in _devices of entry, -1 if not found
 //
 Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
-  if (!longaddr) { return device_unk; }
-  for (auto &elem : _devices) {
-    if (elem.longaddr == longaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findLongAddr(longaddr);
 }
 const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
   if (!longaddr) { return device_unk; }
+  if (_index_size) {
+    uint32_t mask = _index_size - 1;
+    for (uint32_t i = Z_IndexHashLong(longaddr) & mask; _long_index[i]; i = (i + 1) & mask) {
+      if (_long_index[i]->longaddr == longaddr) { return *_long_index[i]; }
+    }
+    return device_unk;
+  }
   for (const auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
@@ -204,6 +279,7 @@ bool Z_Devices::removeDevice(uint16_t shortaddr) {
   Z_Device & device = findShortAddr(shortaddr);
   if (foundDevice(device)) {
     _devices.remove(&device);
+    indexRebuild();
     dirty();
     return true;
   }
@@ -227,6 +303,7 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
       // erase the previous shortaddr
       freeDeviceEntry(s_found);
       _devices.remove(s_found);
+      indexRebuild();
       dirty();
       return *l_found;
     }
@@ -234,11 +311,13 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
     // shortaddr already exists but longaddr not
     // add the longaddr to the entry
     s_found->longaddr = longaddr;
+    indexRebuild();
     dirty();
     return *s_found;
   } else if (foundDevice(*l_found)) {
     // longaddr entry exists, update shortaddr
     l_found->shortaddr = shortaddr;
+    indexRebuild();
     dirty();
     return *l_found;
   } else {
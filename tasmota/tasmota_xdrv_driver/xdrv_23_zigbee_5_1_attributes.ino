@@ -211,11 +211,15 @@ uint16_t CxToCluster(uint8_t cx) {
   return 0xFFFF;
 }
 
+// Cx_cluster[] is sorted by cluster number, keep it this way
 uint8_t ClusterToCx(uint16_t cluster) {
-  for (uint32_t i=0; i<nitems(Cx_cluster); i++) {
-    if (pgm_read_word(&Cx_cluster[i]) == cluster) {
-      return i;
-    }
+  uint32_t lo = 0;
+  uint32_t hi = nitems(Cx_cluster);
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    uint16_t mid_cluster = pgm_read_word(&Cx_cluster[mid]);
+    if (mid_cluster == cluster) { return mid; }
+    if (mid_cluster < cluster) { lo = mid + 1; } else { hi = mid; }
   }
   return 0xFF;
 }
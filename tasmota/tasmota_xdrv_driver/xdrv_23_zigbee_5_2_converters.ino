@@ -30,6 +30,97 @@ typedef union ZCLHeaderFrameControl_t {
   uint32_t d8;                         // raw 8 bits field
 } ZCLHeaderFrameControl_t;
 
+//
+// Lookup indexes over Z_PostProcess
+//
+// Z_PostProcess is grouped by cluster, so for each Cx we keep the range [start, end[
+// of entries for this cluster. Names are indexed in a sorted array of entry numbers,
+// ordered case-insensitively and then by position, so a binary search returns
+// the same entry as a linear scan would.
+// Both are built once on first use. If the name index can't be allocated,
+// name lookup falls back to the linear scan.
+//
+struct Z_AttrIndex {
+  uint16_t cx_start[nitems(Cx_cluster)];
+  uint16_t cx_end[nitems(Cx_cluster)];
+  uint16_t *names = nullptr;        // sorted indexes into Z_PostProcess
+  uint16_t names_count = 0;
+  bool init = false;
+} Z_attr_index;
+
+// case-insensitive compare of two strings in Z_strings, consistent with strcasecmp_P()
+int Z_AttrNameCmp(const void *a, const void *b) {
+  uint16_t ia = *(const uint16_t*)a;
+  uint16_t ib = *(const uint16_t*)b;
+  const char * sa = Z_strings + pgm_read_word(&Z_PostProcess[ia].name_offset);
+  const char * sb = Z_strings + pgm_read_word(&Z_PostProcess[ib].name_offset);
+  while (1) {
+    int ca = tolower((uint8_t)pgm_read_byte(sa++));
+    int cb = tolower((uint8_t)pgm_read_byte(sb++));
+    if (ca != cb) { return ca - cb; }
+    if (ca == 0) { break; }
+  }
+  return (int)ia - (int)ib;       // keep table order for duplicate names
+}
+
+void Z_AttrIndexInit(void) {
+  if (Z_attr_index.init) { return; }
+  Z_attr_index.init = true;
+
+  for (uint32_t cx = 0; cx < nitems(Cx_cluster); cx++) {
+    Z_attr_index.cx_start[cx] = 0;
+    Z_attr_index.cx_end[cx] = 0;
+  }
+  uint32_t names_count = 0;
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    uint8_t cx = pgm_read_byte(&Z_PostProcess[i].cluster_short);
+    if (cx < nitems(Cx_cluster)) {
+      if (Z_attr_index.cx_end[cx] == 0) { Z_attr_index.cx_start[cx] = i; }
+      Z_attr_index.cx_end[cx] = i + 1;
+    }
+    if (pgm_read_word(&Z_PostProcess[i].name_offset)) { names_count++; }
+  }
+
+  Z_attr_index.names = (uint16_t*) malloc(names_count * sizeof(uint16_t));
+  if (Z_attr_index.names == nullptr) { return; }
+  names_count = 0;
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    if (pgm_read_word(&Z_PostProcess[i].name_offset)) { Z_attr_index.names[names_count++] = i; }
+  }
+  qsort(Z_attr_index.names, names_count, sizeof(uint16_t), Z_AttrNameCmp);
+  Z_attr_index.names_count = names_count;
+}
+
+// Returns the index in Z_PostProcess of the first entry with this name, or -1
+int32_t Z_AttrIndexFindName(const char *name) {
+  Z_AttrIndexInit();
+  if (Z_attr_index.names == nullptr) {
+    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+      uint16_t name_offset = pgm_read_word(&Z_PostProcess[i].name_offset);
+      if (0 == name_offset) { continue; }         // avoid strcasecmp_P() from crashing
+      if (0 == strcasecmp_P(name, Z_strings + name_offset)) { return i; }
+    }
+    return -1;
+  }
+  // lower bound, so that the first entry in table order is returned
+  uint32_t lo = 0;
+  uint32_t hi = Z_attr_index.names_count;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    uint16_t i = Z_attr_index.names[mid];
+    if (strcasecmp_P(name, Z_strings + pgm_read_word(&Z_PostProcess[i].name_offset)) > 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < Z_attr_index.names_count) {
+    uint16_t i = Z_attr_index.names[lo];
+    if (0 == strcasecmp_P(name, Z_strings + pgm_read_word(&Z_PostProcess[i].name_offset))) { return i; }
+  }
+  return -1;
+}
+
 //
 // Find attribute matcher by name
 //
@@ -39,22 +130,19 @@ class Z_attribute_match Z_findAttributeMatcherByName(uint16_t shortaddr, const c
 
   Z_attribute_match matched_attr = Z_plugin_matchAttributeByName(device.modelId, device.manufacturerId, name);
   if (!matched_attr.found()) {
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    int32_t i = Z_AttrIndexFindName(name);
+    if (i >= 0) {
       const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      if (0 == pgm_read_word(&converter->name_offset)) { continue; }         // avoid strcasecmp_P() from crashing
-      if (0 == strcasecmp_P(name, Z_strings + pgm_read_word(&converter->name_offset))) {
-        matched_attr.cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-        matched_attr.attribute = pgm_read_word(&converter->attribute);
-        matched_attr.name = (Z_strings + pgm_read_word(&converter->name_offset));
-        int8_t multiplier8 = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-        if (multiplier8 > 1) { matched_attr.multiplier = multiplier8; }
-        if (multiplier8 < 0) { matched_attr.divider = -multiplier8; }
-        matched_attr.zigbee_type = pgm_read_byte(&converter->type);
-        uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
-        matched_attr.map_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4);
-        matched_attr.map_offset = (conv_mapping & 0x0F);
-        break;
-      }
+      matched_attr.cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
+      matched_attr.attribute = pgm_read_word(&converter->attribute);
+      matched_attr.name = (Z_strings + pgm_read_word(&converter->name_offset));
+      int8_t multiplier8 = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
+      if (multiplier8 > 1) { matched_attr.multiplier = multiplier8; }
+      if (multiplier8 < 0) { matched_attr.divider = -multiplier8; }
+      matched_attr.zigbee_type = pgm_read_byte(&converter->type);
+      uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
+      matched_attr.map_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4);
+      matched_attr.map_offset = (conv_mapping & 0x0F);
     }
   }
   return matched_attr;
@@ -69,13 +157,15 @@ class Z_attribute_match Z_findAttributeMatcherById(uint16_t shortaddr, uint16_t
   // works even if the device is unknown
 
   Z_attribute_match matched_attr = Z_plugin_matchAttributeById(device.modelId, device.manufacturerId, cluster, attr_id);
-  if (!matched_attr.found()) {
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+  uint8_t cx = ClusterToCx(cluster);
+  if (!matched_attr.found() && (cx != 0xFF)) {
+    Z_AttrIndexInit();
+    for (uint32_t i = Z_attr_index.cx_start[cx]; i < Z_attr_index.cx_end[cx]; i++) {
       const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
+      if (pgm_read_byte(&converter->cluster_short) != cx) { continue; }
       uint16_t conv_attr_id = pgm_read_word(&converter->attribute);
 
-      if ((conv_cluster == cluster) && (conv_attr_id == attr_id || (attr_glob && conv_attr_id == 0xFFFF))) {
+      if (conv_attr_id == attr_id || (attr_glob && conv_attr_id == 0xFFFF)) {
         matched_attr.cluster = cluster;
         matched_attr.attribute = attr_id;
         matched_attr.name = (Z_strings + pgm_read_word(&converter->name_offset));
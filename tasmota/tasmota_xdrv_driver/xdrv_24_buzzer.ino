@@ -239,6 +239,8 @@ void CmndBuzzer(void) {
 bool Xdrv24(uint32_t function) {
   bool result = false;
 
+  if ((FUNC_INIT == function) && !Buzzer.active) { XdrvUnsubscribeAll(); }  // Periodic calls only with configured device
+
   if (Buzzer.active) {
     switch (function) {
       case FUNC_EVERY_100_MSECOND:
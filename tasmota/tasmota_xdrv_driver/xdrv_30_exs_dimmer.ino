@@ -589,6 +589,8 @@ bool Xdrv30(uint32_t function)
 {
   bool result = false;
 
+  if ((FUNC_INIT == function) && (EXS_DIMMER != TasmotaGlobal.module_type)) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (EXS_DIMMER == TasmotaGlobal.module_type)
   {
     switch (function)
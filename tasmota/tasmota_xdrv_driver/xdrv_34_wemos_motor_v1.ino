@@ -276,6 +276,7 @@ bool Xdrv34(uint32_t function)
 
   if (FUNC_INIT == function) {
     WMotorV1Detect();
+    if (WMotorV1.detected) { XdrvSubscribeAll(); } else { XdrvUnsubscribeAll(); }  // Periodic calls only with detected device
   }
   else if (WMotorV1.detected) {
     switch (function) {
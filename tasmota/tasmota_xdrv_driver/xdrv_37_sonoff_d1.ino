@@ -177,6 +177,8 @@ bool Xdrv37(uint32_t function)
 {
   bool result = false;
 
+  if ((FUNC_INIT == function) && (SONOFF_D1 != TasmotaGlobal.module_type)) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (SONOFF_D1 == TasmotaGlobal.module_type) {
     switch (function) {
       case FUNC_SERIAL:
@@ -855,6 +855,8 @@ bool Xnrg31(uint32_t function) {
 bool Xdrv45(uint32_t function) {
   bool result = false;
 
+  if ((FUNC_INIT == function) && !Shd.present) { XdrvUnsubscribeAll(); }  // Periodic calls only with selected module
+
   if (FUNC_MODULE_INIT == function) {
     result = ShdModuleSelected();
   } else if (Shd.present) {
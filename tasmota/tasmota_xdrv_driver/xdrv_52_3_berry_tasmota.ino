@@ -626,6 +626,112 @@ extern "C" {
     be_return(vm);
   }
 
+  // Min-heap of triggers ordered by `trig`, used for timers and crons
+  // `list` is the stack index of the internal list, values are compared by difference since `millis()` wraps around
+  // Triggers with the same `trig` are returned in no particular order
+  static int32_t heap_diff(int32_t a, int32_t b) {
+    return (int32_t)((uint32_t)a - (uint32_t)b);
+  }
+
+  static int32_t heap_trig(bvm *vm, int32_t list, int32_t i) {
+    be_pushint(vm, i);
+    be_getindex(vm, list);            // push `l[i]`
+    be_getmember(vm, -1, "trig");
+    int32_t trig = be_toint(vm, -1);
+    be_pop(vm, 3);
+    return trig;
+  }
+
+  // l[to] = l[from]
+  static void heap_move(bvm *vm, int32_t list, int32_t from, int32_t to) {
+    be_pushint(vm, from);
+    be_getindex(vm, list);
+    be_pushint(vm, to);
+    be_pushvalue(vm, -2);
+    be_setindex(vm, list);
+    be_pop(vm, 4);
+  }
+
+  // l[to] = value at stack index `idx`
+  static void heap_set(bvm *vm, int32_t list, int32_t to, int32_t idx) {
+    be_pushint(vm, to);
+    be_pushvalue(vm, idx);
+    be_setindex(vm, list);
+    be_pop(vm, 2);
+  }
+
+  // tasmota._heap_push(l:list, trigger:instance) -> nil
+  int32_t tasm_heap_push(bvm *vm);
+  int32_t tasm_heap_push(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top >= 2 && be_islistinstance(vm, 1) && be_isinstance(vm, 2)) {
+      be_getmember(vm, 2, "trig");
+      int32_t trig = be_toint(vm, -1);
+      be_pop(vm, 1);
+      be_getmember(vm, 1, ".p");
+      int32_t list = be_top(vm);
+      int32_t i = be_data_size(vm, list);
+      be_pushnil(vm);
+      be_data_push(vm, list);         // grow the list by one slot
+      be_pop(vm, 1);
+      while (i > 0) {                 // move down parents that trigger later
+        int32_t parent = (i - 1) / 2;
+        if (heap_diff(heap_trig(vm, list, parent), trig) <= 0) { break; }
+        heap_move(vm, list, parent, i);
+        i = parent;
+      }
+      heap_set(vm, list, i, 2);
+      be_return_nil(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
+  // tasmota._heap_pop(l:list) -> instance or nil, removes and returns the first trigger
+  int32_t tasm_heap_pop(bvm *vm);
+  int32_t tasm_heap_pop(bvm *vm) {
+    int32_t top = be_top(vm); // Get the number of arguments
+    if (top >= 1 && be_islistinstance(vm, 1)) {
+      be_getmember(vm, 1, ".p");
+      int32_t list = be_top(vm);
+      int32_t n = be_data_size(vm, list);
+      if (n <= 0) { be_return_nil(vm); }
+      be_pushint(vm, 0);
+      be_getindex(vm, list);
+      int32_t first = be_top(vm);     // returned trigger
+      be_pushint(vm, n - 1);
+      be_getindex(vm, list);
+      int32_t last = be_top(vm);      // last trigger, moved down from the root
+      be_getmember(vm, last, "trig");
+      int32_t trig = be_toint(vm, -1);
+      be_pop(vm, 1);
+      n--;
+      be_pushint(vm, n);
+      be_data_resize(vm, list);
+      be_pop(vm, 1);
+      if (n > 0) {
+        int32_t i = 0;
+        while (2 * i + 1 < n) {       // move up children that trigger earlier
+          int32_t child = 2 * i + 1;
+          int32_t child_trig = heap_trig(vm, list, child);
+          if (child + 1 < n) {
+            int32_t right_trig = heap_trig(vm, list, child + 1);
+            if (heap_diff(right_trig, child_trig) < 0) {
+              child++;
+              child_trig = right_trig;
+            }
+          }
+          if (heap_diff(child_trig, trig) >= 0) { break; }
+          heap_move(vm, list, child, i);
+          i = child;
+        }
+        heap_set(vm, list, i, last);
+      }
+      be_pushvalue(vm, first);
+      be_return(vm);
+    }
+    be_raise(vm, kTypeError, nullptr);
+  }
+
   int32_t be_Tasmota_version(void) {
     return Settings->version;
   }
@@ -26,6 +26,7 @@
 extern "C" {
   #include "be_bytecode.h"
   #include "be_var.h"
+  #include "be_profiler.h"
 }
 #include "berry_tasmota.h"
 #ifdef USE_MATTER_DEVICE
@@ -41,14 +42,15 @@ extern "C" {
 extern "C" {
   extern void be_load_custom_libs(bvm *vm);
   extern void be_tracestack(bvm *vm);
+  extern const char* be_str2cstr(const bstring *s);
 }
 
 const char kBrCommands[] PROGMEM = D_PRFX_BR "|"    // prefix
-  D_CMND_BR_RUN "|" D_CMND_BR_RESTART
+  D_CMND_BR_RUN "|" D_CMND_BR_RESTART "|" D_CMND_BR_PROFILE
   ;
 
 void (* const BerryCommand[])(void) PROGMEM = {
-  CmndBrRun, CmndBrRestart
+  CmndBrRun, CmndBrRestart, CmndBrProfile
   };
 
 int32_t callBerryEventDispatcher(const char *type, const char *cmd, int32_t idx, const char *payload, uint32_t data_len = 0);
@@ -412,6 +414,56 @@ void CmndBrRestart(void) {
   ResponseCmndChar_P("Berry VM restarted");
 }
 
+/*********************************************************************************************\
+ * BrProfile - sampling profiler of Berry functions
+ *
+ *   BrProfile start    clear previous results and start sampling
+ *   BrProfile stop     stop sampling, results are kept
+ *   BrProfile [<n>]    show the <n> functions (default 5) with most samples and most bytes allocated
+\*********************************************************************************************/
+void CmndBrProfile(void) {
+  if (berry.vm == nullptr) { ResponseCmndChar_P(PSTR(D_BR_NOT_STARTED)); return; }
+#if BE_USE_PROFILER
+  if (!strcasecmp_P(XdrvMailbox.data, PSTR("start"))) {
+    if (be_profiler_start(berry.vm)) {
+      ResponseCmndDone();
+    } else {
+      ResponseCmndChar_P(PSTR("Not enough memory"));
+    }
+    return;
+  }
+  if (!strcasecmp_P(XdrvMailbox.data, PSTR("stop"))) {
+    be_profiler_stop(berry.vm);
+    ResponseCmndDone();
+    return;
+  }
+  if (berry.vm->profiler == nullptr) { ResponseCmndChar_P(PSTR("Not started")); return; }
+
+  bprofentry * entries = (bprofentry *) malloc(sizeof(bprofentry) * BE_PROFILER_SIZE);
+  if (entries == nullptr) { ResponseCmndChar_P(PSTR("Not enough memory")); return; }
+  uint32_t top = (XdrvMailbox.payload > 0) ? XdrvMailbox.payload : 5;
+  uint32_t total = berry.vm->profiler->other_samples;
+  for (uint32_t i = 0; i < BE_PROFILER_SIZE; i++) {
+    total += berry.vm->profiler->entries[i].samples;
+  }
+  Response_P(PSTR("{\"" D_PRFX_BR D_CMND_BR_PROFILE "\":{\"Running\":%d,\"Samples\":%u"), be_profiler_running(berry.vm), total);
+  for (uint32_t by_alloc = 0; by_alloc <= 1; by_alloc++) {
+    // each function is reported as [name, samples, bytes allocated]
+    uint32_t count = be_profiler_sort(berry.vm, entries, btrue, by_alloc);
+    ResponseAppend_P(by_alloc ? PSTR(",\"Alloc\":[") : PSTR(",\"Cpu\":["));
+    for (uint32_t i = 0; i < count && i < top; i++) {
+      ResponseAppend_P(PSTR("%s[\"%s\",%u,%u]"), i ? "," : "", EscapeJSONString(be_str2cstr(entries[i].proto->name)).c_str(),
+                       entries[i].samples, entries[i].alloc);
+    }
+    ResponseAppend_P(PSTR("]"));
+  }
+  ResponseJsonEndEnd();
+  free(entries);
+#else
+  ResponseCmndChar_P(PSTR("Profiler not enabled"));
+#endif
+}
+
 /*********************************************************************************************\
  * Execute a script in Flash file-system
  *
@@ -859,21 +911,64 @@ extern "C" bbool BerryBECLoader(const char * url) {
   size_t loaded_sz = 0;
   const void * loaded_buf = be_tobytes(vm, -1, &loaded_sz);
 
-  FlashFileImplPtr fp = FlashFileImplPtr(new FlashFileImpl(loaded_buf, loaded_sz));
-  File * f_ptr = new File(fp);   // we need to allocate dynamically because be_close calls `delete` on it
-  bclosure* loaded_bec = be_bytecode_load_from_fs(vm, f_ptr);
-  be_pop(vm, 1);
-  if (loaded_bec != NULL) {
-    be_pushclosure(vm, loaded_bec);
-    be_call(vm, 0);
-    be_pop(vm, 1);
+  // instructions are copied since the buffer is freed right after
+  if (be_loadbytecode(vm, loaded_buf, loaded_sz, bfalse) != 0) {
+    AddLog(LOG_LEVEL_INFO, "BRY: invalid bytecode from URL '%s'", url);
+    be_error_pop_all(vm);             // clear Berry stack
+    return false;
   }
-   be_gc_collect(vm);   // force a GC to free the buffer now
+  be_call(vm, 0);
+  be_pop(vm, 2);      // pop closure and buffer
+  be_gc_collect(vm);   // force a GC to free the buffer now
   return true;
 }
 
 #endif // USE_WEBSERVER
 
+#ifdef USE_BERRY_BEC_PARTITION
+/*********************************************************************************************\
+ * Run precompiled bytecode stored in a data partition
+ *
+ * The partition is memory-mapped and never unmapped, so that instructions are
+ * used in place from flash instead of being copied to heap.
+ * The partition contains a single `.bec` file as generated by `berry -g -c`,
+ * named globals avoid any relocation of instructions at load time.
+\*********************************************************************************************/
+#include "esp_partition.h"
+
+void BrLoadPartition(const char * label) {
+  if (berry.vm == nullptr || TasmotaGlobal.no_autoexec) { return; }
+
+  const esp_partition_t * part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  if (part == nullptr) { return; }
+
+  const void * data;
+  esp_partition_mmap_handle_t handle;
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &data, &handle) != ESP_OK) {
+    AddLog(LOG_LEVEL_INFO, D_LOG_BERRY "unable to map partition '%s'", label);
+    return;
+  }
+
+  uint32_t start = millis();
+  if (be_loadbytecode(berry.vm, data, part->size, btrue) != 0) {
+    be_error_pop_all(berry.vm);             // clear Berry stack
+    esp_partition_munmap(handle);
+    AddLog(LOG_LEVEL_INFO, D_LOG_BERRY "invalid bytecode in partition '%s'", label);
+    return;
+  }
+  AddLog(LOG_LEVEL_DEBUG, D_LOG_BERRY "Loaded partition '%s' in %i ms", label, millis() - start);
+
+  BrTimeoutStart();
+  if (be_pcall(berry.vm, 0) != 0) {
+    be_error_pop_all(berry.vm);             // clear Berry stack
+    return;
+  }
+  BrTimeoutReset();
+  be_pop(berry.vm, 1);
+  AddLog(LOG_LEVEL_INFO, D_LOG_BERRY "Successfully loaded partition '%s'", label);
+}
+#endif // USE_BERRY_BEC_PARTITION
+
 /*********************************************************************************************\
  * Interface
 \*********************************************************************************************/
@@ -892,6 +987,9 @@ bool Xdrv52(uint32_t function)
         // we generate a synthetic event `autoexec`
         callBerryEventDispatcher(PSTR("autoexec"), nullptr, 0, nullptr);
 
+#ifdef USE_BERRY_BEC_PARTITION
+        BrLoadPartition(USE_BERRY_BEC_PARTITION);   // run precompiled bytecode from flash before autoexec.be
+#endif // USE_BERRY_BEC_PARTITION
         BrLoad("autoexec.be");   // run autoexec.be at first tick, so we know all modules are initialized
         berry.autoexec_done = true;
 
@@ -931,6 +1029,9 @@ bool Xdrv52(uint32_t function)
 
     // Module specific events
     case FUNC_EVERY_50_MSECOND:
+#if BE_USE_INCREMENTAL_GC
+      if (berry.vm) { be_gc_step(berry.vm); }     // advance the pending GC cycle between events
+#endif
       callBerryEventDispatcher(PSTR("every_50ms"), nullptr, 0, nullptr);
       break;
     case FUNC_EVERY_100_MSECOND:
@@ -80,6 +80,7 @@ bool Xdrv61(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Ds3502Detect();
+    if (Ds3502.max_devices) { XdrvSubscribeAll(); } else { XdrvUnsubscribeAll(); }  // Periodic calls only with detected device
   }
   else if (Ds3502.max_devices) {
     switch (function) {
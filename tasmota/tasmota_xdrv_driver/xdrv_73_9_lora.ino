@@ -454,6 +454,7 @@ bool Xdrv73(uint32_t function) {
 
   if (FUNC_INIT == function) {
     LoraInit();
+    if (Lora) { XdrvSubscribeAll(); } else { XdrvUnsubscribeAll(); }  // Periodic calls only with detected device
   }
   else if (Lora) {
     switch (function) {
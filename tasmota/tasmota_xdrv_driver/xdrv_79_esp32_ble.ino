@@ -335,6 +335,99 @@ struct BLE_simple_device_t {
   uint16_t maxAge;    // maximum observed age of this device
 };
 
+////////////////////////////////////////////////////////////////
+// hashed index from a MAC to a value, for lists searched on every advert.
+// open addressing with linear probing, grows to stay under 3/4 full.
+// not thread safe, protect it like the list it indexes.
+template <typename V> class MacIndex {
+  struct entry_t {
+    uint8_t mac[6];
+    uint8_t used;
+    V value;
+  };
+  entry_t *table = nullptr;
+  uint32_t size = 0;    // power of 2
+  uint32_t count = 0;
+
+  uint32_t home(const uint8_t *mac) const {
+    uint32_t h = 2166136261;            // FNV-1a
+    for (int i = 0; i < 6; i++){
+      h = (h ^ mac[i]) * 16777619;
+    }
+    return h & (size - 1);
+  }
+
+  entry_t *lookup(const uint8_t *mac) const {
+    if (!count) return nullptr;
+    for (uint32_t i = home(mac); table[i].used; i = (i + 1) & (size - 1)){
+      if (!memcmp(table[i].mac, mac, 6)) return &table[i];
+    }
+    return nullptr;
+  }
+
+  bool grow(){
+    uint32_t newsize = size ? size * 2 : 16;
+    entry_t *newtable = (entry_t *)calloc(newsize, sizeof(entry_t));
+    if (!newtable) return false;
+    entry_t *oldtable = table;
+    uint32_t oldsize = size;
+    table = newtable;
+    size = newsize;
+    count = 0;
+    for (uint32_t i = 0; i < oldsize; i++){
+      if (oldtable[i].used) set(oldtable[i].mac, oldtable[i].value);
+    }
+    free(oldtable);
+    return true;
+  }
+
+public:
+  ~MacIndex(){ free(table); }
+
+  void clear(){
+    if (table) memset(table, 0, size * sizeof(entry_t));
+    count = 0;
+  }
+
+  // returns nullptr if the MAC is not indexed
+  V *find(const uint8_t *mac){
+    entry_t *e = lookup(mac);
+    return e ? &e->value : nullptr;
+  }
+
+  // add or replace, returns false if out of memory
+  bool set(const uint8_t *mac, V value){
+    if (((count + 1) * 4 > size * 3) && !grow()) return false;
+    uint32_t i = home(mac);
+    while (table[i].used && memcmp(table[i].mac, mac, 6)){
+      i = (i + 1) & (size - 1);
+    }
+    if (!table[i].used){
+      memcpy(table[i].mac, mac, 6);
+      table[i].used = 1;
+      count++;
+    }
+    table[i].value = value;
+    return true;
+  }
+
+  void remove(const uint8_t *mac){
+    entry_t *e = lookup(mac);
+    if (!e) return;
+    // shift back the following entries of the probe sequence, no tombstones needed
+    uint32_t i = e - table;
+    for (uint32_t j = (i + 1) & (size - 1); table[j].used; j = (j + 1) & (size - 1)){
+      uint32_t k = home(table[j].mac);
+      // entry j stays if its home is cyclically in (i, j]
+      if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) continue;
+      table[i] = table[j];
+      i = j;
+    }
+    table[i].used = 0;
+    count--;
+  }
+};
+
 
 
 // this protects our queues, which can be accessed by multiple tasks
@@ -452,6 +545,8 @@ std::deque<BLE_ESP32::generic_sensor_t*> mqttOperations;
 #define MAX_BLE_DEVICES_LOGGED 80
 std::deque<BLE_ESP32::BLE_simple_device_t*> seenDevices;
 std::deque<BLE_ESP32::BLE_simple_device_t*> freeDevices;
+// seenDevices by MAC
+MacIndex<BLE_ESP32::BLE_simple_device_t*> seenDevicesIndex;
 
 
 
@@ -624,18 +719,17 @@ int addSeenDevice(const uint8_t *mac, uint8_t addrtype, const char *name, int8_t
 
   int devicefound = 0;
   // do we already know this device?
-  for (int i = 0; i < seenDevices.size(); i++){
-    if (!memcmp(seenDevices[i]->mac, mac, 6)){
-      seenDevices[i]->lastseen = now;
-      seenDevices[i]->addrtype = addrtype;
-      seenDevices[i]->RSSI = RSSI;
-      if ((!seenDevices[i]->name[0]) && name[0]){
-        strncpy(seenDevices[i]->name, name, sizeof(seenDevices[i]->name));
-        seenDevices[i]->name[sizeof(seenDevices[i]->name)-1] = 0;
-      }
-      devicefound = 1;
-      break;
+  BLE_ESP32::BLE_simple_device_t** known = seenDevicesIndex.find(mac);
+  if (known){
+    BLE_ESP32::BLE_simple_device_t* dev = *known;
+    dev->lastseen = now;
+    dev->addrtype = addrtype;
+    dev->RSSI = RSSI;
+    if ((!dev->name[0]) && name[0]){
+      strncpy(dev->name, name, sizeof(dev->name));
+      dev->name[sizeof(dev->name)-1] = 0;
     }
+    devicefound = 1;
   }
   if (!devicefound){
     // if no free slots, add one if we have not reached our limit
@@ -657,7 +751,7 @@ int addSeenDevice(const uint8_t *mac, uint8_t addrtype, const char *name, int8_t
     }
 
     // get a new device from the free list
-    if (freeDevices.size()){
+    if (freeDevices.size() && seenDevicesIndex.set(mac, freeDevices[0])){
       BLE_ESP32::BLE_simple_device_t* dev = freeDevices[0];
       freeDevices.erase(freeDevices.begin());
       memcpy(dev->mac, mac, 6);
@@ -718,6 +812,7 @@ int deleteSeenDevices(int ageS = 0){
               addr, alias, dev->addrtype, BLEAddressFilter);
           }
 #endif
+          seenDevicesIndex.remove(dev->mac);
           seenDevices.erase(seenDevices.begin()+i);
           freeDevices.push_back(dev);
           res++;
@@ -735,9 +830,12 @@ int deleteSeenDevices(int ageS = 0){
 int deleteSeenDevice(uint8_t *mac){
   int res = 0;
   TasAutoMutex localmutex(&BLEDevicesMutex, "BLEDel2");
+  BLE_ESP32::BLE_simple_device_t** known = seenDevicesIndex.find(mac);
+  if (!known) return res;
+  BLE_ESP32::BLE_simple_device_t* dev = *known;
+  seenDevicesIndex.remove(mac);
   for (int i = 0; i < seenDevices.size(); i++){
-    if (!memcmp(seenDevices[i]->mac, mac, 6)){
-      BLE_ESP32::BLE_simple_device_t* dev = seenDevices[i];
+    if (seenDevices[i] == dev){
       seenDevices.erase(seenDevices.begin()+i);
       freeDevices.push_back(dev);
       res = 1;
@@ -765,16 +863,14 @@ uint32_t devicePresent(uint8_t *mac){
   uint32_t nowS = (uint32_t)now;
 
   TasAutoMutex localmutex(&BLEDevicesMutex, "BLEPRes");
-  for (int i = 0; i < seenDevices.size(); i++){
-    if (!memcmp(seenDevices[i]->mac, mac, 6)){
-      uint64_t lastseen = seenDevices[i]->lastseen/1000L;
-      lastseen = lastseen/1000L;
-      uint32_t lastseenS = (uint32_t) lastseen;
-      uint32_t ageS = nowS-lastseenS;
-      if (!ageS) ageS++;
-      res = ageS;
-      break;
-    }
+  BLE_ESP32::BLE_simple_device_t** known = seenDevicesIndex.find(mac);
+  if (known){
+    uint64_t lastseen = (*known)->lastseen/1000L;
+    lastseen = lastseen/1000L;
+    uint32_t lastseenS = (uint32_t) lastseen;
+    uint32_t ageS = nowS-lastseenS;
+    if (!ageS) ageS++;
+    res = ageS;
   }
   return res;
 }
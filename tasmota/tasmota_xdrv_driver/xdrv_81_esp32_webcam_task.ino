@@ -350,34 +350,35 @@ struct PICSTORE {
 #endif // RTSP_FRAME_TIME
 
 // RTSP streamer class
+// the frame is packetized once and shared by all the rtsp clients
 class localOV2640Streamer : public CStreamer {
-    BufPtr f_ptr; // temp pointer to frame buffer
-    int f_len;
+    CRtpFrame *f_frame; // temp pointer to the shared frame
 public:
     localOV2640Streamer(SOCKET aClient, int width, int height);
-    void setframe(BufPtr ptr, int len);
+    void setframe(CRtpFrame *frame);
     void clearframe();
     virtual void    streamImage(uint32_t curMsec);
 };
 
 localOV2640Streamer::localOV2640Streamer(SOCKET aClient, int width, int height) : CStreamer(aClient, width, height) {
-  clearframe();
+  f_frame = nullptr;
 #ifdef WEBCAM_DEV_DEBUG  
   AddLog(LOG_LEVEL_DEBUG,PSTR("CAM:RTSP w%d h%d"), width, height);
 #endif
 }
-void localOV2640Streamer::setframe(BufPtr ptr, int len) {
-  f_ptr = ptr;
-  f_len = len;
+void localOV2640Streamer::setframe(CRtpFrame *frame) {
+  clearframe();
+  f_frame = frame;
+  if (f_frame) f_frame->retain();
 }
 void localOV2640Streamer::clearframe() {
-  f_ptr = nullptr;
-  f_len = 0;
+  if (f_frame) f_frame->release();
+  f_frame = nullptr;
 }
 void localOV2640Streamer::streamImage(uint32_t curMsec){
-  if (!f_ptr) return;
-  streamFrame(f_ptr, f_len, curMsec);
-  //AddLog(LOG_LEVEL_DEBUG,PSTR("CAM: RTSP Stream Frame %d"), f_len);
+  if (!f_frame) return;
+  streamFrame(f_frame, curMsec);
+  //AddLog(LOG_LEVEL_DEBUG,PSTR("CAM: RTSP Stream Frame %d"), f_frame->fragmentCount());
 }
 
 typedef struct tag_wc_rtspclient {
@@ -618,6 +619,7 @@ struct WC_Motion {
   uint32_t motion_trigger_limit; // last amount of difference measured (~100 for none, > ~1000 for motion?)
   uint8_t scale; /*0=native, 1=/2, 2=/4, 3=/8*/
   uint8_t swscale; // skips pixels 0=native, 1=/2, 2=/4, 3=/8 - after scale
+  uint8_t dc_decode; // at scale 3, use only the DC of jpeg blocks instead of a full decode
   uint8_t enable_diffbuff; // enable create of a buffer containing the last difference image
   uint8_t enable_backgroundbuff;
   uint8_t capture_background;
@@ -1977,15 +1979,21 @@ static void WCOperationTask(void *pvParameters){
                 // if rtsp is active, we will have one or more clients
                 volatile wc_rtspclient *rtspclient = Wc.rtspclient;
                 uint8_t rtspclientcount = 0;
+                // packetized on the first streaming client only, the jpeg must stay valid until released
+                CRtpFrame *rtp_frame = nullptr;
                 while (rtspclient) {
                   if (rtspclient->camStreamer && rtspclient->rtsp_session){
-                    rtspclient->camStreamer->setframe(_jpg_buf, _jpg_buf_len);
+                    if (!rtp_frame && rtspclient->rtsp_session->m_streaming){
+                      rtp_frame = CRtpFrame::create(_jpg_buf, _jpg_buf_len, Wc.width, Wc.height);
+                    }
+                    rtspclient->camStreamer->setframe(rtp_frame);
                     rtspclient->rtsp_session->broadcastCurrentFrame(now);
                     rtspclient->camStreamer->clearframe();
                   }
                   rtspclient = rtspclient->p_next;
                   rtspclientcount++;
                 }
+                if (rtp_frame) rtp_frame->release();
                 WcStats.rtspclientcount = rtspclientcount;
     #endif
 
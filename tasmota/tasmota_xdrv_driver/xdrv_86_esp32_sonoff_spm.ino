@@ -2649,6 +2649,7 @@ bool Xdrv86(uint32_t function) {
 
   if (FUNC_INIT == function) {
     SSPMInit();
+    if (Sspm) { XdrvSubscribeAll(); } else { XdrvUnsubscribeAll(); }  // Periodic calls only with detected device
   }
   else if (Sspm) {
     switch (function) {
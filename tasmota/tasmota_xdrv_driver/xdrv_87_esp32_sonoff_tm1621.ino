@@ -584,6 +584,7 @@ bool Xdrv87(uint32_t function) {
 
   if (FUNC_INIT == function) {
     TM1621PreInit();
+    if (Tm1621.present) { XdrvSubscribeAll(); } else { XdrvUnsubscribeAll(); }  // Periodic calls only with detected device
   }
   else if (Tm1621.present) {
     switch (function) {
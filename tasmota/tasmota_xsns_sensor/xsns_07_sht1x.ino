@@ -191,6 +191,7 @@ bool Xsns07(uint32_t function) {
 
   if (FUNC_INIT == function) {
     ShtDetect();
+    if (Sht1x.type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Sht1x.type) {
     switch (function) {
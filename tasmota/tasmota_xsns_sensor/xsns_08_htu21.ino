@@ -262,6 +262,7 @@ bool Xsns08(uint32_t function)
 
   if (FUNC_INIT == function) {
     HtuDetect();
+    if (Htu.type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Htu.type) {
     switch (function) {
@@ -691,6 +691,7 @@ bool Xsns09(uint32_t function) {
 
   if (FUNC_INIT == function) {
     BmpDetect();
+    if (bmp_count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (bmp_count) {
     switch (function) {
@@ -701,6 +701,7 @@ bool Xsns100(uint32_t function)
 
   if (FUNC_INIT == function) {
     Ina3221Detect();
+    if (Ina3221Data) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Ina3221Data) {
     switch (function) {
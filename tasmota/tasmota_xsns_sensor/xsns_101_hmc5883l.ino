@@ -228,6 +228,7 @@ bool Xsns101(uint32_t function) {
 
   if (FUNC_INIT == function) {
     HMC5883L_Init();
+    if (HMC5883L != nullptr) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (HMC5883L != nullptr) {
     switch (function) {
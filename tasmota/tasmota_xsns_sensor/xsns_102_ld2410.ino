@@ -518,6 +518,7 @@ bool Xsns102(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Ld2410Detect();
+    if (LD2410Serial) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (LD2410Serial) {
     switch (function) {
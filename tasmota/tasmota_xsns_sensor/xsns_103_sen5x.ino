@@ -213,6 +213,7 @@ bool Xsns103(uint32_t function) {
 
   if (FUNC_INIT == function) {
     sen5x_Init();
+    if (SEN5XDATA != nullptr) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (SEN5XDATA != nullptr) {
     switch (function) {
@@ -132,6 +132,7 @@ bool Xsns104(uint32_t function)
 
   if (FUNC_INIT == function) {
     pmsa003i_Init();
+    if (Pmsa003i.type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Pmsa003i.type) {
     switch (function) {
@@ -258,6 +258,7 @@ bool Xsns106(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Gdk101Detect();
+    if (Gdk.ready) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Gdk.ready) {
     switch (function) {
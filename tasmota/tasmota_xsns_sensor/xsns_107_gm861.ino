@@ -378,6 +378,7 @@ bool Xsns107(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Gm861Init();
+    if (Gm861Serial) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Gm861Serial) {
     switch (function) {
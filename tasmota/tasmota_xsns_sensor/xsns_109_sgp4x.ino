@@ -299,6 +299,7 @@ bool Xsns109(uint32_t function)
 
   if (FUNC_INIT == function) {
     sgp4x_Init();
+    if (sgp4x_init) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (sgp4x_init) {
     switch (function) {
@@ -209,6 +209,7 @@ bool Xsns10(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Bh1750Detect();
+    if (Bh1750.count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Bh1750.count) {
     switch (function) {
@@ -157,6 +157,7 @@ bool Xsns110(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Max17043Init();
+    if (max17043) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (max17043) {
     switch (function) {
@@ -155,6 +155,7 @@ bool Xsns111(uint32_t function)
 
   if (FUNC_INIT == function) {
     ens16xDetect();
+    if (ENS16xCount) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (ENS16xCount) {
     switch (function) {
@@ -127,6 +127,7 @@ bool Xsns112(uint32_t function)
 
   if (FUNC_INIT == function) {
     ens210Detect();
+    if (ENS210data) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (ENS210data) {
     switch (function) {
@@ -302,6 +302,7 @@ bool Xsns11(uint32_t function)
 
   if (FUNC_INIT == function) {
     Veml6070Detect();
+    if (veml6070_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (veml6070_type) {
     switch (function) {
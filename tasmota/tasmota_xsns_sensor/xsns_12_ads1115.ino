@@ -319,6 +319,7 @@ bool Xsns12(uint32_t function)
 
   if (FUNC_INIT == function) {
     Ads1115Detect();
+    if (ads1115_count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (ads1115_count) {
     switch (function) {
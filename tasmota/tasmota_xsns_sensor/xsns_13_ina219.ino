@@ -377,6 +377,7 @@ bool Xsns13(uint32_t function)
 
   if (FUNC_INIT == function) {
     Ina219Detect();
+    if (Ina219Data) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Ina219Data) {
     switch (function) {
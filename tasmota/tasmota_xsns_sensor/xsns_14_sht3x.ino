@@ -168,6 +168,7 @@ bool Xsns14(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Sht3xDetect();
+    XsnsUnsubscribeAll();              // Sensor is only read on request
   }
   else if (sht3x_count) {
     switch (function) {
@@ -124,6 +124,7 @@ bool Xsns16(uint32_t function)
 
   if (FUNC_INIT == function) {
     Tsl2561Detect();
+    if (tsl2561_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (tsl2561_type) {
     switch (function) {
@@ -97,6 +97,7 @@ bool Xsns19(uint32_t function)
 
   if (FUNC_INIT == function) {
     MGSPrepare();
+    if (mgs_detected) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (mgs_detected) {
     switch (function) {
@@ -149,6 +149,7 @@ bool Xsns21(uint32_t function)
 
   if (FUNC_INIT == function) {
     sgp30_Init();
+    if (sgp30_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (sgp30_type) {
     switch (function) {
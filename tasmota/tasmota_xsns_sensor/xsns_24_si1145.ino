@@ -376,6 +376,7 @@ bool Xsns24(uint32_t function)
 
   if (FUNC_INIT == function) {
     Si1145Detect();
+    if (si1145_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (si1145_type) {
     switch (function) {
@@ -110,6 +110,7 @@ bool Xsns25(uint32_t function)
 
   if (FUNC_INIT == function) {
     spl007Detect();
+    if (spl007_s.valid) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (spl007_s.valid) {
     switch (function) {
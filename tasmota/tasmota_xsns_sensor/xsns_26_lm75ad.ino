@@ -106,6 +106,7 @@ bool Xsns26(uint32_t function)
 
   if (FUNC_INIT == function) {
     LM75ADDetect();
+    if (lm75ad_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (lm75ad_type) {
     switch (function) {
@@ -113,6 +113,7 @@ bool Xsns31(uint32_t function)
 
   if (FUNC_INIT == function) {
     CCS811Detect();
+    if (CCS811_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (CCS811_type) {
     switch (function) {
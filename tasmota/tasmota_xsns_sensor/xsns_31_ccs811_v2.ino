@@ -314,6 +314,7 @@ bool Xsns31(uint32_t function)
 
   if (FUNC_INIT == function) {
     CCS811Detect();
+    if (CCS811_devices_found) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (CCS811_devices_found) {
     switch (function) {
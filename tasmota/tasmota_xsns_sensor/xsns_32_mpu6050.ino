@@ -256,6 +256,7 @@ bool Xsns32(uint32_t function)
 
   if (FUNC_INIT == function) {
     MPU_6050Detect();
+    if (MPU_6050_found) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (MPU_6050_found) {
     switch (function) {
@@ -344,6 +344,7 @@ bool Xsns33(uint32_t function) {
 
   if (FUNC_INIT == function) {
     QMC5883L_Init();
+    if (QMC5883L != nullptr) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (QMC5883L != nullptr) {
     switch (function) {
@@ -646,6 +646,7 @@ bool Xsns37(uint32_t function) {
 
   if (FUNC_INIT == function) {
     RfSnsInit();
+    if (rfsns_raw_signal) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (rfsns_raw_signal) {
     switch (function) {
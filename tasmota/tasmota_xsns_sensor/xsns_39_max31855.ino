@@ -198,6 +198,7 @@ bool Xsns39(uint32_t function)
 
   if (FUNC_INIT == function) {
     MAX31855_Init();
+    if (max31855_initialized) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (max31855_initialized) {
     switch (function) {
@@ -766,6 +766,7 @@ bool Xsns40(uint32_t function) {
 
   if (FUNC_INIT == function) {
     PN532_Init();
+    if (Pn532.present) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Pn532.present) {
     switch (function) {
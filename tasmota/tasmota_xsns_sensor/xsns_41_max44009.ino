@@ -147,6 +147,7 @@ bool Xsns41(uint32_t function)
 
   if (FUNC_INIT == function) {
     Max4409Detect();
+    if (max44009_found) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (max44009_found) {
     switch (function) {
@@ -294,6 +294,7 @@ bool Xsns44(uint32_t function)
 
   if (FUNC_INIT == function) {
     SPS30_Detect();
+    if (sps30_ready) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (sps30_ready) {
     switch (function) {
@@ -236,6 +236,7 @@ bool Xsns45(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Vl53l0Detect();
+    if (VL53L0X_detected) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (VL53L0X_detected) {
     switch (function) {
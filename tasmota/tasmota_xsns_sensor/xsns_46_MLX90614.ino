@@ -145,6 +145,7 @@ bool Xsns46(uint32_t function)
 
   if (FUNC_INIT == function) {
     MLX90614_Init();
+    if (mlx90614.ready) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (mlx90614.ready) {
     switch (function) {
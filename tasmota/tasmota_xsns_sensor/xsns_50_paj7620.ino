@@ -430,6 +430,7 @@ bool Xsns50(uint32_t function)
 
   if (FUNC_INIT == function) {
     PAJ7620Detect();
+    if (PAJ7620_next_job) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (PAJ7620_next_job) {
     switch (function) {
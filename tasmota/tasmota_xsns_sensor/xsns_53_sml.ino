@@ -477,9 +477,14 @@ struct METER_DESC {
   uint8_t sopt;
   TRX_EN_TYPE trx_en;
   bool shift_mode;
+  bool sbmirror;
   uint16_t sbsiz;
   uint8_t *sbuff;
+  uint8_t *sbmem;
+  uint16_t sboff;
   uint16_t spos;
+  uint16_t dline_start;
+  uint16_t dline_cnt;
   uint16_t sibsiz;
 	uint32_t lastms;
 	uint16_t tout_ms;
@@ -586,6 +591,14 @@ int8_t index;
 };
 
 
+// decoder line of the meter descriptor, resolved once by SML_CompileLines
+struct SML_DLINE {
+  const char *mp;
+  int16_t first;
+  uint8_t vindex;
+  uint8_t dindex;
+};
+
 struct SML_GLOBS {
   uint8_t sml_send_blocks;
   uint8_t sml_100ms_cnt;
@@ -612,6 +625,7 @@ struct SML_GLOBS {
   struct SML_MEDIAN_FILTER *sml_mf;
 #endif
 	uint8_t *script_meter;
+	struct SML_DLINE *dlines;
 	struct METER_DESC *mp;
   uint8_t to_cnt;
   bool ready;
@@ -1409,9 +1423,33 @@ void sml_empty_receiver(uint32_t meters) {
   }
 }
 
-void sml_shift_in(uint32_t meters, uint32_t shard) {
-  uint32_t count;
+// advance the receive window by one byte
+// a mirrored buffer holds every byte twice, so moving the window start keeps it linear
+void sml_shift_window(struct METER_DESC *mp) {
+  if (mp->sbmirror) {
+    uint8_t last = mp->sbuff[mp->sbsiz - 1];
+    mp->sboff++;
+    if (mp->sboff >= mp->sbsiz) {
+      mp->sboff = 0;
+    }
+    mp->sbuff = mp->sbmem + mp->sboff;
+    mp->sbuff[mp->sbsiz - 1] = last;
+  } else {
+    for (uint32_t count = 0; count < mp->sbsiz - 1; count++) {
+      mp->sbuff[count] = mp->sbuff[count + 1];
+    }
+  }
+}
+
+// copy the last window byte to its mirror
+void sml_shift_sync(struct METER_DESC *mp) {
+  if (mp->sbmirror) {
+    uint32_t pos = mp->sboff + mp->sbsiz - 1;
+    mp->sbmem[(pos >= mp->sbsiz) ? pos - mp->sbsiz : pos + mp->sbsiz] = mp->sbuff[mp->sbsiz - 1];
+  }
+}
 
+void sml_shift_in(uint32_t meters, uint32_t shard) {
   struct METER_DESC *mp = &meter_desc[meters];
 
   if (!mp->sbuff) return;
@@ -1443,9 +1481,7 @@ void sml_shift_in(uint32_t meters, uint32_t shard) {
 
   if (mp->shift_mode) {
     // shift in
-    for (count = 0; count < mp->sbsiz - 1; count++) {
-      mp->sbuff[count] = mp->sbuff[count + 1];
-    }
+    sml_shift_window(mp);
   }
     
   uint8_t iob;
@@ -1626,6 +1662,7 @@ void sml_shift_in(uint32_t meters, uint32_t shard) {
   sb_counter++;
 
   if (mp->shift_mode) {
+    sml_shift_sync(mp);
     SML_Decode(meters);
   }
 }
@@ -1757,50 +1794,105 @@ double sml_get_obis_value(uint8_t *data) {
 
 
 
-void SML_Decode(uint8_t index) {
-  const char *mp = (const char*)sml_globs.meter_p;
-  int8_t mindex;
-  uint8_t *cp;
-  uint8_t dindex = 0, vindex = 0;
-  delay(0);
+// get meter index of descriptor line, skip to its decoder
+// returns false for html and special option lines which have no variable
+bool SML_LineMeter(const char **mpp, int8_t *mindex) {
+  const char *mp = *mpp;
+  *mindex = ((*mp) & 7) - 1;
+  if (*mindex < 0 || *mindex >= sml_globs.meters_used) *mindex = 0;
+  mp += 2;
+  *mpp = mp;
+  return !(*mp == '=' && (*(mp + 1) == 'h' || *(mp + 1) == 's'));
+}
 
-  if (!sml_globs.ready) {
-    return;
+// resolve the meter descriptor once into per meter lists of decoder lines
+// with variable and delta index and the first byte to match if known
+void SML_CompileLines(void) {
+  if (sml_globs.dlines) {
+    free(sml_globs.dlines);
+    sml_globs.dlines = 0;
   }
-
-  while (mp != NULL) {
-    // check list of defines
-    if (*mp == 0) break;
-
-    // new section
-    mindex = ((*mp) & 7) - 1;
-
-    if (mindex < 0 || mindex >= sml_globs.meters_used) mindex = 0;
-    mp += 2;
-    if (*mp == '=' && *(mp+1) == 'h') {
-      mp = strchr(mp, '|');
-      if (mp) mp++;
-      continue;
-    }
-
-    if (*mp == '=' && *(mp+1) == 's') {
-      mp = strchr(mp, '|');
-      if (mp) mp++;
-      continue;
+  for (uint32_t meters = 0; meters < sml_globs.meters_used; meters++) {
+    meter_desc[meters].dline_cnt = 0;
+  }
+  uint16_t lines = 0;
+  int8_t mindex;
+  const char *mp = (const char*)sml_globs.meter_p;
+  while (mp && *mp) {
+    if (SML_LineMeter(&mp, &mindex)) {
+      meter_desc[mindex].dline_cnt++;
+      lines++;
     }
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+  }
+  if (!lines) return;
+  sml_globs.dlines = (struct SML_DLINE*)calloc(lines, sizeof(struct SML_DLINE));
+  if (!sml_globs.dlines) {
+    AddLog(LOG_LEVEL_INFO, PSTR("SML: no memory for %d decoder lines"), lines);
+    return;
+  }
+  uint16_t start = 0;
+  for (uint32_t meters = 0; meters < sml_globs.meters_used; meters++) {
+    meter_desc[meters].dline_start = start;
+    start += meter_desc[meters].dline_cnt;
+    meter_desc[meters].dline_cnt = 0;
+  }
 
-    // =d must handle dindex
-    if (*mp == '=' && *(mp + 1) == 'd') {
-      if (index != mindex) {
+  uint8_t vindex = 0, dindex = 0;
+  mp = (const char*)sml_globs.meter_p;
+  while (mp && *mp) {
+    if (SML_LineMeter(&mp, &mindex)) {
+      struct METER_DESC *mdp = &meter_desc[mindex];
+      struct SML_DLINE *dl = &sml_globs.dlines[mdp->dline_start + mdp->dline_cnt++];
+      dl->mp = mp;
+      dl->vindex = vindex;
+      dl->dindex = dindex;
+      dl->first = -1;
+      if (*mp != '=' && *mp != '@') {
+        uint8_t type = sml_globs.mp[mindex].type;
+        if (type == 's') {
+          dl->first = (hexnibble(*mp) << 4) | hexnibble(*(mp + 1));
+        } else if ((type == 'o' || type == 'c') && !(*mp & 0x80)) {
+          dl->first = *mp;
+        }
+      }
+      if (*mp == '=' && *(mp + 1) == 'd' && dindex < 255) {
         dindex++;
       }
+      if (vindex < sml_globs.maxvars - 1) {
+        vindex++;
+      }
     }
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+  }
+}
+
+void SML_Decode(uint8_t index) {
+  const char *mp;
+  int8_t mindex = index;
+  uint8_t *cp;
+  uint8_t dindex, vindex;
+  delay(0);
+
+  if (!sml_globs.ready || !sml_globs.dlines || index >= sml_globs.meters_used) {
+    return;
+  }
 
-    if (index != mindex) goto nextsect;
+  struct METER_DESC *mdp = &meter_desc[index];
+  for (uint32_t line = mdp->dline_start; line < mdp->dline_start + mdp->dline_cnt; line++) {
+    struct SML_DLINE *dl = &sml_globs.dlines[line];
+    mp = dl->mp;
+    vindex = dl->vindex;
+    dindex = dl->dindex;
 
     // start of serial source buffer
     cp = meter_desc[mindex].sbuff;
 
+    // first byte of the pattern does not match
+    if (dl->first >= 0 && *cp != dl->first) continue;
+
     // compare
     if (*mp == '=') {
       // calculated entry, check syntax
@@ -2464,12 +2556,8 @@ void SML_Decode(uint8_t index) {
       //AddLog(LOG_LEVEL_INFO, PSTR("set valid in line %d"), vindex);
     }
 nextsect:
-    // next section
-    if (vindex < sml_globs.maxvars - 1) {
-      vindex++;
-    }
-    mp = strchr(mp, '|');
-    if (mp) mp++;
+    // next line
+    ;
   }
 }
 
@@ -2980,10 +3068,13 @@ void reset_sml_vars(uint16_t maxmeters) {
     mp->spos = 0;
     mp->sbsiz = SML_BSIZ;
     mp->sibsiz = TMSBSIZ;
-    if (mp->sbuff) {
-      free(mp->sbuff);
-      mp->sbuff = 0;
+    if (mp->sbmem) {
+      free(mp->sbmem);
+      mp->sbmem = 0;
     }
+    mp->sbuff = 0;
+    mp->sboff = 0;
+    mp->sbmirror = false;
 #ifdef USE_SML_SPECOPT
     mp->so_obis1 = 0;
     mp->so_obis2 = 0;
@@ -3371,7 +3462,8 @@ next_line:
   for (uint32_t meters = 0; meters < sml_globs.meters_used; meters++ ) {
     struct METER_DESC *mp = &meter_desc[meters];
     if (mp->sbsiz) {
-      mp->sbuff = (uint8_t*)calloc(mp->sbsiz, 1);
+      mp->sbmem = (uint8_t*)calloc(mp->sbsiz, 1);
+      mp->sbuff = mp->sbmem;
 			memory += mp->sbsiz;
     }
   }
@@ -3653,6 +3745,18 @@ next_line:
       mp->shift_mode = (type != 'o' && type != 'e' && type != 'k' && type != 'm' && type != 'M' && type != 'p' && type != 'R' && type != 'v');
     }
 
+    if (mp->shift_mode && mp->sbmem) {
+      // mirror buffer for O(1) shift in
+      uint8_t *mem = (uint8_t*)realloc(mp->sbmem, mp->sbsiz * 2);
+      if (mem) {
+        memset(mem + mp->sbsiz, 0, mp->sbsiz);
+        mp->sbmem = mem;
+        mp->sbuff = mem;
+        mp->sboff = 0;
+        mp->sbmirror = true;
+      }
+    }
+
 #ifdef USE_SML_DECRYPT
 		if (mp->use_crypt) {
 #ifdef USE_SML_AUTHKEY
@@ -3665,6 +3769,8 @@ next_line:
 #endif
   }
 
+  SML_CompileLines();
+
   sml_globs.ready = true;
 }
 
@@ -3801,6 +3907,14 @@ uint32_t sml_getv(uint32_t sel) {
 uint32_t SML_Shift_Num(uint32_t meter, uint32_t shift) {
   struct METER_DESC *mp = &sml_globs.mp[meter];
   if (shift > mp->sbsiz) shift = mp->sbsiz;
+  if (mp->sbmirror) {
+    for (uint16_t cnt = 0; cnt < shift; cnt++) {
+      sml_shift_window(mp);
+      sml_shift_sync(mp);
+      SML_Decode(meter);
+    }
+    return shift;
+  }
   for (uint16_t cnt = 0; cnt < shift; cnt++) {
      for (uint16_t count = 0; count < mp->sbsiz - 1; count++) {
       mp->sbuff[count] = mp->sbuff[count + 1];
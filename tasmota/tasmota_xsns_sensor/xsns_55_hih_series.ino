@@ -112,6 +112,7 @@ bool Xsns55(uint32_t function)
 
   if (FUNC_INIT == function) {
     Hih6Detect();
+    if (Hih6.type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Hih6.type) {
     switch (function) {
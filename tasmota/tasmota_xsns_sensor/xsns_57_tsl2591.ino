@@ -125,6 +125,7 @@ bool Xsns57(uint32_t function)
 
   if (FUNC_INIT == function) {
     Tsl2591Init();
+    if (tsl2591_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (tsl2591_type) {
     switch (function) {
@@ -106,6 +106,7 @@ bool Xsns58(uint32_t function)
 
   if (FUNC_INIT == function) {
     Dht12Detect();
+    if (Dht12.count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Dht12.count) {
     switch (function) {
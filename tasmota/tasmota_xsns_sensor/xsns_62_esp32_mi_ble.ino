@@ -20,11 +20,13 @@
   You should have received a copy of the GNU General Public License
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
-#define MI32_VERSION "V0.9.2.4"
+#define MI32_VERSION "V0.9.2.5"
 /*
   --------------------------------------------------------------------------------------------
   Version yyyymmdd  Action    Description
   --------------------------------------------------------------------------------------------
+  0.9.2.5 20261017  changed - decode adverts by batches in the main task, hashed MAC lookup, add MI32Stats
+  -------
   0.9.2.4 20240111  changed - Enhancement of debug log output                              
   -------
   0.9.2.3 20240101  changed - added initial support for MI LYWSD02MMC                              
@@ -86,6 +88,7 @@
 #define USE_MI_DECRYPTION
 
 #include <vector>
+#include <atomic>
 #ifdef USE_MI_DECRYPTION
 #include <t_bearssl.h>
 #endif //USE_MI_DECRYPTION
@@ -129,6 +132,10 @@ void MI32notifyCB(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pD
 #define MI32_BLE_TOPIC "tasmota_ble"
 #endif
 
+#ifndef MI32_ADVERT_QUEUE
+#define MI32_ADVERT_QUEUE 32       // adverts waiting to be decoded, power of 2
+#endif
+
 ///////////////////////////////////////////////////////////
 
 
@@ -447,9 +454,32 @@ struct MAC_t {
 std::vector<mi_sensor_t> MIBLEsensors;
 std::vector<mi_bindKey_t> MIBLEbindKeys;
 std::vector<MAC_t> MIBLEBlockList;
+// slot in MIBLEsensors by MAC, rebuilt when sensors are removed
+BLE_ESP32::MacIndex<uint16_t> MIBLEsensorIndex;
 
 SemaphoreHandle_t slotmutex = (SemaphoreHandle_t) nullptr;
 
+// adverts of interest are copied by the BLE task and decoded by batches in the main task,
+// through a single producer/single consumer ring
+#define MI32_ADVERT_DATA 32        // a legacy advert is at most 31 bytes
+
+struct mi_advert_t {
+  uint8_t addr[6];
+  int8_t RSSI;
+  uint8_t len;
+  uint16_t UUID;                   // of the service data, 0 for manufacturer data
+  uint8_t data[MI32_ADVERT_DATA];
+};
+
+struct {
+  mi_advert_t ring[MI32_ADVERT_QUEUE];
+  std::atomic<uint32_t> head{0};   // written by the BLE task only
+  std::atomic<uint32_t> tail{0};   // written by the main task only
+  uint32_t received = 0;           // BLE task
+  uint32_t dropped = 0;            // BLE task, ring full
+  uint32_t processed = 0;          // main task
+} MI32adverts;
+
 /*********************************************************************************************\
  * constants
 \*********************************************************************************************/
@@ -461,7 +491,7 @@ const char kMI32_Commands[] PROGMEM = D_CMND_MI32 "|"
   "Key|"
   "Keys|"
 #endif  // USE_MI_DECRYPTION
-  "Period|Time|Page|Battery|Unit|Block|Option|Topic";
+  "Period|Time|Page|Battery|Unit|Block|Option|Topic|Stats";
 
 void (*const MI32_Commands[])(void) PROGMEM = {
 #ifdef USE_MI_DECRYPTION
@@ -469,7 +499,7 @@ void (*const MI32_Commands[])(void) PROGMEM = {
   &CmndMi32Keys,
 #endif  // USE_MI_DECRYPTION
   &CmndMi32Period, &CmndMi32Time, &CmndMi32Page, &CmndMi32Battery, &CmndMi32Unit, &CmndMi32Block,
-  &CmndMi32Option, &CmndMi32Topic };
+  &CmndMi32Option, &CmndMi32Topic, &CmndMi32Stats };
 
 
 #define MI_UNKOWN      1
@@ -1065,84 +1095,124 @@ int genericOpCompleteFn(BLE_ESP32::generic_sensor_t *op){
   return 0;
 }
 
+// called from the BLE task, only queues the adverts we can decode
 int MI32advertismentCallback(BLE_ESP32::ble_advertisment_t *pStruct)
 {
-  // we will try not to use this...
   BLEAdvertisedDevice *advertisedDevice = pStruct->advertisedDevice;
-
-  // AddLog(LOG_LEVEL_DEBUG, PSTR("M32: Advertised Device: %s Buffer: %u"),advertisedDevice->getAddress().toString().c_str(),advertisedDevice->getServiceData(0).length());
-  int RSSI = pStruct->RSSI;
   const uint8_t *addr = pStruct->addr;
-  if(MI32isInBlockList(addr) == true) return 0;
-  if (MI32.option.onlyAliased){
-    const char *alias = BLE_ESP32::getAlias(addr);
-    if (!alias || !(*alias)){
+  uint16_t UUID = 0;
+  std::string data;
+
+  // ATBTN uses manufacturer data and not a service - bit more like an IBeacon
+  if (!memcmp(ATBTN_Addr, addr, 6)) {
+    data = advertisedDevice->getManufacturerData();
+  } else {
+    if (advertisedDevice->getServiceDataCount() == 0) {
       return 0;
     }
+    NimBLEUUID UUIDBig = advertisedDevice->getServiceDataUUID(0);//.getNative()->u16.value;
+    const ble_uuid_any_t* native = UUIDBig.getNative();
+    if (native->u.type != 16){
+      //not interested in 128 bit;
+      return 0;
+    }
+    UUID = native->u16.value;
+    switch(UUID){
+      case 0xfe95: // std MI?
+      case 0xfdcd: // CGD1 & CGDK2
+      case 0x181a: // ATC
+      case 0x181d: // Mi Scale V1
+      case 0x181b: // Mi Scale V2
+        break;
+      default:
+        return 0;
+    }
+    data = advertisedDevice->getServiceData(0);
   }
 
-  // ATBTN uses manufacturer data and not a service - bit more like an IBeacon
-  if (!memcmp(ATBTN_Addr, addr, 6))
-  {
-    //AddLog(LOG_LEVEL_INFO, PSTR("M32: AvagoBtn: %s"), advertisedDevice->toString().c_str());
-    MI32ParseATBtn((uint8_t*)advertisedDevice->getManufacturerData().data(), advertisedDevice->getManufacturerData().length(), addr, RSSI);
+  MI32adverts.received++;
+  uint32_t head = MI32adverts.head.load(std::memory_order_relaxed);
+  if ((head - MI32adverts.tail.load(std::memory_order_acquire) >= MI32_ADVERT_QUEUE) || (data.length() > MI32_ADVERT_DATA)) {
+    MI32adverts.dropped++;
     return 0;
   }
+  mi_advert_t *ad = &MI32adverts.ring[head & (MI32_ADVERT_QUEUE - 1)];
+  memcpy(ad->addr, addr, 6);
+  ad->RSSI = pStruct->RSSI;
+  ad->UUID = UUID;
+  ad->len = data.length();
+  memcpy(ad->data, data.data(), ad->len);
+  MI32adverts.head.store(head + 1, std::memory_order_release);
+  return 0;
+}
 
-  int svcdataCount = advertisedDevice->getServiceDataCount();
-
-  if (svcdataCount == 0) {
-    return 0;
+void MI32decodeAdvert(struct mi_advert_t *ad)
+{
+  int RSSI = ad->RSSI;
+  const uint8_t *addr = ad->addr;
+  if(MI32isInBlockList(addr) == true) return;
+  if (MI32.option.onlyAliased){
+    const char *alias = BLE_ESP32::getAlias(addr);
+    if (!alias || !(*alias)){
+      return;
+    }
   }
 
-  NimBLEUUID UUIDBig = advertisedDevice->getServiceDataUUID(0);//.getNative()->u16.value;
-
-  const ble_uuid_any_t* native = UUIDBig.getNative();
-  if (native->u.type != 16){
-    //not interested in 128 bit;
-    return 0;
+  if (!ad->UUID) {
+    MI32ParseATBtn(ad->data, ad->len, addr, RSSI);
+    return;
   }
-  uint16_t UUID = native->u16.value;
 
+  uint16_t UUID = ad->UUID;
   if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("M32: %s: svc[0] UUID (%x)"), MIaddrStr(addr), UUID);
-  std::string ServiceDataStr = advertisedDevice->getServiceData(0);
-
-  uint32_t  ServiceDataLength = ServiceDataStr.length();
-  const uint8_t *ServiceData = (const uint8_t *)ServiceDataStr.data();
+  uint32_t  ServiceDataLength = ad->len;
+  const uint8_t *ServiceData = ad->data;
   char temp[60];
   BLE_ESP32::dump(temp, 60, ServiceData, ServiceDataLength);
   if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("M32: %s: SrvData %s"), MIaddrStr(addr), temp);
 
-  if (UUID){
-    // this will take and keep the mutex until the function is over
-    TasAutoMutex localmutex(&slotmutex, "Mi32AdCB2");
-    switch(UUID){
-      case 0xfe95: // std MI?
-      {
-          MI32ParseResponse(ServiceData, ServiceDataLength, addr, RSSI);
-      } break;
-      case 0xfdcd: // CGD1 & CGDK2
-      {
-        if (ServiceDataLength == 17){ // CGDK2
-          MI32ParseCGDK2Packet(ServiceData, ServiceDataLength, addr, RSSI);
-        } else {
-          MI32ParseResponse(ServiceData, ServiceDataLength, addr, RSSI);
-        }
-      } break;
-      case 0x181a: { //ATC
-        MI32ParseATCPacket(ServiceData, ServiceDataLength, addr, RSSI);
-      } break;
-      case 0x181d: // Mi Scale V1
-      case 0x181b: // Mi Scale V2
-      {
-        MI32ParseMiScalePacket(ServiceData, ServiceDataLength, addr, RSSI, UUID);
-      } break;
+  switch(UUID){
+    case 0xfe95: // std MI?
+    {
+        MI32ParseResponse(ServiceData, ServiceDataLength, addr, RSSI);
+    } break;
+    case 0xfdcd: // CGD1 & CGDK2
+    {
+      if (ServiceDataLength == 17){ // CGDK2
+        MI32ParseCGDK2Packet(ServiceData, ServiceDataLength, addr, RSSI);
+      } else {
+        MI32ParseResponse(ServiceData, ServiceDataLength, addr, RSSI);
+      }
+    } break;
+    case 0x181a: { //ATC
+      MI32ParseATCPacket(ServiceData, ServiceDataLength, addr, RSSI);
+    } break;
+    case 0x181d: // Mi Scale V1
+    case 0x181b: // Mi Scale V2
+    {
+      MI32ParseMiScalePacket(ServiceData, ServiceDataLength, addr, RSSI, UUID);
+    } break;
 
-      default:{
-      } break;
-    }
+    default:{
+    } break;
+  }
+}
+
+// called from the main task, decodes the queued adverts
+void MI32processAdverts()
+{
+  uint32_t tail = MI32adverts.tail.load(std::memory_order_relaxed);
+  uint32_t head = MI32adverts.head.load(std::memory_order_acquire);
+  if (tail == head) return;
+
+  // this will take and keep the mutex until the function is over
+  TasAutoMutex localmutex(&slotmutex, "Mi32Adverts");
+  for (; tail != head; tail++) {
+    MI32decodeAdvert(&MI32adverts.ring[tail & (MI32_ADVERT_QUEUE - 1)]);
+    MI32adverts.processed++;
+    // give the slot back to the BLE task
+    MI32adverts.tail.store(tail + 1, std::memory_order_release);
   }
-  return 0;
 }
 
 
@@ -1496,29 +1566,27 @@ uint32_t MIBLEgetSensorSlot(const uint8_t *mac, uint16_t _type, uint8_t counter,
   }
 
   //AddLog(LOG_LEVEL_DEBUG_MORE,PSTR("M32: Vector size %u"), MIBLEsensors.size());
-  for(uint32_t i=0; i<MIBLEsensors.size(); i++){
-    if(!memcmp(mac, MIBLEsensors[i].MAC, 6)){
-      // AddLog(LOG_LEVEL_DEBUG,PSTR("M32: Counters: %x %x"),MIBLEsensors[i].lastCnt, counter);
-      if(MIBLEsensors[i].lastCnt==counter) {
-        // AddLog(LOG_LEVEL_DEBUG,PSTR("Old packet"));
-        if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("M32: %s: Slot %u/[0-%u] - ign repeat"), MIaddrStr(mac), i, MIBLEsensors.size() - 1);
-        if(ignoreDuplicate) return 0xff; // packet received before, stop here
-      }
-      if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG, PSTR("M32: %s: Frame %d, last %d"), MIaddrStr(mac), counter, MIBLEsensors[i].lastCnt);
-      MIBLEsensors[i].lastCnt = counter;
-      if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("M32: %s: Slot %u/[0-%u]"), MIaddrStr(mac), i, MIBLEsensors.size() - 1);
-
-      if (MIBLEsensors[i].type != _type){
-        // this happens on incorrectly configured pvvx ATC firmware
-        AddLog(LOG_LEVEL_ERROR, PSTR("M32: %s: Slot %u - device type 0x%04x(%s) -> 0x%04x(%s) - check device is only sending one type of advert."), MIaddrStr(mac), i,
-          kMI32DeviceID[MIBLEsensors[i].type-1], kMI32DeviceType[MIBLEsensors[i].type-1], kMI32DeviceID[_type-1], kMI32DeviceType[_type-1]);
-        MIBLEsensors[i].type = _type;
-      }
+  uint16_t *known = MIBLEsensorIndex.find(mac);
+  if(known){
+    uint32_t i = *known;
+    // AddLog(LOG_LEVEL_DEBUG,PSTR("M32: Counters: %x %x"),MIBLEsensors[i].lastCnt, counter);
+    if(MIBLEsensors[i].lastCnt==counter) {
+      // AddLog(LOG_LEVEL_DEBUG,PSTR("Old packet"));
+      if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("M32: %s: Slot %u/[0-%u] - ign repeat"), MIaddrStr(mac), i, MIBLEsensors.size() - 1);
+      if(ignoreDuplicate) return 0xff; // packet received before, stop here
+    }
+    if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG, PSTR("M32: %s: Frame %d, last %d"), MIaddrStr(mac), counter, MIBLEsensors[i].lastCnt);
+    MIBLEsensors[i].lastCnt = counter;
+    if (BLE_ESP32::BLEDebugMode) AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("M32: %s: Slot %u/[0-%u]"), MIaddrStr(mac), i, MIBLEsensors.size() - 1);
 
-      return i;
+    if (MIBLEsensors[i].type != _type){
+      // this happens on incorrectly configured pvvx ATC firmware
+      AddLog(LOG_LEVEL_ERROR, PSTR("M32: %s: Slot %u - device type 0x%04x(%s) -> 0x%04x(%s) - check device is only sending one type of advert."), MIaddrStr(mac), i,
+        kMI32DeviceID[MIBLEsensors[i].type-1], kMI32DeviceType[MIBLEsensors[i].type-1], kMI32DeviceID[_type-1], kMI32DeviceType[_type-1]);
+      MIBLEsensors[i].type = _type;
     }
-    //AddLog(LOG_LEVEL_DEBUG_MORE,PSTR("M32: i: %x %x %x %x %x %x"), MIBLEsensors[i].MAC[5], MIBLEsensors[i].MAC[4], MIBLEsensors[i].MAC[3], MIBLEsensors[i].MAC[2], MIBLEsensors[i].MAC[1], MIBLEsensors[i].MAC[0]);
-    //AddLog(LOG_LEVEL_DEBUG_MORE,PSTR("M32: n: %x %x %x %x %x %x"), mac[5], mac[4], mac[3], mac[2], mac[1], mac[0]);
+
+    return i;
   }
   //AddLog(LOG_LEVEL_DEBUG_MORE,PSTR("M32: new sensor -> slot %u"), MIBLEsensors.size());
   //AddLog(LOG_LEVEL_DEBUG_MORE,PSTR("M32: found new sensor"));
@@ -1598,6 +1666,11 @@ uint32_t MIBLEgetSensorSlot(const uint8_t *mac, uint16_t _type, uint8_t counter,
       break;
     }
   MIBLEsensors.push_back(_newSensor);
+  if (!MIBLEsensorIndex.set(mac, MIBLEsensors.size() - 1)){
+    // out of memory, an unindexed sensor would be added again on each advert
+    MIBLEsensors.pop_back();
+    return 0xff;
+  }
   AddLog(LOG_LEVEL_DEBUG, PSTR("M32: %s: New %s at slot %u"), MIaddrStr(mac), kMI32DeviceType[_type-1], MIBLEsensors.size() - 1);
   MI32.mode.shallShowStatusInfo = 1;
   return MIBLEsensors.size()-1;
@@ -2251,6 +2324,20 @@ void MI32removeMIBLEsensor(uint8_t* MAC){
   MIBLEsensors.erase( std::remove_if( MIBLEsensors.begin() , MIBLEsensors.end(), [MAC]( mi_sensor_t _sensor )->bool
   { return (!memcmp(_sensor.MAC, MAC, 6)); }
   ), end( MIBLEsensors ) );
+  MI32rebuildSensorIndex();
+}
+
+// the slots move when sensors are removed
+void MI32rebuildSensorIndex(){
+  MIBLEsensorIndex.clear();
+  for (uint32_t i = 0; i < MIBLEsensors.size(); i++){
+    if (!MIBLEsensorIndex.set(MIBLEsensors[i].MAC, i)){
+      // out of memory, unindexed sensors would be added again on each advert
+      AddLog(LOG_LEVEL_ERROR, PSTR("M32: No mem for index, drop %u sensors"), MIBLEsensors.size() - i);
+      MIBLEsensors.erase(MIBLEsensors.begin() + i, MIBLEsensors.end());
+      break;
+    }
+  }
 }
 
 /***********************************************************************\
@@ -2306,6 +2393,7 @@ void MI32notifyHT_LY(int _slot, char *_buf, int len){
  */
 
 void MI32Every50mSecond(){
+  MI32processAdverts();
 
   if(MI32.mode.shallTriggerTele){
       MI32.mode.shallTriggerTele = 0;
@@ -2413,12 +2501,8 @@ int findSlot(char *addrOrAlias){
   int res = BLE_ESP32::getAddr(mac, addrOrAlias);
   if (!res) return -1;
 
-  for (int i = MIBLEsensors.size()-1; i >= 0 ; i--) {
-    if (!memcmp(MIBLEsensors[i].MAC, mac, 6)){
-      return i;
-    }
-  }
-  return -1;
+  uint16_t *slot = MIBLEsensorIndex.find(mac);
+  return slot ? *slot : -1;
 }
 
 void CmndMi32Time(void) {
@@ -2445,6 +2529,11 @@ void CmndMi32Time(void) {
   ResponseCmndChar_P("fail");
 }
 
+void CmndMi32Stats(void) {
+  Response_P(PSTR("{\"%s\":{\"Received\":%u,\"Dropped\":%u,\"Processed\":%u,\"Sensors\":%u}}"),
+    XdrvMailbox.command, MI32adverts.received, MI32adverts.dropped, MI32adverts.processed, MIBLEsensors.size());
+}
+
 void CmndMi32Page(void) {
   if (XdrvMailbox.payload > 0) {
     MI32.perPage = XdrvMailbox.payload;
@@ -2598,6 +2687,7 @@ void CmndMi32Option(void){
         if (MI32.option.onlyAliased){
           // discard all sensors for a restart
           MIBLEsensors.clear();
+          MIBLEsensorIndex.clear();
         }
       } else {
         value = MI32.option.onlyAliased;
@@ -2803,6 +2893,7 @@ void MI32TimeoutSensors(){
   // PROBLEM: when we take this, it hangs the BLE loop.
   // BUT, devicePresent uses the
   // remove devices for which the adverts have timed out
+  bool removed = false;
   for (int i = MIBLEsensors.size()-1; i >= 0; i--) {
     //if (MIBLEsensors[i].MAC[2] || MIBLEsensors[i].MAC[3] || MIBLEsensors[i].MAC[4] || MIBLEsensors[i].MAC[5]){
       // Since we use a pseudo MAC for the ATBTN slots we need to ignore these warnings
@@ -2812,9 +2903,14 @@ void MI32TimeoutSensors(){
         AddLog(LOG_LEVEL_DEBUG, PSTR("M32: %s: Dev no longer present"), MIaddrStr(MIBLEsensors[i].MAC));
         TasAutoMutex localmutex(&slotmutex, "Mi32Timeout");
         MIBLEsensors.erase(MIBLEsensors.begin() + i);
+        removed = true;
       }
     //}
   }
+  if (removed){
+    TasAutoMutex localmutex(&slotmutex, "Mi32Timeout");
+    MI32rebuildSensorIndex();
+  }
 }
 
 // this assumes that we're adding to a ResponseTime_P
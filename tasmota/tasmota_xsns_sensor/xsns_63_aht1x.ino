@@ -202,6 +202,7 @@ bool Xsns63(uint32_t function)
 
   if (FUNC_INIT == function) {
     AHT1XDetect();
+    if (aht1x.count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (aht1x.count) {
     switch (function) {
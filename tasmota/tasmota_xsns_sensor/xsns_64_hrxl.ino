@@ -88,6 +88,7 @@ void HRXLShow(bool json) {
 bool Xsns64(uint32_t function) {
   if (FUNC_INIT == function) {
     HRXLInit();
+    if (HRXLSerial) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (HRXLSerial) {
     switch (function) {
@@ -299,6 +299,7 @@ bool Xsns65(uint32_t function)
 
   if (FUNC_INIT == function) {
     HdcDetect();
+    if (hdc_device_id) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (hdc_device_id) {
     switch (function) {
@@ -146,6 +146,7 @@ bool Xsns66(uint32_t function)
 
   if (FUNC_INIT == function) {
     IAQ_Init();
+    if (iAQ.ready) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (iAQ.ready) {
     switch (function) {
@@ -831,6 +831,7 @@ bool Xsns67(uint32_t function) {
   bool result = false;
   if (FUNC_INIT == function) {
     AS3935Detect();
+    if (as3935_sensor.active) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (as3935_sensor.active) {
     switch (function) {
@@ -280,6 +280,7 @@ bool Xsns70(uint32_t function)
 
   if (FUNC_INIT == function) {
     VEML6075Detect();
+    if (veml6075_active) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (veml6075_active) {
     switch (function) {
@@ -179,6 +179,7 @@ bool Xsns71(uint32_t function)
 
   if (FUNC_INIT == function) {
     VEML7700Detect();
+    if (veml7700_sensor.active) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (veml7700_sensor.active) {
     switch (function) {
@@ -150,6 +150,7 @@ bool Xsns73(uint32_t function)
 
   if (FUNC_INIT == function) {
     HP303B_Detect();
+    if (hp303b_cfg.count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (hp303b_cfg.count) {
     switch (function) {
@@ -114,6 +114,7 @@ bool Xsns74(uint32_t function)
 
   if (FUNC_INIT == function) {
     LMT01_Init();
+    if (lmt01_initialized) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (lmt01_initialized) {
     switch (function) {
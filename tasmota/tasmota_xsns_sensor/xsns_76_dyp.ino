@@ -117,6 +117,7 @@ void DYPShow(bool json) {
 bool Xsns76(uint32_t function) {
   if (FUNC_INIT == function) {
     DYPInit();
+    if (DYPSerial) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (DYPSerial) {
     switch (function) {
@@ -165,6 +165,7 @@ bool Xsns77(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Vl53l1Detect();
+    if (VL53L1X_detected) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (VL53L1X_detected) {
     switch (function) {
@@ -336,6 +336,7 @@ bool Xsns79(uint32_t function) {
 
   if (FUNC_INIT == function) {
     As608Init();
+    if (As608.selected) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (As608.selected) {
     switch (function) {
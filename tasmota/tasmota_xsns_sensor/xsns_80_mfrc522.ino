@@ -170,6 +170,7 @@ bool Xsns80(uint32_t function) {
 
   if (FUNC_INIT == function) {
     RC522Init();
+    if (Rc522.present) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Rc522.present) {
     switch (function) {
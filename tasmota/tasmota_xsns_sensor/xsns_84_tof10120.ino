@@ -116,6 +116,7 @@ bool Xsns84(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Tof10120Detect();
+    if (tof10120_sensor.ready) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (tof10120_sensor.ready) {
     switch (function) {
@@ -112,6 +112,7 @@ bool Xsns85(uint32_t function) {
 
   if (FUNC_INIT == function) {
     MPU_Detect();
+    if (mpu_sensor.ready) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (mpu_sensor.ready) {
     switch (function) {
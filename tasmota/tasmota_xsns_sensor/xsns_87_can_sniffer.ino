@@ -196,6 +196,7 @@ bool Xsns87(uint32_t function) {
 
   if (FUNC_INIT == function) {
     MCP2515_Init();
+    if (Mcp2515.init_status) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (Mcp2515.init_status) {
     switch (function) {
@@ -174,6 +174,7 @@ bool Xsns88(uint32_t function)
 
   if (FUNC_INIT == function) {
     Am2320Detect();
+    if (am2320_found) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (am2320_found) {
     switch (function) {
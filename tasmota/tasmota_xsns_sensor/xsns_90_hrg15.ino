@@ -262,6 +262,7 @@ bool Xsns90(uint32_t function) {
 
   if (FUNC_INIT == function) {
     Rg15Init();
+    if (HydreonSerial) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (HydreonSerial) {
     switch (function) {
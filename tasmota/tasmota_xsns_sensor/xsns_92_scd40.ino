@@ -467,6 +467,7 @@ bool Xsns92(uint32_t function)
 
   if (FUNC_INIT == function) {
     Scd40Detect();
+    if (scd40Found) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (scd40Found) {
     switch (function) {
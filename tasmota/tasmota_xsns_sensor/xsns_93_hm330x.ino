@@ -319,6 +319,7 @@ bool Xsns93(uint32_t function)
 
   if (FUNC_INIT == function) {
     HM330XInit();
+    if (HM330Xdata) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (HM330Xdata) {
     switch (function) {
@@ -112,6 +112,7 @@ bool Xsns97(uint32_t function) {
 
   if (FUNC_INIT == function) {
     HYT_Detect();
+    if (HYT.count) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (HYT.count) {
     switch (function) {
@@ -147,6 +147,7 @@ bool Xsns98(uint32_t function)
 
   if (FUNC_INIT == function) {
     sgp40_Init();
+    if (sgp40_type) { XsnsSubscribeAll(); } else { XsnsUnsubscribeAll(); }  // Periodic calls only with detected sensor
   }
   else if (sgp40_type) {
     switch (function) {
@@ -537,6 +537,7 @@ bool (* const xdrv_func_ptr[])(uint32_t) = {   // Driver Function Pointers
 };
 
 const uint8_t xdrv_present = sizeof(xdrv_func_ptr) / sizeof(xdrv_func_ptr[0]);  // Number of drivers found
+static_assert(sizeof(xdrv_func_ptr) / sizeof(xdrv_func_ptr[0]) <= 128, "Xdrv_active and Xdrv_unsubscribed bitmaps hold up to 128 drivers");
 
 /*********************************************************************************************\
  * Xdrv available list
@@ -1108,6 +1109,96 @@ void ShowFreeMem(const char *where) {
 }
 #endif
 
+/*********************************************************************************************\
+ * Function subscription
+ *
+ * High frequency functions FUNC_LOOP up to FUNC_EVERY_SECOND are only called for subscribed
+ * drivers. All drivers are subscribed by default. A driver not needing these functions, like
+ * one without detected hardware, can unsubscribe while handling any function and subscribe
+ * again when it is needed, like hardware found on a later FUNC_INIT pass.
+\*********************************************************************************************/
+
+uint32_t Xdrv_unsubscribed[FUNC_SUBSCRIPTIONS][4] = { 0 };
+uint32_t Xdrv_current = 0;                  // Index of driver being called
+
+void XdrvUnsubscribe(uint32_t function) {
+  if ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND)) {
+    bitSet(Xdrv_unsubscribed[function - FUNC_LOOP][Xdrv_current / 32], Xdrv_current % 32);
+  }
+}
+
+void XdrvUnsubscribeAll(void) {
+  for (uint32_t function = FUNC_LOOP; function <= FUNC_EVERY_SECOND; function++) {
+    XdrvUnsubscribe(function);
+  }
+}
+
+void XdrvSubscribe(uint32_t function) {
+  if ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND)) {
+    bitClear(Xdrv_unsubscribed[function - FUNC_LOOP][Xdrv_current / 32], Xdrv_current % 32);
+  }
+}
+
+void XdrvSubscribeAll(void) {
+  for (uint32_t function = FUNC_LOOP; function <= FUNC_EVERY_SECOND; function++) {
+    XdrvSubscribe(function);
+  }
+}
+
+bool XdrvCallIndex(uint32_t x, uint32_t function) {
+  // Restore caller index on return as a driver may call other drivers before unsubscribing
+  uint32_t caller = Xdrv_current;
+  Xdrv_current = x;
+  bool result = xdrv_func_ptr[x](function);
+  Xdrv_current = caller;
+  return result;
+}
+
+bool XdrvCallSubscribed(uint32_t function) {
+  // Only call drivers subscribed to high frequency function
+  bool result = false;
+
+#ifdef USE_PROFILE_DISPATCH
+  uint32_t profile_dispatch_start = micros();
+  uint32_t calls = 0;
+#endif  // USE_PROFILE_DISPATCH
+
+  uint32_t* unsubscribed = Xdrv_unsubscribed[function - FUNC_LOOP];
+  for (uint32_t base = 0; base < xdrv_present; base += 32) {
+    uint32_t subscribed = ~unsubscribed[base / 32];
+    if (xdrv_present - base < 32) {
+      subscribed &= (1u << (xdrv_present - base)) -1;
+    }
+    while (subscribed) {
+      uint32_t x = base + __builtin_ctz(subscribed);
+      subscribed &= subscribed -1;         // Clear lowest set bit
+
+#ifdef USE_PROFILE_FUNCTION
+      uint32_t profile_function_start = millis();
+#endif  // USE_PROFILE_FUNCTION
+
+      result = XdrvCallIndex(x, function);
+
+#ifdef USE_PROFILE_FUNCTION
+#ifdef XFUNC_PTR_IN_ROM
+      uint32_t index = pgm_read_byte(kXdrvList + x);
+#else
+      uint32_t index = kXdrvList[x];
+#endif
+      PROFILE_FUNCTION("drv", index, function, profile_function_start);
+#endif  // USE_PROFILE_FUNCTION
+
+#ifdef USE_PROFILE_DISPATCH
+      calls++;
+#endif  // USE_PROFILE_DISPATCH
+    }
+  }
+
+  PROFILE_DISPATCH("drv", function, calls, xdrv_present - calls, profile_dispatch_start);
+
+  return result;
+}
+
 /*********************************************************************************************\
  * Function call to single xdrv
 \*********************************************************************************************/
@@ -1120,7 +1211,7 @@ bool XdrvCallDriver(uint32_t driver, uint32_t function) {
     uint32_t listed = kXdrvList[x];
 #endif
     if (driver == listed) {
-      return xdrv_func_ptr[x](function);
+      return XdrvCallIndex(x, function);
     }
   }
   return false;
@@ -1139,13 +1230,19 @@ bool XdrvCall(uint32_t function) {
   uint32_t profile_driver_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
+  if ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND)) {
+    result = XdrvCallSubscribed(function);
+    PROFILE_DRIVER("drv", function, profile_driver_start);
+    return result;
+  }
+
   for (uint32_t x = 0; x < xdrv_present; x++) {
 
 #ifdef USE_PROFILE_FUNCTION
     uint32_t profile_function_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
-    result = xdrv_func_ptr[x](function);
+    result = XdrvCallIndex(x, function);
 
 #ifdef USE_WEBSERVER
     if (FUNC_WEB_SENSOR == function) { 
@@ -533,6 +533,7 @@ bool (* const xsns_func_ptr[])(uint32_t) = {  // Sensor Function Pointers for si
 };
 
 const uint8_t xsns_present = sizeof(xsns_func_ptr) / sizeof(xsns_func_ptr[0]);  // Number of External Sensors found
+static_assert(sizeof(xsns_func_ptr) / sizeof(xsns_func_ptr[0]) <= 128, "Xsns_unsubscribed bitmaps hold up to 128 sensors");
 
 /*********************************************************************************************\
  * Xsns available list
@@ -1090,6 +1091,97 @@ void XsnsSensorState(uint32_t sensor_list) {
   ResponseAppend_P(PSTR("\""));
 }
 
+/*********************************************************************************************\
+ * Function subscription
+ *
+ * High frequency functions FUNC_LOOP up to FUNC_EVERY_SECOND are only called for subscribed
+ * sensors. All sensors are subscribed by default. A sensor not needing these functions, like
+ * one without detected hardware, can unsubscribe while handling any function and subscribe
+ * again when it is needed, like hardware found on a later FUNC_INIT pass.
+\*********************************************************************************************/
+
+uint32_t Xsns_unsubscribed[FUNC_SUBSCRIPTIONS][4] = { 0 };
+uint32_t Xsns_current = 0;                  // Index of sensor being called
+
+void XsnsUnsubscribe(uint32_t function) {
+  if ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND)) {
+    bitSet(Xsns_unsubscribed[function - FUNC_LOOP][Xsns_current / 32], Xsns_current % 32);
+  }
+}
+
+void XsnsUnsubscribeAll(void) {
+  for (uint32_t function = FUNC_LOOP; function <= FUNC_EVERY_SECOND; function++) {
+    XsnsUnsubscribe(function);
+  }
+}
+
+void XsnsSubscribe(uint32_t function) {
+  if ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND)) {
+    bitClear(Xsns_unsubscribed[function - FUNC_LOOP][Xsns_current / 32], Xsns_current % 32);
+  }
+}
+
+void XsnsSubscribeAll(void) {
+  for (uint32_t function = FUNC_LOOP; function <= FUNC_EVERY_SECOND; function++) {
+    XsnsSubscribe(function);
+  }
+}
+
+bool XsnsCallIndex(uint32_t x, uint32_t function) {
+  // Restore caller index on return as a sensor may call other sensors before unsubscribing
+  uint32_t caller = Xsns_current;
+  Xsns_current = x;
+  bool result = xsns_func_ptr[x](function);
+  Xsns_current = caller;
+  return result;
+}
+
+bool XsnsCallSubscribed(uint32_t function) {
+  // Only call enabled sensors subscribed to high frequency function
+  bool result = false;
+
+#ifdef USE_PROFILE_DISPATCH
+  uint32_t profile_dispatch_start = micros();
+  uint32_t calls = 0;
+#endif  // USE_PROFILE_DISPATCH
+
+  uint32_t* unsubscribed = Xsns_unsubscribed[function - FUNC_LOOP];
+  for (uint32_t base = 0; base < xsns_present; base += 32) {
+    uint32_t subscribed = ~unsubscribed[base / 32];
+    if (xsns_present - base < 32) {
+      subscribed &= (1u << (xsns_present - base)) -1;
+    }
+    while (subscribed) {
+      uint32_t x = base + __builtin_ctz(subscribed);
+      subscribed &= subscribed -1;         // Clear lowest set bit
+      if (!XsnsEnabled(0, x)) { continue; }  // Skip disabled sensor
+
+#ifdef USE_PROFILE_FUNCTION
+      uint32_t profile_function_start = millis();
+#endif  // USE_PROFILE_FUNCTION
+
+      result = XsnsCallIndex(x, function);
+
+#ifdef USE_PROFILE_FUNCTION
+#ifdef XFUNC_PTR_IN_ROM
+      uint32_t index = pgm_read_byte(kXsnsList + x);
+#else
+      uint32_t index = kXsnsList[x];
+#endif
+      PROFILE_FUNCTION("sns", index, function, profile_function_start);
+#endif  // USE_PROFILE_FUNCTION
+
+#ifdef USE_PROFILE_DISPATCH
+      calls++;
+#endif  // USE_PROFILE_DISPATCH
+    }
+  }
+
+  PROFILE_DISPATCH("sns", function, calls, xsns_present - calls, profile_dispatch_start);
+
+  return result;
+}
+
 /*********************************************************************************************\
  * Function call to all xsns
 \*********************************************************************************************/
@@ -1108,7 +1200,7 @@ bool XsnsNextCall(uint32_t function, uint8_t &xsns_index) {
     if (xsns_index == xsns_present) { xsns_index = 0; }
   }
 
-  return xsns_func_ptr[xsns_index](function);
+  return XsnsCallIndex(xsns_index, function);
 }
 
 bool XsnsCall(uint32_t function) {
@@ -1120,6 +1212,12 @@ bool XsnsCall(uint32_t function) {
   uint32_t profile_driver_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
+  if ((function >= FUNC_LOOP) && (function <= FUNC_EVERY_SECOND)) {
+    result = XsnsCallSubscribed(function);
+    PROFILE_DRIVER("sns", function, profile_driver_start);
+    return result;
+  }
+
   for (uint32_t x = 0; x < xsns_present; x++) {
     if (XsnsEnabled(0, x)) {  // Skip disabled sensor
       if ((FUNC_WEB_SENSOR == function) && !XsnsEnabled(1, x)) { continue; }  // Skip web info for disabled sensors
@@ -1128,7 +1226,7 @@ bool XsnsCall(uint32_t function) {
       uint32_t profile_function_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
-      result = xsns_func_ptr[x](function);
+      result = XsnsCallIndex(x, function);
 
 #ifdef USE_WEBSERVER
       if (FUNC_WEB_SENSOR == function) { WSContentSeparator(1); }  // Show separator if needed